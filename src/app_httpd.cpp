@@ -1,13 +1,34 @@
 // Copied from original project to src/ for PlatformIO
+#include <limits.h>
 #include "esp_http_server.h"
 #include "esp_timer.h"
+#include "esp_heap_caps.h"
 #include "esp_camera.h"
 #include "img_converters.h"
 #include "fb_gfx.h"
 #include "esp32-hal-ledc.h"
 #include "sdkconfig.h"
+#ifndef ASSETS_NO_BUILTIN_UI
 #include "camera_index.h"
+#endif
 #include "board_config.h"
+#include "asset_bundle.h"
+#include "frame_pipe.h"
+#include "ws_stream.h"
+#include "ws_control.h"
+#include "mcast_sender.h"
+#include "rtsp_server.h"
+#include "prerecord.h"
+#include "avi_writer.h"
+#include "timelapse.h"
+#include "overlay.h"
+#include "privacy_mask.h"
+#include "wifi_link.h"
+#include "camera_settings.h"
+#include "cmd_registry.h"
+#include "heap_mon.h"
+#include "cam_watchdog.h"
+#include "url_form.h"
 #include <Preferences.h>
 #include "portal.h"
 #include <WiFi.h>
@@ -25,19 +46,53 @@ bool isStreaming = false;
 
 #endif
 
-typedef struct {
-  httpd_req_t *req;
-  size_t len;
-} jpg_chunking_t;
-
 #define PART_BOUNDARY "123456789000000000000987654321"
 static const char *_STREAM_CONTENT_TYPE = "multipart/x-mixed-replace;boundary=" PART_BOUNDARY;
 static const char *_STREAM_BOUNDARY = "\r\n--" PART_BOUNDARY "\r\n";
-static const char *_STREAM_PART = "Content-Type: image/jpeg\r\nContent-Length: %u\r\nX-Timestamp: %d.%06d\r\n\r\n";
+static const char *_STREAM_PART = "Content-Type: image/jpeg\r\nContent-Length: %u\r\nX-Timestamp: %lld.%06ld\r\nX-Seq: %lu\r\nX-Latency-us: %lu\r\n\r\n";
+static const char *_BURST_CONTENT_TYPE = "multipart/mixed;boundary=" PART_BOUNDARY;
+static const char *_BURST_PART = "Content-Type: image/jpeg\r\nContent-Length: %u\r\nX-Timestamp: %lld.%06ld\r\nX-Seq: %lu\r\n\r\n";
+static const char *_BURST_END = "\r\n--" PART_BOUNDARY "--\r\n";
 
 httpd_handle_t stream_httpd = NULL;
 httpd_handle_t camera_httpd = NULL;
 
+// HTTP server tuning. The control server (UI, /control, /status, /capture...)
+// gets the higher priority so slider moves stay responsive while the stream
+// server pushes frames. Both run on the Wi-Fi core by default. Any of these can
+// be overridden from build_flags.
+#ifndef HTTPD_CTRL_MAX_SOCKETS
+#define HTTPD_CTRL_MAX_SOCKETS 4
+#endif
+#ifndef HTTPD_CTRL_PRIORITY
+#define HTTPD_CTRL_PRIORITY (tskIDLE_PRIORITY + 6)
+#endif
+#ifndef HTTPD_CTRL_CORE
+#define HTTPD_CTRL_CORE 0
+#endif
+#ifndef HTTPD_CTRL_SEND_TIMEOUT_S
+#define HTTPD_CTRL_SEND_TIMEOUT_S 5
+#endif
+
+#ifndef HTTPD_STREAM_MAX_SOCKETS
+#define HTTPD_STREAM_MAX_SOCKETS 2
+#endif
+#ifndef HTTPD_STREAM_PRIORITY
+#define HTTPD_STREAM_PRIORITY (tskIDLE_PRIORITY + 5)
+#endif
+#ifndef HTTPD_STREAM_CORE
+#define HTTPD_STREAM_CORE 0
+#endif
+// Short send timeout so a stalled viewer is dropped quickly instead of
+// blocking the stream task; LRU purge then reclaims its socket.
+#ifndef HTTPD_STREAM_SEND_TIMEOUT_S
+#define HTTPD_STREAM_SEND_TIMEOUT_S 3
+#endif
+
+// httpd_start() reserves three more per server: the listener, its control
+// socket and one to accept (and LRU purge) while full
+#define HTTPD_INTERNAL_SOCKETS 3
+
 typedef struct {
   size_t size;   //number of values used for filtering
   size_t index;  //current value index
@@ -51,7 +106,7 @@ static ra_filter_t ra_filter;
 static ra_filter_t *ra_filter_init(ra_filter_t *filter, size_t sample_size) {
   memset(filter, 0, sizeof(ra_filter_t));
 
-  filter->values = (int *)malloc(sample_size * sizeof(int));
+  filter->values = (int *)heap_mon_malloc(HEAP_TAG_HTTP, sample_size * sizeof(int), 0);
   if (!filter->values) {
     return NULL;
   }
@@ -92,13 +147,12 @@ void enable_led(bool en) {  // Turn LED On or Off
 #endif
 
 static esp_err_t bmp_handler(httpd_req_t *req) {
-  camera_fb_t *fb = NULL;
   esp_err_t res = ESP_OK;
 #if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_INFO
   uint64_t fr_start = esp_timer_get_time();
 #endif
-  fb = esp_camera_fb_get();
-  if (!fb) {
+  frame_t *f = frame_pipe_acquire(0, 1000);
+  if (!f) {
     log_e("Camera capture failed");
     httpd_resp_send_500(req);
     return ESP_FAIL;
@@ -109,20 +163,31 @@ static esp_err_t bmp_handler(httpd_req_t *req) {
   httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
 
   char ts[32];
-  snprintf(ts, 32, "%lld.%06ld", fb->timestamp.tv_sec, fb->timestamp.tv_usec);
+  snprintf(ts, 32, "%lld.%06ld", f->timestamp.tv_sec, f->timestamp.tv_usec);
   httpd_resp_set_hdr(req, "X-Timestamp", (const char *)ts);
 
+  // frames in the pipe are always JPEG; frame2bmp decodes them
+  camera_fb_t jpg_fb = {};
+  jpg_fb.buf = f->buf;
+  jpg_fb.len = f->len;
+  jpg_fb.width = f->width;
+  jpg_fb.height = f->height;
+  jpg_fb.format = PIXFORMAT_JPEG;
+  jpg_fb.timestamp = f->timestamp;
+
   uint8_t *buf = NULL;
   size_t buf_len = 0;
-  bool converted = frame2bmp(fb, &buf, &buf_len);
-  esp_camera_fb_return(fb);
+  bool converted = frame2bmp(&jpg_fb, &buf, &buf_len);
+  frame_pipe_release(f);
+  // a failed UXGA conversion is the first sign of a fragmented heap
+  heap_mon_adopt(HEAP_TAG_BMP, converted ? buf : NULL, (size_t)jpg_fb.width * jpg_fb.height * 3 + 54);
   if (!converted) {
     log_e("BMP Conversion failed");
     httpd_resp_send_500(req);
     return ESP_FAIL;
   }
   res = httpd_resp_send(req, (const char *)buf, buf_len);
-  free(buf);
+  heap_mon_free(HEAP_TAG_BMP, buf);
 #if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_INFO
   uint64_t fr_end = esp_timer_get_time();
 #endif
@@ -132,20 +197,8 @@ static esp_err_t bmp_handler(httpd_req_t *req) {
 
 // Portal endpoints moved to src/portal.cpp (portal_register)
 
-static size_t jpg_encode_stream(void *arg, size_t index, const void *data, size_t len) {
-  jpg_chunking_t *j = (jpg_chunking_t *)arg;
-  if (!index) {
-    j->len = 0;
-  }
-  if (httpd_resp_send_chunk(j->req, (const char *)data, len) != ESP_OK) {
-    return 0;
-  }
-  j->len += len;
-  return len;
-}
-
 static esp_err_t capture_handler(httpd_req_t *req) {
-  camera_fb_t *fb = NULL;
+  frame_t *f = NULL;
   esp_err_t res = ESP_OK;
 #if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_INFO
   int64_t fr_start = esp_timer_get_time();
@@ -153,14 +206,14 @@ static esp_err_t capture_handler(httpd_req_t *req) {
 
 #if defined(LED_GPIO_NUM)
   enable_led(true);
-  vTaskDelay(150 / portTICK_PERIOD_MS);  // The LED needs to be turned on ~150ms before the call to esp_camera_fb_get()
-  fb = esp_camera_fb_get();              // or it won't be visible in the frame. A better way to do this is needed.
+  vTaskDelay(150 / portTICK_PERIOD_MS);                // The LED needs to be turned on ~150ms before the frame is captured
+  f = frame_pipe_acquire(frame_pipe_seq(), 1000);  // or it won't be visible in the frame. A better way to do this is needed.
   enable_led(false);
 #else
-  fb = esp_camera_fb_get();
+  f = frame_pipe_acquire(0, 1000);
 #endif
 
-  if (!fb) {
+  if (!f) {
     log_e("Camera capture failed");
     httpd_resp_send_500(req);
     return ESP_FAIL;
@@ -171,26 +224,20 @@ static esp_err_t capture_handler(httpd_req_t *req) {
   httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
 
   char ts[32];
-  snprintf(ts, 32, "%lld.%06ld", fb->timestamp.tv_sec, fb->timestamp.tv_usec);
+  snprintf(ts, 32, "%lld.%06ld", f->timestamp.tv_sec, f->timestamp.tv_usec);
   httpd_resp_set_hdr(req, "X-Timestamp", (const char *)ts);
+  char seq[16];
+  snprintf(seq, sizeof(seq), "%lu", (unsigned long)f->seq);
+  httpd_resp_set_hdr(req, "X-Seq", (const char *)seq);
+  char latency[16];
+  snprintf(latency, sizeof(latency), "%lu", (unsigned long)frame_pipe_trace(f, esp_timer_get_time(), 0));
+  httpd_resp_set_hdr(req, "X-Latency-us", (const char *)latency);
 
 #if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_INFO
-  size_t fb_len = 0;
+  size_t fb_len = f->len;
 #endif
-  if (fb->format == PIXFORMAT_JPEG) {
-#if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_INFO
-    fb_len = fb->len;
-#endif
-    res = httpd_resp_send(req, (const char *)fb->buf, fb->len);
-  } else {
-    jpg_chunking_t jchunk = {req, 0};
-    res = frame2jpg_cb(fb, 80, jpg_encode_stream, &jchunk) ? ESP_OK : ESP_FAIL;
-    httpd_resp_send_chunk(req, NULL, 0);
-#if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_INFO
-    fb_len = jchunk.len;
-#endif
-  }
-  esp_camera_fb_return(fb);
+  res = httpd_resp_send(req, (const char *)f->buf, f->len);
+  frame_pipe_release(f);
 #if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_INFO
   int64_t fr_end = esp_timer_get_time();
 #endif
@@ -198,13 +245,134 @@ static esp_err_t capture_handler(httpd_req_t *req) {
   return res;
 }
 
+#ifndef BURST_ARENA_SIZE
+#define BURST_ARENA_SIZE (2 * 1024 * 1024)
+#endif
+#define BURST_MAX_FRAMES  32
+#define BURST_MAX_SPAN_MS 10000
+
+typedef struct {
+  uint32_t offset;
+  uint32_t len;
+  uint32_t seq;
+  struct timeval timestamp;
+} burst_frame_t;
+
+// PSRAM arena for /burst, reserved at startup so a burst never waits on malloc
+static uint8_t *burst_arena = NULL;
+
+// GET /burst?n=10&interval_ms=50 grabs N consecutive frames at least interval_ms
+// apart (by sensor timestamp) into the arena, then sends them as
+// multipart/mixed. Spacing is set by the sensor; the network only starts
+// after the last frame. Served on the stream port: the capture and the send
+// hold the server's task for seconds.
+static esp_err_t burst_handler(httpd_req_t *req) {
+  static burst_frame_t frames[BURST_MAX_FRAMES];
+  char query[48] = "";
+  char value[8];
+  int n = 10;
+  int interval_ms = 0;
+  if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK) {
+    if (httpd_query_key_value(query, "n", value, sizeof(value)) == ESP_OK) {
+      n = atoi(value);
+    }
+    if (httpd_query_key_value(query, "interval_ms", value, sizeof(value)) == ESP_OK) {
+      interval_ms = atoi(value);
+    }
+  }
+  if (n < 1 || n > BURST_MAX_FRAMES || interval_ms < 0 || interval_ms * (n - 1) > BURST_MAX_SPAN_MS) {
+    httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "n or interval_ms out of range");
+    return ESP_FAIL;
+  }
+  if (!burst_arena) {
+    httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "no burst arena (PSRAM)");
+    return ESP_FAIL;
+  }
+
+  int count = 0;
+  size_t used = 0;
+  bool truncated = false;
+  int64_t first_us = 0;
+  uint32_t last_seq = frame_pipe_seq();
+  while (count < n) {
+    frame_t *f = frame_pipe_acquire(last_seq, 1000);
+    if (!f) {
+      log_e("Camera capture failed");
+      break;
+    }
+    last_seq = f->seq;
+    int64_t ts = (int64_t)f->timestamp.tv_sec * 1000000LL + f->timestamp.tv_usec;
+    // targets are relative to the first frame so the spacing does not drift
+    if (count && ts < first_us + (int64_t)count * interval_ms * 1000) {
+      frame_pipe_release(f);
+      continue;
+    }
+    if (used + f->len > BURST_ARENA_SIZE) {
+      frame_pipe_release(f);
+      truncated = true;
+      break;
+    }
+    memcpy(burst_arena + used, f->buf, f->len);
+    frames[count].offset = used;
+    frames[count].len = f->len;
+    frames[count].seq = f->seq;
+    frames[count].timestamp = f->timestamp;
+    frame_pipe_release(f);
+    if (!count) {
+      first_us = ts;
+    }
+    used += frames[count].len;
+    count++;
+  }
+  if (!count) {
+    httpd_resp_send_500(req);
+    return ESP_FAIL;
+  }
+
+  char hdr[16];
+  httpd_resp_set_type(req, _BURST_CONTENT_TYPE);
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  snprintf(hdr, sizeof(hdr), "%d", count);
+  httpd_resp_set_hdr(req, "X-Burst-Count", hdr);
+  if (truncated) {
+    httpd_resp_set_hdr(req, "X-Burst-Truncated", "1");
+  }
+
+  esp_err_t res = ESP_OK;
+  char part_buf[160];
+  for (int i = 0; i < count && res == ESP_OK; i++) {
+    res = httpd_resp_send_chunk(req, _STREAM_BOUNDARY, strlen(_STREAM_BOUNDARY));
+    if (res == ESP_OK) {
+      size_t hlen = snprintf(
+        part_buf, sizeof(part_buf), _BURST_PART, (unsigned)frames[i].len, (long long)frames[i].timestamp.tv_sec, (long)frames[i].timestamp.tv_usec,
+        (unsigned long)frames[i].seq
+      );
+      res = httpd_resp_send_chunk(req, part_buf, hlen);
+    }
+    if (res == ESP_OK) {
+      res = httpd_resp_send_chunk(req, (const char *)burst_arena + frames[i].offset, frames[i].len);
+    }
+  }
+  if (res == ESP_OK) {
+    res = httpd_resp_send_chunk(req, _BURST_END, strlen(_BURST_END));
+  }
+  if (res == ESP_OK) {
+    res = httpd_resp_send_chunk(req, NULL, 0);
+  }
+  int64_t last_us = (int64_t)frames[count - 1].timestamp.tv_sec * 1000000LL + frames[count - 1].timestamp.tv_usec;
+  log_i("Burst: %d frames, %uB, span %ums", count, (unsigned)used, (unsigned)((last_us - first_us) / 1000));
+  return res;
+}
+
 static esp_err_t stream_handler(httpd_req_t *req) {
-  camera_fb_t *fb = NULL;
+  frame_t *f = NULL;
+  uint32_t last_seq = 0;
   struct timeval _timestamp;
   esp_err_t res = ESP_OK;
   size_t _jpg_buf_len = 0;
   uint8_t *_jpg_buf = NULL;
   char *part_buf[128];
+  uint32_t skipped = 0;
 
   static int64_t last_frame = 0;
   if (!last_frame) {
@@ -224,50 +392,47 @@ static esp_err_t stream_handler(httpd_req_t *req) {
   enable_led(true);
 #endif
 
+  int64_t last_sent_us = esp_timer_get_time();
   while (true) {
-    fb = esp_camera_fb_get();
-    if (!fb) {
+    f = frame_pipe_acquire(last_seq, 1000);
+    if (!f && esp_timer_get_time() - last_sent_us < (int64_t)CAM_WATCHDOG_HOLD_MS * 1000) {
+      // the capture watchdog may be restarting the camera; keep the client
+      continue;
+    }
+    if (!f) {
       log_e("Camera capture failed");
       res = ESP_FAIL;
     } else {
-      _timestamp.tv_sec = fb->timestamp.tv_sec;
-      _timestamp.tv_usec = fb->timestamp.tv_usec;
-      if (fb->format != PIXFORMAT_JPEG) {
-        bool jpeg_converted = frame2jpg(fb, 80, &_jpg_buf, &_jpg_buf_len);
-        esp_camera_fb_return(fb);
-        fb = NULL;
-        if (!jpeg_converted) {
-          log_e("JPEG compression failed");
-          res = ESP_FAIL;
-        }
-      } else {
-        _jpg_buf_len = fb->len;
-        _jpg_buf = fb->buf;
-      }
+      skipped = last_seq ? f->seq - last_seq - 1 : 0;
+      last_seq = f->seq;
+      _timestamp.tv_sec = f->timestamp.tv_sec;
+      _timestamp.tv_usec = f->timestamp.tv_usec;
+      _jpg_buf_len = f->len;
+      _jpg_buf = f->buf;
     }
     if (res == ESP_OK) {
       res = httpd_resp_send_chunk(req, _STREAM_BOUNDARY, strlen(_STREAM_BOUNDARY));
     }
     if (res == ESP_OK) {
-      size_t hlen = snprintf((char *)part_buf, 128, _STREAM_PART, _jpg_buf_len, _timestamp.tv_sec, _timestamp.tv_usec);
+      uint32_t latency = frame_pipe_trace(f, esp_timer_get_time(), skipped);
+      size_t hlen = snprintf(
+        (char *)part_buf, sizeof(part_buf), _STREAM_PART, (unsigned)_jpg_buf_len, (long long)_timestamp.tv_sec, (long)_timestamp.tv_usec,
+        (unsigned long)last_seq, (unsigned long)latency
+      );
       res = httpd_resp_send_chunk(req, (const char *)part_buf, hlen);
     }
     if (res == ESP_OK) {
       res = httpd_resp_send_chunk(req, (const char *)_jpg_buf, _jpg_buf_len);
     }
-    if (fb) {
-      esp_camera_fb_return(fb);
-      fb = NULL;
-      _jpg_buf = NULL;
-    } else if (_jpg_buf) {
-      free(_jpg_buf);
-      _jpg_buf = NULL;
-    }
+    frame_pipe_release(f);
+    f = NULL;
+    _jpg_buf = NULL;
     if (res != ESP_OK) {
       log_e("Send frame failed");
       break;
     }
     int64_t fr_end = esp_timer_get_time();
+    last_sent_us = fr_end;
 
     int64_t frame_time = fr_end - last_frame;
     last_frame = fr_end;
@@ -290,111 +455,151 @@ static esp_err_t stream_handler(httpd_req_t *req) {
   return res;
 }
 
-static esp_err_t parse_get(httpd_req_t *req, char **obuf) {
-  char *buf = NULL;
-  size_t buf_len = 0;
+#define RECORD_AVI_MAX_S   600
+#define RECORD_AVI_BUF     (16 * 1024)
+
+static int64_t frame_timestamp_us(const frame_t *f) {
+  return (int64_t)f->timestamp.tv_sec * 1000000LL + f->timestamp.tv_usec;
+}
+
+static size_t avi_send_chunk(void *ctx, const uint8_t *data, size_t len) {
+  return httpd_resp_send_chunk((httpd_req_t *)ctx, (const char *)data, len) == ESP_OK ? len : 0;
+}
+
+// GET /record.avi?seconds=N streams an AVI of the next N seconds as it is
+// captured, without buffering the clip.
+static esp_err_t record_avi_handler(httpd_req_t *req) {
+  char query[32] = "";
+  char value[8];
+  uint32_t seconds = 10;
+  if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK && httpd_query_key_value(query, "seconds", value, sizeof(value)) == ESP_OK) {
+    seconds = atoi(value);
+  }
+  if (seconds < 1 || seconds > RECORD_AVI_MAX_S) {
+    httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "seconds out of range");
+    return ESP_FAIL;
+  }
+
+  // The header of a stream is never patched and the pipe's fps reads 0 after
+  // it idled, so the nominal rate comes from the first two frames' timestamps
+  frame_t *f = frame_pipe_acquire(0, 1000);
+  frame_t *next = f ? frame_pipe_acquire(f->seq, 1000) : NULL;
+  uint8_t *buf = next ? (uint8_t *)heap_mon_malloc(HEAP_TAG_AVI, RECORD_AVI_BUF, 0) : NULL;
+  if (!buf) {
+    if (!next) {
+      log_e("Camera capture failed");
+    }
+    frame_pipe_release(f);
+    frame_pipe_release(next);
+    httpd_resp_send_500(req);
+    return ESP_FAIL;
+  }
+
+  httpd_resp_set_type(req, "video/x-msvideo");
+  httpd_resp_set_hdr(req, "Content-Disposition", "attachment; filename=record.avi");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
 
-  buf_len = httpd_req_get_url_query_len(req) + 1;
-  if (buf_len > 1) {
-    buf = (char *)malloc(buf_len);
-    if (!buf) {
-      httpd_resp_send_500(req);
-      return ESP_FAIL;
+  uint32_t fps_milli = avi_fps_milli(2, frame_timestamp_us(f), frame_timestamp_us(next));
+  avi_sink_t sink = {avi_send_chunk, NULL, req};
+  avi_writer_t avi;
+  bool ok = avi_writer_begin(&avi, &sink, f->width, f->height, fps_milli, buf, RECORD_AVI_BUF, 0);
+  int64_t end = esp_timer_get_time() + (int64_t)seconds * 1000000LL;
+  uint32_t frames = 0;
+  while (ok) {
+    uint32_t seq = f->seq;
+    ok = avi_writer_add_frame(&avi, f->buf, f->len, frame_timestamp_us(f));
+    frame_pipe_release(f);
+    f = NULL;
+    frames++;
+    if (!ok || esp_timer_get_time() >= end) {
+      break;
     }
-    if (httpd_req_get_url_query_str(req, buf, buf_len) == ESP_OK) {
-      *obuf = buf;
-      return ESP_OK;
+    f = next ? next : frame_pipe_acquire(seq, 1000);
+    next = NULL;
+    if (!f) {
+      log_e("Camera capture failed");
+      break;
     }
-    free(buf);
+  }
+  frame_pipe_release(f);
+  frame_pipe_release(next);
+  ok = avi_writer_end(&avi) && ok;
+  heap_mon_free(HEAP_TAG_AVI, buf);
+  log_i("AVI: %lu frames in %lus", (unsigned long)frames, (unsigned long)seconds);
+  if (!ok) {
+    return ESP_FAIL;
+  }
+  return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+// Copy the query string into buf (URL_FORM_QUERY_MAX bytes on the caller's stack)
+static esp_err_t parse_get(httpd_req_t *req, char *buf) {
+  size_t buf_len = httpd_req_get_url_query_len(req) + 1;
+  if (buf_len > 1 && buf_len <= URL_FORM_QUERY_MAX && httpd_req_get_url_query_str(req, buf, URL_FORM_QUERY_MAX) == ESP_OK) {
+    return ESP_OK;
   }
   httpd_resp_send_404(req);
   return ESP_FAIL;
 }
 
+// One pass over the query: vals[i] = integer value of keys[i], unchanged if absent
+static void parse_get_ints(char *buf, const char *const keys[], int vals[], size_t n) {
+  url_form_t form;
+  url_span_t key, val;
+  url_form_init(&form, buf);
+  while (url_form_next(&form, &key, &val)) {
+    for (size_t i = 0; i < n; i++) {
+      if (url_span_eq(&key, keys[i])) {
+        vals[i] = atoi(val.p);
+        break;
+      }
+    }
+  }
+}
+
+// The watchdog is restarting the driver, or it did not come back
+static esp_err_t send_camera_offline(httpd_req_t *req) {
+  httpd_resp_set_status(req, "503 Service Unavailable");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  httpd_resp_set_hdr(req, "Retry-After", "1");
+  return httpd_resp_sendstr(req, "Camera offline");
+}
+
 static esp_err_t cmd_handler(httpd_req_t *req) {
-  char *buf = NULL;
-  char variable[32];
-  char value[32];
+  char buf[URL_FORM_QUERY_MAX];
+  const char *variable = NULL;
+  const char *value = NULL;
 
-  if (parse_get(req, &buf) != ESP_OK) {
+  if (parse_get(req, buf) != ESP_OK) {
     return ESP_FAIL;
   }
-  if (httpd_query_key_value(buf, "var", variable, sizeof(variable)) != ESP_OK || httpd_query_key_value(buf, "val", value, sizeof(value)) != ESP_OK) {
-    free(buf);
+  url_form_t form;
+  url_span_t key, val_span;
+  url_form_init(&form, buf);
+  while (url_form_next(&form, &key, &val_span)) {
+    if (url_span_eq(&key, "var")) {
+      variable = val_span.p;
+    } else if (url_span_eq(&key, "val")) {
+      value = val_span.p;
+    }
+  }
+  if (!variable || !value) {
     httpd_resp_send_404(req);
     return ESP_FAIL;
   }
-  free(buf);
 
-  int val = atoi(value);
-  log_i("%s = %d", variable, val);
-  sensor_t *s = esp_camera_sensor_get();
-  int res = 0;
-
-  if (!strcmp(variable, "framesize")) {
-    if (s->pixformat == PIXFORMAT_JPEG) {
-      res = s->set_framesize(s, (framesize_t)val);
-    }
-  } else if (!strcmp(variable, "quality")) {
-    res = s->set_quality(s, val);
-  } else if (!strcmp(variable, "contrast")) {
-    res = s->set_contrast(s, val);
-  } else if (!strcmp(variable, "brightness")) {
-    res = s->set_brightness(s, val);
-  } else if (!strcmp(variable, "saturation")) {
-    res = s->set_saturation(s, val);
-  } else if (!strcmp(variable, "gainceiling")) {
-    res = s->set_gainceiling(s, (gainceiling_t)val);
-  } else if (!strcmp(variable, "colorbar")) {
-    res = s->set_colorbar(s, val);
-  } else if (!strcmp(variable, "awb")) {
-    res = s->set_whitebal(s, val);
-  } else if (!strcmp(variable, "agc")) {
-    res = s->set_gain_ctrl(s, val);
-  } else if (!strcmp(variable, "aec")) {
-    res = s->set_exposure_ctrl(s, val);
-  } else if (!strcmp(variable, "hmirror")) {
-    res = s->set_hmirror(s, val);
-  } else if (!strcmp(variable, "vflip")) {
-    res = s->set_vflip(s, val);
-  } else if (!strcmp(variable, "awb_gain")) {
-    res = s->set_awb_gain(s, val);
-  } else if (!strcmp(variable, "agc_gain")) {
-    res = s->set_agc_gain(s, val);
-  } else if (!strcmp(variable, "aec_value")) {
-    res = s->set_aec_value(s, val);
-  } else if (!strcmp(variable, "aec2")) {
-    res = s->set_aec2(s, val);
-  } else if (!strcmp(variable, "dcw")) {
-    res = s->set_dcw(s, val);
-  } else if (!strcmp(variable, "bpc")) {
-    res = s->set_bpc(s, val);
-  } else if (!strcmp(variable, "wpc")) {
-    res = s->set_wpc(s, val);
-  } else if (!strcmp(variable, "raw_gma")) {
-    res = s->set_raw_gma(s, val);
-  } else if (!strcmp(variable, "lenc")) {
-    res = s->set_lenc(s, val);
-  } else if (!strcmp(variable, "special_effect")) {
-    res = s->set_special_effect(s, val);
-  } else if (!strcmp(variable, "wb_mode")) {
-    res = s->set_wb_mode(s, val);
-  } else if (!strcmp(variable, "ae_level")) {
-    res = s->set_ae_level(s, val);
-  }
-#if defined(LED_GPIO_NUM)
-  else if (!strcmp(variable, "led_intensity")) {
-    led_duty = val;
-    if (isStreaming) {
-      enable_led(true);
-    }
-  }
-#endif
-  else {
-    log_i("Unknown command: %s", variable);
-    res = -1;
+  // same "set" command as the serial console; holding the sensor tells an
+  // offline camera apart from a rejected value
+  if (!cam_sensor_take()) {
+    return send_camera_offline(req);
   }
+  const char *args[] = {variable, value};
+  int res = cmd_call("set", 2, args, NULL);
+  cam_sensor_give();
 
+  if (res == CMD_ERR_USAGE) {
+    return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "val must be an integer");
+  }
   if (res < 0) {
     return httpd_resp_send_500(req);
   }
@@ -410,7 +615,10 @@ static int print_reg(char *p, sensor_t *s, uint16_t reg, uint32_t mask) {
 static esp_err_t status_handler(httpd_req_t *req) {
   static char json_response[1024];
 
-  sensor_t *s = esp_camera_sensor_get();
+  sensor_t *s = cam_sensor_take();
+  if (!s) {
+    return send_camera_offline(req);
+  }
   char *p = json_response;
   *p++ = '{';
 
@@ -470,11 +678,13 @@ static esp_err_t status_handler(httpd_req_t *req) {
   p += sprintf(p, "\"vflip\":%u,", s->status.vflip);
   p += sprintf(p, "\"dcw\":%u,", s->status.dcw);
   p += sprintf(p, "\"colorbar\":%u", s->status.colorbar);
+  cam_sensor_give();
 #if defined(LED_GPIO_NUM)
   p += sprintf(p, ",\"led_intensity\":%u", led_duty);
 #else
   p += sprintf(p, ",\"led_intensity\":%d", -1);
 #endif
+  p += sprintf(p, ",\"timestamp\":%u", overlay_timestamp());
   *p++ = '}';
   *p++ = 0;
   httpd_resp_set_type(req, "application/json");
@@ -483,24 +693,28 @@ static esp_err_t status_handler(httpd_req_t *req) {
 }
 
 static esp_err_t xclk_handler(httpd_req_t *req) {
-  char *buf = NULL;
-  char _xclk[32];
+  char buf[URL_FORM_QUERY_MAX];
+  static const char *const keys[] = {"xclk"};
+  int vals[] = {INT_MIN};
 
-  if (parse_get(req, &buf) != ESP_OK) {
+  if (parse_get(req, buf) != ESP_OK) {
     return ESP_FAIL;
   }
-  if (httpd_query_key_value(buf, "xclk", _xclk, sizeof(_xclk)) != ESP_OK) {
-    free(buf);
+  parse_get_ints(buf, keys, vals, 1);
+  if (vals[0] == INT_MIN) {
     httpd_resp_send_404(req);
     return ESP_FAIL;
   }
-  free(buf);
 
-  int xclk = atoi(_xclk);
+  int xclk = vals[0];
   log_i("Set XCLK: %d MHz", xclk);
 
-  sensor_t *s = esp_camera_sensor_get();
+  sensor_t *s = cam_sensor_take();
+  if (!s) {
+    return send_camera_offline(req);
+  }
   int res = s->set_xclk(s, LEDC_TIMER_0, xclk);
+  cam_sensor_give();
   if (res) {
     return httpd_resp_send_500(req);
   }
@@ -510,29 +724,30 @@ static esp_err_t xclk_handler(httpd_req_t *req) {
 }
 
 static esp_err_t reg_handler(httpd_req_t *req) {
-  char *buf = NULL;
-  char _reg[32];
-  char _mask[32];
-  char _val[32];
+  char buf[URL_FORM_QUERY_MAX];
+  static const char *const keys[] = {"reg", "mask", "val"};
+  int vals[] = {INT_MIN, INT_MIN, INT_MIN};
 
-  if (parse_get(req, &buf) != ESP_OK) {
+  if (parse_get(req, buf) != ESP_OK) {
     return ESP_FAIL;
   }
-  if (httpd_query_key_value(buf, "reg", _reg, sizeof(_reg)) != ESP_OK || httpd_query_key_value(buf, "mask", _mask, sizeof(_mask)) != ESP_OK
-      || httpd_query_key_value(buf, "val", _val, sizeof(_val)) != ESP_OK) {
-    free(buf);
+  parse_get_ints(buf, keys, vals, 3);
+  if (vals[0] == INT_MIN || vals[1] == INT_MIN || vals[2] == INT_MIN) {
     httpd_resp_send_404(req);
     return ESP_FAIL;
   }
-  free(buf);
 
-  int reg = atoi(_reg);
-  int mask = atoi(_mask);
-  int val = atoi(_val);
+  int reg = vals[0];
+  int mask = vals[1];
+  int val = vals[2];
   log_i("Set Register: reg: 0x%02x, mask: 0x%02x, value: 0x%02x", reg, mask, val);
 
-  sensor_t *s = esp_camera_sensor_get();
+  sensor_t *s = cam_sensor_take();
+  if (!s) {
+    return send_camera_offline(req);
+  }
   int res = s->set_reg(s, reg, mask, val);
+  cam_sensor_give();
   if (res) {
     return httpd_resp_send_500(req);
   }
@@ -542,24 +757,27 @@ static esp_err_t reg_handler(httpd_req_t *req) {
 }
 
 static esp_err_t greg_handler(httpd_req_t *req) {
-  char *buf = NULL;
-  char _reg[32];
-  char _mask[32];
+  char buf[URL_FORM_QUERY_MAX];
+  static const char *const keys[] = {"reg", "mask"};
+  int vals[] = {INT_MIN, INT_MIN};
 
-  if (parse_get(req, &buf) != ESP_OK) {
+  if (parse_get(req, buf) != ESP_OK) {
     return ESP_FAIL;
   }
-  if (httpd_query_key_value(buf, "reg", _reg, sizeof(_reg)) != ESP_OK || httpd_query_key_value(buf, "mask", _mask, sizeof(_mask)) != ESP_OK) {
-    free(buf);
+  parse_get_ints(buf, keys, vals, 2);
+  if (vals[0] == INT_MIN || vals[1] == INT_MIN) {
     httpd_resp_send_404(req);
     return ESP_FAIL;
   }
-  free(buf);
 
-  int reg = atoi(_reg);
-  int mask = atoi(_mask);
-  sensor_t *s = esp_camera_sensor_get();
+  int reg = vals[0];
+  int mask = vals[1];
+  sensor_t *s = cam_sensor_take();
+  if (!s) {
+    return send_camera_offline(req);
+  }
   int res = s->get_reg(s, reg, mask);
+  cam_sensor_give();
   if (res < 0) {
     return httpd_resp_send_500(req);
   }
@@ -571,34 +789,32 @@ static esp_err_t greg_handler(httpd_req_t *req) {
   return httpd_resp_send(req, val, strlen(val));
 }
 
-static int parse_get_var(char *buf, const char *key, int def) {
-  char _int[16];
-  if (httpd_query_key_value(buf, key, _int, sizeof(_int)) != ESP_OK) {
-    return def;
-  }
-  return atoi(_int);
-}
-
 static esp_err_t pll_handler(httpd_req_t *req) {
-  char *buf = NULL;
+  char buf[URL_FORM_QUERY_MAX];
+  static const char *const keys[] = {"bypass", "mul", "sys", "root", "pre", "seld5", "pclken", "pclk"};
+  int vals[8] = {0};
 
-  if (parse_get(req, &buf) != ESP_OK) {
+  if (parse_get(req, buf) != ESP_OK) {
     return ESP_FAIL;
   }
+  parse_get_ints(buf, keys, vals, 8);
 
-  int bypass = parse_get_var(buf, "bypass", 0);
-  int mul = parse_get_var(buf, "mul", 0);
-  int sys = parse_get_var(buf, "sys", 0);
-  int root = parse_get_var(buf, "root", 0);
-  int pre = parse_get_var(buf, "pre", 0);
-  int seld5 = parse_get_var(buf, "seld5", 0);
-  int pclken = parse_get_var(buf, "pclken", 0);
-  int pclk = parse_get_var(buf, "pclk", 0);
-  free(buf);
+  int bypass = vals[0];
+  int mul = vals[1];
+  int sys = vals[2];
+  int root = vals[3];
+  int pre = vals[4];
+  int seld5 = vals[5];
+  int pclken = vals[6];
+  int pclk = vals[7];
 
   log_i("Set Pll: bypass: %d, mul: %d, sys: %d, root: %d, pre: %d, seld5: %d, pclken: %d, pclk: %d", bypass, mul, sys, root, pre, seld5, pclken, pclk);
-  sensor_t *s = esp_camera_sensor_get();
+  sensor_t *s = cam_sensor_take();
+  if (!s) {
+    return send_camera_offline(req);
+  }
   int res = s->set_pll(s, bypass, mul, sys, root, pre, seld5, pclken, pclk);
+  cam_sensor_give();
   if (res) {
     return httpd_resp_send_500(req);
   }
@@ -608,32 +824,38 @@ static esp_err_t pll_handler(httpd_req_t *req) {
 }
 
 static esp_err_t win_handler(httpd_req_t *req) {
-  char *buf = NULL;
+  char buf[URL_FORM_QUERY_MAX];
+  static const char *const keys[] = {"sx", "sy", "ex", "ey", "offx", "offy", "tx", "ty", "ox", "oy", "scale", "binning"};
+  int vals[12] = {0};
 
-  if (parse_get(req, &buf) != ESP_OK) {
+  if (parse_get(req, buf) != ESP_OK) {
     return ESP_FAIL;
   }
-
-  int startX = parse_get_var(buf, "sx", 0);
-  int startY = parse_get_var(buf, "sy", 0);
-  int endX = parse_get_var(buf, "ex", 0);
-  int endY = parse_get_var(buf, "ey", 0);
-  int offsetX = parse_get_var(buf, "offx", 0);
-  int offsetY = parse_get_var(buf, "offy", 0);
-  int totalX = parse_get_var(buf, "tx", 0);
-  int totalY = parse_get_var(buf, "ty", 0);  // codespell:ignore totaly
-  int outputX = parse_get_var(buf, "ox", 0);
-  int outputY = parse_get_var(buf, "oy", 0);
-  bool scale = parse_get_var(buf, "scale", 0) == 1;
-  bool binning = parse_get_var(buf, "binning", 0) == 1;
-  free(buf);
+  parse_get_ints(buf, keys, vals, 12);
+
+  int startX = vals[0];
+  int startY = vals[1];
+  int endX = vals[2];
+  int endY = vals[3];
+  int offsetX = vals[4];
+  int offsetY = vals[5];
+  int totalX = vals[6];
+  int totalY = vals[7];  // codespell:ignore totaly
+  int outputX = vals[8];
+  int outputY = vals[9];
+  bool scale = vals[10] == 1;
+  bool binning = vals[11] == 1;
 
   log_i(
     "Set Window: Start: %d %d, End: %d %d, Offset: %d %d, Total: %d %d, Output: %d %d, Scale: %u, Binning: %u", startX, startY, endX, endY, offsetX, offsetY,
     totalX, totalY, outputX, outputY, scale, binning  // codespell:ignore totaly
   );
-  sensor_t *s = esp_camera_sensor_get();
+  sensor_t *s = cam_sensor_take();
+  if (!s) {
+    return send_camera_offline(req);
+  }
   int res = s->set_res_raw(s, startX, startY, endX, endY, offsetX, offsetY, totalX, totalY, outputX, outputY, scale, binning);  // codespell:ignore totaly
+  cam_sensor_give();
   if (res) {
     return httpd_resp_send_500(req);
   }
@@ -652,21 +874,41 @@ static esp_err_t index_handler(httpd_req_t *req) {
     return httpd_resp_send(req, NULL, 0);
   }
 
+  sensor_t *s = cam_sensor_take();
+  if (s == NULL) {
+    log_e("Camera sensor not found");
+    return send_camera_offline(req);
+  }
+  uint16_t pid = s->id.PID;
+  cam_sensor_give();
+
+  // Prefer the UI from the asset bundle in the `fr` partition, so it can be
+  // updated without reflashing the application.
+  const char *asset = "index_ov2640.html";
+  if (pid == OV3660_PID) {
+    asset = "index_ov3660.html";
+  } else if (pid == OV5640_PID) {
+    asset = "index_ov5640.html";
+  }
+  const asset_entry_t *e = asset_bundle_find(asset);
+  if (e) {
+    return asset_bundle_send(req, e);
+  }
+
+#ifndef ASSETS_NO_BUILTIN_UI
   httpd_resp_set_type(req, "text/html");
   httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
-  sensor_t *s = esp_camera_sensor_get();
-  if (s != NULL) {
-    if (s->id.PID == OV3660_PID) {
-      return httpd_resp_send(req, (const char *)index_ov3660_html_gz, index_ov3660_html_gz_len);
-    } else if (s->id.PID == OV5640_PID) {
-      return httpd_resp_send(req, (const char *)index_ov5640_html_gz, index_ov5640_html_gz_len);
-    } else {
-      return httpd_resp_send(req, (const char *)index_ov2640_html_gz, index_ov2640_html_gz_len);
-    }
+  if (pid == OV3660_PID) {
+    return httpd_resp_send(req, (const char *)index_ov3660_html_gz, index_ov3660_html_gz_len);
+  } else if (pid == OV5640_PID) {
+    return httpd_resp_send(req, (const char *)index_ov5640_html_gz, index_ov5640_html_gz_len);
   } else {
-    log_e("Camera sensor not found");
-    return httpd_resp_send_500(req);
+    return httpd_resp_send(req, (const char *)index_ov2640_html_gz, index_ov2640_html_gz_len);
   }
+#else
+  log_e("%s not found in asset bundle", asset);
+  return httpd_resp_send_404(req);
+#endif
 }
 
 // Simple captive-portal handler: redirect to /portal (useful for Android/iOS detection)
@@ -676,9 +918,46 @@ static esp_err_t captive_redirect_handler(httpd_req_t *req) {
   return httpd_resp_send(req, NULL, 0);
 }
 
+// Log the limits a server actually started with, and warn when the socket
+// budget of both servers exceeds what lwIP was built for.
+static void httpd_self_check(const char *name, const httpd_config_t *config, esp_err_t err) {
+  if (err != ESP_OK) {
+    log_e("%s server failed to start on port %u: %s", name, config->server_port, esp_err_to_name(err));
+    return;
+  }
+  log_i(
+    "%s server: port %u, sockets %u (LRU purge %s), handlers %u, prio %u, core %d, send/recv timeout %u/%us, stack %u", name, config->server_port,
+    config->max_open_sockets, config->lru_purge_enable ? "on" : "off", config->max_uri_handlers, config->task_priority, (int)config->core_id,
+    config->send_wait_timeout, config->recv_wait_timeout, (unsigned)config->stack_size
+  );
+}
+
+// Everything that holds lwIP sockets: both HTTP servers, RTSP and multicast.
+// The defaults add up to 4 + 2 + 2 * 3 + 3 + 1 = 16, the stock Arduino limit;
+// raise the per-server limits only with a larger CONFIG_LWIP_MAX_SOCKETS.
+static void httpd_check_socket_budget() {
+#ifdef CONFIG_LWIP_MAX_SOCKETS
+  int http = HTTPD_CTRL_MAX_SOCKETS + HTTPD_STREAM_MAX_SOCKETS + 2 * HTTPD_INTERNAL_SOCKETS;
+  int needed = http + RTSP_MAX_SOCKETS + MCAST_SOCKETS;
+  if (needed > CONFIG_LWIP_MAX_SOCKETS) {
+    log_w("Servers may need %d sockets (HTTP %d, RTSP %d, multicast %d), lwIP allows %d", needed, http, RTSP_MAX_SOCKETS, MCAST_SOCKETS,
+          CONFIG_LWIP_MAX_SOCKETS);
+  } else {
+    log_i("Servers use up to %d of %d lwIP sockets (HTTP %d, RTSP %d, multicast %d)", needed, CONFIG_LWIP_MAX_SOCKETS, http, RTSP_MAX_SOCKETS,
+          MCAST_SOCKETS);
+  }
+#endif
+}
+
 void startCameraServer() {
   httpd_config_t config = HTTPD_DEFAULT_CONFIG();
-  config.max_uri_handlers = 16;
+  config.max_uri_handlers = 32;
+  config.uri_match_fn = httpd_uri_match_wildcard;
+  config.max_open_sockets = HTTPD_CTRL_MAX_SOCKETS;
+  config.lru_purge_enable = true;
+  config.task_priority = HTTPD_CTRL_PRIORITY;
+  config.core_id = HTTPD_CTRL_CORE;
+  config.send_wait_timeout = HTTPD_CTRL_SEND_TIMEOUT_S;
 
   httpd_uri_t index_uri = {
     .uri = "/",
@@ -745,6 +1024,32 @@ void startCameraServer() {
 #endif
   };
 
+  httpd_uri_t burst_uri = {
+    .uri = "/burst",
+    .method = HTTP_GET,
+    .handler = burst_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    ,
+    .is_websocket = true,
+    .handle_ws_control_frames = false,
+    .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t record_avi_uri = {
+    .uri = "/record.avi",
+    .method = HTTP_GET,
+    .handler = record_avi_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    ,
+    .is_websocket = true,
+    .handle_ws_control_frames = false,
+    .supported_subprotocol = NULL
+#endif
+  };
+
   httpd_uri_t bmp_uri = {
     .uri = "/bmp",
     .method = HTTP_GET,
@@ -823,10 +1128,22 @@ void startCameraServer() {
 #endif
   };
 
+  heap_mon_begin();
   ra_filter_init(&ra_filter, 20);
+  asset_bundle_begin();
+  if (psramFound() && BURST_ARENA_SIZE > 0) {
+    burst_arena = (uint8_t *)heap_mon_malloc(HEAP_TAG_BURST, BURST_ARENA_SIZE, MALLOC_CAP_SPIRAM);
+    if (!burst_arena) {
+      log_e("Failed to reserve %u byte burst arena", (unsigned)BURST_ARENA_SIZE);
+    }
+  }
+
+  httpd_check_socket_budget();
 
   log_i("Starting web server on port: '%d'", config.server_port);
-  if (httpd_start(&camera_httpd, &config) == ESP_OK) {
+  esp_err_t err = httpd_start(&camera_httpd, &config);
+  httpd_self_check("Control", &config, err);
+  if (err == ESP_OK) {
     httpd_register_uri_handler(camera_httpd, &index_uri);
     httpd_register_uri_handler(camera_httpd, &cmd_uri);
     httpd_register_uri_handler(camera_httpd, &status_uri);
@@ -838,6 +1155,17 @@ void startCameraServer() {
     httpd_register_uri_handler(camera_httpd, &greg_uri);
     httpd_register_uri_handler(camera_httpd, &pll_uri);
     httpd_register_uri_handler(camera_httpd, &win_uri);
+    asset_bundle_register(camera_httpd);
+    frame_pipe_register(camera_httpd);
+    ws_stream_register(camera_httpd);
+    ws_control_register(camera_httpd);
+    mcast_sender_register(camera_httpd);
+    prerecord_register(camera_httpd);
+    timelapse_register(camera_httpd);
+    privacy_mask_register(camera_httpd);
+    wifi_link_register(camera_httpd);
+    heap_mon_register(camera_httpd);
+    cam_watchdog_register(camera_httpd);
     // register portal endpoints (in portal.cpp)
     portal_register(camera_httpd);
 
@@ -869,9 +1197,17 @@ void startCameraServer() {
 
   config.server_port += 1;
   config.ctrl_port += 1;
+  config.max_open_sockets = HTTPD_STREAM_MAX_SOCKETS;
+  config.task_priority = HTTPD_STREAM_PRIORITY;
+  config.core_id = HTTPD_STREAM_CORE;
+  config.send_wait_timeout = HTTPD_STREAM_SEND_TIMEOUT_S;
   log_i("Starting stream server on port: '%d'", config.server_port);
-  if (httpd_start(&stream_httpd, &config) == ESP_OK) {
+  err = httpd_start(&stream_httpd, &config);
+  httpd_self_check("Stream", &config, err);
+  if (err == ESP_OK) {
     httpd_register_uri_handler(stream_httpd, &stream_uri);
+    httpd_register_uri_handler(stream_httpd, &record_avi_uri);
+    httpd_register_uri_handler(stream_httpd, &burst_uri);
   }
 }
 
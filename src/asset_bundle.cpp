@@ -0,0 +1,147 @@
+#include "asset_bundle.h"
+#include <Arduino.h>
+#include "esp_partition.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+#define ASSET_PARTITION_LABEL "fr"
+
+static const uint8_t *_bundle = NULL;
+static const asset_bundle_hdr_t *_hdr = NULL;
+static const asset_entry_t *_entries = NULL;
+static esp_partition_mmap_handle_t _mmap_handle;
+
+bool asset_bundle_begin() {
+  if (_hdr) {
+    return true;
+  }
+  const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, ASSET_PARTITION_LABEL);
+  if (!part) {
+    log_w("No '%s' partition, using built-in UI", ASSET_PARTITION_LABEL);
+    return false;
+  }
+  const void *ptr = NULL;
+  if (esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA, &ptr, &_mmap_handle) != ESP_OK) {
+    log_e("Failed to mmap '%s' partition", ASSET_PARTITION_LABEL);
+    return false;
+  }
+  const asset_bundle_hdr_t *hdr = (const asset_bundle_hdr_t *)ptr;
+  size_t index_end = sizeof(asset_bundle_hdr_t) + (size_t)hdr->count * sizeof(asset_entry_t);
+  if (hdr->magic != ASSET_BUNDLE_MAGIC || hdr->version != ASSET_BUNDLE_VERSION || hdr->total_len > part->size || index_end > hdr->total_len) {
+    log_w("No valid asset bundle in '%s', using built-in UI", ASSET_PARTITION_LABEL);
+    esp_partition_munmap(_mmap_handle);
+    return false;
+  }
+  const asset_entry_t *entries = (const asset_entry_t *)((const uint8_t *)ptr + sizeof(asset_bundle_hdr_t));
+  for (int i = 0; i < hdr->count; i++) {
+    // offset + length could wrap in 32 bits, so compare against the space left
+    if (entries[i].offset < index_end || entries[i].offset > hdr->total_len || entries[i].length > hdr->total_len - entries[i].offset
+        || entries[i].name[ASSET_NAME_MAX - 1] != 0) {
+      log_e("Asset bundle entry %d is corrupt", i);
+      esp_partition_munmap(_mmap_handle);
+      return false;
+    }
+  }
+
+  _bundle = (const uint8_t *)ptr;
+  _entries = entries;
+  _hdr = hdr;
+  log_i("Asset bundle: %u files, %u bytes", hdr->count, hdr->total_len);
+  return true;
+}
+
+const asset_entry_t *asset_bundle_find(const char *name) {
+  if (!_hdr || !name) {
+    return NULL;
+  }
+  if (*name == '/') {
+    name++;
+  }
+  for (int i = 0; i < _hdr->count; i++) {
+    if (!strcmp(_entries[i].name, name)) {
+      return &_entries[i];
+    }
+  }
+  return NULL;
+}
+
+const uint8_t *asset_bundle_data(const asset_entry_t *e) {
+  return _bundle + e->offset;
+}
+
+static const char *content_type(const char *name) {
+  const char *ext = strrchr(name, '.');
+  if (!ext) {
+    return "application/octet-stream";
+  }
+  if (!strcmp(ext, ".html") || !strcmp(ext, ".htm")) {
+    return "text/html";
+  } else if (!strcmp(ext, ".js")) {
+    return "application/javascript";
+  } else if (!strcmp(ext, ".css")) {
+    return "text/css";
+  } else if (!strcmp(ext, ".json")) {
+    return "application/json";
+  } else if (!strcmp(ext, ".svg")) {
+    return "image/svg+xml";
+  } else if (!strcmp(ext, ".png")) {
+    return "image/png";
+  } else if (!strcmp(ext, ".ico")) {
+    return "image/x-icon";
+  }
+  return "application/octet-stream";
+}
+
+esp_err_t asset_bundle_send(httpd_req_t *req, const asset_entry_t *e) {
+  char etag[12];
+  snprintf(etag, sizeof(etag), "\"%08lx\"", (unsigned long)e->etag);
+
+  char inm[16];
+  if (httpd_req_get_hdr_value_str(req, "If-None-Match", inm, sizeof(inm)) == ESP_OK && !strcmp(inm, etag)) {
+    httpd_resp_set_status(req, "304 Not Modified");
+    httpd_resp_set_hdr(req, "ETag", etag);
+    return httpd_resp_send(req, NULL, 0);
+  }
+
+  httpd_resp_set_type(req, content_type(e->name));
+  if (e->flags & ASSET_FLAG_GZIP) {
+    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+  }
+  httpd_resp_set_hdr(req, "ETag", etag);
+  httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+  // Sent straight from the flash mapping, no RAM copy
+  return httpd_resp_send(req, (const char *)asset_bundle_data(e), e->length);
+}
+
+static esp_err_t asset_handler(httpd_req_t *req) {
+  // strip "/ui/" prefix and any query string
+  char name[ASSET_NAME_MAX];
+  const char *path = req->uri + 3;
+  if (*path == '/') {
+    path++;
+  }
+  size_t len = strcspn(path, "?#");
+  if (len == 0 || len >= sizeof(name)) {
+    return httpd_resp_send_404(req);
+  }
+  memcpy(name, path, len);
+  name[len] = 0;
+
+  const asset_entry_t *e = asset_bundle_find(name);
+  if (!e) {
+    return httpd_resp_send_404(req);
+  }
+  return asset_bundle_send(req, e);
+}
+
+void asset_bundle_register(httpd_handle_t server) {
+  httpd_uri_t asset_uri = {
+    .uri = "/ui/*",
+    .method = HTTP_GET,
+    .handler = asset_handler,
+    .user_ctx = NULL
+  };
+  httpd_register_uri_handler(server, &asset_uri);
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_http_server.h"
+
+// Packed web asset bundle stored in the `fr` data partition (see partitions.csv).
+// Produced on the host by tools/mkassets.py. All integers are little endian.
+//
+//   asset_bundle_hdr_t                 16 bytes
+//   asset_entry_t[count]               64 bytes each
+//   file data                          each file aligned to 4 bytes
+//
+// The partition is memory-mapped once at startup, so handlers send directly from
+// the flash cache without copying into RAM.
+
+#define ASSET_BUNDLE_MAGIC   0x42415743  // "CWAB"
+#define ASSET_BUNDLE_VERSION 1
+#define ASSET_NAME_MAX       48
+
+#define ASSET_FLAG_GZIP 0x01
+
+typedef struct __attribute__((packed)) {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t count;
+  uint32_t total_len;  // header + index + data
+  uint32_t reserved;
+} asset_bundle_hdr_t;
+
+typedef struct __attribute__((packed)) {
+  char name[ASSET_NAME_MAX];  // NUL terminated, no leading '/'
+  uint32_t offset;            // from start of bundle
+  uint32_t length;
+  uint32_t etag;  // CRC32 of the stored (possibly gzipped) content
+  uint32_t flags;
+} asset_entry_t;
+
+// Map the `fr` partition and validate the bundle. Safe to call more than once.
+// Returns false if the partition is missing or does not hold a valid bundle.
+bool asset_bundle_begin();
+
+// Look up an asset by name (e.g. "index_ov2640.html"). Returns NULL if not found.
+const asset_entry_t *asset_bundle_find(const char *name);
+
+// Pointer to the mapped content of an entry
+const uint8_t *asset_bundle_data(const asset_entry_t *e);
+
+// Send an asset with Content-Type, Content-Encoding and ETag headers, answering
+// 304 when the request's If-None-Match matches.
+esp_err_t asset_bundle_send(httpd_req_t *req, const asset_entry_t *e);
+
+// Register GET /ui/* which serves any file of the bundle
+void asset_bundle_register(httpd_handle_t server);
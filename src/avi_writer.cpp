@@ -0,0 +1,330 @@
+#include "avi_writer.h"
+#include <stdlib.h>
+#include <string.h>
+#include "heap_mon.h"
+
+#define AVIF_HASINDEX       0x00000010
+#define AVIF_TRUSTCKTYPE    0x00000800
+#define AVIIF_KEYFRAME      0x00000010
+#define AVI_INDEX_OF_INDEXES 0x00
+#define AVI_INDEX_OF_CHUNKS  0x01
+
+// Fixed header layout, see avi_write_header()
+#define AVI_HDRL_SIZE  1004
+#define AVI_STRL_SIZE  660
+#define AVI_ODML_SIZE  260
+#define AVI_DMLH_SIZE  248
+#define AVI_INDX_SIZE  (24 + 16 * AVI_SUPER_INDEX_SIZE)
+#define AVI_MOVI_POS   1032
+
+static void avi_flush(avi_writer_t *w) {
+  if (w->buf_len && !w->failed && w->sink.write(w->sink.ctx, w->buf, w->buf_len) != w->buf_len) {
+    w->failed = true;
+  }
+  w->buf_len = 0;
+}
+
+static void avi_emit(avi_writer_t *w, const void *data, size_t len) {
+  w->pos += len;
+  // large payloads (the JPEGs) bypass the buffer
+  if (len >= w->buf_size) {
+    avi_flush(w);
+    if (!w->failed && w->sink.write(w->sink.ctx, (const uint8_t *)data, len) != len) {
+      w->failed = true;
+    }
+    return;
+  }
+  if (w->buf_len + len > w->buf_size) {
+    avi_flush(w);
+  }
+  memcpy(w->buf + w->buf_len, data, len);
+  w->buf_len += len;
+}
+
+static void avi_u16(avi_writer_t *w, uint16_t v) {
+  uint8_t b[2] = {(uint8_t)v, (uint8_t)(v >> 8)};
+  avi_emit(w, b, sizeof(b));
+}
+
+static void avi_u32(avi_writer_t *w, uint32_t v) {
+  uint8_t b[4] = {(uint8_t)v, (uint8_t)(v >> 8), (uint8_t)(v >> 16), (uint8_t)(v >> 24)};
+  avi_emit(w, b, sizeof(b));
+}
+
+static void avi_u64(avi_writer_t *w, uint64_t v) {
+  avi_u32(w, (uint32_t)v);
+  avi_u32(w, (uint32_t)(v >> 32));
+}
+
+static void avi_fourcc(avi_writer_t *w, const char *cc) {
+  avi_emit(w, cc, 4);
+}
+
+static void avi_zero(avi_writer_t *w, size_t len) {
+  static const uint8_t zero[64] = {0};
+  while (len) {
+    size_t n = len > sizeof(zero) ? sizeof(zero) : len;
+    avi_emit(w, zero, n);
+    len -= n;
+  }
+}
+
+static bool avi_seekable(const avi_writer_t *w) {
+  return w->sink.seek != NULL;
+}
+
+uint32_t avi_fps_milli(uint32_t frames, int64_t first_us, int64_t last_us) {
+  if (frames < 2 || last_us <= first_us) {
+    return 0;
+  }
+  uint32_t fps_milli = (uint32_t)((uint64_t)(frames - 1) * 1000000000ULL / (uint64_t)(last_us - first_us));
+  return fps_milli ? fps_milli : 1;
+}
+
+// Everything up to and including the first 'movi' fourcc. Called with zero
+// counts at start and, for seekable sinks, again at close with the totals.
+static void avi_write_header(avi_writer_t *w, bool final) {
+  uint32_t fps_milli = w->fps_milli ? w->fps_milli : 1000;
+  uint32_t measured = avi_fps_milli(w->frames, w->first_us, w->last_us);
+  if (final && measured) {
+    fps_milli = measured;
+  }
+  const avi_riff_t *r0 = &w->riffs[0];
+  uint32_t riff_count = final ? w->riff_count : 0;
+
+  avi_fourcc(w, "RIFF");
+  avi_u32(w, final ? r0->riff_size : 0);  // 0 = open ended
+  avi_fourcc(w, "AVI ");
+  avi_fourcc(w, "LIST");
+  avi_u32(w, AVI_HDRL_SIZE);
+  avi_fourcc(w, "hdrl");
+
+  avi_fourcc(w, "avih");
+  avi_u32(w, 56);
+  avi_u32(w, (uint32_t)(1000000000ULL / fps_milli));              // dwMicroSecPerFrame
+  avi_u32(w, (uint32_t)((uint64_t)w->max_frame * fps_milli / 1000));  // dwMaxBytesPerSec
+  avi_u32(w, 0);                                                   // dwPaddingGranularity
+  avi_u32(w, avi_seekable(w) ? AVIF_HASINDEX | AVIF_TRUSTCKTYPE : 0);
+  avi_u32(w, final ? r0->frames : 0);                              // dwTotalFrames, first RIFF only
+  avi_u32(w, 0);                                                   // dwInitialFrames
+  avi_u32(w, 1);                                                   // dwStreams
+  avi_u32(w, w->max_frame);                                        // dwSuggestedBufferSize
+  avi_u32(w, w->width);
+  avi_u32(w, w->height);
+  avi_zero(w, 16);
+
+  avi_fourcc(w, "LIST");
+  avi_u32(w, AVI_STRL_SIZE);
+  avi_fourcc(w, "strl");
+
+  avi_fourcc(w, "strh");
+  avi_u32(w, 56);
+  avi_fourcc(w, "vids");
+  avi_fourcc(w, "MJPG");
+  avi_u32(w, 0);                     // dwFlags
+  avi_u16(w, 0);                     // wPriority
+  avi_u16(w, 0);                     // wLanguage
+  avi_u32(w, 0);                     // dwInitialFrames
+  avi_u32(w, 1000);                  // dwScale
+  avi_u32(w, fps_milli);             // dwRate
+  avi_u32(w, 0);                     // dwStart
+  avi_u32(w, final ? w->frames : 0); // dwLength
+  avi_u32(w, w->max_frame);          // dwSuggestedBufferSize
+  avi_u32(w, 0xFFFFFFFF);            // dwQuality
+  avi_u32(w, 0);                     // dwSampleSize
+  avi_u16(w, 0);                     // rcFrame
+  avi_u16(w, 0);
+  avi_u16(w, w->width);
+  avi_u16(w, w->height);
+
+  avi_fourcc(w, "strf");
+  avi_u32(w, 40);
+  avi_u32(w, 40);                    // biSize
+  avi_u32(w, w->width);
+  avi_u32(w, w->height);
+  avi_u16(w, 1);                     // biPlanes
+  avi_u16(w, 24);                    // biBitCount
+  avi_fourcc(w, "MJPG");
+  avi_u32(w, (uint32_t)w->width * w->height * 3);
+  avi_zero(w, 16);
+
+  // OpenDML super index, one entry per RIFF
+  avi_fourcc(w, "indx");
+  avi_u32(w, AVI_INDX_SIZE);
+  avi_u16(w, 4);                     // wLongsPerEntry
+  avi_emit(w, "\0", 1);              // bIndexSubType
+  avi_emit(w, "\0", 1);              // bIndexType = AVI_INDEX_OF_INDEXES
+  avi_u32(w, riff_count);
+  avi_fourcc(w, "00dc");
+  avi_zero(w, 12);
+  for (uint32_t i = 0; i < AVI_SUPER_INDEX_SIZE; i++) {
+    if (i < riff_count) {
+      avi_u64(w, w->riffs[i].ix_pos);
+      avi_u32(w, w->riffs[i].ix_size);
+      avi_u32(w, w->riffs[i].frames);
+    } else {
+      avi_zero(w, 16);
+    }
+  }
+
+  avi_fourcc(w, "LIST");
+  avi_u32(w, AVI_ODML_SIZE);
+  avi_fourcc(w, "odml");
+  avi_fourcc(w, "dmlh");
+  avi_u32(w, AVI_DMLH_SIZE);
+  avi_u32(w, final ? w->frames : 0);
+  avi_zero(w, AVI_DMLH_SIZE - 4);
+
+  avi_fourcc(w, "LIST");
+  avi_u32(w, final ? r0->movi_size : 0);  // 0 = read to end of file
+  avi_fourcc(w, "movi");
+}
+
+// Close the current RIFF: standard index inside movi, then idx1 for the first
+static void avi_close_riff(avi_writer_t *w) {
+  avi_riff_t *r = &w->riffs[w->riff_count - 1];
+
+  r->ix_pos = w->pos;
+  r->ix_size = 8 + 24 + 8 * r->frames;
+  avi_fourcc(w, "ix00");
+  avi_u32(w, r->ix_size - 8);
+  avi_u16(w, 2);                       // wLongsPerEntry
+  avi_emit(w, "\0", 1);                // bIndexSubType
+  avi_emit(w, "\x01", 1);              // bIndexType = AVI_INDEX_OF_CHUNKS
+  avi_u32(w, r->frames);
+  avi_fourcc(w, "00dc");
+  avi_u64(w, r->movi_pos);             // qwBaseOffset
+  avi_u32(w, 0);
+  for (uint32_t i = 0; i < r->frames; i++) {
+    avi_u32(w, w->index[i].offset + 8);  // points at the data, not the chunk header
+    avi_u32(w, w->index[i].size);
+  }
+  r->movi_size = (uint32_t)(w->pos - r->movi_pos);
+
+  if (w->riff_count == 1) {
+    avi_fourcc(w, "idx1");
+    avi_u32(w, 16 * r->frames);
+    for (uint32_t i = 0; i < r->frames; i++) {
+      avi_fourcc(w, "00dc");
+      avi_u32(w, AVIIF_KEYFRAME);
+      avi_u32(w, w->index[i].offset);
+      avi_u32(w, w->index[i].size);
+    }
+  }
+  r->riff_size = (uint32_t)(w->pos - r->riff_pos - 8);
+}
+
+static bool avi_next_riff(avi_writer_t *w) {
+  if (w->riff_count == AVI_SUPER_INDEX_SIZE) {
+    w->failed = true;
+    return false;
+  }
+  avi_close_riff(w);
+  avi_riff_t *r = &w->riffs[w->riff_count++];
+  memset(r, 0, sizeof(*r));
+  r->riff_pos = w->pos;
+  r->movi_pos = w->pos + 20;
+  avi_fourcc(w, "RIFF");
+  avi_u32(w, 0);
+  avi_fourcc(w, "AVIX");
+  avi_fourcc(w, "LIST");
+  avi_u32(w, 0);
+  avi_fourcc(w, "movi");
+  return true;
+}
+
+bool avi_writer_begin(
+  avi_writer_t *w, const avi_sink_t *sink, uint16_t width, uint16_t height, uint32_t fps_milli, uint8_t *buf, size_t buf_size,
+  uint32_t max_frames
+) {
+  memset(w, 0, sizeof(*w));
+  w->sink = *sink;
+  w->buf = buf;
+  w->buf_size = buf_size;
+  w->width = width;
+  w->height = height;
+  w->fps_milli = fps_milli;
+
+  if (avi_seekable(w)) {
+    w->index_size = max_frames ? max_frames : 1;
+    w->index = (avi_index_entry_t *)heap_mon_malloc(HEAP_TAG_AVI, w->index_size * sizeof(avi_index_entry_t), 0);
+    if (!w->index) {
+      return false;
+    }
+  }
+  w->riff_count = 1;
+  w->riffs[0].movi_pos = AVI_MOVI_POS;
+  avi_write_header(w, false);
+  return !w->failed;
+}
+
+bool avi_writer_add_frame(avi_writer_t *w, const uint8_t *jpeg, size_t len, int64_t timestamp_us) {
+  if (w->failed) {
+    return false;
+  }
+  size_t padded = len + (len & 1);
+  if (avi_seekable(w)) {
+    avi_riff_t *r = &w->riffs[w->riff_count - 1];
+    // leave room for this riff's ix00 and idx1
+    uint64_t tail = 32 + 24ULL * (r->frames + 1);
+    if (r->frames && (r->frames == w->index_size || w->pos + 8 + padded + tail - r->riff_pos > AVI_RIFF_LIMIT)) {
+      if (!avi_next_riff(w)) {
+        return false;
+      }
+      r = &w->riffs[w->riff_count - 1];
+    }
+    w->index[r->frames].offset = (uint32_t)(w->pos - r->movi_pos);
+    w->index[r->frames].size = len;
+    r->frames++;
+  }
+
+  avi_fourcc(w, "00dc");
+  avi_u32(w, len);
+  avi_emit(w, jpeg, len);
+  if (len & 1) {
+    avi_emit(w, "\0", 1);
+  }
+
+  if (!w->frames) {
+    w->first_us = timestamp_us;
+  }
+  w->last_us = timestamp_us;
+  w->frames++;
+  if (len > w->max_frame) {
+    w->max_frame = len;
+  }
+  return !w->failed;
+}
+
+bool avi_writer_end(avi_writer_t *w) {
+  if (avi_seekable(w) && !w->failed) {
+    avi_close_riff(w);
+    avi_flush(w);
+
+    // patch the sizes of every RIFF and rewrite the main header
+    for (uint32_t i = 1; i < w->riff_count && !w->failed; i++) {
+      const avi_riff_t *r = &w->riffs[i];
+      if (!w->sink.seek(w->sink.ctx, r->riff_pos + 4)) {
+        w->failed = true;
+        break;
+      }
+      avi_u32(w, r->riff_size);
+      avi_flush(w);
+      if (!w->sink.seek(w->sink.ctx, r->riff_pos + 16)) {
+        w->failed = true;
+        break;
+      }
+      avi_u32(w, r->movi_size);
+      avi_flush(w);
+    }
+    if (!w->failed && w->sink.seek(w->sink.ctx, 0)) {
+      avi_write_header(w, true);
+    } else {
+      w->failed = true;
+    }
+  }
+  avi_flush(w);
+  heap_mon_free(HEAP_TAG_AVI, w->index);
+  w->index = NULL;
+  return !w->failed;
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Streaming AVI (RIFF, MJPEG video) muxer.
+//
+// Frames are written as they arrive through a fixed-size write buffer; nothing
+// is kept in memory apart from a preallocated per-RIFF index. Two modes:
+//
+// - Seekable sinks (files): each RIFF is closed at ~1 GB with an OpenDML
+//   standard index (ix00), the first one also carries the legacy idx1, later
+//   ones are 'AVIX' extensions. At close the header is rewritten with the real
+//   frame counts, frame rate and the OpenDML super index (indx).
+// - Streams (seek == NULL, e.g. an HTTP download): the header is written once
+//   with the nominal frame rate and open-ended RIFF/movi sizes, and no index is
+//   appended. Players read such files sequentially and play them at the
+//   nominal rate, so it has to be measured before the first frame.
+
+#define AVI_RIFF_LIMIT        (1UL << 30)  // start an AVIX RIFF beyond this
+#define AVI_SUPER_INDEX_SIZE  32           // max RIFFs per file
+#define AVI_HEADER_SIZE       1036         // everything up to the first frame
+
+typedef struct {
+  size_t (*write)(void *ctx, const uint8_t *data, size_t len);
+  bool (*seek)(void *ctx, uint64_t pos);  // NULL for non-seekable sinks
+  void *ctx;
+} avi_sink_t;
+
+typedef struct {
+  uint32_t offset;  // chunk position relative to the 'movi' fourcc
+  uint32_t size;
+} avi_index_entry_t;
+
+typedef struct {
+  uint64_t riff_pos;
+  uint64_t movi_pos;   // position of the 'movi' fourcc
+  uint64_t ix_pos;
+  uint32_t ix_size;
+  uint32_t riff_size;
+  uint32_t movi_size;
+  uint32_t frames;
+} avi_riff_t;
+
+typedef struct {
+  avi_sink_t sink;
+  uint8_t *buf;
+  size_t buf_size;
+  size_t buf_len;
+  uint64_t pos;              // bytes handed to the sink or buffered
+  bool failed;
+
+  uint16_t width;
+  uint16_t height;
+  uint32_t fps_milli;        // nominal frame rate, frames per 1000 s
+  uint32_t frames;
+  uint32_t max_frame;
+  int64_t first_us;
+  int64_t last_us;
+
+  avi_index_entry_t *index;  // entries for the current RIFF
+  uint32_t index_size;
+  avi_riff_t riffs[AVI_SUPER_INDEX_SIZE];
+  uint32_t riff_count;
+} avi_writer_t;
+
+// Frame rate, frames per 1000 s, of frames timestamped from first_us to last_us;
+// 0 if it cannot be told (fewer than two frames, or no time between them)
+uint32_t avi_fps_milli(uint32_t frames, int64_t first_us, int64_t last_us);
+
+// Start a file. fps_milli is the nominal frame rate, 0 for 1 fps. buf is the
+// caller's write buffer. max_frames bounds the index of one RIFF (ignored for
+// streams); a new RIFF is started when it fills up.
+bool avi_writer_begin(
+  avi_writer_t *w, const avi_sink_t *sink, uint16_t width, uint16_t height, uint32_t fps_milli, uint8_t *buf, size_t buf_size,
+  uint32_t max_frames
+);
+
+// Append one JPEG. timestamp_us is used to derive the real frame rate at close.
+bool avi_writer_add_frame(avi_writer_t *w, const uint8_t *jpeg, size_t len, int64_t timestamp_us);
+
+// Flush, write the indexes and, for seekable sinks, patch the header. Frees the
+// index. Returns false if any write failed.
+bool avi_writer_end(avi_writer_t *w);
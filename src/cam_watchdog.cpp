@@ -0,0 +1,211 @@
+#include "cam_watchdog.h"
+#include <Arduino.h>
+#include "esp_timer.h"
+#include "freertos/semphr.h"
+#include "board_config.h"
+#include "camera_settings.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+#define MAX_SETTINGS 48
+
+static portMUX_TYPE _lock = portMUX_INITIALIZER_UNLOCKED;
+static SemaphoreHandle_t _sensor_lock = NULL;
+static camera_config_t _config;
+static bool _have_config = false;
+static cam_watchdog_stats_t _stats;
+
+// owned by the capture task
+static int64_t _outage_us = 0;       // start of the current outage, 0 while healthy
+static uint32_t _fail_run = 0;       // failures since the last restart
+static uint32_t _restarts = 0;       // restarts since the last cooldown
+static uint32_t _outage_restarts = 0;
+static int64_t _cooldown_until = 0;
+static int _saved[MAX_SETTINGS];     // sensor settings from before the outage
+static int _saved_count = 0;
+
+void cam_watchdog_begin(const camera_config_t *config) {
+  _config = *config;
+  _have_config = true;
+  if (!_sensor_lock) {
+    _sensor_lock = xSemaphoreCreateRecursiveMutex();
+  }
+}
+
+sensor_t *cam_sensor_take() {
+  if (!_sensor_lock) {
+    return NULL;
+  }
+  if (xSemaphoreTakeRecursive(_sensor_lock, pdMS_TO_TICKS(CAM_WATCHDOG_LOCK_MS)) != pdTRUE) {
+    return NULL;
+  }
+  sensor_t *s = esp_camera_sensor_get();
+  if (!s) {
+    // a failed restart left no driver
+    xSemaphoreGiveRecursive(_sensor_lock);
+  }
+  return s;
+}
+
+void cam_sensor_give() {
+  xSemaphoreGiveRecursive(_sensor_lock);
+}
+
+cam_watchdog_action_t cam_watchdog_check(bool ok, int64_t wait_us) {
+  int64_t now = esp_timer_get_time();
+  uint32_t wait_ms = (uint32_t)(wait_us / 1000);
+  bool slow = ok && wait_ms > CAM_WATCHDOG_GAP_MS;
+
+  if (ok && !slow) {
+    if (_outage_us) {
+      uint32_t ms = (uint32_t)((now - _outage_us) / 1000);
+      if (_outage_restarts) {
+        portENTER_CRITICAL(&_lock);
+        _stats.recoveries++;
+        _stats.last_recovery_ms = ms;
+        if (ms > _stats.max_recovery_ms) {
+          _stats.max_recovery_ms = ms;
+        }
+        portEXIT_CRITICAL(&_lock);
+        Serial.printf("Camera recovered after %lu ms offline (%lu restarts)\n", (unsigned long)ms, (unsigned long)_outage_restarts);
+      }
+      _outage_us = 0;
+      _outage_restarts = 0;
+      _fail_run = 0;
+      _restarts = 0;
+      _cooldown_until = 0;
+    }
+    return CAM_WATCHDOG_NONE;
+  }
+
+  portENTER_CRITICAL(&_lock);
+  if (slow) {
+    _stats.gaps++;
+    if (wait_ms > _stats.max_gap_ms) {
+      _stats.max_gap_ms = wait_ms;
+    }
+  } else {
+    _stats.failures++;
+  }
+  portEXIT_CRITICAL(&_lock);
+  if (!_outage_us) {
+    // the outage began when the failed grab started waiting
+    _outage_us = now - wait_us;
+  }
+
+  if (++_fail_run < CAM_WATCHDOG_REGRABS || !_have_config || now < _cooldown_until) {
+    return CAM_WATCHDOG_NONE;
+  }
+  // the step is taken in cam_watchdog_recover(): a restart the capture task
+  // postpones is asked for again on the next failure
+  if (_restarts < CAM_WATCHDOG_REINITS) {
+    return CAM_WATCHDOG_REINIT;
+  }
+  return PWDN_GPIO_NUM >= 0 ? CAM_WATCHDOG_POWER_CYCLE : CAM_WATCHDOG_REINIT;
+}
+
+bool cam_watchdog_recover(cam_watchdog_action_t action) {
+  int64_t t0 = esp_timer_get_time();
+  _fail_run = 0;
+  if (++_restarts > CAM_WATCHDOG_REINITS) {
+    // last resort, then leave the sensor alone for a while
+    _restarts = 0;
+    _cooldown_until = t0 + (int64_t)CAM_WATCHDOG_COOLDOWN_MS * 1000;
+  }
+
+  // nobody touches the sensor from here until its settings are back
+  xSemaphoreTakeRecursive(_sensor_lock, portMAX_DELAY);
+  // a failed restart leaves no sensor, so keep the settings from the first one
+  if (!_outage_restarts && esp_camera_sensor_get()) {
+    _saved_count = camera_setting_count() < MAX_SETTINGS ? camera_setting_count() : MAX_SETTINGS;
+    for (int i = 0; i < _saved_count; i++) {
+      _saved[i] = camera_setting_read(i);
+    }
+  }
+  _outage_restarts++;
+
+  esp_camera_deinit();
+#if PWDN_GPIO_NUM >= 0
+  if (action == CAM_WATCHDOG_POWER_CYCLE) {
+    pinMode(PWDN_GPIO_NUM, OUTPUT);
+    digitalWrite(PWDN_GPIO_NUM, HIGH);
+    delay(CAM_WATCHDOG_PWDN_MS);
+    digitalWrite(PWDN_GPIO_NUM, LOW);
+    delay(10);
+  }
+#endif
+  esp_err_t err = esp_camera_init(&_config);
+  if (err == ESP_OK) {
+    // framesize first, the other settings depend on the mode it loads
+    int fs = camera_setting_index("framesize");
+    if (fs >= 0 && fs < _saved_count) {
+      camera_setting_write(fs, _saved[fs]);
+    }
+    for (int i = 0; i < _saved_count; i++) {
+      if (i != fs) {
+        camera_setting_write(i, _saved[i]);
+      }
+    }
+  }
+  xSemaphoreGiveRecursive(_sensor_lock);
+  uint32_t ms = (uint32_t)((esp_timer_get_time() - t0) / 1000);
+
+  portENTER_CRITICAL(&_lock);
+  if (_outage_restarts == 1) {
+    _stats.stalls++;
+  }
+  if (action == CAM_WATCHDOG_POWER_CYCLE) {
+    _stats.power_cycles++;
+  } else {
+    _stats.reinits++;
+  }
+  if (err != ESP_OK) {
+    _stats.init_errors++;
+  }
+  _stats.last_restart_ms = ms;
+  portEXIT_CRITICAL(&_lock);
+
+  if (err != ESP_OK) {
+    Serial.printf("Camera stalled, %s failed with error 0x%x\n", action == CAM_WATCHDOG_POWER_CYCLE ? "power cycle" : "restart", err);
+    return false;
+  }
+  Serial.printf("Camera stalled, %s took %lu ms\n", action == CAM_WATCHDOG_POWER_CYCLE ? "power cycle" : "restart", (unsigned long)ms);
+  return true;
+}
+
+void cam_watchdog_get_stats(cam_watchdog_stats_t *out) {
+  int64_t outage = _outage_us;
+  portENTER_CRITICAL(&_lock);
+  *out = _stats;
+  portEXIT_CRITICAL(&_lock);
+  out->stalled_ms = outage ? (uint32_t)((esp_timer_get_time() - outage) / 1000) : 0;
+}
+
+static esp_err_t camera_handler(httpd_req_t *req) {
+  cam_watchdog_stats_t st;
+  cam_watchdog_get_stats(&st);
+  char json[384];
+  int n = snprintf(
+    json, sizeof(json),
+    "{\"stalled_ms\":%lu,\"failures\":%lu,\"gaps\":%lu,\"max_gap_ms\":%lu,\"stalls\":%lu,\"reinits\":%lu,\"power_cycles\":%lu,"
+    "\"init_errors\":%lu,\"recoveries\":%lu,\"last_recovery_ms\":%lu,\"max_recovery_ms\":%lu,\"last_restart_ms\":%lu}",
+    (unsigned long)st.stalled_ms, (unsigned long)st.failures, (unsigned long)st.gaps, (unsigned long)st.max_gap_ms, (unsigned long)st.stalls,
+    (unsigned long)st.reinits, (unsigned long)st.power_cycles, (unsigned long)st.init_errors, (unsigned long)st.recoveries,
+    (unsigned long)st.last_recovery_ms, (unsigned long)st.max_recovery_ms, (unsigned long)st.last_restart_ms
+  );
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  return httpd_resp_send(req, json, n);
+}
+
+void cam_watchdog_register(httpd_handle_t server) {
+  httpd_uri_t camera_uri = {
+    .uri = "/debug/camera",
+    .method = HTTP_GET,
+    .handler = camera_handler,
+    .user_ctx = NULL
+  };
+  httpd_register_uri_handler(server, &camera_uri);
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <stdint.h>
+#include "esp_camera.h"
+#include "esp_http_server.h"
+
+// Capture health watchdog.
+//
+// The capture task reports every esp_camera_fb_get() to cam_watchdog_check():
+// NULL, or a frame that took longer than CAM_WATCHDOG_GAP_MS to arrive, is a
+// failure. A wedged sensor (SCCB lockup, DMA overflow) is recovered in steps:
+//
+//   1. re-grab, CAM_WATCHDOG_REGRABS failures in a row
+//   2. esp_camera_deinit() + esp_camera_init() with the configuration saved by
+//      cam_watchdog_begin(), CAM_WATCHDOG_REINITS times
+//   3. the same with the sensor powered down through PWDN_GPIO_NUM for
+//      CAM_WATCHDOG_PWDN_MS in between (boards without the pin repeat step 2),
+//      then CAM_WATCHDOG_COOLDOWN_MS before starting over at step 2
+//
+// Sensor settings (camera_settings table) are read before the driver goes
+// down and written back after it comes up. The restart holds the sensor lock,
+// so code outside the capture task reaches the sensor only through
+// cam_sensor_take()/cam_sensor_give() and must cope with it being absent.
+// Recovery time runs from the start of the first failed grab to the next good
+// frame. /stream keeps its clients through an outage of up to
+// CAM_WATCHDOG_HOLD_MS instead of dropping them on the first missing frame.
+
+#ifndef CAM_WATCHDOG_REGRABS
+#define CAM_WATCHDOG_REGRABS 2
+#endif
+#ifndef CAM_WATCHDOG_REINITS
+#define CAM_WATCHDOG_REINITS 2
+#endif
+#ifndef CAM_WATCHDOG_GAP_MS
+#define CAM_WATCHDOG_GAP_MS 2000
+#endif
+#ifndef CAM_WATCHDOG_PWDN_MS
+#define CAM_WATCHDOG_PWDN_MS 100
+#endif
+#ifndef CAM_WATCHDOG_COOLDOWN_MS
+#define CAM_WATCHDOG_COOLDOWN_MS 10000
+#endif
+// How long cam_sensor_take() waits out a driver restart
+#ifndef CAM_WATCHDOG_LOCK_MS
+#define CAM_WATCHDOG_LOCK_MS 3000
+#endif
+// How long /stream keeps a client waiting for the next frame
+#ifndef CAM_WATCHDOG_HOLD_MS
+#define CAM_WATCHDOG_HOLD_MS 30000
+#endif
+
+typedef enum {
+  CAM_WATCHDOG_NONE,         // keep grabbing
+  CAM_WATCHDOG_REINIT,
+  CAM_WATCHDOG_POWER_CYCLE,
+} cam_watchdog_action_t;
+
+typedef struct {
+  uint32_t failures;        // NULL frames
+  uint32_t gaps;            // frames later than CAM_WATCHDOG_GAP_MS
+  uint32_t max_gap_ms;
+  uint32_t stalls;          // outages that needed a driver restart
+  uint32_t reinits;
+  uint32_t power_cycles;
+  uint32_t init_errors;     // esp_camera_init() failures during recovery
+  uint32_t recoveries;      // outages that ended with a good frame
+  uint32_t last_recovery_ms;
+  uint32_t max_recovery_ms;
+  uint32_t last_restart_ms;  // time spent in the last deinit/init
+  uint32_t stalled_ms;       // current outage, 0 while healthy
+} cam_watchdog_stats_t;
+
+// Save the configuration the driver was started with and create the sensor
+// lock; call right after esp_camera_init()
+void cam_watchdog_begin(const camera_config_t *config);
+
+// The sensor with the lock held, or NULL (lock not held) if the driver is down
+// or restarting for longer than CAM_WATCHDOG_LOCK_MS. The lock is recursive.
+sensor_t *cam_sensor_take();
+
+// Release a sensor returned by cam_sensor_take()
+void cam_sensor_give();
+
+// Capture task: result of one grab that waited wait_us. Returns what to do;
+// until cam_watchdog_recover() runs, every further failure asks for the same
+// step.
+cam_watchdog_action_t cam_watchdog_check(bool ok, int64_t wait_us);
+
+// Capture task: restart the driver and move the escalation one step on (to the
+// cooldown after the power cycle). Every driver frame buffer must have been
+// returned. Returns false if the driver did not come back.
+bool cam_watchdog_recover(cam_watchdog_action_t action);
+
+void cam_watchdog_get_stats(cam_watchdog_stats_t *out);
+
+// Register GET /debug/camera (watchdog counters and recovery times as JSON)
+void cam_watchdog_register(httpd_handle_t server);
@@ -0,0 +1,149 @@
+#include "camera_settings.h"
+#include <Arduino.h>
+#include "board_config.h"
+#include "overlay.h"
+#include "cam_watchdog.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+#if defined(LED_GPIO_NUM)
+// LED flash state lives in app_httpd.cpp
+extern int led_duty;
+extern bool isStreaming;
+void enable_led(bool en);
+#endif
+
+typedef struct {
+  const char *name;
+  int (*set)(sensor_t *s, int val);
+  int (*get)(sensor_t *s);
+} camera_setting_t;
+
+// Sorted by name for camera_setting_index()
+static constexpr camera_setting_t _settings[] = {
+  {"ae_level", [](sensor_t *s, int v) { return s->set_ae_level(s, v); }, [](sensor_t *s) { return (int)s->status.ae_level; }},
+  {"aec", [](sensor_t *s, int v) { return s->set_exposure_ctrl(s, v); }, [](sensor_t *s) { return (int)s->status.aec; }},
+  {"aec2", [](sensor_t *s, int v) { return s->set_aec2(s, v); }, [](sensor_t *s) { return (int)s->status.aec2; }},
+  {"aec_value", [](sensor_t *s, int v) { return s->set_aec_value(s, v); }, [](sensor_t *s) { return (int)s->status.aec_value; }},
+  {"agc", [](sensor_t *s, int v) { return s->set_gain_ctrl(s, v); }, [](sensor_t *s) { return (int)s->status.agc; }},
+  {"agc_gain", [](sensor_t *s, int v) { return s->set_agc_gain(s, v); }, [](sensor_t *s) { return (int)s->status.agc_gain; }},
+  {"awb", [](sensor_t *s, int v) { return s->set_whitebal(s, v); }, [](sensor_t *s) { return (int)s->status.awb; }},
+  {"awb_gain", [](sensor_t *s, int v) { return s->set_awb_gain(s, v); }, [](sensor_t *s) { return (int)s->status.awb_gain; }},
+  {"bpc", [](sensor_t *s, int v) { return s->set_bpc(s, v); }, [](sensor_t *s) { return (int)s->status.bpc; }},
+  {"brightness", [](sensor_t *s, int v) { return s->set_brightness(s, v); }, [](sensor_t *s) { return (int)s->status.brightness; }},
+  {"colorbar", [](sensor_t *s, int v) { return s->set_colorbar(s, v); }, [](sensor_t *s) { return (int)s->status.colorbar; }},
+  {"contrast", [](sensor_t *s, int v) { return s->set_contrast(s, v); }, [](sensor_t *s) { return (int)s->status.contrast; }},
+  {"dcw", [](sensor_t *s, int v) { return s->set_dcw(s, v); }, [](sensor_t *s) { return (int)s->status.dcw; }},
+  {"framesize",
+   [](sensor_t *s, int v) {
+     return s->pixformat == PIXFORMAT_JPEG ? s->set_framesize(s, (framesize_t)v) : 0;
+   },
+   [](sensor_t *s) {
+     return (int)s->status.framesize;
+   }},
+  {"gainceiling", [](sensor_t *s, int v) { return s->set_gainceiling(s, (gainceiling_t)v); }, [](sensor_t *s) { return (int)s->status.gainceiling; }},
+  {"hmirror", [](sensor_t *s, int v) { return s->set_hmirror(s, v); }, [](sensor_t *s) { return (int)s->status.hmirror; }},
+#if defined(LED_GPIO_NUM)
+  {"led_intensity",
+   [](sensor_t *s, int v) {
+     led_duty = v;
+     if (isStreaming) {
+       enable_led(true);
+     }
+     return 0;
+   },
+   [](sensor_t *s) {
+     return led_duty;
+   }},
+#endif
+  {"lenc", [](sensor_t *s, int v) { return s->set_lenc(s, v); }, [](sensor_t *s) { return (int)s->status.lenc; }},
+  {"quality", [](sensor_t *s, int v) { return s->set_quality(s, v); }, [](sensor_t *s) { return (int)s->status.quality; }},
+  {"raw_gma", [](sensor_t *s, int v) { return s->set_raw_gma(s, v); }, [](sensor_t *s) { return (int)s->status.raw_gma; }},
+  {"saturation", [](sensor_t *s, int v) { return s->set_saturation(s, v); }, [](sensor_t *s) { return (int)s->status.saturation; }},
+  {"special_effect", [](sensor_t *s, int v) { return s->set_special_effect(s, v); }, [](sensor_t *s) { return (int)s->status.special_effect; }},
+  {"timestamp",
+   [](sensor_t *s, int v) {
+     overlay_set_timestamp(v);
+     return 0;
+   },
+   [](sensor_t *s) {
+     return (int)overlay_timestamp();
+   }},
+  {"vflip", [](sensor_t *s, int v) { return s->set_vflip(s, v); }, [](sensor_t *s) { return (int)s->status.vflip; }},
+  {"wb_mode", [](sensor_t *s, int v) { return s->set_wb_mode(s, v); }, [](sensor_t *s) { return (int)s->status.wb_mode; }},
+  {"wpc", [](sensor_t *s, int v) { return s->set_wpc(s, v); }, [](sensor_t *s) { return (int)s->status.wpc; }},
+};
+
+#define SETTINGS_COUNT ((int)(sizeof(_settings) / sizeof(_settings[0])))
+
+static constexpr int name_cmp(const char *a, const char *b) {
+  return (*a != *b || !*a) ? (unsigned char)*a - (unsigned char)*b : name_cmp(a + 1, b + 1);
+}
+
+static constexpr bool settings_sorted(int i = 1) {
+  return i >= SETTINGS_COUNT || (name_cmp(_settings[i - 1].name, _settings[i].name) < 0 && settings_sorted(i + 1));
+}
+
+static_assert(settings_sorted(), "keep _settings sorted by name");
+
+int camera_setting_count() {
+  return SETTINGS_COUNT;
+}
+
+const char *camera_setting_name(int i) {
+  return (i >= 0 && i < SETTINGS_COUNT) ? _settings[i].name : NULL;
+}
+
+int camera_setting_index(const char *name) {
+  int lo = 0, hi = SETTINGS_COUNT;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    int c = strcmp(_settings[mid].name, name);
+    if (c == 0) {
+      return mid;
+    }
+    if (c < 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return -1;
+}
+
+int camera_setting_write(int i, int val) {
+  if (i < 0 || i >= SETTINGS_COUNT) {
+    return -1;
+  }
+  sensor_t *s = cam_sensor_take();
+  if (!s) {
+    return -1;
+  }
+  int res = _settings[i].set(s, val);
+  cam_sensor_give();
+  return res;
+}
+
+int camera_setting_read(int i) {
+  if (i < 0 || i >= SETTINGS_COUNT) {
+    return 0;
+  }
+  sensor_t *s = cam_sensor_take();
+  if (!s) {
+    return 0;
+  }
+  int val = _settings[i].get(s);
+  cam_sensor_give();
+  return val;
+}
+
+int camera_setting_apply(const char *name, int val) {
+  int i = camera_setting_index(name);
+  if (i < 0) {
+    log_i("Unknown command: %s", name);
+    return -1;
+  }
+  return camera_setting_write(i, val);
+}
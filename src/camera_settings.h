@@ -0,0 +1,26 @@
+#pragma once
+
+#include "esp_camera.h"
+
+// Table of the sensor settings exposed by /control and the WebSocket control
+// channel. Settings are addressed by name or by their index in the table; the
+// index is stable for a given build.
+
+// Number of settings in the table
+int camera_setting_count();
+
+// Name of setting i, or NULL when out of range
+const char *camera_setting_name(int i);
+
+// Index of the named setting, or -1
+int camera_setting_index(const char *name);
+
+// Apply a value. Returns the sensor driver result (< 0 on failure), -1 for an
+// unknown index or while the camera is offline.
+int camera_setting_write(int i, int val);
+
+// Current value as tracked by the sensor driver, 0 while the camera is offline
+int camera_setting_read(int i);
+
+// Convenience wrapper for name/value callers such as /control
+int camera_setting_apply(const char *name, int val);
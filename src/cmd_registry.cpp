@@ -0,0 +1,391 @@
+#include "cmd_registry.h"
+#include <Arduino.h>
+#include <WiFi.h>
+#include <Preferences.h>
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <strings.h>
+#include "camera_settings.h"
+#include "heap_mon.h"
+#include "wifi_link.h"
+#include "serial_proto.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+extern String wifi_ssid;
+extern String wifi_password;
+extern Preferences prefs;
+
+void cmd_printf(const cmd_out_t *out, const char *fmt, ...) {
+  if (!out || !out->write) {
+    return;
+  }
+  char buf[192];
+  va_list ap;
+  va_start(ap, fmt);
+  int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+  va_end(ap);
+  if (n > 0) {
+    out->write(out->ctx, buf, n < (int)sizeof(buf) ? n : sizeof(buf) - 1);
+  }
+}
+
+static void save_credentials(const cmd_out_t *out) {
+  prefs.begin("wifi", false);
+  prefs.putString("ssid", wifi_ssid);
+  prefs.putString("pass", wifi_password);
+  prefs.end();
+  cmd_printf(out, "Credentials saved to NVS\n");
+}
+
+static int cmd_connect(const cmd_out_t *out, int argc, const cmd_arg_t *argv) {
+  // Hands over to the link supervisor; the result is printed when it connects
+  cmd_printf(out, "Connecting to WiFi '%s'...\n", wifi_ssid.c_str());
+  wifi_link_begin(wifi_ssid.c_str(), wifi_password.c_str());
+  return 0;
+}
+
+static int cmd_del(const cmd_out_t *out, int argc, const cmd_arg_t *argv) {
+  prefs.begin("wifi", false);
+  prefs.remove("ssid");
+  prefs.remove("pass");
+  prefs.end();
+  // defaults from secrets/example are reloaded by main on the next boot
+  cmd_printf(out, "Credentials removed from NVS\n");
+  return 0;
+}
+
+static int cmd_dhcp(const cmd_out_t *out, int argc, const cmd_arg_t *argv) {
+  wifi_link_set_static(0, 0, 0, 0);
+  cmd_printf(out, "DHCP enabled, applies on next connect\n");
+  return 0;
+}
+
+static int cmd_get(const cmd_out_t *out, int argc, const cmd_arg_t *argv) {
+  if (argc > 0) {
+    int i = camera_setting_index(argv[0].s);
+    if (i < 0) {
+      cmd_printf(out, "Unknown setting '%s'\n", argv[0].s);
+      return -1;
+    }
+    cmd_printf(out, "%s = %d\n", argv[0].s, camera_setting_read(i));
+    return 0;
+  }
+  for (int i = 0; i < camera_setting_count(); i++) {
+    cmd_printf(out, "%-16s %d\n", camera_setting_name(i), camera_setting_read(i));
+  }
+  return 0;
+}
+
+static int cmd_heap(const cmd_out_t *out, int argc, const cmd_arg_t *argv) {
+  heap_mon_stats_t st;
+  heap_mon_get_stats(&st);
+  const heap_region_stats_t *r = &st.internal;
+  for (int i = 0; i < 2; i++, r = &st.psram) {
+    cmd_printf(out, "%-8s %lu free (min %lu), largest block %lu (min %lu), fragmentation %u%% (start %u%%, max %u%%)\n", i ? "PSRAM:" : "Internal:",
+               (unsigned long)r->free, (unsigned long)r->min_free, (unsigned long)r->largest, (unsigned long)r->min_largest, r->frag, r->frag_base,
+               r->frag_max);
+  }
+  for (int i = 0; i < HEAP_TAG_COUNT; i++) {
+    heap_tag_stats_t t;
+    heap_mon_get_tag((heap_tag_t)i, &t);
+    cmd_printf(out, "  %-10s %7lu bytes in %lu (peak %lu), %lu allocs, %lu failed (last %lu bytes)\n", heap_mon_tag_name((heap_tag_t)i),
+               (unsigned long)t.live_bytes, (unsigned long)t.live_count, (unsigned long)t.peak_bytes, (unsigned long)t.allocs,
+               (unsigned long)t.failures, (unsigned long)t.last_fail_size);
+  }
+  if (st.soak_failed) {
+    cmd_printf(out, "Soak check FAILED: fragmentation grew more than %u points\n", (unsigned)HEAP_MON_SOAK_FRAG_PCT);
+  }
+  return 0;
+}
+
+static int cmd_help(const cmd_out_t *out, int argc, const cmd_arg_t *argv) {
+  cmd_print_help(out);
+  return 0;
+}
+
+static int cmd_set(const cmd_out_t *out, int argc, const cmd_arg_t *argv) {
+  log_i("%s = %ld", argv[0].s, argv[1].i);
+  int res = camera_setting_apply(argv[0].s, (int)argv[1].i);
+  if (res < 0) {
+    cmd_printf(out, "Failed to set '%s' (%d)\n", argv[0].s, res);
+  }
+  return res;
+}
+
+static int cmd_setip(const cmd_out_t *out, int argc, const cmd_arg_t *argv) {
+  IPAddress ip[4];
+  for (int i = 0; i < argc; i++) {
+    if (!ip[i].fromString(argv[i].s)) {
+      return CMD_ERR_USAGE;
+    }
+  }
+  if (!wifi_link_set_static(ip[0], ip[1], ip[2], argc > 3 ? (uint32_t)ip[3] : 0)) {
+    return CMD_ERR_USAGE;
+  }
+  cmd_printf(out, "Static IP saved, applies on next connect\n");
+  return 0;
+}
+
+static int cmd_setpass(const cmd_out_t *out, int argc, const cmd_arg_t *argv) {
+  wifi_password = argv[0].s;
+  save_credentials(out);
+  cmd_printf(out, "Password updated\n");
+  return 0;
+}
+
+static int cmd_setssid(const cmd_out_t *out, int argc, const cmd_arg_t *argv) {
+  wifi_ssid = argv[0].s;
+  save_credentials(out);
+  cmd_printf(out, "SSID updated\n");
+  return 0;
+}
+
+static int cmd_show(const cmd_out_t *out, int argc, const cmd_arg_t *argv) {
+  char masked[65];
+  size_t n = wifi_password.length() < sizeof(masked) - 1 ? wifi_password.length() : sizeof(masked) - 1;
+  memset(masked, '*', n);
+  masked[n] = '\0';
+  cmd_printf(out, "SSID: %s\n", wifi_ssid.c_str());
+  cmd_printf(out, "Password: %s\n", masked);
+  return 0;
+}
+
+static int cmd_showip(const cmd_out_t *out, int argc, const cmd_arg_t *argv) {
+  if (WiFi.status() == WL_CONNECTED) {
+    cmd_printf(out, "IP: %s\n", WiFi.localIP().toString().c_str());
+  } else {
+    cmd_printf(out, "Not connected to WiFi\n");
+  }
+  return 0;
+}
+
+static int cmd_snap(const cmd_out_t *out, int argc, const cmd_arg_t *argv) {
+  long baud = argc > 0 ? argv[0].i : SERIAL_PROTO_SNAP_BAUD;
+  if (baud < SERIAL_PROTO_BAUD_MIN || baud > SERIAL_PROTO_BAUD_MAX) {
+    return CMD_ERR_USAGE;
+  }
+  // tools/serial_snap.py waits for this line, then switches its side
+  cmd_printf(out, "SNAP %lu\n", (unsigned long)baud);
+  serial_proto_start(baud);
+  return 0;
+}
+
+static int cmd_wifistats(const cmd_out_t *out, int argc, const cmd_arg_t *argv) {
+  wifi_link_stats_t st;
+  wifi_link_get_stats(&st);
+  cmd_printf(out, "Connects: %lu attempts, %lu cached BSSID (avg %lu ms), %lu scan (avg %lu ms), %lu fallbacks\n", (unsigned long)st.attempts,
+             (unsigned long)st.fast, (unsigned long)(st.fast ? st.fast_ms_total / st.fast : 0), (unsigned long)st.full,
+             (unsigned long)(st.full ? st.full_ms_total / st.full : 0), (unsigned long)st.fallbacks);
+  cmd_printf(out, "Last connect: %lu ms (%s), address: %s\n", (unsigned long)st.last_ms, st.last_fast ? "cached BSSID" : "scan",
+             st.static_ip ? "static" : "DHCP");
+  if (st.cached) {
+    cmd_printf(out, "Cached BSSID %02x:%02x:%02x:%02x:%02x:%02x channel %u\n", st.bssid[0], st.bssid[1], st.bssid[2], st.bssid[3], st.bssid[4],
+               st.bssid[5], st.channel);
+  } else {
+    cmd_printf(out, "No cached BSSID\n");
+  }
+  cmd_printf(out, "Link: %s, RSSI %d dBm (avg %d, min %d), %lu failures in a row, retry in %lu ms\n", wifi_link_state_name(st.state), st.rssi,
+             st.rssi_avg, st.rssi_min, (unsigned long)st.failures, (unsigned long)st.backoff_ms);
+  cmd_printf(out, "Offline: %lu disconnects, %lu ms total, last outage %lu ms, %lu AP fallbacks\n", (unsigned long)st.disconnects,
+             (unsigned long)st.down_ms_total, (unsigned long)st.last_down_ms, (unsigned long)st.ap_fallbacks);
+  return 0;
+}
+
+// Sorted by name (checked below) for the binary search in cmd_find()
+static constexpr cmd_t _cmds[] = {
+  {"connect", "", cmd_connect, "", "Connect with the current credentials"},
+  {"del", "", cmd_del, "", "Remove saved credentials from NVS (resets to defaults)"},
+  {"dhcp", "", cmd_dhcp, "", "Go back to DHCP (next connect)"},
+  {"get", "W", cmd_get, "[setting]", "Show one camera setting, or all of them"},
+  {"heap", "", cmd_heap, "", "Show free memory, fragmentation and allocations per subsystem"},
+  {"help", "", cmd_help, "", "Show this message"},
+  {"set", "wi", cmd_set, "<setting> <value>", "Change a camera setting (same names as /control)"},
+  {"setip", "wwwW", cmd_setip, "<ip> <gw> <mask> [dns]", "Use a static IP (next connect)"},
+  {"setpass", "r", cmd_setpass, "<pass>", "Set password and save"},
+  {"setssid", "r", cmd_setssid, "<ssid>", "Set SSID and save"},
+  {"show", "", cmd_show, "", "Show current SSID and masked password"},
+  {"showip", "", cmd_showip, "", "Show current IP if connected"},
+  {"snap", "I", cmd_snap, "[baud]", "Send a JPEG frame to tools/serial_snap.py at a raised baud rate"},
+  {"wifistats", "", cmd_wifistats, "", "Show link state, RSSI, offline time and connect times"},
+};
+
+#define CMD_COUNT ((int)(sizeof(_cmds) / sizeof(_cmds[0])))
+
+static constexpr int name_cmp(const char *a, const char *b) {
+  return (*a != *b || !*a) ? (unsigned char)*a - (unsigned char)*b : name_cmp(a + 1, b + 1);
+}
+
+static constexpr bool is_optional(char k) {
+  return k >= 'A' && k <= 'Z';
+}
+
+// Optional arguments only at the end, rest of the line only last
+static constexpr bool schema_ok(const char *s, int n = 0) {
+  return !*s ? n <= CMD_MAX_ARGS
+             : !(s[1] && (s[0] == 'r' || s[0] == 'R')) && !(is_optional(s[0]) && s[1] && !is_optional(s[1])) && schema_ok(s + 1, n + 1);
+}
+
+static constexpr bool cmds_valid(int i = 0) {
+  return i >= CMD_COUNT || ((i == 0 || name_cmp(_cmds[i - 1].name, _cmds[i].name) < 0) && schema_ok(_cmds[i].args) && cmds_valid(i + 1));
+}
+
+static_assert(cmds_valid(), "keep _cmds sorted by name, with valid argument schemas");
+
+// Compare a table name with the first len characters of s, ignoring case
+static int key_cmp(const char *name, const char *s, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    int c = tolower((unsigned char)s[i]);
+    if (name[i] != c) {
+      return (unsigned char)name[i] - c;
+    }
+  }
+  return name[len] ? 1 : 0;
+}
+
+static bool has_prefix(const char *name, const char *s, size_t len) {
+  return strncasecmp(name, s, len) == 0;
+}
+
+const cmd_t *cmd_find(const char *name, size_t len, bool *ambiguous) {
+  if (ambiguous) {
+    *ambiguous = false;
+  }
+  if (!len) {
+    return NULL;
+  }
+  // first entry not below the key; an exact match or the first with it as prefix
+  int lo = 0, hi = CMD_COUNT;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (key_cmp(_cmds[mid].name, name, len) < 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  if (lo == CMD_COUNT || !has_prefix(_cmds[lo].name, name, len)) {
+    return NULL;
+  }
+  if (_cmds[lo].name[len] && lo + 1 < CMD_COUNT && has_prefix(_cmds[lo + 1].name, name, len)) {
+    if (ambiguous) {
+      *ambiguous = true;
+    }
+    return NULL;
+  }
+  return &_cmds[lo];
+}
+
+static bool parse_int(const char *s, long *out) {
+  char *end;
+  *out = strtol(s, &end, 0);
+  return end != s && !*end;
+}
+
+static int usage(const cmd_t *cmd, const cmd_out_t *out) {
+  cmd_printf(out, "Usage: %s%s%s\n", cmd->name, *cmd->usage ? " " : "", cmd->usage);
+  return CMD_ERR_USAGE;
+}
+
+static int exec(const cmd_t *cmd, int argc, cmd_arg_t *argv, const cmd_out_t *out) {
+  for (int i = 0; i < argc; i++) {
+    char k = cmd->args[i];
+    if ((k == 'i' || k == 'I') && !parse_int(argv[i].s, &argv[i].i)) {
+      return usage(cmd, out);
+    }
+  }
+  int res = cmd->run(out, argc, argv);
+  return res == CMD_ERR_USAGE ? usage(cmd, out) : res;
+}
+
+static int min_args(const char *schema) {
+  int n = 0;
+  while (schema[n] >= 'a') {
+    n++;
+  }
+  return n;
+}
+
+int cmd_run(char *line, const cmd_out_t *out) {
+  char *p = line;
+  while (*p == ' ' || *p == '\t') {
+    p++;
+  }
+  char *name = p;
+  while (*p && *p != ' ' && *p != '\t') {
+    p++;
+  }
+  size_t len = p - name;
+  if (!len) {
+    return 0;
+  }
+
+  bool ambiguous;
+  const cmd_t *cmd = cmd_find(name, len, &ambiguous);
+  if (!cmd) {
+    cmd_printf(out, ambiguous ? "Ambiguous command '%.*s'\n" : "Unknown command '%.*s'. Type 'help' for commands.\n", (int)len, name);
+    return ambiguous ? CMD_ERR_AMBIGUOUS : CMD_ERR_UNKNOWN;
+  }
+
+  cmd_arg_t argv[CMD_MAX_ARGS];
+  int argc = 0;
+  for (const char *k = cmd->args; *k && argc < CMD_MAX_ARGS; k++) {
+    while (*p == ' ' || *p == '\t') {
+      p++;
+    }
+    if (!*p) {
+      break;
+    }
+    argv[argc++].s = p;
+    if (*k == 'r' || *k == 'R') {
+      // rest of the line, without trailing blanks
+      char *e = p + strlen(p);
+      while (e > p && (e[-1] == ' ' || e[-1] == '\t')) {
+        e--;
+      }
+      *e = '\0';
+      p = e;
+      break;
+    }
+    while (*p && *p != ' ' && *p != '\t') {
+      p++;
+    }
+    if (*p) {
+      *p++ = '\0';
+    }
+  }
+  while (*p == ' ' || *p == '\t') {
+    p++;
+  }
+  if (*p || argc < min_args(cmd->args)) {
+    return usage(cmd, out);
+  }
+  return exec(cmd, argc, argv, out);
+}
+
+int cmd_call(const char *name, int argc, const char *const *args, const cmd_out_t *out) {
+  const cmd_t *cmd = cmd_find(name, strlen(name), NULL);
+  if (!cmd) {
+    return CMD_ERR_UNKNOWN;
+  }
+  if (argc > CMD_MAX_ARGS || argc < min_args(cmd->args) || argc > (int)strlen(cmd->args)) {
+    return usage(cmd, out);
+  }
+  cmd_arg_t argv[CMD_MAX_ARGS];
+  for (int i = 0; i < argc; i++) {
+    argv[i].s = args[i];
+  }
+  return exec(cmd, argc, argv, out);
+}
+
+void cmd_print_help(const cmd_out_t *out) {
+  cmd_printf(out, "Serial commands (any unique prefix works):\n");
+  for (int i = 0; i < CMD_COUNT; i++) {
+    char head[40];
+    snprintf(head, sizeof(head), "%s%s%s", _cmds[i].name, *_cmds[i].usage ? " " : "", _cmds[i].usage);
+    cmd_printf(out, "  %-28s - %s\n", head, _cmds[i].help);
+  }
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Command registry.
+//
+// One constexpr table of commands (name, argument schema, handler, help),
+// kept sorted by name, serves the serial shell, HTTP /control and the
+// WebSocket control channel (both run "set <var> <val>"; the channel maps its
+// setting indexes to names first). Lookup is a binary search that also
+// accepts a unique prefix ("wifis" runs wifistats). The arguments are split in
+// place and checked against the schema once, before the handler runs, so
+// handlers never parse.
+//
+// Schema: one letter per argument; upper case marks an optional one (only
+// trailing arguments may be optional):
+//   i / I  integer (decimal, 0x hex)
+//   w / W  word
+//   r / R  rest of the line, spaces included (last)
+
+#define CMD_MAX_ARGS 4
+
+typedef struct {
+  const char *s;
+  long i;  // parsed value of an integer argument
+} cmd_arg_t;
+
+// Where command output goes; write may be NULL to discard it
+typedef struct {
+  void (*write)(void *ctx, const char *s, size_t len);
+  void *ctx;
+} cmd_out_t;
+
+// Returns >= 0 on success; negative values are command specific failures
+typedef int (*cmd_fn)(const cmd_out_t *out, int argc, const cmd_arg_t *argv);
+
+typedef struct {
+  const char *name;
+  const char *args;   // schema
+  cmd_fn run;
+  const char *usage;  // argument names for help and usage errors
+  const char *help;
+} cmd_t;
+
+#define CMD_ERR_UNKNOWN   -1000
+#define CMD_ERR_AMBIGUOUS -1001
+#define CMD_ERR_USAGE     -1002
+
+// Exact name or unique prefix (case-insensitive), NULL if none
+const cmd_t *cmd_find(const char *name, size_t len, bool *ambiguous);
+
+// Split line ("name args...") in place, check it and run it
+int cmd_run(char *line, const cmd_out_t *out);
+
+// Run a command with arguments already split (e.g. from a query string)
+int cmd_call(const char *name, int argc, const char *const *args, const cmd_out_t *out);
+
+void cmd_printf(const cmd_out_t *out, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+
+void cmd_print_help(const cmd_out_t *out);
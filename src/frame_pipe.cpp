@@ -0,0 +1,545 @@
+#include "frame_pipe.h"
+#include <Arduino.h>
+#include <stdarg.h>
+#include "esp_timer.h"
+#include "img_converters.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/event_groups.h"
+#include "heap_mon.h"
+#include "cam_watchdog.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+// The capture task stops grabbing when nobody asked for a frame for this long
+#define FRAME_PIPE_IDLE_US 1000000
+#define FRAME_PIPE_EVT_NEW BIT0
+
+static frame_t _pool[FRAME_PIPE_MAX_DEPTH];
+static bool _pool_used[FRAME_PIPE_MAX_DEPTH];
+static size_t _depth = 0;
+
+static frame_t *_latest = NULL;
+static uint32_t _seq = 0;
+static uint32_t _held = 0;  // references held by consumers
+
+static portMUX_TYPE _lock = portMUX_INITIALIZER_UNLOCKED;
+static SemaphoreHandle_t _slots = NULL;
+static EventGroupHandle_t _events = NULL;
+static TaskHandle_t _task = NULL;
+static volatile int64_t _last_demand_us = 0;
+static volatile frame_pipe_power_fn _power_hook = NULL;
+static volatile frame_pipe_stage_fn _stage = NULL;
+
+// statistics, written by the capture task only
+static uint32_t _frames = 0;
+static uint32_t _failures = 0;
+static uint32_t _slot_waits = 0;
+static uint32_t _fb_get_us = 0;
+static uint32_t _transcode_us = 0;
+static uint32_t _stage_us = 0;
+static uint32_t _dropped = 0;
+static uint32_t _busy_pct = 0;
+static float _fps = 0;
+
+// Latency stages of a delivered frame, in microseconds
+enum {
+  LAT_SENSOR_TO_DEQUEUE,
+  LAT_DEQUEUE_TO_READY,  // transcode and frame stage
+  LAT_READY_TO_SENT,     // waiting in the pipe and for the consumer
+  LAT_TOTAL,
+  LAT_STAGES
+};
+static const char *_lat_names[LAT_STAGES] = {"sensor_to_dequeue", "dequeue_to_ready", "ready_to_sent", "total"};
+
+static uint32_t _lat[FRAME_PIPE_TRACE_SAMPLES][LAT_STAGES];
+static uint32_t _lat_count = 0;  // samples since the last reset
+static uint32_t _lat_skipped = 0;
+static portMUX_TYPE _lat_lock = portMUX_INITIALIZER_UNLOCKED;
+static volatile uint32_t _first_sent_ms = 0;  // boot to the first frame sent
+
+static inline void ema(uint32_t *avg, int64_t sample) {
+  *avg = *avg ? (uint32_t)(*avg + (sample - (int64_t)*avg) / 16) : (uint32_t)sample;
+}
+
+static frame_t *pool_get() {
+  frame_t *f = NULL;
+  portENTER_CRITICAL(&_lock);
+  for (size_t i = 0; i < _depth; i++) {
+    if (!_pool_used[i]) {
+      _pool_used[i] = true;
+      f = &_pool[i];
+      break;
+    }
+  }
+  portEXIT_CRITICAL(&_lock);
+  return f;
+}
+
+// Frees the frame's buffer and hands its slot back to the capture task
+static void frame_free(frame_t *f) {
+  if (f->fb) {
+    esp_camera_fb_return(f->fb);
+  } else {
+    heap_mon_free(HEAP_TAG_FRAME, f->buf);
+  }
+  f->fb = NULL;
+  f->buf = NULL;
+  portENTER_CRITICAL(&_lock);
+  _pool_used[f - _pool] = false;
+  portEXIT_CRITICAL(&_lock);
+  xSemaphoreGive(_slots);
+}
+
+static void frame_unref(frame_t *f) {
+  bool last;
+  portENTER_CRITICAL(&_lock);
+  last = (--f->refs == 0);
+  portEXIT_CRITICAL(&_lock);
+  if (last) {
+    frame_free(f);
+  }
+}
+
+// Replace the published frame; the pipe's own reference moves to the new frame
+static void publish(frame_t *f) {
+  frame_t *old;
+  portENTER_CRITICAL(&_lock);
+  old = _latest;
+  f->seq = ++_seq;
+  f->refs = 1;
+  _latest = f;
+  portEXIT_CRITICAL(&_lock);
+  // wake every waiting consumer
+  xEventGroupSetBits(_events, FRAME_PIPE_EVT_NEW);
+  xEventGroupClearBits(_events, FRAME_PIPE_EVT_NEW);
+  if (old) {
+    frame_unref(old);
+  }
+}
+
+static void unpublish() {
+  frame_t *old;
+  portENTER_CRITICAL(&_lock);
+  old = _latest;
+  _latest = NULL;
+  portEXIT_CRITICAL(&_lock);
+  if (old) {
+    frame_unref(old);
+  }
+}
+
+// Driver restarts free every frame buffer, so wait until consumers have
+// returned theirs. A restart is postponed rather than pulling a buffer from
+// under a client; the watchdog asks for the same step on the next failure.
+static void restart_driver(cam_watchdog_action_t action) {
+  unpublish();
+  int64_t deadline = esp_timer_get_time() + 2000000;
+  while (uxSemaphoreGetCount(_slots) < _depth) {
+    if (esp_timer_get_time() > deadline) {
+      log_w("Frame pipe: frames still held, camera restart postponed");
+      return;
+    }
+    vTaskDelay(pdMS_TO_TICKS(10));
+  }
+  cam_watchdog_recover(action);
+}
+
+static void capture_task(void *arg) {
+  int64_t window_start = esp_timer_get_time();
+  int64_t blocked_us = 0;
+  uint32_t window_frames = 0;
+  bool idle = false;
+
+  while (true) {
+    int64_t now = esp_timer_get_time();
+    if (now - window_start >= 1000000) {
+      int64_t span = now - window_start;
+      _fps = window_frames * 1000000.0f / span;
+      _busy_pct = blocked_us >= span ? 0 : (uint32_t)((span - blocked_us) * 100 / span);
+      window_start = now;
+      window_frames = 0;
+      blocked_us = 0;
+    }
+
+    if (now - _last_demand_us > FRAME_PIPE_IDLE_US) {
+      // nobody is watching: give the driver its buffer back and sleep
+      unpublish();
+      if (!idle) {
+        idle = true;
+        if (_power_hook) {
+          _power_hook(false);
+        }
+      }
+      ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(1000));
+      blocked_us += esp_timer_get_time() - now;
+      continue;
+    }
+    if (idle) {
+      idle = false;
+      if (_power_hook) {
+        _power_hook(true);
+      }
+    }
+
+    if (xSemaphoreTake(_slots, 0) != pdTRUE) {
+      _slot_waits++;
+      if (xSemaphoreTake(_slots, pdMS_TO_TICKS(100)) != pdTRUE) {
+        blocked_us += esp_timer_get_time() - now;
+        continue;
+      }
+    }
+    frame_t *f = pool_get();
+
+    int64_t t0 = esp_timer_get_time();
+    camera_fb_t *fb = esp_camera_fb_get();
+    int64_t t1 = esp_timer_get_time();
+    blocked_us += t1 - now;
+    ema(&_fb_get_us, t1 - t0);
+    if (!fb) {
+      log_e("Camera capture failed");
+      _failures++;
+      frame_free(f);
+      cam_watchdog_action_t action = cam_watchdog_check(false, t1 - t0);
+      if (action != CAM_WATCHDOG_NONE) {
+        restart_driver(action);
+      }
+      vTaskDelay(pdMS_TO_TICKS(10));
+      continue;
+    }
+    // frames that arrive very late count toward a restart too
+    cam_watchdog_action_t action = cam_watchdog_check(true, t1 - t0);
+    if (action != CAM_WATCHDOG_NONE) {
+      esp_camera_fb_return(fb);
+      frame_free(f);
+      restart_driver(action);
+      continue;
+    }
+
+    f->timestamp = fb->timestamp;
+    f->capture_us = t1;
+    f->width = fb->width;
+    f->height = fb->height;
+    if (fb->format == PIXFORMAT_JPEG) {
+      f->fb = fb;
+      f->buf = fb->buf;
+      f->len = fb->len;
+    } else {
+      f->fb = NULL;
+      f->buf = NULL;
+      f->len = 0;
+      bool converted = frame2jpg(fb, 80, &f->buf, &f->len);
+      heap_mon_adopt(HEAP_TAG_FRAME, converted ? f->buf : NULL, 0);
+      esp_camera_fb_return(fb);
+      ema(&_transcode_us, esp_timer_get_time() - t1);
+      if (!converted) {
+        log_e("JPEG compression failed");
+        _failures++;
+        frame_free(f);
+        continue;
+      }
+    }
+
+    frame_pipe_stage_fn stage = _stage;
+    if (stage) {
+      int64_t t2 = esp_timer_get_time();
+      bool keep = stage(f);
+      ema(&_stage_us, esp_timer_get_time() - t2);
+      if (!keep) {
+        _dropped++;
+        frame_free(f);
+        continue;
+      }
+    }
+
+    f->ready_us = esp_timer_get_time();
+    publish(f);
+    _frames++;
+    window_frames++;
+  }
+}
+
+bool frame_pipe_begin(size_t depth) {
+  if (_task) {
+    return true;
+  }
+  _depth = depth < 1 ? 1 : (depth > FRAME_PIPE_MAX_DEPTH ? FRAME_PIPE_MAX_DEPTH : depth);
+  _slots = xSemaphoreCreateCounting(_depth, _depth);
+  _events = xEventGroupCreate();
+  if (!_slots || !_events) {
+    log_e("Frame pipe: out of memory");
+    return false;
+  }
+  if (xTaskCreatePinnedToCore(capture_task, "capture", FRAME_PIPE_STACK, NULL, FRAME_PIPE_PRIORITY, &_task, FRAME_PIPE_CORE) != pdPASS) {
+    log_e("Frame pipe: failed to start capture task");
+    return false;
+  }
+  log_i("Frame pipe: depth %u, capture task on core %d", (unsigned)_depth, FRAME_PIPE_CORE);
+  return true;
+}
+
+void frame_pipe_set_power_hook(frame_pipe_power_fn fn) {
+  _power_hook = fn;
+}
+
+void frame_pipe_set_stage(frame_pipe_stage_fn fn) {
+  _stage = fn;
+}
+
+frame_t *frame_pipe_acquire(uint32_t after_seq, uint32_t timeout_ms) {
+  if (!_task) {
+    return NULL;
+  }
+  int64_t now = esp_timer_get_time();
+  if (now - _last_demand_us > FRAME_PIPE_IDLE_US) {
+    _last_demand_us = now;
+    xTaskNotifyGive(_task);
+  }
+  int64_t deadline = now + (int64_t)timeout_ms * 1000;
+
+  while (true) {
+    _last_demand_us = esp_timer_get_time();
+    frame_t *f = NULL;
+    portENTER_CRITICAL(&_lock);
+    if (_latest && _latest->seq > after_seq) {
+      f = _latest;
+      f->refs++;
+      _held++;
+    }
+    portEXIT_CRITICAL(&_lock);
+    if (f) {
+      return f;
+    }
+
+    int64_t left = deadline - esp_timer_get_time();
+    if (left <= 0) {
+      return NULL;
+    }
+    // Wake-ups can be missed between the check above and the wait, so wait in
+    // short steps rather than for the whole timeout.
+    uint32_t wait_ms = left > 50000 ? 50 : (uint32_t)(left / 1000) + 1;
+    xEventGroupWaitBits(_events, FRAME_PIPE_EVT_NEW, pdFALSE, pdTRUE, pdMS_TO_TICKS(wait_ms));
+  }
+}
+
+void frame_pipe_release(frame_t *f) {
+  if (!f) {
+    return;
+  }
+  portENTER_CRITICAL(&_lock);
+  _held--;
+  portEXIT_CRITICAL(&_lock);
+  frame_unref(f);
+}
+
+static inline uint32_t clamp_us(int64_t us) {
+  return us < 0 ? 0 : (us > UINT32_MAX ? UINT32_MAX : (uint32_t)us);
+}
+
+uint32_t frame_pipe_trace(const frame_t *f, int64_t sent_us, uint32_t skipped) {
+  int64_t sensor_us = (int64_t)f->timestamp.tv_sec * 1000000LL + f->timestamp.tv_usec;
+  // a timestamp from another clock would make the first stage meaningless
+  if (sensor_us <= 0 || sensor_us > f->capture_us) {
+    sensor_us = f->capture_us;
+  }
+  uint32_t total = clamp_us(sent_us - sensor_us);
+  if (!_first_sent_ms) {
+    _first_sent_ms = (uint32_t)(sent_us / 1000);
+    Serial.printf("First frame sent %lu ms after boot\n", (unsigned long)_first_sent_ms);
+  }
+  portENTER_CRITICAL(&_lat_lock);
+  uint32_t *s = _lat[_lat_count % FRAME_PIPE_TRACE_SAMPLES];
+  s[LAT_SENSOR_TO_DEQUEUE] = clamp_us(f->capture_us - sensor_us);
+  s[LAT_DEQUEUE_TO_READY] = clamp_us(f->ready_us - f->capture_us);
+  s[LAT_READY_TO_SENT] = clamp_us(sent_us - f->ready_us);
+  s[LAT_TOTAL] = total;
+  _lat_count++;
+  _lat_skipped += skipped;
+  portEXIT_CRITICAL(&_lat_lock);
+  return total;
+}
+
+uint32_t frame_pipe_seq() {
+  return _seq;
+}
+
+void frame_pipe_get_stats(frame_pipe_stats_t *out) {
+  memset(out, 0, sizeof(*out));
+  if (!_slots) {
+    return;
+  }
+  portENTER_CRITICAL(&_lock);
+  out->seq = _seq;
+  out->consumers = _held;
+  portEXIT_CRITICAL(&_lock);
+  out->depth = _depth;
+  out->in_flight = _depth - uxSemaphoreGetCount(_slots);
+  out->frames = _frames;
+  out->failures = _failures;
+  out->slot_waits = _slot_waits;
+  out->fb_get_us = _fb_get_us;
+  out->transcode_us = _transcode_us;
+  out->stage_us = _stage_us;
+  out->dropped = _dropped;
+  out->first_frame_ms = _first_sent_ms;
+  out->busy_pct = _busy_pct;
+  out->fps = _fps;
+}
+
+// snprintf that never moves p past end
+static char *appendf(char *p, char *end, const char *fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  int n = vsnprintf(p, end - p, fmt, ap);
+  va_end(ap);
+  if (n < 0) {
+    return p;
+  }
+  return (p + n > end) ? end : p + n;
+}
+
+#if configUSE_TRACE_FACILITY && configGENERATE_RUN_TIME_STATS
+#define TASK_SAMPLE_MAX 32
+// Per-task CPU share since the previous /debug/pipeline request
+static char *print_task_load(char *p, char *end) {
+  static TaskHandle_t prev_handle[TASK_SAMPLE_MAX];
+  static uint32_t prev_runtime[TASK_SAMPLE_MAX];
+  static uint32_t prev_total = 0;
+  static TaskStatus_t tasks[TASK_SAMPLE_MAX];
+
+  uint32_t total = 0;
+  UBaseType_t n = uxTaskGetSystemState(tasks, TASK_SAMPLE_MAX, &total);
+  uint32_t span = total - prev_total;
+  // run time is summed over both cores
+  span *= portNUM_PROCESSORS;
+
+  p = appendf(p, end, ",\"tasks\":[");
+  for (UBaseType_t i = 0; i < n && p < end; i++) {
+    uint32_t last = 0;
+    for (int j = 0; j < TASK_SAMPLE_MAX; j++) {
+      if (prev_handle[j] == tasks[i].xHandle) {
+        last = prev_runtime[j];
+        break;
+      }
+    }
+    uint32_t pct = span ? (uint32_t)((uint64_t)(tasks[i].ulRunTimeCounter - last) * 100 / span) : 0;
+#if configTASKLIST_INCLUDE_COREID
+    int core = tasks[i].xCoreID == tskNO_AFFINITY ? -1 : (int)tasks[i].xCoreID;
+#else
+    int core = -1;
+#endif
+    p = appendf(
+      p, end, "%s{\"name\":\"%s\",\"core\":%d,\"prio\":%u,\"cpu\":%u,\"stack_free\":%u}", i ? "," : "", tasks[i].pcTaskName, core,
+      (unsigned)tasks[i].uxCurrentPriority, (unsigned)pct, (unsigned)tasks[i].usStackHighWaterMark
+    );
+  }
+  p = appendf(p, end, "]");
+
+  for (UBaseType_t i = 0; i < TASK_SAMPLE_MAX; i++) {
+    prev_handle[i] = i < n ? tasks[i].xHandle : NULL;
+    prev_runtime[i] = i < n ? tasks[i].ulRunTimeCounter : 0;
+  }
+  prev_total = total;
+  return p;
+}
+#endif
+
+static esp_err_t pipeline_handler(httpd_req_t *req) {
+  static char json_response[2048];
+  frame_pipe_stats_t st;
+  frame_pipe_get_stats(&st);
+
+  char *p = json_response;
+  char *end = json_response + sizeof(json_response) - 2;
+  p = appendf(
+    p, end,
+    "{\"seq\":%lu,\"fps\":%.1f,\"depth\":%lu,\"in_flight\":%lu,\"consumers\":%lu,\"frames\":%lu,\"failures\":%lu,\"slot_waits\":%lu,"
+    "\"fb_get_us\":%lu,\"transcode_us\":%lu,\"stage_us\":%lu,\"dropped\":%lu,\"first_frame_ms\":%lu,\"capture_busy\":%lu,"
+    "\"capture_core\":%d",
+    (unsigned long)st.seq, st.fps, (unsigned long)st.depth, (unsigned long)st.in_flight, (unsigned long)st.consumers, (unsigned long)st.frames,
+    (unsigned long)st.failures, (unsigned long)st.slot_waits, (unsigned long)st.fb_get_us, (unsigned long)st.transcode_us, (unsigned long)st.stage_us,
+    (unsigned long)st.dropped, (unsigned long)st.first_frame_ms, (unsigned long)st.busy_pct,
+    FRAME_PIPE_CORE
+  );
+#if configUSE_TRACE_FACILITY && configGENERATE_RUN_TIME_STATS
+  p = print_task_load(p, end);
+#endif
+  *p++ = '}';
+  *p = 0;
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  return httpd_resp_send(req, json_response, p - json_response);
+}
+
+static int cmp_u32(const void *a, const void *b) {
+  uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+  return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+static esp_err_t latency_handler(httpd_req_t *req) {
+  static char json_response[768];
+  static uint32_t column[FRAME_PIPE_TRACE_SAMPLES];
+  static uint32_t samples[FRAME_PIPE_TRACE_SAMPLES][LAT_STAGES];
+  char query[32] = "";
+  char value[8];
+  httpd_req_get_url_query_str(req, query, sizeof(query));
+  bool reset = httpd_query_key_value(query, "reset", value, sizeof(value)) == ESP_OK && atoi(value);
+
+  portENTER_CRITICAL(&_lat_lock);
+  uint32_t count = _lat_count;
+  uint32_t skipped = _lat_skipped;
+  uint32_t n = count < FRAME_PIPE_TRACE_SAMPLES ? count : FRAME_PIPE_TRACE_SAMPLES;
+  memcpy(samples, _lat, n * sizeof(samples[0]));
+  if (reset) {
+    _lat_count = 0;
+    _lat_skipped = 0;
+  }
+  portEXIT_CRITICAL(&_lat_lock);
+
+  char *p = json_response;
+  char *end = json_response + sizeof(json_response) - 2;
+  // skipped: frames a consumer never sent because a newer one replaced them
+  p = appendf(
+    p, end, "{\"frames\":%lu,\"skipped\":%lu,\"samples\":%lu", (unsigned long)count, (unsigned long)skipped, (unsigned long)n
+  );
+  for (int k = 0; k < LAT_STAGES; k++) {
+    for (uint32_t i = 0; i < n; i++) {
+      column[i] = samples[i][k];
+    }
+    qsort(column, n, sizeof(column[0]), cmp_u32);
+    uint32_t p50 = n ? column[n * 50 / 100] : 0;
+    uint32_t p90 = n ? column[n * 90 / 100] : 0;
+    uint32_t p99 = n ? column[n * 99 / 100] : 0;
+    uint32_t max = n ? column[n - 1] : 0;
+    p = appendf(
+      p, end, ",\"%s\":{\"p50\":%lu,\"p90\":%lu,\"p99\":%lu,\"max\":%lu}", _lat_names[k], (unsigned long)p50, (unsigned long)p90,
+      (unsigned long)p99, (unsigned long)max
+    );
+  }
+  *p++ = '}';
+  *p = 0;
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  return httpd_resp_send(req, json_response, p - json_response);
+}
+
+void frame_pipe_register(httpd_handle_t server) {
+  httpd_uri_t pipeline_uri = {
+    .uri = "/debug/pipeline",
+    .method = HTTP_GET,
+    .handler = pipeline_handler,
+    .user_ctx = NULL
+  };
+  httpd_register_uri_handler(server, &pipeline_uri);
+
+  httpd_uri_t latency_uri = {
+    .uri = "/debug/latency",
+    .method = HTTP_GET,
+    .handler = latency_handler,
+    .user_ctx = NULL
+  };
+  httpd_register_uri_handler(server, &latency_uri);
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <sys/time.h>
+#include "esp_camera.h"
+#include "esp_http_server.h"
+
+// Capture pipeline.
+//
+// A single capture task, pinned to the application core, owns the camera driver:
+// it grabs frames, transcodes non-JPEG frames, and publishes the newest frame.
+// HTTP handlers (on the Wi-Fi core) never call esp_camera_fb_get() themselves;
+// they acquire a reference to a published frame and release it after sending.
+//
+// The number of frames in flight (published + held by consumers) is bounded by
+// the pipeline depth, so a slow consumer applies backpressure to the capture
+// task instead of starving the camera driver of frame buffers.
+
+#ifndef FRAME_PIPE_CORE
+#define FRAME_PIPE_CORE 1
+#endif
+#ifndef FRAME_PIPE_PRIORITY
+#define FRAME_PIPE_PRIORITY (tskIDLE_PRIORITY + 5)
+#endif
+#ifndef FRAME_PIPE_STACK
+#define FRAME_PIPE_STACK 6144
+#endif
+#define FRAME_PIPE_MAX_DEPTH 4
+// Latency samples kept for /debug/latency
+#ifndef FRAME_PIPE_TRACE_SAMPLES
+#define FRAME_PIPE_TRACE_SAMPLES 256
+#endif
+
+typedef struct {
+  uint32_t seq;               // monotonic frame number, starts at 1
+  struct timeval timestamp;   // fb->timestamp (esp_timer time of the frame's capture)
+  int64_t capture_us;         // esp_timer time the driver handed us the frame
+  int64_t ready_us;           // esp_timer time the frame was encoded and published
+  uint8_t *buf;               // JPEG data
+  size_t len;
+  size_t width;
+  size_t height;
+  camera_fb_t *fb;            // driver buffer, or NULL when buf is heap owned
+  int refs;
+} frame_t;
+
+typedef struct {
+  uint32_t seq;           // last published frame
+  uint32_t depth;         // max frames in flight
+  uint32_t in_flight;     // frames currently published or held
+  uint32_t consumers;     // frames currently held by consumers
+  uint32_t frames;        // frames published since start
+  uint32_t failures;      // esp_camera_fb_get() failures
+  uint32_t slot_waits;    // times the capture task waited for a free slot
+  uint32_t fb_get_us;     // avg time spent in esp_camera_fb_get()
+  uint32_t transcode_us;  // avg time spent converting to JPEG
+  uint32_t stage_us;      // avg time spent in the frame stage
+  uint32_t dropped;       // frames dropped by the frame stage
+  uint32_t first_frame_ms;  // boot to the first frame sent to a client, 0 until then
+  uint32_t busy_pct;      // capture task time not spent blocked, percent
+  float fps;
+} frame_pipe_stats_t;
+
+// Start the capture task. depth is normally the driver's fb_count.
+bool frame_pipe_begin(size_t depth);
+
+// Wait up to timeout_ms for a frame newer than after_seq and take a reference
+// on it. Pass 0 to get the newest frame. Returns NULL on timeout.
+frame_t *frame_pipe_acquire(uint32_t after_seq, uint32_t timeout_ms);
+
+// Drop a reference taken with frame_pipe_acquire()
+void frame_pipe_release(frame_t *f);
+
+// Called from the capture task with on = false when it stops grabbing for lack
+// of demand, and with on = true before it grabs again. The hook may talk to the
+// sensor (e.g. put it in standby); no frame is being captured meanwhile.
+typedef void (*frame_pipe_power_fn)(bool on);
+void frame_pipe_set_power_hook(frame_pipe_power_fn fn);
+
+// Called from the capture task for every frame before it is published, to edit
+// it once for all consumers. The stage may replace buf and len; a new buffer
+// must be heap allocated, and the stage then returns fb to the driver and sets
+// fb to NULL so the buffer is freed with the frame. Returning false drops the
+// frame.
+typedef bool (*frame_pipe_stage_fn)(frame_t *f);
+void frame_pipe_set_stage(frame_pipe_stage_fn fn);
+
+// Capture-to-send latency tracing. Consumers call this when the first byte of
+// a frame goes out, with the number of frames they skipped since their previous
+// one (seq gap). Samples feed the percentiles at /debug/latency. Returns the
+// frame's age at sent_us, from the sensor timestamp.
+uint32_t frame_pipe_trace(const frame_t *f, int64_t sent_us, uint32_t skipped);
+
+// Sequence number of the newest published frame
+uint32_t frame_pipe_seq();
+
+void frame_pipe_get_stats(frame_pipe_stats_t *out);
+
+// Register GET /debug/pipeline (queue depths and task load as JSON) and
+// GET /debug/latency (latency percentiles per stage, ?reset=1 to clear)
+void frame_pipe_register(httpd_handle_t server);
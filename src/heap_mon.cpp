@@ -0,0 +1,186 @@
+#include "heap_mon.h"
+#include <Arduino.h>
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+#define CAPS_INTERNAL (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+
+static const char *const _tag_names[HEAP_TAG_COUNT] = {"http", "frame", "bmp", "avi", "prerecord", "burst"};
+
+static portMUX_TYPE _lock = portMUX_INITIALIZER_UNLOCKED;
+static heap_tag_stats_t _tags[HEAP_TAG_COUNT];
+static heap_mon_stats_t _stats;
+static esp_timer_handle_t _timer = NULL;
+
+static void account(heap_tag_t tag, void *p, size_t size) {
+  heap_tag_stats_t *t = &_tags[tag];
+  size_t got = p ? heap_caps_get_allocated_size(p) : 0;
+  portENTER_CRITICAL(&_lock);
+  if (p) {
+    t->live_bytes += got;
+    t->live_count++;
+    t->allocs++;
+    if (t->live_bytes > t->peak_bytes) {
+      t->peak_bytes = t->live_bytes;
+    }
+  } else {
+    t->failures++;
+    t->last_fail_size = size;
+  }
+  portEXIT_CRITICAL(&_lock);
+}
+
+void *heap_mon_malloc(heap_tag_t tag, size_t size, uint32_t caps) {
+  void *p = caps ? heap_caps_malloc(size, caps) : malloc(size);
+  account(tag, p, size);
+  return p;
+}
+
+void heap_mon_adopt(heap_tag_t tag, void *p, size_t size) {
+  account(tag, p, size);
+}
+
+void heap_mon_free(heap_tag_t tag, void *p) {
+  if (!p) {
+    return;
+  }
+  size_t size = heap_caps_get_allocated_size(p);
+  heap_tag_stats_t *t = &_tags[tag];
+  portENTER_CRITICAL(&_lock);
+  t->live_bytes -= size < t->live_bytes ? size : t->live_bytes;
+  if (t->live_count) {
+    t->live_count--;
+  }
+  portEXIT_CRITICAL(&_lock);
+  heap_caps_free(p);
+}
+
+const char *heap_mon_tag_name(heap_tag_t tag) {
+  return (tag >= 0 && tag < HEAP_TAG_COUNT) ? _tag_names[tag] : "?";
+}
+
+void heap_mon_get_tag(heap_tag_t tag, heap_tag_stats_t *out) {
+  portENTER_CRITICAL(&_lock);
+  *out = _tags[tag];
+  portEXIT_CRITICAL(&_lock);
+}
+
+// Heap queries take the heap lock, so they run outside the critical section
+static void sample_region(heap_region_stats_t *r, uint32_t caps, bool first) {
+  uint32_t free_size = heap_caps_get_free_size(caps);
+  uint32_t min_free = heap_caps_get_minimum_free_size(caps);
+  uint32_t largest = heap_caps_get_largest_free_block(caps);
+  uint8_t frag = free_size ? (uint8_t)(100 - (uint64_t)largest * 100 / free_size) : 0;
+
+  portENTER_CRITICAL(&_lock);
+  r->free = free_size;
+  r->min_free = min_free;
+  r->largest = largest;
+  r->frag = frag;
+  if (first) {
+    r->frag_base = frag;
+    r->frag_max = frag;
+    r->min_largest = largest;
+  } else {
+    if (frag > r->frag_max) {
+      r->frag_max = frag;
+    }
+    if (largest < r->min_largest) {
+      r->min_largest = largest;
+    }
+  }
+  portEXIT_CRITICAL(&_lock);
+}
+
+static void sample() {
+  portENTER_CRITICAL(&_lock);
+  bool first = _stats.samples++ == 0;
+  portEXIT_CRITICAL(&_lock);
+  sample_region(&_stats.internal, CAPS_INTERNAL, first);
+  sample_region(&_stats.psram, MALLOC_CAP_SPIRAM, first);
+
+#if HEAP_MON_SOAK_FRAG_PCT > 0
+  if (!_stats.soak_failed) {
+    const heap_region_stats_t *regions[] = {&_stats.internal, &_stats.psram};
+    for (int i = 0; i < 2; i++) {
+      const heap_region_stats_t *r = regions[i];
+      if (r->frag > r->frag_base + HEAP_MON_SOAK_FRAG_PCT) {
+        _stats.soak_failed = true;
+        Serial.printf("HEAP SOAK FAIL: %s fragmentation %u%% (start %u%%, limit +%u), largest block %lu of %lu free\n", i ? "psram" : "internal",
+                      r->frag, r->frag_base, (unsigned)HEAP_MON_SOAK_FRAG_PCT, (unsigned long)r->largest, (unsigned long)r->free);
+        break;
+      }
+    }
+  }
+#endif
+}
+
+static void on_timer(void *arg) {
+  sample();
+}
+
+void heap_mon_begin() {
+  if (_timer) {
+    return;
+  }
+  sample();
+  esp_timer_create_args_t args = {};
+  args.callback = on_timer;
+  args.name = "heap_mon";
+  if (esp_timer_create(&args, &_timer) == ESP_OK) {
+    esp_timer_start_periodic(_timer, (uint64_t)HEAP_MON_PERIOD_MS * 1000);
+  }
+}
+
+void heap_mon_get_stats(heap_mon_stats_t *out) {
+  sample();
+  portENTER_CRITICAL(&_lock);
+  *out = _stats;
+  portEXIT_CRITICAL(&_lock);
+}
+
+static char *put_region(char *p, char *end, const char *name, const heap_region_stats_t *r) {
+  return p + snprintf(
+    p, end - p, "\"%s\":{\"free\":%lu,\"min_free\":%lu,\"largest\":%lu,\"min_largest\":%lu,\"frag\":%u,\"frag_start\":%u,\"frag_max\":%u},", name,
+    (unsigned long)r->free, (unsigned long)r->min_free, (unsigned long)r->largest, (unsigned long)r->min_largest, r->frag, r->frag_base, r->frag_max
+  );
+}
+
+static esp_err_t heap_handler(httpd_req_t *req) {
+  heap_mon_stats_t st;
+  heap_mon_get_stats(&st);
+
+  char json[1536];
+  char *p = json, *end = json + sizeof(json);
+  *p++ = '{';
+  p = put_region(p, end, "internal", &st.internal);
+  p = put_region(p, end, "psram", &st.psram);
+  p += snprintf(p, end - p, "\"samples\":%lu,\"soak_limit\":%u,\"soak_failed\":%d,\"tags\":{", (unsigned long)st.samples,
+                (unsigned)HEAP_MON_SOAK_FRAG_PCT, st.soak_failed ? 1 : 0);
+  for (int i = 0; i < HEAP_TAG_COUNT; i++) {
+    heap_tag_stats_t t;
+    heap_mon_get_tag((heap_tag_t)i, &t);
+    p += snprintf(p, end - p, "%s\"%s\":{\"bytes\":%lu,\"count\":%lu,\"peak\":%lu,\"allocs\":%lu,\"failures\":%lu,\"last_fail_size\":%lu}",
+                  i ? "," : "", _tag_names[i], (unsigned long)t.live_bytes, (unsigned long)t.live_count, (unsigned long)t.peak_bytes,
+                  (unsigned long)t.allocs, (unsigned long)t.failures, (unsigned long)t.last_fail_size);
+  }
+  p += snprintf(p, end - p, "}}");
+
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  return httpd_resp_send(req, json, p - json);
+}
+
+void heap_mon_register(httpd_handle_t server) {
+  httpd_uri_t heap_uri = {
+    .uri = "/debug/heap",
+    .method = HTTP_GET,
+    .handler = heap_handler,
+    .user_ctx = NULL
+  };
+  httpd_register_uri_handler(server, &heap_uri);
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_http_server.h"
+
+// Heap accounting and fragmentation monitor.
+//
+// Long-lived buffers and the per-request conversion outputs go through tagged
+// wrappers, which keep live bytes, counts, peaks and failed allocations per
+// subsystem. Sizes come from heap_caps_get_allocated_size(), so buffers that
+// a library allocates (frame2jpg, frame2bmp) are accounted with
+// heap_mon_adopt() and released with heap_mon_free() like any other.
+//
+// A timer samples free size, minimum free size and the largest free block of
+// internal RAM and PSRAM every HEAP_MON_PERIOD_MS. Fragmentation is
+// 100 - largest * 100 / free: the share of free memory that a single
+// allocation cannot use, which is what makes a UXGA frame2bmp fail on a unit
+// with plenty of free PSRAM.
+//
+// Soak mode (HEAP_MON_SOAK_FRAG_PCT > 0): once fragmentation of either region
+// grows by more than that many points over the first sample, the monitor
+// latches a failure, prints it on the console and reports it in /debug/heap,
+// so a long run can be checked unattended.
+
+#ifndef HEAP_MON_PERIOD_MS
+#define HEAP_MON_PERIOD_MS 10000
+#endif
+#ifndef HEAP_MON_SOAK_FRAG_PCT
+#define HEAP_MON_SOAK_FRAG_PCT 0
+#endif
+
+typedef enum {
+  HEAP_TAG_HTTP,       // request handlers and their filters
+  HEAP_TAG_FRAME,      // transcoded and overlaid frames in the pipe
+  HEAP_TAG_BMP,        // /bmp conversion output
+  HEAP_TAG_AVI,        // AVI staging buffers and indexes
+  HEAP_TAG_PRERECORD,  // pre-event ring
+  HEAP_TAG_BURST,      // burst capture arena
+  HEAP_TAG_COUNT
+} heap_tag_t;
+
+typedef struct {
+  uint32_t live_bytes;
+  uint32_t live_count;
+  uint32_t peak_bytes;
+  uint32_t allocs;
+  uint32_t failures;
+  uint32_t last_fail_size;  // size of the last failed allocation
+} heap_tag_stats_t;
+
+typedef struct {
+  uint32_t free;
+  uint32_t min_free;
+  uint32_t largest;
+  uint32_t min_largest;  // smallest largest-block seen
+  uint8_t frag;          // percent, last sample
+  uint8_t frag_base;     // first sample
+  uint8_t frag_max;
+} heap_region_stats_t;
+
+typedef struct {
+  heap_region_stats_t internal;
+  heap_region_stats_t psram;
+  uint32_t samples;
+  bool soak_failed;
+} heap_mon_stats_t;
+
+// Start sampling
+void heap_mon_begin();
+
+// caps 0 allocates with malloc(), anything else with heap_caps_malloc()
+void *heap_mon_malloc(heap_tag_t tag, size_t size, uint32_t caps);
+
+// Account a buffer allocated elsewhere; NULL records a failure of size bytes
+// (0 when the library does not say how much it asked for)
+void heap_mon_adopt(heap_tag_t tag, void *p, size_t size);
+
+// Free a buffer from heap_mon_malloc() or heap_mon_adopt(); NULL is ignored
+void heap_mon_free(heap_tag_t tag, void *p);
+
+const char *heap_mon_tag_name(heap_tag_t tag);
+
+void heap_mon_get_tag(heap_tag_t tag, heap_tag_stats_t *out);
+
+// Takes a fresh sample first
+void heap_mon_get_stats(heap_mon_stats_t *out);
+
+// Register GET /debug/heap (regions and per-tag accounting as JSON)
+void heap_mon_register(httpd_handle_t server);
@@ -0,0 +1,617 @@
+#include "jpeg_blocks.h"
+#include <math.h>
+#include <string.h>
+
+#define HUFF_FAST_BITS 9
+#define JPEG_MAX_COMPS 3
+
+typedef struct {
+  uint8_t fast_len[1 << HUFF_FAST_BITS];  // 0 when the code is longer
+  uint8_t fast_val[1 << HUFF_FAST_BITS];
+  int32_t maxcode[17];
+  int32_t valptr[17];
+  int32_t mincode[17];
+  uint8_t vals[256];
+  uint16_t code[256];  // encoder side
+  uint8_t size[256];   // 0 if the symbol has no code
+} huff_t;
+
+typedef struct {
+  uint8_t id;
+  uint8_t h;
+  uint8_t v;
+  uint8_t tq;
+  uint8_t td;
+  uint8_t ta;
+  int pred_in;
+  int pred_out;
+} comp_t;
+
+typedef struct {
+  huff_t dc[4];
+  huff_t ac[4];
+  uint16_t qt[4][64];  // zigzag order, as stored
+  comp_t comps[JPEG_MAX_COMPS];
+  uint8_t ncomps;
+  uint8_t scan[JPEG_MAX_COMPS];  // component indexes in scan order
+  uint8_t nscan;
+  uint16_t width;
+  uint16_t height;
+  uint8_t h_max;
+  uint8_t v_max;
+  uint16_t dri;
+  size_t scan_start;
+} jpeg_ctx_t;
+
+typedef struct {
+  const uint8_t *p;
+  const uint8_t *end;
+  uint32_t acc;  // left aligned
+  int n;
+  int zeros;     // zero bytes fed past a marker
+  bool marker;
+} bit_reader_t;
+
+typedef struct {
+  uint8_t *p;
+  uint8_t *end;
+  uint32_t acc;
+  int n;
+  bool overflow;
+} bit_writer_t;
+
+// Large tables, so a single static context; only the capture task rewrites
+static jpeg_ctx_t _ctx;
+
+static const uint8_t _zigzag[64] = {
+  0,  1,  8,  16, 9,  2,  3,  10, 17, 24, 32, 25, 18, 11, 4,  5,  12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13, 6,  7,  14, 21, 28,
+  35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51, 58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63,
+};
+
+static float _dct[8][8];  // _dct[u][x] = C(u) / 2 * cos((2x + 1) u pi / 16)
+
+static inline uint16_t be16(const uint8_t *p) {
+  return (p[0] << 8) | p[1];
+}
+
+static bool huff_build(huff_t *h, const uint8_t *bits, const uint8_t *vals, int nvals) {
+  memset(h->fast_len, 0, sizeof(h->fast_len));
+  memset(h->size, 0, sizeof(h->size));
+  int32_t code = 0;
+  int k = 0;
+  for (int l = 1; l <= 16; l++) {
+    h->valptr[l] = k;
+    h->mincode[l] = code;
+    for (int i = 0; i < bits[l - 1]; i++, k++, code++) {
+      if (k >= nvals || code >= (1 << l)) {
+        return false;
+      }
+      uint8_t sym = vals[k];
+      h->vals[k] = sym;
+      h->code[sym] = code;
+      h->size[sym] = l;
+      if (l <= HUFF_FAST_BITS) {
+        int shift = HUFF_FAST_BITS - l;
+        for (int j = 0; j < (1 << shift); j++) {
+          h->fast_len[(code << shift) | j] = l;
+          h->fast_val[(code << shift) | j] = sym;
+        }
+      }
+    }
+    h->maxcode[l] = bits[l - 1] ? code - 1 : -1;
+    code <<= 1;
+  }
+  return true;
+}
+
+// Parse the headers up to the start of the scan
+static bool jpeg_parse(const uint8_t *in, size_t len, jpeg_ctx_t *c) {
+  if (len < 4 || in[0] != 0xFF || in[1] != 0xD8) {
+    return false;
+  }
+  c->ncomps = 0;
+  c->dri = 0;
+  size_t i = 2;
+  while (i + 4 <= len) {
+    if (in[i] != 0xFF) {
+      return false;
+    }
+    uint8_t m = in[i + 1];
+    if (m == 0xFF) {
+      i++;
+      continue;
+    }
+    size_t seglen = be16(in + i + 2);
+    if (seglen < 2 || i + 2 + seglen > len) {
+      return false;
+    }
+    const uint8_t *s = in + i + 4;
+    size_t n = seglen - 2;
+
+    if (m == 0xDB) {
+      for (size_t o = 0; o < n;) {
+        uint8_t pq = s[o] >> 4, tq = s[o] & 15;
+        o++;
+        if (tq > 3 || o + (pq ? 128 : 64) > n) {
+          return false;
+        }
+        for (int k = 0; k < 64; k++) {
+          c->qt[tq][k] = pq ? be16(s + o + 2 * k) : s[o + k];
+        }
+        o += pq ? 128 : 64;
+      }
+    } else if (m == 0xC0 || m == 0xC1) {
+      if (n < 6 || s[0] != 8) {
+        return false;
+      }
+      c->height = be16(s + 1);
+      c->width = be16(s + 3);
+      c->ncomps = s[5];
+      if ((c->ncomps != 1 && c->ncomps != 3) || n < 6 + 3 * (size_t)c->ncomps) {
+        return false;
+      }
+      c->h_max = c->v_max = 1;
+      for (int k = 0; k < c->ncomps; k++) {
+        comp_t *cp = &c->comps[k];
+        cp->id = s[6 + 3 * k];
+        cp->h = s[7 + 3 * k] >> 4;
+        cp->v = s[7 + 3 * k] & 15;
+        cp->tq = s[8 + 3 * k] & 3;
+        if (cp->h < 1 || cp->h > 4 || cp->v < 1 || cp->v > 4) {
+          return false;
+        }
+        c->h_max = cp->h > c->h_max ? cp->h : c->h_max;
+        c->v_max = cp->v > c->v_max ? cp->v : c->v_max;
+      }
+    } else if (m >= 0xC2 && m <= 0xCF && m != 0xC4 && m != 0xC8 && m != 0xCC) {
+      return false;  // progressive, lossless or arithmetic coding
+    } else if (m == 0xC4) {
+      for (size_t o = 0; o + 17 <= n;) {
+        uint8_t tc = s[o] >> 4, th = s[o] & 15;
+        const uint8_t *bits = s + o + 1;
+        int nvals = 0;
+        for (int k = 0; k < 16; k++) {
+          nvals += bits[k];
+        }
+        if (th > 3 || tc > 1 || nvals > 256 || o + 17 + nvals > n) {
+          return false;
+        }
+        if (!huff_build(tc ? &c->ac[th] : &c->dc[th], bits, s + o + 17, nvals)) {
+          return false;
+        }
+        o += 17 + nvals;
+      }
+    } else if (m == 0xDD) {
+      if (n < 2) {
+        return false;
+      }
+      c->dri = be16(s);
+    } else if (m == 0xDA) {
+      if (!c->ncomps || n < 1) {
+        return false;
+      }
+      c->nscan = s[0];
+      // interleaved scans only (or a single gray component)
+      if (c->nscan != c->ncomps || n < 1 + 2 * (size_t)c->nscan + 3) {
+        return false;
+      }
+      for (int k = 0; k < c->nscan; k++) {
+        int idx = -1;
+        for (int j = 0; j < c->ncomps; j++) {
+          if (c->comps[j].id == s[1 + 2 * k]) {
+            idx = j;
+          }
+        }
+        if (idx < 0) {
+          return false;
+        }
+        c->scan[k] = idx;
+        c->comps[idx].td = (s[2 + 2 * k] >> 4) & 3;
+        c->comps[idx].ta = s[2 + 2 * k] & 3;
+      }
+      c->scan_start = i + 2 + seglen;
+      return true;
+    }
+    i += 2 + seglen;
+  }
+  return false;
+}
+
+bool jpeg_info(const uint8_t *in, size_t len, jpeg_info_t *info) {
+  if (!jpeg_parse(in, len, &_ctx)) {
+    return false;
+  }
+  info->width = _ctx.width;
+  info->height = _ctx.height;
+  info->components = _ctx.ncomps;
+  info->h_max = _ctx.h_max;
+  info->v_max = _ctx.v_max;
+  return true;
+}
+
+static inline void br_fill(bit_reader_t *b) {
+  while (b->n <= 24) {
+    uint32_t c = 0;
+    const uint8_t *p = b->p;
+    if (!b->marker && p < b->end && (p[0] != 0xFF || (p + 1 < b->end && p[1] == 0x00))) {
+      c = *p;
+      b->p += c == 0xFF ? 2 : 1;
+    } else {
+      // stop at the marker and feed zeros
+      b->marker = true;
+      b->zeros++;
+    }
+    b->acc |= c << (24 - b->n);
+    b->n += 8;
+  }
+}
+
+static inline uint32_t br_get(bit_reader_t *b, int s) {
+  if (!s) {
+    return 0;
+  }
+  br_fill(b);
+  uint32_t v = b->acc >> (32 - s);
+  b->acc <<= s;
+  b->n -= s;
+  return v;
+}
+
+// True if the reader consumed bits that were not in the stream
+static inline bool br_overrun(const bit_reader_t *b) {
+  return b->n < b->zeros * 8;
+}
+
+static int br_decode(bit_reader_t *b, const huff_t *h, uint32_t *code, int *len) {
+  br_fill(b);
+  uint32_t look = b->acc >> (32 - HUFF_FAST_BITS);
+  int l = h->fast_len[look];
+  if (l) {
+    *code = look >> (HUFF_FAST_BITS - l);
+    *len = l;
+    b->acc <<= l;
+    b->n -= l;
+    return h->fast_val[look];
+  }
+  for (l = HUFF_FAST_BITS + 1; l <= 16; l++) {
+    int32_t c = b->acc >> (32 - l);
+    if (c <= h->maxcode[l]) {
+      *code = c;
+      *len = l;
+      b->acc <<= l;
+      b->n -= l;
+      return h->vals[h->valptr[l] + c - h->mincode[l]];
+    }
+  }
+  return -1;
+}
+
+// Skip to the restart marker that ends the interval
+static bool br_restart(bit_reader_t *b) {
+  if (br_overrun(b)) {
+    return false;
+  }
+  b->acc = 0;
+  b->n = 0;
+  b->zeros = 0;
+  b->marker = false;
+  while (b->p + 1 < b->end) {
+    if (b->p[0] == 0xFF && b->p[1] >= 0xD0 && b->p[1] <= 0xD7) {
+      b->p += 2;
+      return true;
+    }
+    b->p++;
+  }
+  return false;
+}
+
+static inline void bw_put(bit_writer_t *w, uint32_t bits, int len) {
+  w->acc = (w->acc << len) | (bits & ((1u << len) - 1));
+  w->n += len;
+  while (w->n >= 8) {
+    uint8_t byte = w->acc >> (w->n - 8);
+    w->n -= 8;
+    if (w->p + 2 > w->end) {
+      w->overflow = true;
+      continue;
+    }
+    *w->p++ = byte;
+    if (byte == 0xFF) {
+      *w->p++ = 0x00;
+    }
+  }
+}
+
+static void bw_flush(bit_writer_t *w) {
+  if (w->n) {
+    bw_put(w, 0x7F, 8 - w->n);  // pad with ones
+  }
+}
+
+static void bw_marker(bit_writer_t *w, uint8_t m) {
+  if (w->p + 2 > w->end) {
+    w->overflow = true;
+    return;
+  }
+  *w->p++ = 0xFF;
+  *w->p++ = m;
+}
+
+static inline int extend(uint32_t v, int s) {
+  return s && v < (1u << (s - 1)) ? (int)v - (1 << s) + 1 : (int)v;
+}
+
+// Huffman code for (run << 4 | size of v) followed by the value bits
+static bool put_value(bit_writer_t *w, const huff_t *h, int run, int v) {
+  int a = v < 0 ? -v : v;
+  int s = 0;
+  while (a) {
+    s++;
+    a >>= 1;
+  }
+  int sym = (run << 4) | s;
+  if (!h->size[sym]) {
+    return false;
+  }
+  bw_put(w, h->code[sym], h->size[sym]);
+  if (s) {
+    bw_put(w, v < 0 ? v + (1 << s) - 1 : v, s);
+  }
+  return true;
+}
+
+static void dct_init() {
+  if (_dct[0][0] != 0) {
+    return;
+  }
+  for (int u = 0; u < 8; u++) {
+    for (int x = 0; x < 8; x++) {
+      _dct[u][x] = (u ? 0.5f : 0.35355339f) * cosf((2 * x + 1) * u * (float)M_PI / 16);
+    }
+  }
+}
+
+// Coefficients (zigzag, quantized) to pixels
+static void block_to_pixels(const int16_t *coef, const uint16_t *q, uint8_t *px) {
+  float f[64], t[64];
+  for (int k = 0; k < 64; k++) {
+    f[_zigzag[k]] = coef[k] * q[k];
+  }
+  for (int v = 0; v < 8; v++) {
+    for (int x = 0; x < 8; x++) {
+      float s = 0;
+      for (int u = 0; u < 8; u++) {
+        s += _dct[u][x] * f[v * 8 + u];
+      }
+      t[v * 8 + x] = s;
+    }
+  }
+  for (int y = 0; y < 8; y++) {
+    for (int x = 0; x < 8; x++) {
+      float s = 128.5f;
+      for (int v = 0; v < 8; v++) {
+        s += _dct[v][y] * t[v * 8 + x];
+      }
+      px[y * 8 + x] = s < 0 ? 0 : (s > 255 ? 255 : (uint8_t)s);
+    }
+  }
+}
+
+// Pixels to coefficients (zigzag, quantized)
+static void pixels_to_block(const uint8_t *px, const uint16_t *q, int16_t *coef) {
+  float t[64], f[64];
+  for (int y = 0; y < 8; y++) {
+    for (int u = 0; u < 8; u++) {
+      float s = 0;
+      for (int x = 0; x < 8; x++) {
+        s += _dct[u][x] * (px[y * 8 + x] - 128);
+      }
+      t[y * 8 + u] = s;
+    }
+  }
+  for (int v = 0; v < 8; v++) {
+    for (int u = 0; u < 8; u++) {
+      float s = 0;
+      for (int y = 0; y < 8; y++) {
+        s += _dct[v][y] * t[y * 8 + u];
+      }
+      f[v * 8 + u] = s;
+    }
+  }
+  for (int k = 0; k < 64; k++) {
+    float c = f[_zigzag[k]] / q[k];
+    int r = (int)(c < 0 ? c - 0.5f : c + 0.5f);
+    int lim = k ? 1023 : 2047;
+    coef[k] = r < -lim ? -lim : (r > lim ? lim : r);
+  }
+}
+
+static const jpeg_edit_t *find_edit(const jpeg_edit_t *edits, size_t n, int x, int y, int w, int h) {
+  const jpeg_edit_t *hit = NULL;
+  for (size_t i = 0; i < n; i++) {
+    const jpeg_edit_t *e = &edits[i];
+    if (x < e->x + e->w && e->x < x + w && y < e->y + e->h && e->y < y + h) {
+      // fills (privacy masks) take precedence over drawing
+      if (e->type == JPEG_EDIT_FILL) {
+        return e;
+      }
+      hit = hit ? hit : e;
+    }
+  }
+  return hit;
+}
+
+static bool rewrite_block(
+  jpeg_ctx_t *c, comp_t *cp, bool luma, bit_reader_t *br, bit_writer_t *bw, const jpeg_edit_t *edit, int px, int py
+) {
+  const huff_t *dc = &c->dc[cp->td];
+  const huff_t *ac = &c->ac[cp->ta];
+  uint32_t code;
+  int len;
+
+  int s = br_decode(br, dc, &code, &len);
+  if (s < 0 || s > 11) {
+    return false;
+  }
+  uint32_t raw = br_get(br, s);
+  int diff = extend(raw, s);
+  int dcv = cp->pred_in + diff;
+  cp->pred_in = dcv;
+
+  if (!edit) {
+    // DC is re-coded only when an edited block changed the predictor
+    int out_diff = dcv - cp->pred_out;
+    cp->pred_out = dcv;
+    if (out_diff == diff) {
+      bw_put(bw, code, len);
+      if (s) {
+        bw_put(bw, raw, s);
+      }
+    } else if (!put_value(bw, dc, 0, out_diff)) {
+      return false;
+    }
+    // AC codes are copied bit for bit
+    for (int k = 1; k < 64;) {
+      int sym = br_decode(br, ac, &code, &len);
+      if (sym < 0) {
+        return false;
+      }
+      bw_put(bw, code, len);
+      int r = sym >> 4, sz = sym & 15;
+      if (sz) {
+        bw_put(bw, br_get(br, sz), sz);
+        k += r + 1;
+      } else if (r == 15) {
+        k += 16;
+      } else {
+        break;
+      }
+      if (k > 64) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  int16_t coef[64];
+  memset(coef, 0, sizeof(coef));
+  coef[0] = dcv;
+  for (int k = 1; k < 64;) {
+    int sym = br_decode(br, ac, &code, &len);
+    if (sym < 0) {
+      return false;
+    }
+    int r = sym >> 4, sz = sym & 15;
+    if (sz) {
+      k += r;
+      if (k > 63) {
+        return false;
+      }
+      coef[k++] = extend(br_get(br, sz), sz);
+    } else if (r == 15) {
+      k += 16;
+    } else {
+      break;
+    }
+  }
+
+  const uint16_t *q = c->qt[cp->tq];
+  if (edit->type == JPEG_EDIT_FILL) {
+    int level = luma ? edit->luma : (cp == &c->comps[1] ? edit->cb : edit->cr);
+    int v = (level - 128) * 8;
+    memset(coef, 0, sizeof(coef));
+    coef[0] = (v < 0 ? v - q[0] / 2 : v + q[0] / 2) / (int)q[0];
+  } else if (luma) {
+    uint8_t pixels[64];
+    block_to_pixels(coef, q, pixels);
+    edit->draw(edit->ctx, px, py, pixels);
+    pixels_to_block(pixels, q, coef);
+  } else {
+    memset(coef, 0, sizeof(coef));
+  }
+
+  int out_diff = coef[0] - cp->pred_out;
+  cp->pred_out = coef[0];
+  if (!put_value(bw, dc, 0, out_diff)) {
+    return false;
+  }
+  int run = 0;
+  for (int k = 1; k < 64; k++) {
+    if (!coef[k]) {
+      run++;
+      continue;
+    }
+    for (; run > 15; run -= 16) {
+      if (!put_value(bw, ac, 15, 0)) {
+        return false;
+      }
+    }
+    if (!put_value(bw, ac, run, coef[k])) {
+      return false;
+    }
+    run = 0;
+  }
+  return !run || put_value(bw, ac, 0, 0);
+}
+
+size_t jpeg_rewrite(const uint8_t *in, size_t len, uint8_t *out, size_t cap, const jpeg_edit_t *edits, size_t n_edits) {
+  jpeg_ctx_t *c = &_ctx;
+  if (!jpeg_parse(in, len, c) || c->scan_start > cap) {
+    return 0;
+  }
+  dct_init();
+  memcpy(out, in, c->scan_start);
+
+  bit_reader_t br = {in + c->scan_start, in + len, 0, 0, 0, false};
+  bit_writer_t bw = {out + c->scan_start, out + cap, 0, 0, false};
+  for (int k = 0; k < c->ncomps; k++) {
+    c->comps[k].pred_in = c->comps[k].pred_out = 0;
+  }
+
+  // a single component scan is not interleaved: one block per MCU
+  bool single = c->nscan == 1;
+  int mcu_w = single ? 8 : 8 * c->h_max;
+  int mcu_h = single ? 8 : 8 * c->v_max;
+  int mcus_x = (c->width + mcu_w - 1) / mcu_w;
+  int mcus_y = (c->height + mcu_h - 1) / mcu_h;
+  uint32_t mcu = 0;
+  uint8_t rst = 0;
+
+  for (int my = 0; my < mcus_y; my++) {
+    // rows without any edit skip the rectangle tests
+    const jpeg_edit_t *row_edit = find_edit(edits, n_edits, 0, my * mcu_h, c->width, mcu_h);
+    for (int mx = 0; mx < mcus_x; mx++, mcu++) {
+      if (c->dri && mcu && mcu % c->dri == 0) {
+        if (!br_restart(&br)) {
+          return 0;
+        }
+        bw_flush(&bw);
+        bw_marker(&bw, 0xD0 + rst);
+        rst = (rst + 1) & 7;
+        for (int k = 0; k < c->ncomps; k++) {
+          c->comps[k].pred_in = c->comps[k].pred_out = 0;
+        }
+      }
+      for (int k = 0; k < c->nscan; k++) {
+        comp_t *cp = &c->comps[c->scan[k]];
+        int bh = single ? 1 : cp->h, bv = single ? 1 : cp->v;
+        int sx = single ? 1 : c->h_max / cp->h, sy = single ? 1 : c->v_max / cp->v;
+        for (int by = 0; by < bv; by++) {
+          for (int bx = 0; bx < bh; bx++) {
+            int px = (mx * bh + bx) * 8 * sx, py = (my * bv + by) * 8 * sy;
+            const jpeg_edit_t *e = row_edit ? find_edit(edits, n_edits, px, py, 8 * sx, 8 * sy) : NULL;
+            if (!rewrite_block(c, cp, c->scan[k] == 0, &br, &bw, e, px, py)) {
+              return 0;
+            }
+          }
+        }
+      }
+    }
+  }
+  if (br_overrun(&br)) {
+    return 0;
+  }
+  bw_flush(&bw);
+  bw_marker(&bw, 0xD9);
+  return bw.overflow ? 0 : bw.p - out;
+}
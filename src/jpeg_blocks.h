@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Block-level JPEG rewriting without a full decode.
+//
+// jpeg_rewrite() walks the entropy-coded scan of a baseline Huffman JPEG once
+// and copies it to the output. Blocks outside every edit keep their original
+// Huffman codes (only their DC difference is recomputed); blocks inside an
+// edit are replaced:
+//
+// - JPEG_EDIT_FILL blocks become a constant color (DC only, no AC terms).
+// - JPEG_EDIT_DRAW luma blocks are dequantized and inverse transformed to
+//   pixels, handed to the draw callback, then transformed and quantized back;
+//   chroma blocks in the rectangle are set to neutral gray.
+//
+// The Huffman pass touches every block (codes have no random access), but the
+// pixel work is proportional to the edited area. Edits are in pixels and cover
+// every block they touch. Headers are copied unchanged, so the output decodes
+// with the same quantization and Huffman tables.
+
+typedef enum {
+  JPEG_EDIT_FILL,
+  JPEG_EDIT_DRAW,
+} jpeg_edit_type_t;
+
+// Called for every luma block of a DRAW edit. x, y is the block's top left
+// corner in pixels; pixels holds 8x8 luma values, row major, to modify in place.
+typedef void (*jpeg_draw_fn)(void *ctx, int x, int y, uint8_t *pixels);
+
+typedef struct {
+  jpeg_edit_type_t type;
+  uint16_t x;
+  uint16_t y;
+  uint16_t w;
+  uint16_t h;
+  uint8_t luma;    // FILL color
+  uint8_t cb;
+  uint8_t cr;
+  jpeg_draw_fn draw;
+  void *ctx;
+} jpeg_edit_t;
+
+typedef struct {
+  uint16_t width;
+  uint16_t height;
+  uint8_t components;
+  uint8_t h_max;  // MCU size is 8 * h_max x 8 * v_max
+  uint8_t v_max;
+} jpeg_info_t;
+
+// Frame size and sampling of a baseline JPEG; false if it is not one
+bool jpeg_info(const uint8_t *in, size_t len, jpeg_info_t *info);
+
+// Rewrite in into out (cap bytes). Returns the output length, or 0 if the JPEG
+// is not baseline Huffman, is corrupt, needs a Huffman code its tables do not
+// define, or does not fit in cap.
+size_t jpeg_rewrite(const uint8_t *in, size_t len, uint8_t *out, size_t cap, const jpeg_edit_t *edits, size_t n_edits);
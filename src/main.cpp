@@ -56,8 +56,16 @@ void startCameraServer();
 void setupLedFlash();
 #include "serial_cmds.h"
 #include "ap_mode.h"
+#include "frame_pipe.h"
+#include "rtsp_server.h"
+#include "timelapse.h"
+#include "overlay.h"
+#include "wifi_link.h"
+#include "cam_watchdog.h"
 
 void setup() {
+  // room for a whole binary protocol frame (serial_proto.h) between loop() passes
+  Serial.setRxBufferSize(2048);
   Serial.begin(115200);
   Serial.setDebugOutput(true);
   Serial.println();
@@ -122,67 +130,48 @@ void setup() {
     return;
   }
 
-  sensor_t *s = esp_camera_sensor_get();
-  // initial sensors are flipped vertically and colors are a bit saturated
-  if (s->id.PID == OV3660_PID) {
-    s->set_vflip(s, 1);        // flip it back
-    s->set_brightness(s, 1);   // up the brightness just a bit
-    s->set_saturation(s, -2);  // lower the saturation
-  }
-  // drop down frame size for higher initial frame rate
-  if (config.pixel_format == PIXFORMAT_JPEG) {
-    s->set_framesize(s, FRAMESIZE_QVGA);
-  }
+  // kept for the capture watchdog, which restarts the driver with it
+  cam_watchdog_begin(&config);
+
+  // From here on only the capture task talks to the camera driver, and the
+  // sensor is reached through the watchdog's lock
+  overlay_begin();
+  frame_pipe_begin(config.fb_count);
+  timelapse_begin();
+
+  sensor_t *s = cam_sensor_take();
+  if (s) {
+    // initial sensors are flipped vertically and colors are a bit saturated
+    if (s->id.PID == OV3660_PID) {
+      s->set_vflip(s, 1);        // flip it back
+      s->set_brightness(s, 1);   // up the brightness just a bit
+      s->set_saturation(s, -2);  // lower the saturation
+    }
+    // drop down frame size for higher initial frame rate
+    if (config.pixel_format == PIXFORMAT_JPEG) {
+      s->set_framesize(s, FRAMESIZE_QVGA);
+    }
 
 #if defined(CAMERA_MODEL_M5STACK_WIDE) || defined(CAMERA_MODEL_M5STACK_ESP32CAM)
-  s->set_vflip(s, 1);
-  s->set_hmirror(s, 1);
+    s->set_vflip(s, 1);
+    s->set_hmirror(s, 1);
 #endif
+    cam_sensor_give();
+  }
   // Load credentials from NVS or fallback to secrets
   loadCredentials();
 
   Serial.printf("Using SSID: %s\n", wifi_ssid.c_str());
-  // We don't call connect here from the serial module; do an initial connect
-  WiFi.disconnect(true);
-  WiFi.begin(wifi_ssid.c_str(), wifi_password.c_str());
-  unsigned long start = millis();
-  while (WiFi.status() != WL_CONNECTED && (millis() - start) < 15000) {
-    delay(500);
-    Serial.print('.');
-  }
-  Serial.println();
-  if (WiFi.status() == WL_CONNECTED) {
-    Serial.println("WiFi connected");
-    WiFi.setSleep(false);
-  } else {
-    Serial.println("WiFi connection failed (initial)");
-    // Start AP portal so user can configure WiFi
-    const char *ap_ssid = "CameraPortal";
-    const char *ap_pass = ""; // open AP
-    bool ok = apModeStart(ap_ssid, NULL);
-    if (ok) {
-      Serial.printf("Started AP '%s' at %s - visit http://%s/portal\n", ap_ssid, apModeIP(), apModeIP());
-    } else {
-      Serial.println("Failed to start AP portal");
-    }
-  }
+  // Association runs in the background: the servers start right away and the
+  // address is printed once the station is up (or the AP portal after a timeout)
+  wifi_link_begin(wifi_ssid.c_str(), wifi_password.c_str());
 
   // Initialize serial command module
   serialCmdsBegin();
 
   startCameraServer();
-
-  // Print the address to use depending on whether STA or AP mode is active.
-  String addr;
-  if (WiFi.status() == WL_CONNECTED) {
-    addr = WiFi.localIP().toString();
-  } else {
-    addr = String(apModeIP());
-  }
-
-  Serial.print("Camera Ready! Use 'http://");
-  Serial.print(addr);
-  Serial.println("' to connect");
+  rtsp_server_begin();
+  Serial.printf("Servers started %lu ms after boot\n", (unsigned long)millis());
 }
 
 void loop() {
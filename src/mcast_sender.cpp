@@ -0,0 +1,221 @@
+#include "mcast_sender.h"
+#include <Arduino.h>
+#include "frame_pipe.h"
+#include "lwip/sockets.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+#define MCAST_MAX_FEC   32
+#define MCAST_SEND_RETRIES 5
+
+static TaskHandle_t _task = NULL;
+static SemaphoreHandle_t _exited = NULL;  // given by the task on its way out
+static volatile bool _enabled = false;
+static int _sock = -1;
+static struct sockaddr_in _dest;
+static uint8_t _fec = 0;
+static uint8_t _ttl = 1;
+
+static uint32_t _seq = 0;
+static uint32_t _frames = 0;
+static uint32_t _datagrams = 0;
+static uint32_t _send_errors = 0;
+
+static uint8_t _pkt[sizeof(mcast_hdr_t) + MCAST_PAYLOAD];
+static uint8_t _parity[MCAST_PAYLOAD];
+
+static bool send_datagram(size_t len) {
+  // lwIP runs out of pbufs when the radio falls behind; back off briefly
+  for (int i = 0; i < MCAST_SEND_RETRIES; i++) {
+    if (sendto(_sock, _pkt, len, 0, (struct sockaddr *)&_dest, sizeof(_dest)) == (int)len) {
+      _datagrams++;
+      return true;
+    }
+    if (errno != ENOMEM && errno != EAGAIN) {
+      break;
+    }
+    vTaskDelay(1);
+  }
+  _send_errors++;
+  return false;
+}
+
+static void send_frame(const frame_t *f) {
+  mcast_hdr_t *hdr = (mcast_hdr_t *)_pkt;
+  uint8_t *payload = _pkt + sizeof(mcast_hdr_t);
+  uint16_t count = (f->len + MCAST_PAYLOAD - 1) / MCAST_PAYLOAD;
+  uint8_t fec = _fec;
+
+  hdr->magic = MCAST_MAGIC;
+  hdr->version = MCAST_VERSION;
+  hdr->frame_id = f->seq;
+  hdr->frag_count = count;
+  hdr->fec_group = fec;
+  hdr->frame_len = f->len;
+  hdr->timestamp_us = (uint64_t)f->timestamp.tv_sec * 1000000ULL + f->timestamp.tv_usec;
+
+  size_t parity_len = 0;
+  // a stop request abandons the rest of the frame
+  for (uint16_t i = 0; i < count && _enabled; i++) {
+    size_t off = (size_t)i * MCAST_PAYLOAD;
+    size_t n = f->len - off > MCAST_PAYLOAD ? MCAST_PAYLOAD : f->len - off;
+
+    hdr->flags = 0;
+    hdr->seq = _seq++;
+    hdr->frag = i;
+    hdr->payload_len = n;
+    hdr->offset = off;
+    memcpy(payload, f->buf + off, n);
+    send_datagram(sizeof(mcast_hdr_t) + n);
+
+    if (!fec) {
+      continue;
+    }
+    if (i % fec == 0) {
+      memset(_parity, 0, sizeof(_parity));
+      parity_len = 0;
+    }
+    for (size_t k = 0; k < n; k++) {
+      _parity[k] ^= f->buf[off + k];
+    }
+    if (n > parity_len) {
+      parity_len = n;
+    }
+    // close the group after fec fragments or at the end of the frame
+    if (i % fec == fec - 1 || i == count - 1) {
+      uint16_t group = i / fec;
+      hdr->flags = MCAST_FLAG_PARITY;
+      hdr->seq = _seq++;
+      hdr->frag = group;
+      hdr->payload_len = parity_len;
+      hdr->offset = (uint32_t)group * fec * MCAST_PAYLOAD;
+      memcpy(payload, _parity, parity_len);
+      send_datagram(sizeof(mcast_hdr_t) + parity_len);
+    }
+  }
+  _frames++;
+}
+
+// Owns the socket once started and closes it on the way out
+static void mcast_task(void *arg) {
+  uint32_t last_seq = 0;
+  while (_enabled) {
+    frame_t *f = frame_pipe_acquire(last_seq, 1000);
+    if (!f) {
+      continue;
+    }
+    last_seq = f->seq;
+    send_frame(f);
+    frame_pipe_release(f);
+  }
+  close(_sock);
+  _sock = -1;
+  _task = NULL;
+  xSemaphoreGive(_exited);
+  vTaskDelete(NULL);
+}
+
+bool mcast_sender_start(const char *group, uint16_t port, uint8_t fec, uint8_t ttl) {
+  struct sockaddr_in dest = {};
+  dest.sin_family = AF_INET;
+  dest.sin_port = htons(port);
+  if (inet_pton(AF_INET, group, &dest.sin_addr) != 1 || (ntohl(dest.sin_addr.s_addr) >> 28) != 0xE) {
+    log_e("Multicast: '%s' is not a multicast address", group);
+    return false;
+  }
+  if (fec > MCAST_MAX_FEC) {
+    fec = MCAST_MAX_FEC;
+  }
+
+  mcast_sender_stop();
+  if (!_exited && !(_exited = xSemaphoreCreateBinary())) {
+    return false;
+  }
+  _sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+  if (_sock < 0) {
+    log_e("Multicast: socket failed");
+    return false;
+  }
+  setsockopt(_sock, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl));
+  _dest = dest;
+  _fec = fec;
+  _ttl = ttl;
+
+  _enabled = true;
+  if (xTaskCreatePinnedToCore(mcast_task, "mcast", 3072, NULL, tskIDLE_PRIORITY + 4, &_task, 0) != pdPASS) {
+    log_e("Multicast: failed to start task");
+    _enabled = false;
+    _task = NULL;
+    close(_sock);
+    _sock = -1;
+    return false;
+  }
+  log_i("Multicast: sending to %s:%u, FEC group %u", group, port, fec);
+  return true;
+}
+
+void mcast_sender_stop() {
+  if (!_task) {
+    return;
+  }
+  // the task sees this within one frame wait and closes the socket itself
+  _enabled = false;
+  xSemaphoreTake(_exited, portMAX_DELAY);
+  log_i("Multicast: stopped");
+}
+
+static esp_err_t mcast_handler(httpd_req_t *req) {
+  char query[128] = "";
+  char value[32];
+  httpd_req_get_url_query_str(req, query, sizeof(query));
+
+  if (httpd_query_key_value(query, "enable", value, sizeof(value)) == ESP_OK) {
+    if (atoi(value)) {
+      char group[16] = MCAST_DEFAULT_GROUP;
+      uint16_t port = MCAST_DEFAULT_PORT;
+      uint8_t fec = _fec;
+      uint8_t ttl = _ttl;
+      httpd_query_key_value(query, "group", group, sizeof(group));
+      if (httpd_query_key_value(query, "port", value, sizeof(value)) == ESP_OK) {
+        port = atoi(value);
+      }
+      if (httpd_query_key_value(query, "fec", value, sizeof(value)) == ESP_OK) {
+        fec = atoi(value);
+      }
+      if (httpd_query_key_value(query, "ttl", value, sizeof(value)) == ESP_OK) {
+        ttl = atoi(value);
+      }
+      if (!mcast_sender_start(group, port, fec, ttl)) {
+        return httpd_resp_send_500(req);
+      }
+    } else {
+      mcast_sender_stop();
+    }
+  }
+
+  char group[16];
+  inet_ntop(AF_INET, &_dest.sin_addr, group, sizeof(group));
+  char json[256];
+  int n = snprintf(
+    json, sizeof(json), "{\"enabled\":%d,\"group\":\"%s\",\"port\":%u,\"fec\":%u,\"ttl\":%u,\"frames\":%lu,\"datagrams\":%lu,\"send_errors\":%lu}",
+    _enabled ? 1 : 0, group, ntohs(_dest.sin_port), _fec, _ttl, (unsigned long)_frames, (unsigned long)_datagrams, (unsigned long)_send_errors
+  );
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  return httpd_resp_send(req, json, n);
+}
+
+void mcast_sender_register(httpd_handle_t server) {
+  httpd_uri_t mcast_uri = {
+    .uri = "/mcast",
+    .method = HTTP_GET,
+    .handler = mcast_handler,
+    .user_ctx = NULL
+  };
+  httpd_register_uri_handler(server, &mcast_uri);
+}
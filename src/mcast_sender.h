@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdint.h>
+#include "esp_http_server.h"
+
+// Opt-in UDP multicast distribution of the frame pipe.
+//
+// Each JPEG is split into MCAST_PAYLOAD sized fragments, each sent as one
+// datagram prefixed with mcast_hdr_t. With FEC enabled, every group of `fec`
+// data fragments is followed by one XOR parity datagram, which lets a receiver
+// rebuild any single lost fragment of that group. Any number of LAN clients
+// can join the group for the airtime of one stream; tools/mcast_recv.py is a
+// reference receiver.
+//
+// Controlled with GET /mcast?enable=1&group=239.255.0.1&port=5004&fec=8&ttl=1
+// (all parameters optional); the reply is the current status as JSON.
+
+#define MCAST_MAGIC    0x4D43  // "CM"
+#define MCAST_VERSION  1
+#define MCAST_PAYLOAD  1400
+#define MCAST_FLAG_PARITY 0x01
+
+#define MCAST_SOCKETS 1  // lwIP sockets while sending
+
+#define MCAST_DEFAULT_GROUP "239.255.0.1"
+#define MCAST_DEFAULT_PORT  5004
+
+typedef struct __attribute__((packed)) {
+  uint16_t magic;
+  uint8_t version;
+  uint8_t flags;
+  uint32_t frame_id;      // frame sequence number
+  uint32_t seq;           // datagram sequence number
+  uint16_t frag;          // data fragment index, or FEC group index for parity
+  uint16_t frag_count;    // data fragments in this frame
+  uint16_t fec_group;     // data fragments per parity datagram, 0 = no FEC
+  uint16_t payload_len;   // bytes following the header
+  uint32_t offset;        // byte offset of this fragment in the frame
+  uint32_t frame_len;
+  uint64_t timestamp_us;  // capture timestamp
+} mcast_hdr_t;
+
+// Start sending to group:port. fec is the FEC group size (0 disables parity).
+bool mcast_sender_start(const char *group, uint16_t port, uint8_t fec, uint8_t ttl);
+
+// Returns once the sender task has exited and closed its socket
+void mcast_sender_stop();
+
+// Register GET /mcast
+void mcast_sender_register(httpd_handle_t server);
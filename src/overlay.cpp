@@ -0,0 +1,175 @@
+#include "overlay.h"
+#include <Arduino.h>
+#include <time.h>
+#include "esp_heap_caps.h"
+#include "jpeg_blocks.h"
+#include "privacy_mask.h"
+#include "heap_mon.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+#define OVERLAY_MAX_TEXT 24
+#define OVERLAY_PAD      2  // font pixels around the text
+
+// 8x8 glyphs, one byte per row, most significant bit on the left
+static constexpr char _font_chars[] = "0123456789-:./";
+static constexpr uint8_t _font[][8] = {
+  {0x3C, 0x66, 0x6E, 0x76, 0x66, 0x66, 0x3C, 0x00},  // 0
+  {0x18, 0x38, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x00},  // 1
+  {0x3C, 0x66, 0x06, 0x0C, 0x30, 0x60, 0x7E, 0x00},  // 2
+  {0x3C, 0x66, 0x06, 0x1C, 0x06, 0x66, 0x3C, 0x00},  // 3
+  {0x0C, 0x1C, 0x3C, 0x6C, 0x7E, 0x0C, 0x0C, 0x00},  // 4
+  {0x7E, 0x60, 0x7C, 0x06, 0x06, 0x66, 0x3C, 0x00},  // 5
+  {0x3C, 0x60, 0x7C, 0x66, 0x66, 0x66, 0x3C, 0x00},  // 6
+  {0x7E, 0x06, 0x0C, 0x18, 0x30, 0x30, 0x30, 0x00},  // 7
+  {0x3C, 0x66, 0x66, 0x3C, 0x66, 0x66, 0x3C, 0x00},  // 8
+  {0x3C, 0x66, 0x66, 0x3E, 0x06, 0x0C, 0x38, 0x00},  // 9
+  {0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00},  // -
+  {0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00},  // :
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00},  // .
+  {0x02, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x40, 0x00},  // /
+};
+static_assert(sizeof(_font) / sizeof(_font[0]) == sizeof(_font_chars) - 1, "one glyph per character");
+
+typedef struct {
+  char text[OVERLAY_MAX_TEXT];
+  int len;
+  int x;
+  int y;
+  int scale;
+} overlay_text_t;
+
+static volatile bool _timestamp = OVERLAY_TIMESTAMP;
+
+static const uint8_t *glyph(char c) {
+  for (int i = 0; _font_chars[i]; i++) {
+    if (_font_chars[i] == c) {
+      return _font[i];
+    }
+  }
+  return NULL;  // blank
+}
+
+// jpeg_draw_fn: darken the box, then set the glyph pixels
+static void draw_text(void *ctx, int bx, int by, uint8_t *pixels) {
+  const overlay_text_t *t = (const overlay_text_t *)ctx;
+  int w = (t->len * 8 + 2 * OVERLAY_PAD) * t->scale;
+  int h = (8 + 2 * OVERLAY_PAD) * t->scale;
+  for (int j = 0; j < 8; j++) {
+    int ry = by + j - t->y;
+    for (int i = 0; i < 8; i++) {
+      int rx = bx + i - t->x;
+      if (rx < 0 || ry < 0 || rx >= w || ry >= h) {
+        continue;
+      }
+      uint8_t *p = &pixels[j * 8 + i];
+      *p = *p * 3 / 8;
+      int fx = rx / t->scale - OVERLAY_PAD, fy = ry / t->scale - OVERLAY_PAD;
+      if (fx < 0 || fy < 0 || fy >= 8 || fx >= t->len * 8) {
+        continue;
+      }
+      const uint8_t *g = glyph(t->text[fx / 8]);
+      if (g && (g[fy] & (0x80 >> (fx % 8)))) {
+        *p = 235;
+      }
+    }
+  }
+}
+
+static void format_time(const frame_t *f, overlay_text_t *t) {
+  time_t now = time(NULL);
+  struct tm tm;
+  localtime_r(&now, &tm);
+  if (tm.tm_year + 1900 >= 2021) {
+    t->len = strftime(t->text, sizeof(t->text), "%Y-%m-%d %H:%M:%S", &tm);
+  } else {
+    // clock not set: uptime
+    uint32_t s = f->capture_us / 1000000;
+    t->len = snprintf(t->text, sizeof(t->text), "%lu:%02lu:%02lu", (unsigned long)(s / 3600), (unsigned long)(s / 60 % 60), (unsigned long)(s % 60));
+  }
+}
+
+bool overlay_stage(frame_t *f) {
+  bool masked = privacy_mask_count() > 0;
+  if (!masked && !_timestamp) {
+    return true;
+  }
+  // from here on a masked frame is dropped rather than published unmasked
+  jpeg_info_t info;
+  if (!jpeg_info(f->buf, f->len, &info)) {
+    return !masked;
+  }
+
+  jpeg_edit_t edits[PRIVACY_MASK_MAX_ZONES + 1];
+  size_t n = privacy_mask_edits(info.width, info.height, edits, PRIVACY_MASK_MAX_ZONES);
+  masked = n > 0;
+  // whole MCUs, so no chroma block is shared with the picture
+  int mcu_w = 8 * info.h_max, mcu_h = 8 * info.v_max;
+  for (size_t i = 0; i < n; i++) {
+    jpeg_edit_t *e = &edits[i];
+    int x1 = (e->x + e->w + mcu_w - 1) / mcu_w * mcu_w;
+    int y1 = (e->y + e->h + mcu_h - 1) / mcu_h * mcu_h;
+    e->x = e->x / mcu_w * mcu_w;
+    e->y = e->y / mcu_h * mcu_h;
+    e->w = x1 - e->x;
+    e->h = y1 - e->y;
+  }
+
+  overlay_text_t t;
+  if (_timestamp) {
+    format_time(f, &t);
+    t.scale = info.width / 640 > 1 ? info.width / 640 : 1;
+    t.x = 0;
+    t.y = 0;
+
+    int w = (t.len * 8 + 2 * OVERLAY_PAD) * t.scale;
+    int h = (8 + 2 * OVERLAY_PAD) * t.scale;
+    jpeg_edit_t *edit = &edits[n++];
+    memset(edit, 0, sizeof(*edit));
+    edit->type = JPEG_EDIT_DRAW;
+    edit->w = (w + mcu_w - 1) / mcu_w * mcu_w;
+    edit->h = (h + mcu_h - 1) / mcu_h * mcu_h;
+    edit->draw = draw_text;
+    edit->ctx = &t;
+  }
+
+  // re-encoded blocks may grow a little
+  size_t cap = f->len + f->len / 4 + 4096;
+  uint8_t *out = (uint8_t *)heap_mon_malloc(HEAP_TAG_FRAME, cap, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (!out) {
+    out = (uint8_t *)heap_mon_malloc(HEAP_TAG_FRAME, cap, 0);
+  }
+  if (!out) {
+    return !masked;
+  }
+  size_t len = jpeg_rewrite(f->buf, f->len, out, cap, edits, n);
+  if (!len) {
+    log_w("Overlay: JPEG rewrite failed%s", masked ? ", frame dropped" : "");
+    heap_mon_free(HEAP_TAG_FRAME, out);
+    return !masked;
+  }
+  if (f->fb) {
+    esp_camera_fb_return(f->fb);
+    f->fb = NULL;
+  } else {
+    heap_mon_free(HEAP_TAG_FRAME, f->buf);
+  }
+  f->buf = out;
+  f->len = len;
+  return true;
+}
+
+void overlay_set_timestamp(bool on) {
+  _timestamp = on;
+}
+
+bool overlay_timestamp() {
+  return _timestamp;
+}
+
+void overlay_begin() {
+  privacy_mask_begin();
+  frame_pipe_set_stage(overlay_stage);
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "frame_pipe.h"
+
+// Privacy masks and timestamp overlay, applied in the JPEG domain.
+//
+// The overlay is a frame pipe stage: it rewrites each frame once with
+// jpeg_rewrite(). Mask zones (privacy_mask.h) become flat blocks; the blocks
+// under the text box are decoded to pixels, get the glyphs drawn and are
+// encoded back; every other block keeps its Huffman codes.
+//
+// The text is the local date and time, or the uptime while the clock is not
+// set, drawn white on a darkened box in the top left corner and scaled with
+// the frame width (one font pixel per 640 frame pixels).
+
+#ifndef OVERLAY_TIMESTAMP
+#define OVERLAY_TIMESTAMP 0
+#endif
+
+// Load the mask zones and install the stage in the frame pipe
+void overlay_begin();
+
+void overlay_set_timestamp(bool on);
+bool overlay_timestamp();
+
+// Frame pipe stage (see frame_pipe_set_stage)
+bool overlay_stage(frame_t *f);
@@ -2,21 +2,44 @@
 #include <Preferences.h>
 #include <Arduino.h>
 #include <WiFi.h>
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "wifi_link.h"
+#include "url_form.h"
 
-static String urlDecode(const String &input) {
-  String ret = "";
-  for (size_t i = 0; i < input.length(); ++i) {
-    char c = input.charAt(i);
-    if (c == '+') ret += ' ';
-    else if (c == '%' && i + 2 < input.length()) {
-      char hex[3] = { input.charAt(i+1), input.charAt(i+2), 0 };
-      char val = (char) strtol(hex, NULL, 16);
-      ret += val;
-      i += 2;
-    } else ret += c;
-  }
-  return ret;
-}
+#ifndef PORTAL_FORM_MAX
+#define PORTAL_FORM_MAX 320
+#endif
+#ifndef PORTAL_SCAN_PERIOD_MS
+#define PORTAL_SCAN_PERIOD_MS 30000
+#endif
+#ifndef PORTAL_SCAN_WAIT_MS
+#define PORTAL_SCAN_WAIT_MS 8000
+#endif
+// ?refresh=1 requests parked at once; more get the cached list
+#ifndef PORTAL_SCAN_WAITERS
+#define PORTAL_SCAN_WAITERS 2
+#endif
+#ifndef PORTAL_SCAN_JSON_SIZE
+#define PORTAL_SCAN_JSON_SIZE 2048
+#endif
+
+// Scan cache: the JSON array of the last completed scan. It is rebuilt in the
+// back buffer when a scan finishes and swapped in under _scan_lock, which
+// /portal/scan holds while sending the front buffer.
+static char _scan_buf[2][PORTAL_SCAN_JSON_SIZE] = {"[]", "[]"};
+static size_t _scan_len[2] = {2, 2};
+static uint8_t _scan_front = 0;
+static volatile uint32_t _scan_seq = 0;
+static volatile int64_t _scan_us = 0;
+static volatile bool _scanning = false;
+static SemaphoreHandle_t _scan_lock = NULL;
+static esp_timer_handle_t _scan_timer = NULL;
+static esp_timer_handle_t _wait_timer = NULL;
+static httpd_handle_t _server = NULL;
+// parked ?refresh=1 requests, only touched on the httpd task
+static httpd_req_t *_scan_waiters[PORTAL_SCAN_WAITERS];
 
 static const char *portal_form = R"PORTAL_HTML(<html><head><title>Camera WiFi Portal</title>
 <meta name=viewport content="width=device-width,initial-scale=1">
@@ -29,15 +52,15 @@ SSID:<br><input type=text id=ssid name=ssid size=32><br>
 Password:<br><input type=password id=pass name=pass size=32><br><br>
 <input type=submit value=Save>
 </form>
-<p>After saving, press <a href="/portal/reboot">reboot</a> to apply.</p>
 <script>
-async function scan() {
+async function scan(refresh) {
   document.getElementById('status').innerText = 'scanning...';
   try {
-    const r = await fetch('/portal/scan');
-    const list = await r.json();
+    const r = await fetch('/portal/scan' + (refresh ? '?refresh=1' : ''));
+    const list = (await r.json()).networks;
     const container = document.getElementById('networks');
     container.innerHTML = '';
+    document.getElementById('status').innerText = '';
     if (!list || list.length == 0) { container.innerText = 'No networks found'; return; }
     const ul = document.createElement('ul');
     list.forEach(n => {
@@ -49,13 +72,43 @@ async function scan() {
       li.appendChild(btn); ul.appendChild(li);
     });
     container.appendChild(ul);
-    document.getElementById('status').innerText = '';
   } catch(e) { document.getElementById('status').innerText = 'scan failed'; }
 }
-document.getElementById('scan').addEventListener('click', scan);
+document.getElementById('scan').addEventListener('click', () => scan(true));
+scan(false);
+</script>
+</body></html>)PORTAL_HTML";
+
+static const char *portal_saved = R"PORTAL_HTML(<html><head><title>Camera WiFi Portal</title>
+<meta name=viewport content="width=device-width,initial-scale=1">
+</head><body>
+<h3>Saved. Connecting...</h3>
+<p id=status>waiting for the network</p>
+<p><a href="/portal">Back</a> | <a href="/portal/reboot">Reboot</a></p>
+<script>
+const reasons = {2: 'authentication expired', 15: 'wrong password?', 201: 'network not found', 202: 'authentication failed', 204: 'handshake failed'};
+async function poll() {
+  try {
+    const s = await (await fetch('/portal/status')).json();
+    const el = document.getElementById('status');
+    if (s.state == 'connected') {
+      el.innerHTML = 'Connected. The camera is at <a href="http://' + s.ip + '/">http://' + s.ip + '/</a>';
+      if (s.ap) el.innerHTML += '<br>This access point closes in a few seconds.';
+      return;
+    }
+    el.innerText = s.state + (s.failures ? ', ' + s.failures + ' failed attempts' : '') +
+      (s.failures && reasons[s.reason] ? ' (' + reasons[s.reason] + ')' : '') +
+      (s.state == 'backoff' ? ', retrying in ' + Math.round(s.retry_ms / 1000) + ' s' : '');
+  } catch (e) {}
+  setTimeout(poll, 1000);
+}
+poll();
 </script>
 </body></html>)PORTAL_HTML";
 
+extern String wifi_ssid;
+extern String wifi_password;
+
 static esp_err_t portal_get_handler(httpd_req_t *req) {
   httpd_resp_set_type(req, "text/html");
   return httpd_resp_send(req, portal_form, strlen(portal_form));
@@ -69,50 +122,71 @@ static esp_err_t portal_save_handler(httpd_req_t *req) {
     httpd_resp_send(req, bad, strlen(bad));
     return ESP_FAIL;
   }
-  char *buf = (char *)malloc(total_len + 1);
-  if (!buf) {
-    httpd_resp_send_500(req);
+  // ssid (32 bytes) and pass (64), even fully percent-encoded
+  char buf[PORTAL_FORM_MAX];
+  if (total_len >= (int)sizeof(buf)) {
+    httpd_resp_set_status(req, "413 Payload Too Large");
+    httpd_resp_send(req, NULL, 0);
     return ESP_FAIL;
   }
   int received = 0;
   while (received < total_len) {
     int r = httpd_req_recv(req, buf + received, total_len - received);
     if (r <= 0) {
-      free(buf);
       httpd_resp_send_500(req);
       return ESP_FAIL;
     }
     received += r;
   }
   buf[total_len] = '\0';
-  String body = String(buf);
-  free(buf);
 
-  String ssid = "";
-  String pass = "";
-  int i = body.indexOf("ssid=");
-  if (i >= 0) {
-    int j = body.indexOf('&', i);
-    String v = (j >= 0) ? body.substring(i+5, j) : body.substring(i+5);
-    ssid = urlDecode(v);
+  const char *ssid = "";
+  const char *pass = "";
+  url_form_t form;
+  url_span_t key, val;
+  url_form_init(&form, buf);
+  while (url_form_next(&form, &key, &val)) {
+    if (url_span_eq(&key, "ssid")) {
+      ssid = val.p;
+    } else if (url_span_eq(&key, "pass")) {
+      pass = val.p;
+    }
   }
-  i = body.indexOf("pass=");
-  if (i >= 0) {
-    int j = body.indexOf('&', i);
-    String v = (j >= 0) ? body.substring(i+5, j) : body.substring(i+5);
-    pass = urlDecode(v);
+  if (strlen(ssid) > 32 || strlen(pass) > 64) {
+    httpd_resp_set_status(req, "400 Bad Request");
+    const char *bad = "SSID or password too long";
+    return httpd_resp_send(req, bad, strlen(bad));
   }
 
   Preferences prefs;
   prefs.begin("wifi", false);
-  if (ssid.length() > 0) prefs.putString("ssid", ssid);
-  if (pass.length() > 0) prefs.putString("pass", pass);
+  if (*ssid) prefs.putString("ssid", ssid);
+  if (*pass) prefs.putString("pass", pass);
   prefs.end();
 
-  const char *resp = "<html><body><h3>Saved. Please reboot the device to apply settings.</h3>"
-                     "<p><a href=\"/portal/reboot\">Reboot now</a></p></body></html>";
+  // Try them right away in the background; the AP stays up meanwhile
+  if (*ssid) {
+    wifi_ssid = ssid;
+    if (*pass) wifi_password = pass;
+    wifi_link_begin(wifi_ssid.c_str(), wifi_password.c_str());
+  }
+
   httpd_resp_set_type(req, "text/html");
-  return httpd_resp_send(req, resp, strlen(resp));
+  return httpd_resp_send(req, portal_saved, strlen(portal_saved));
+}
+
+// Progress of the connect started by /portal/save, polled by the page above
+static esp_err_t portal_status_handler(httpd_req_t *req) {
+  wifi_link_stats_t st;
+  wifi_link_get_stats(&st);
+  char json[160];
+  int n = snprintf(json, sizeof(json), "{\"state\":\"%s\",\"ip\":\"%s\",\"failures\":%lu,\"reason\":%u,\"retry_ms\":%lu,\"ap\":%d}",
+                   wifi_link_state_name(st.state), st.state == WIFI_LINK_CONNECTED ? WiFi.localIP().toString().c_str() : "", (unsigned long)st.failures,
+                   st.reason, (unsigned long)st.backoff_ms, st.ap ? 1 : 0);
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+  return httpd_resp_send(req, json, n);
 }
 
 static esp_err_t portal_reboot_handler(httpd_req_t *req) {
@@ -123,26 +197,195 @@ static esp_err_t portal_reboot_handler(httpd_req_t *req) {
   return ESP_OK;
 }
 
-static esp_err_t portal_scan_handler(httpd_req_t *req) {
-  int n = WiFi.scanNetworks();
-  String out = "[";
-  for (int i = 0; i < n; ++i) {
-    String ssid = WiFi.SSID(i);
-    ssid.replace("\"", "\\\"");
-    int rssi = WiFi.RSSI(i);
-    bool secure = WiFi.encryptionType(i) != WIFI_AUTH_OPEN;
-    char buf[256];
-    snprintf(buf, sizeof(buf), "{\"ssid\":\"%s\",\"rssi\":%d,\"secure\":%d}", ssid.c_str(), rssi, secure?1:0);
-    out += buf;
-    if (i < n-1) out += ",";
-  }
-  out += "]";
+static void scan_start() {
+  if (_scanning) {
+    return;
+  }
+  // async: returns at once, ARDUINO_EVENT_WIFI_SCAN_DONE follows
+  _scanning = WiFi.scanNetworks(true) == WIFI_SCAN_RUNNING;
+}
+
+// Append s as a JSON string, or nothing if it does not fit
+static size_t json_string(char *out, size_t cap, const char *s) {
+  size_t n = 0;
+  if (cap < 2) {
+    return 0;
+  }
+  out[n++] = '"';
+  for (; *s; s++) {
+    unsigned char c = *s;
+    if (c == '"' || c == '\\') {
+      if (n + 2 > cap) return 0;
+      out[n++] = '\\';
+      out[n++] = c;
+    } else if (c < 0x20) {
+      if (n + 6 > cap) return 0;
+      n += snprintf(out + n, cap - n, "\\u%04x", c);
+    } else {
+      if (n + 1 > cap) return 0;
+      out[n++] = c;
+    }
+  }
+  if (n + 1 > cap) return 0;
+  out[n++] = '"';
+  return n;
+}
+
+static esp_err_t send_scan(httpd_req_t *req);
+
+// Runs on the httpd task: answer every parked ?refresh=1 request
+static void flush_waiters(void *arg) {
+  esp_timer_stop(_wait_timer);
+  for (int i = 0; i < PORTAL_SCAN_WAITERS; i++) {
+    httpd_req_t *req = _scan_waiters[i];
+    if (req) {
+      _scan_waiters[i] = NULL;
+      send_scan(req);
+      httpd_req_async_handler_complete(req);
+    }
+  }
+}
+
+// Scan done or PORTAL_SCAN_WAIT_MS passed; any task
+static void wake_waiters(void *arg) {
+  if (_server) {
+    httpd_queue_work(_server, flush_waiters, NULL);
+  }
+}
+
+// Take req off the httpd task until the running scan ends. False if every slot
+// is taken, and req must be answered now.
+static bool park_waiter(httpd_req_t *req) {
+  int slot = -1;
+  for (int i = 0; i < PORTAL_SCAN_WAITERS && slot < 0; i++) {
+    if (!_scan_waiters[i]) {
+      slot = i;
+    }
+  }
+  httpd_req_t *copy = NULL;
+  if (slot < 0 || httpd_req_async_handler_begin(req, &copy) != ESP_OK) {
+    return false;
+  }
+  _scan_waiters[slot] = copy;
+  // fails if already armed for an earlier waiter, which then bounds this wait
+  esp_timer_start_once(_wait_timer, (uint64_t)PORTAL_SCAN_WAIT_MS * 1000);
+  return true;
+}
+
+// Runs in the Wi-Fi event task once the results are in
+static void on_scan_done(arduino_event_id_t event, arduino_event_info_t info) {
+  int n = WiFi.scanComplete();
+  if (n >= 0) {
+    uint8_t back = _scan_front ^ 1;
+    char *out = _scan_buf[back];
+    size_t cap = PORTAL_SCAN_JSON_SIZE - 1;  // room for the closing bracket
+    size_t len = 0;
+    out[len++] = '[';
+    for (int i = 0; i < n; i++) {
+      String ssid = WiFi.SSID(i);
+      if (!ssid.length()) {
+        continue;  // hidden network
+      }
+      char entry[256];
+      size_t e = snprintf(entry, sizeof(entry), "%s{\"ssid\":", len > 1 ? "," : "");
+      size_t q = json_string(entry + e, sizeof(entry) - e, ssid.c_str());
+      if (!q) continue;
+      e += q;
+      e += snprintf(entry + e, sizeof(entry) - e, ",\"rssi\":%d,\"secure\":%d}", (int)WiFi.RSSI(i), WiFi.encryptionType(i) != WIFI_AUTH_OPEN ? 1 : 0);
+      if (e >= sizeof(entry) || len + e > cap) {
+        break;  // strongest first, drop the tail
+      }
+      memcpy(out + len, entry, e);
+      len += e;
+    }
+    out[len++] = ']';
+    WiFi.scanDelete();
+
+    xSemaphoreTake(_scan_lock, portMAX_DELAY);
+    _scan_len[back] = len;
+    _scan_front = back;
+    _scan_us = esp_timer_get_time();
+    _scan_seq++;
+    xSemaphoreGive(_scan_lock);
+  }
+  _scanning = false;
+  wake_waiters(NULL);
+}
+
+static void on_scan_timer(void *arg) {
+  scan_start();
+}
+
+void portal_scan_begin() {
+  if (_scan_timer) {
+    esp_timer_stop(_scan_timer);
+    esp_timer_start_periodic(_scan_timer, (uint64_t)PORTAL_SCAN_PERIOD_MS * 1000);
+  }
+  scan_start();
+}
+
+void portal_scan_end() {
+  if (_scan_timer) {
+    esp_timer_stop(_scan_timer);
+  }
+}
+
+static esp_err_t send_scan(httpd_req_t *req) {
   httpd_resp_set_type(req, "application/json");
   httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-  return httpd_resp_send(req, out.c_str(), out.length());
+  xSemaphoreTake(_scan_lock, portMAX_DELAY);
+  char head[80];
+  int n = snprintf(head, sizeof(head), "{\"age_ms\":%ld,\"scanning\":%d,\"networks\":", _scan_us ? (long)((esp_timer_get_time() - _scan_us) / 1000) : -1L,
+                   _scanning ? 1 : 0);
+  esp_err_t res = httpd_resp_send_chunk(req, head, n);
+  if (res == ESP_OK) {
+    res = httpd_resp_send_chunk(req, _scan_buf[_scan_front], _scan_len[_scan_front]);
+  }
+  xSemaphoreGive(_scan_lock);
+  if (res == ESP_OK) {
+    res = httpd_resp_send_chunk(req, "}", 1);
+  }
+  if (res == ESP_OK) {
+    res = httpd_resp_send_chunk(req, NULL, 0);
+  }
+  return res;
+}
+
+// Cached results at once; ?refresh=1 answers when a new scan is in (up to
+// PORTAL_SCAN_WAIT_MS), parked as an async request so the server's only task
+// keeps serving /portal/status and the rest meanwhile
+static esp_err_t portal_scan_handler(httpd_req_t *req) {
+  char query[32] = "";
+  char value[4] = "";
+  bool refresh = httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK && httpd_query_key_value(query, "refresh", value, sizeof(value)) == ESP_OK
+                 && atoi(value);
+  int64_t age_us = esp_timer_get_time() - _scan_us;
+  if (refresh) {
+    scan_start();
+    if (_scanning && park_waiter(req)) {
+      return ESP_OK;
+    }
+  } else if (!_scan_us || age_us > (int64_t)PORTAL_SCAN_PERIOD_MS * 1000) {
+    // stale: answer now, the next request gets the new list
+    scan_start();
+  }
+  return send_scan(req);
 }
 
 void portal_register(httpd_handle_t server) {
+  if (!_scan_lock) {
+    _scan_lock = xSemaphoreCreateMutex();
+    esp_timer_create_args_t args = {};
+    args.callback = on_scan_timer;
+    args.name = "portal_scan";
+    esp_timer_create(&args, &_scan_timer);
+    args.callback = wake_waiters;
+    args.name = "portal_wait";
+    esp_timer_create(&args, &_wait_timer);
+    WiFi.onEvent(on_scan_done, ARDUINO_EVENT_WIFI_SCAN_DONE);
+  }
+  _server = server;
+
   httpd_uri_t portal_uri = {
     .uri = "/portal",
     .method = HTTP_GET,
@@ -167,6 +410,14 @@ void portal_register(httpd_handle_t server) {
   };
   httpd_register_uri_handler(server, &portal_scan_uri);
 
+  httpd_uri_t portal_status_uri = {
+    .uri = "/portal/status",
+    .method = HTTP_GET,
+    .handler = portal_status_handler,
+    .user_ctx = NULL
+  };
+  httpd_register_uri_handler(server, &portal_status_uri);
+
   httpd_uri_t portal_reboot_uri = {
     .uri = "/portal/reboot",
     .method = HTTP_GET,
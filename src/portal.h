@@ -4,3 +4,8 @@
 
 // Register the portal endpoints on an existing httpd server handle
 void portal_register(httpd_handle_t server);
+
+// Scan for networks in the background now and every PORTAL_SCAN_PERIOD_MS
+// until portal_scan_end(); /portal/scan answers from the cached results
+void portal_scan_begin();
+void portal_scan_end();
@@ -0,0 +1,497 @@
+#include "prerecord.h"
+#include <Arduino.h>
+#include <time.h>
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "soc/soc_caps.h"
+#include "frame_pipe.h"
+#include "avi_writer.h"
+#include "heap_mon.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#if SOC_SDMMC_HOST_SUPPORTED
+#include "SD_MMC.h"
+#endif
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+#define NO_PIN UINT32_MAX
+#define WRITER_IDLE_US 2000000  // stop a clip when no frame arrives for this long
+
+typedef struct {
+  uint32_t offset;
+  uint32_t len;
+  int64_t ts_us;
+  uint16_t width;
+  uint16_t height;
+} ring_entry_t;
+
+static const record_storage_t *_storage = NULL;
+static TaskHandle_t _feeder = NULL;
+static TaskHandle_t _writer = NULL;
+static volatile bool _running = false;
+static portMUX_TYPE _lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Ring of frame data; entries [_first, _next) are buffered (absolute indices,
+// slot = index % PRERECORD_MAX_FRAMES). _pin is the first entry the writer has
+// not stored yet; it and everything after it cannot be evicted.
+static uint8_t *_ring = NULL;
+static size_t _size = 0;
+static ring_entry_t *_idx = NULL;
+static uint32_t _first = 0;
+static uint32_t _next = 0;
+static size_t _wpos = 0;
+static uint32_t _pin = NO_PIN;
+static int64_t _pre_us = 0;
+
+static uint8_t *_stage = NULL;  // AVI write buffer
+
+static volatile int64_t _rec_end_us = 0;  // 0 when not recording
+static uint32_t _post_s = PRERECORD_POST_S;
+static uint32_t _clips = 0;
+static uint32_t _clip_frames = 0;
+static uint32_t _dropped = 0;
+static uint32_t _write_errors = 0;
+static char _last_clip[32] = "";
+
+static bool _motion = false;
+static uint32_t _motion_avg = 0;
+static size_t _motion_width = 0;
+static uint8_t _motion_hits = 0;
+static uint32_t _motion_events = 0;
+static volatile bool _gpio_hit = false;
+
+#if SOC_SDMMC_HOST_SUPPORTED
+static File _file;
+
+bool record_sd_mount() {
+  static bool mounted = false;
+  if (!mounted) {
+    if (PRERECORD_SD_CLK >= 0) {
+      SD_MMC.setPins(PRERECORD_SD_CLK, PRERECORD_SD_CMD, PRERECORD_SD_D0);
+    }
+    mounted = SD_MMC.begin("/sdcard", true);
+    if (!mounted) {
+      log_e("SD card mount failed");
+    }
+  }
+  return mounted;
+}
+
+static bool sd_open(const char *name) {
+  if (!record_sd_mount()) {
+    return false;
+  }
+  _file = SD_MMC.open(name, FILE_WRITE);
+  return (bool)_file;
+}
+
+static size_t sd_write(const uint8_t *data, size_t len) {
+  return _file.write(data, len);
+}
+
+static bool sd_seek(size_t pos) {
+  return _file.seek(pos);
+}
+
+static void sd_close() {
+  _file.close();
+}
+#else
+bool record_sd_mount() {
+  return false;
+}
+
+static bool sd_open(const char *name) {
+  log_e("Prerecord: no SD_MMC host on this target");
+  return false;
+}
+static size_t sd_write(const uint8_t *data, size_t len) {
+  return 0;
+}
+static bool sd_seek(size_t pos) {
+  return false;
+}
+static void sd_close() {}
+#endif
+
+const record_storage_t record_storage_sd = {sd_open, sd_write, sd_seek, sd_close};
+
+static inline int64_t tv_us(const struct timeval &tv) {
+  return (int64_t)tv.tv_sec * 1000000LL + tv.tv_usec;
+}
+
+// Reserve len contiguous bytes, evicting old entries the writer no longer
+// needs. Returns the offset, or SIZE_MAX if the frame has to be dropped.
+static size_t ring_reserve(size_t len, int64_t ts) {
+  size_t pos = SIZE_MAX;
+  portENTER_CRITICAL(&_lock);
+  while (_first != _next && _first < _pin && ts - _idx[_first % PRERECORD_MAX_FRAMES].ts_us > _pre_us) {
+    _first++;
+  }
+  while (true) {
+    if (_first == _next) {
+      pos = 0;
+      break;
+    }
+    if (_next - _first < PRERECORD_MAX_FRAMES) {
+      size_t rpos = _idx[_first % PRERECORD_MAX_FRAMES].offset;
+      if (_wpos >= rpos) {
+        if (_size - _wpos >= len) {
+          pos = _wpos;
+          break;
+        }
+        if (len < rpos) {
+          pos = 0;
+          break;
+        }
+      } else if (_wpos + len < rpos) {
+        pos = _wpos;
+        break;
+      }
+    }
+    if (_first >= _pin) {
+      break;
+    }
+    _first++;
+  }
+  portEXIT_CRITICAL(&_lock);
+  return pos;
+}
+
+static void ring_push(const uint8_t *buf, size_t len, int64_t ts, size_t width, size_t height) {
+  size_t pos = len <= _size ? ring_reserve(len, ts) : SIZE_MAX;
+  if (pos == SIZE_MAX) {
+    _dropped++;
+    return;
+  }
+  memcpy(_ring + pos, buf, len);
+  portENTER_CRITICAL(&_lock);
+  _idx[_next % PRERECORD_MAX_FRAMES] = {(uint32_t)pos, (uint32_t)len, ts, (uint16_t)width, (uint16_t)height};
+  _next++;
+  _wpos = pos + len;
+  portEXIT_CRITICAL(&_lock);
+}
+
+static void motion_check(size_t len, size_t width) {
+  if (!_motion) {
+    return;
+  }
+  if (width != _motion_width || !_motion_avg) {
+    _motion_width = width;
+    _motion_avg = len;
+    _motion_hits = 0;
+    return;
+  }
+  uint32_t diff = (uint32_t)abs((int)len - (int)_motion_avg) * 100 / _motion_avg;
+  _motion_avg = (_motion_avg * 7 + len) / 8;
+  // two frames in a row so a single noisy frame does not fire
+  if (diff < PRERECORD_MOTION_PCT) {
+    _motion_hits = 0;
+  } else if (++_motion_hits == 2) {
+    _motion_events++;
+    prerecord_trigger(_post_s);
+  }
+}
+
+static void IRAM_ATTR gpio_isr() {
+  _gpio_hit = true;
+}
+
+static void feeder_task(void *arg) {
+  uint32_t last_seq = 0;
+  while (_running) {
+    if (_gpio_hit) {
+      _gpio_hit = false;
+      prerecord_trigger(_post_s);
+    }
+    frame_t *f = frame_pipe_acquire(last_seq, 1000);
+    if (!f) {
+      continue;
+    }
+    last_seq = f->seq;
+    ring_push(f->buf, f->len, tv_us(f->timestamp), f->width, f->height);
+    motion_check(f->len, f->width);
+    frame_pipe_release(f);
+  }
+  _feeder = NULL;
+  vTaskDelete(NULL);
+}
+
+static size_t storage_write(void *ctx, const uint8_t *data, size_t len) {
+  return _storage->write(data, len);
+}
+
+static bool storage_seek(void *ctx, uint64_t pos) {
+  return _storage->seek(pos);
+}
+
+static void clip_name(char *name, size_t size) {
+  time_t now = time(NULL);
+  struct tm tm;
+  if (now > 1600000000 && localtime_r(&now, &tm)) {
+    strftime(name, size, "/clip_%Y%m%d_%H%M%S.avi", &tm);
+  } else {
+    snprintf(name, size, "/clip_%08lu.avi", (unsigned long)millis());
+  }
+}
+
+// Nominal frame rate of the buffered frames, in frames per 1000 s. The AVI
+// header is patched with the real rate when the clip is closed.
+static uint32_t ring_fps_milli() {
+  uint32_t fps = 0;
+  portENTER_CRITICAL(&_lock);
+  if (_next - _first > 1) {
+    int64_t span = _idx[(_next - 1) % PRERECORD_MAX_FRAMES].ts_us - _idx[_first % PRERECORD_MAX_FRAMES].ts_us;
+    if (span > 0) {
+      fps = (uint32_t)((uint64_t)(_next - _first - 1) * 1000000000ULL / span);
+    }
+  }
+  portEXIT_CRITICAL(&_lock);
+  return fps;
+}
+
+// The clip stopped at stopped_at: end it, unless a trigger has moved its end
+// past that meanwhile. Checked and cleared under the lock, so a trigger either
+// extends this clip or sees it over and starts the next one.
+static bool clip_over(int64_t stopped_at) {
+  portENTER_CRITICAL(&_lock);
+  bool over = _rec_end_us < stopped_at;
+  if (over) {
+    _pin = NO_PIN;
+    _rec_end_us = 0;
+  }
+  portEXIT_CRITICAL(&_lock);
+  return over;
+}
+
+static void record_clip() {
+  char name[sizeof(_last_clip)];
+  clip_name(name, sizeof(name));
+  if (!_storage->open(name)) {
+    log_e("Prerecord: cannot create %s", name);
+    _rec_end_us = 0;
+    return;
+  }
+  log_i("Prerecord: recording %s", name);
+
+  static avi_writer_t avi;
+  avi_sink_t sink = {storage_write, _storage->seek ? storage_seek : NULL, NULL};
+  bool started = false;
+  bool ok = true;
+  bool over = false;
+  _clip_frames = 0;
+  int64_t idle_since = esp_timer_get_time();
+  while (ok && _running) {
+    ring_entry_t e;
+    bool have = false;
+    portENTER_CRITICAL(&_lock);
+    if (_pin < _next) {
+      e = _idx[_pin % PRERECORD_MAX_FRAMES];
+      have = true;
+    }
+    portEXIT_CRITICAL(&_lock);
+
+    if (!have) {
+      int64_t now = esp_timer_get_time();
+      if (now - idle_since > WRITER_IDLE_US) {
+        break;
+      }
+      if (now > _rec_end_us && clip_over(now)) {
+        over = true;
+        break;
+      }
+      vTaskDelay(pdMS_TO_TICKS(20));
+      continue;
+    }
+    if (e.ts_us > _rec_end_us && clip_over(e.ts_us)) {
+      over = true;
+      break;
+    }
+    idle_since = esp_timer_get_time();
+    if (!started) {
+      started = true;
+      ok = avi_writer_begin(&avi, &sink, e.width, e.height, ring_fps_milli(), _stage, PRERECORD_WRITE_BLOCK, PRERECORD_CLIP_FRAMES);
+    }
+    // the entry is pinned, so its data stays put while the muxer copies it out
+    ok = ok && avi_writer_add_frame(&avi, _ring + e.offset, e.len, e.ts_us);
+    _clip_frames++;
+    portENTER_CRITICAL(&_lock);
+    _pin++;
+    portEXIT_CRITICAL(&_lock);
+  }
+  if (started) {
+    ok = avi_writer_end(&avi) && ok;
+  }
+  _storage->close();
+
+  if (!over) {
+    portENTER_CRITICAL(&_lock);
+    _pin = NO_PIN;
+    _rec_end_us = 0;
+    portEXIT_CRITICAL(&_lock);
+  }
+
+  if (!ok) {
+    _write_errors++;
+    log_e("Prerecord: write failed, %s is truncated", name);
+  }
+  strcpy(_last_clip, name);
+  _clips++;
+  log_i("Prerecord: %s done, %lu frames", name, (unsigned long)_clip_frames);
+}
+
+static void writer_task(void *arg) {
+  while (_running) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(500));
+    if (_rec_end_us) {
+      record_clip();
+    }
+  }
+  _writer = NULL;
+  vTaskDelete(NULL);
+}
+
+void prerecord_trigger(uint32_t post_s) {
+  if (!_running) {
+    return;
+  }
+  int64_t end = esp_timer_get_time() + (int64_t)post_s * 1000000LL;
+  bool start;
+  portENTER_CRITICAL(&_lock);
+  start = !_rec_end_us;
+  if (start) {
+    _pin = _first;
+  }
+  if (end > _rec_end_us) {
+    _rec_end_us = end;
+  }
+  portEXIT_CRITICAL(&_lock);
+  if (start) {
+    xTaskNotifyGive(_writer);
+  }
+}
+
+bool prerecord_begin(uint32_t pre_s, size_t budget, const record_storage_t *storage) {
+  if (_running) {
+    return true;
+  }
+  _ring = (uint8_t *)heap_mon_malloc(HEAP_TAG_PRERECORD, budget, MALLOC_CAP_SPIRAM);
+  _idx = (ring_entry_t *)heap_mon_malloc(HEAP_TAG_PRERECORD, PRERECORD_MAX_FRAMES * sizeof(ring_entry_t), MALLOC_CAP_SPIRAM);
+  // storage DMA cannot read PSRAM directly, so stage in internal RAM
+  _stage = (uint8_t *)heap_mon_malloc(HEAP_TAG_PRERECORD, PRERECORD_WRITE_BLOCK, MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
+  if (!_ring || !_idx || !_stage) {
+    log_e("Prerecord: cannot allocate %u byte buffer", (unsigned)budget);
+    prerecord_end();
+    return false;
+  }
+  _size = budget;
+  _storage = storage;
+  _pre_us = (int64_t)pre_s * 1000000LL;
+  _first = _next = 0;
+  _wpos = 0;
+  _pin = NO_PIN;
+  _rec_end_us = 0;
+  _running = true;
+
+  if (xTaskCreatePinnedToCore(feeder_task, "prerec", 3072, NULL, tskIDLE_PRIORITY + 4, &_feeder, 0) != pdPASS
+      || xTaskCreatePinnedToCore(writer_task, "prerec_wr", 4096, NULL, tskIDLE_PRIORITY + 2, &_writer, FRAME_PIPE_CORE) != pdPASS) {
+    log_e("Prerecord: failed to start tasks");
+    prerecord_end();
+    return false;
+  }
+#if PRERECORD_TRIGGER_GPIO >= 0
+  pinMode(PRERECORD_TRIGGER_GPIO, INPUT_PULLUP);
+  attachInterrupt(digitalPinToInterrupt(PRERECORD_TRIGGER_GPIO), gpio_isr, FALLING);
+#endif
+  log_i("Prerecord: %lus / %u KB pre-event buffer", (unsigned long)pre_s, (unsigned)(budget / 1024));
+  return true;
+}
+
+void prerecord_end() {
+#if PRERECORD_TRIGGER_GPIO >= 0
+  if (_running) {
+    detachInterrupt(digitalPinToInterrupt(PRERECORD_TRIGGER_GPIO));
+  }
+#endif
+  _running = false;
+  while (_feeder || _writer) {
+    vTaskDelay(pdMS_TO_TICKS(10));
+  }
+  heap_mon_free(HEAP_TAG_PRERECORD, _ring);
+  heap_mon_free(HEAP_TAG_PRERECORD, _idx);
+  heap_mon_free(HEAP_TAG_PRERECORD, _stage);
+  _ring = NULL;
+  _idx = NULL;
+  _stage = NULL;
+  _size = 0;
+}
+
+static esp_err_t record_handler(httpd_req_t *req) {
+  char query[128] = "";
+  char value[16];
+  httpd_req_get_url_query_str(req, query, sizeof(query));
+
+  if (httpd_query_key_value(query, "post", value, sizeof(value)) == ESP_OK) {
+    _post_s = atoi(value);
+  }
+  if (httpd_query_key_value(query, "motion", value, sizeof(value)) == ESP_OK) {
+    _motion = atoi(value);
+    _motion_avg = 0;
+  }
+  if (httpd_query_key_value(query, "enable", value, sizeof(value)) == ESP_OK) {
+    if (atoi(value)) {
+      uint32_t pre = PRERECORD_PRE_S;
+      char pre_value[16];
+      if (httpd_query_key_value(query, "pre", pre_value, sizeof(pre_value)) == ESP_OK) {
+        pre = atoi(pre_value);
+      }
+      if (!prerecord_begin(pre)) {
+        return httpd_resp_send_500(req);
+      }
+    } else {
+      prerecord_end();
+    }
+  }
+  if (httpd_query_key_value(query, "trigger", value, sizeof(value)) == ESP_OK && atoi(value)) {
+    prerecord_trigger(_post_s);
+  }
+
+  uint32_t frames = 0;
+  size_t bytes = 0;
+  int64_t span = 0;
+  portENTER_CRITICAL(&_lock);
+  if (_running && _next != _first) {
+    const ring_entry_t &a = _idx[_first % PRERECORD_MAX_FRAMES];
+    const ring_entry_t &b = _idx[(_next - 1) % PRERECORD_MAX_FRAMES];
+    frames = _next - _first;
+    bytes = b.offset + b.len >= a.offset ? b.offset + b.len - a.offset : _size - a.offset + b.offset + b.len;
+    span = b.ts_us - a.ts_us;
+  }
+  portEXIT_CRITICAL(&_lock);
+
+  char json[384];
+  int n = snprintf(
+    json, sizeof(json),
+    "{\"enabled\":%d,\"frames\":%lu,\"buffered_ms\":%lu,\"bytes\":%u,\"budget\":%u,\"recording\":%d,\"post\":%lu,\"clips\":%lu,"
+    "\"clip_frames\":%lu,\"dropped\":%lu,\"write_errors\":%lu,\"last_clip\":\"%s\",\"motion\":%d,\"motion_events\":%lu}",
+    _running ? 1 : 0, (unsigned long)frames, (unsigned long)(span / 1000), (unsigned)bytes, (unsigned)_size, _rec_end_us ? 1 : 0,
+    (unsigned long)_post_s, (unsigned long)_clips, (unsigned long)_clip_frames, (unsigned long)_dropped, (unsigned long)_write_errors,
+    _last_clip, _motion ? 1 : 0, (unsigned long)_motion_events
+  );
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  return httpd_resp_send(req, json, n);
+}
+
+void prerecord_register(httpd_handle_t server) {
+  httpd_uri_t record_uri = {
+    .uri = "/record",
+    .method = HTTP_GET,
+    .handler = record_handler,
+    .user_ctx = NULL
+  };
+  httpd_register_uri_handler(server, &record_uri);
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_http_server.h"
+
+// Pre-event recording.
+//
+// A consumer task copies every frame from the pipe into a circular buffer in
+// PSRAM, keeping the last `pre` seconds (bounded by the memory budget). When
+// triggered, a writer task flushes the buffered frames and then keeps recording
+// for `post` seconds into one AVI clip on the storage backend. The writer
+// stages data in a fixed buffer and issues large sequential writes; frames it
+// has not written yet are never evicted, so if storage falls behind new frames
+// are dropped from the clip instead of stalling the live stream.
+//
+// Triggers: GET /record?trigger=1, a GPIO going low (PRERECORD_TRIGGER_GPIO),
+// or the motion heuristic (a jump in JPEG size against its running average).
+
+#ifndef PRERECORD_BUDGET
+#define PRERECORD_BUDGET (2 * 1024 * 1024)
+#endif
+#ifndef PRERECORD_PRE_S
+#define PRERECORD_PRE_S 10
+#endif
+#ifndef PRERECORD_POST_S
+#define PRERECORD_POST_S 10
+#endif
+#ifndef PRERECORD_MAX_FRAMES
+#define PRERECORD_MAX_FRAMES 512
+#endif
+#ifndef PRERECORD_WRITE_BLOCK
+#define PRERECORD_WRITE_BLOCK (32 * 1024)
+#endif
+// Frames per AVI RIFF index; longer clips continue in OpenDML AVIX RIFFs
+#ifndef PRERECORD_CLIP_FRAMES
+#define PRERECORD_CLIP_FRAMES 9000
+#endif
+#ifndef PRERECORD_TRIGGER_GPIO
+#define PRERECORD_TRIGGER_GPIO -1
+#endif
+// JPEG size change, in percent of the running average, that counts as motion
+#ifndef PRERECORD_MOTION_PCT
+#define PRERECORD_MOTION_PCT 15
+#endif
+
+// SD card pins (1-bit SD_MMC); -1 keeps the default slot pins
+#if defined(CAMERA_MODEL_ESP32S3_EYE)
+#define PRERECORD_SD_CLK 39
+#define PRERECORD_SD_CMD 38
+#define PRERECORD_SD_D0  40
+#endif
+#ifndef PRERECORD_SD_CLK
+#define PRERECORD_SD_CLK -1
+#define PRERECORD_SD_CMD -1
+#define PRERECORD_SD_D0  -1
+#endif
+
+// Storage backend for clips. write() returns the number of bytes written,
+// seek() positions the next write (returns false when unsupported).
+typedef struct {
+  bool (*open)(const char *name);
+  size_t (*write)(const uint8_t *data, size_t len);
+  bool (*seek)(size_t pos);
+  void (*close)();
+} record_storage_t;
+
+// Clips on the SD card (SD_MMC, 1-bit mode)
+extern const record_storage_t record_storage_sd;
+
+// Mount the SD card on first use; other recorders open their files on SD_MMC
+bool record_sd_mount();
+
+// Allocate the ring buffer and start buffering. Returns false if PSRAM or the
+// storage backend is not available.
+bool prerecord_begin(uint32_t pre_s = PRERECORD_PRE_S, size_t budget = PRERECORD_BUDGET, const record_storage_t *storage = &record_storage_sd);
+
+void prerecord_end();
+
+// Record the buffered frames plus post_s seconds. Triggering while a clip is
+// being written extends it.
+void prerecord_trigger(uint32_t post_s = PRERECORD_POST_S);
+
+// Register GET /record (enable, trigger, motion and status)
+void prerecord_register(httpd_handle_t server);
@@ -0,0 +1,171 @@
+#include "privacy_mask.h"
+#include <Arduino.h>
+#include <Preferences.h>
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+static mask_zone_t _zones[PRIVACY_MASK_MAX_ZONES];
+static size_t _count = 0;
+static portMUX_TYPE _lock = portMUX_INITIALIZER_UNLOCKED;
+
+static void save_zones() {
+  mask_zone_t zones[PRIVACY_MASK_MAX_ZONES];
+  portENTER_CRITICAL(&_lock);
+  size_t n = _count;
+  memcpy(zones, _zones, n * sizeof(mask_zone_t));
+  portEXIT_CRITICAL(&_lock);
+
+  Preferences prefs;
+  prefs.begin("mask", false);
+  if (n) {
+    prefs.putBytes("zones", zones, n * sizeof(mask_zone_t));
+  } else {
+    prefs.remove("zones");
+  }
+  prefs.end();
+}
+
+void privacy_mask_begin() {
+  mask_zone_t zones[PRIVACY_MASK_MAX_ZONES];
+  Preferences prefs;
+  prefs.begin("mask", true);
+  size_t len = prefs.getBytes("zones", zones, sizeof(zones));
+  prefs.end();
+
+  portENTER_CRITICAL(&_lock);
+  _count = len / sizeof(mask_zone_t);
+  memcpy(_zones, zones, _count * sizeof(mask_zone_t));
+  portEXIT_CRITICAL(&_lock);
+  if (_count) {
+    log_i("Privacy mask: %u zones", (unsigned)_count);
+  }
+}
+
+bool privacy_mask_add(const mask_zone_t *zone) {
+  if (zone->x >= 1000 || zone->y >= 1000 || !zone->w || !zone->h) {
+    return false;
+  }
+  mask_zone_t z = *zone;
+  z.w = z.x + z.w > 1000 ? 1000 - z.x : z.w;
+  z.h = z.y + z.h > 1000 ? 1000 - z.y : z.h;
+
+  bool added = false;
+  portENTER_CRITICAL(&_lock);
+  if (_count < PRIVACY_MASK_MAX_ZONES) {
+    _zones[_count++] = z;
+    added = true;
+  }
+  portEXIT_CRITICAL(&_lock);
+  if (added) {
+    save_zones();
+  }
+  return added;
+}
+
+bool privacy_mask_remove(size_t i) {
+  bool removed = false;
+  portENTER_CRITICAL(&_lock);
+  if (i < _count) {
+    memmove(&_zones[i], &_zones[i + 1], (_count - i - 1) * sizeof(mask_zone_t));
+    _count--;
+    removed = true;
+  }
+  portEXIT_CRITICAL(&_lock);
+  if (removed) {
+    save_zones();
+  }
+  return removed;
+}
+
+void privacy_mask_clear() {
+  portENTER_CRITICAL(&_lock);
+  _count = 0;
+  portEXIT_CRITICAL(&_lock);
+  save_zones();
+}
+
+size_t privacy_mask_count() {
+  return _count;
+}
+
+size_t privacy_mask_edits(uint16_t width, uint16_t height, jpeg_edit_t *out, size_t max) {
+  mask_zone_t zones[PRIVACY_MASK_MAX_ZONES];
+  portENTER_CRITICAL(&_lock);
+  size_t n = _count < max ? _count : max;
+  memcpy(zones, _zones, n * sizeof(mask_zone_t));
+  portEXIT_CRITICAL(&_lock);
+
+  for (size_t i = 0; i < n; i++) {
+    // round outwards: a partly covered pixel is masked
+    uint32_t x0 = (uint32_t)zones[i].x * width / 1000;
+    uint32_t y0 = (uint32_t)zones[i].y * height / 1000;
+    uint32_t x1 = ((uint32_t)(zones[i].x + zones[i].w) * width + 999) / 1000;
+    uint32_t y1 = ((uint32_t)(zones[i].y + zones[i].h) * height + 999) / 1000;
+    memset(&out[i], 0, sizeof(jpeg_edit_t));
+    out[i].type = JPEG_EDIT_FILL;
+    out[i].x = x0;
+    out[i].y = y0;
+    out[i].w = x1 - x0;
+    out[i].h = y1 - y0;
+    out[i].luma = 0;
+    out[i].cb = 128;
+    out[i].cr = 128;
+  }
+  return n;
+}
+
+static esp_err_t mask_handler(httpd_req_t *req) {
+  char query[128] = "";
+  char value[32];
+  httpd_req_get_url_query_str(req, query, sizeof(query));
+
+  if (httpd_query_key_value(query, "clear", value, sizeof(value)) == ESP_OK && atoi(value)) {
+    privacy_mask_clear();
+  }
+  if (httpd_query_key_value(query, "del", value, sizeof(value)) == ESP_OK && !privacy_mask_remove(atoi(value))) {
+    return httpd_resp_send_404(req);
+  }
+  if (httpd_query_key_value(query, "add", value, sizeof(value)) == ESP_OK) {
+    unsigned x, y, w, h;
+    if (sscanf(value, "%u,%u,%u,%u", &x, &y, &w, &h) != 4 || x >= 1000 || y >= 1000 || !w || !h || w > 1000 || h > 1000) {
+      return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "add=x,y,w,h in thousandths, x and y below 1000, w and h above 0");
+    }
+    mask_zone_t z = {(uint16_t)x, (uint16_t)y, (uint16_t)w, (uint16_t)h};
+    if (!privacy_mask_add(&z)) {
+      // the zone is valid, so the table is full
+      httpd_resp_set_status(req, "409 Conflict");
+      httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+      return httpd_resp_sendstr(req, "Zone table full");
+    }
+  }
+
+  mask_zone_t zones[PRIVACY_MASK_MAX_ZONES];
+  portENTER_CRITICAL(&_lock);
+  size_t n = _count;
+  memcpy(zones, _zones, n * sizeof(mask_zone_t));
+  portEXIT_CRITICAL(&_lock);
+
+  char json[64 + PRIVACY_MASK_MAX_ZONES * 48];
+  int len = snprintf(json, sizeof(json), "{\"max\":%u,\"zones\":[", PRIVACY_MASK_MAX_ZONES);
+  for (size_t i = 0; i < n; i++) {
+    len += snprintf(
+      json + len, sizeof(json) - len, "%s{\"x\":%u,\"y\":%u,\"w\":%u,\"h\":%u}", i ? "," : "", zones[i].x, zones[i].y, zones[i].w, zones[i].h
+    );
+  }
+  len += snprintf(json + len, sizeof(json) - len, "]}");
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  return httpd_resp_send(req, json, len);
+}
+
+void privacy_mask_register(httpd_handle_t server) {
+  httpd_uri_t mask_uri = {
+    .uri = "/mask",
+    .method = HTTP_GET,
+    .handler = mask_handler,
+    .user_ctx = NULL
+  };
+  httpd_register_uri_handler(server, &mask_uri);
+}
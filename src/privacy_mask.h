@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_http_server.h"
+#include "jpeg_blocks.h"
+
+// Privacy mask zones.
+//
+// Rectangles blanked out of every frame before it leaves the device. The frame
+// pipe stage (overlay_stage) turns them into JPEG_EDIT_FILL edits, so the
+// covered blocks are replaced by flat blocks in the entropy stream without a
+// decode. Since the stage runs once per frame in the capture task, /capture,
+// /stream, recordings and every other consumer get the same masked frame; a
+// frame that cannot be masked is dropped, never sent as is.
+//
+// Zones are in thousandths of the frame size, so they survive framesize
+// changes, and are rounded outwards to whole MCUs (16x16 pixels at 4:2:0).
+// They persist in NVS.
+//
+//   GET /mask?add=100,200,250,300   (x,y,w,h)
+//   GET /mask?del=0
+//   GET /mask?clear=1
+
+#ifndef PRIVACY_MASK_MAX_ZONES
+#define PRIVACY_MASK_MAX_ZONES 8
+#endif
+
+typedef struct {
+  uint16_t x;  // 0..1000
+  uint16_t y;
+  uint16_t w;
+  uint16_t h;
+} mask_zone_t;
+
+// Load the zones from NVS
+void privacy_mask_begin();
+
+bool privacy_mask_add(const mask_zone_t *zone);
+bool privacy_mask_remove(size_t i);
+void privacy_mask_clear();
+size_t privacy_mask_count();
+
+// Fill edits for a width x height frame; returns the number written to out
+size_t privacy_mask_edits(uint16_t width, uint16_t height, jpeg_edit_t *out, size_t max);
+
+// Register GET /mask (edit and list zones as JSON)
+void privacy_mask_register(httpd_handle_t server);
@@ -0,0 +1,571 @@
+#include "rtsp_server.h"
+#include <Arduino.h>
+#include "esp_timer.h"
+#include "frame_pipe.h"
+#include "lwip/sockets.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+#define RTSP_REQ_MAX           1024
+#define RTSP_RESP_MAX          1024
+#define RTSP_SESSION_TIMEOUT_S 60
+#define RTSP_UDP_BASE_PORT     6970
+#define RTSP_TASK_STACK        6144
+#define RTSP_TASK_PRIORITY     (tskIDLE_PRIORITY + 5)
+
+#define RTP_MAX_PACKET 1400
+#define RTP_PT_JPEG    26
+#define RTP_CLOCK_HZ   90000
+
+typedef struct {
+  const uint8_t *scan;  // entropy coded data, markers stripped
+  size_t scan_len;
+  const uint8_t *qt[2];  // luma / chroma tables, 64 bytes each in zigzag order
+  uint16_t width;
+  uint16_t height;
+  uint8_t type;  // RFC 2435 type: 0 = 4:2:2, 1 = 4:2:0, +64 with restart markers
+  uint16_t dri;
+} jpeg_info_t;
+
+typedef struct {
+  bool used;
+  int index;
+  int sock;
+  int udp;  // -1 for TCP interleaved
+  struct sockaddr_in rtp_peer;
+  uint8_t channel;  // interleaved RTP channel
+  bool playing;
+  bool closing;
+  uint16_t seq;
+  uint32_t ssrc;
+  uint32_t id;
+  char req[RTSP_REQ_MAX];
+  size_t req_len;
+  uint8_t pkt[4 + RTP_MAX_PACKET];  // room for the interleaved '$' header
+} rtsp_session_t;
+
+static rtsp_session_t _sessions[RTSP_MAX_SESSIONS];
+static portMUX_TYPE _lock = portMUX_INITIALIZER_UNLOCKED;
+static int _listen_sock = -1;
+
+// Locate tables, geometry and scan data of a baseline JPEG. Only what RFC 2435
+// can describe is accepted: 8-bit tables, 3 components, 4:2:2 or 4:2:0.
+static bool jpeg_parse(const uint8_t *buf, size_t len, jpeg_info_t *info) {
+  memset(info, 0, sizeof(*info));
+  if (len < 4 || buf[0] != 0xFF || buf[1] != 0xD8) {
+    return false;
+  }
+  size_t i = 2;
+  while (i + 4 <= len) {
+    if (buf[i] != 0xFF) {
+      return false;
+    }
+    uint8_t marker = buf[i + 1];
+    if (marker == 0xFF) {  // fill byte
+      i++;
+      continue;
+    }
+    size_t seglen = (buf[i + 2] << 8) | buf[i + 3];
+    if (seglen < 2 || i + 2 + seglen > len) {
+      return false;
+    }
+    const uint8_t *seg = buf + i + 4;
+    size_t slen = seglen - 2;
+
+    if (marker == 0xDB) {  // DQT
+      for (size_t off = 0; off + 65 <= slen; off += 65) {
+        if (seg[off] >> 4) {
+          return false;  // 16-bit tables
+        }
+        uint8_t id = seg[off] & 0x0F;
+        if (id < 2) {
+          info->qt[id] = seg + off + 1;
+        }
+      }
+    } else if (marker == 0xC0) {  // SOF0
+      if (slen < 15 || seg[5] != 3) {
+        return false;
+      }
+      info->height = (seg[1] << 8) | seg[2];
+      info->width = (seg[3] << 8) | seg[4];
+      if (seg[7] == 0x21) {
+        info->type = 0;
+      } else if (seg[7] == 0x22) {
+        info->type = 1;
+      } else {
+        return false;
+      }
+      if (seg[10] != 0x11 || seg[13] != 0x11) {
+        return false;
+      }
+    } else if (marker >= 0xC1 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC) {
+      return false;  // progressive, lossless, arithmetic...
+    } else if (marker == 0xDD && slen >= 2) {  // DRI
+      info->dri = (seg[0] << 8) | seg[1];
+    } else if (marker == 0xDA) {  // SOS
+      info->scan = buf + i + 2 + seglen;
+      // frames can carry padding after EOI
+      size_t end = len;
+      while (end >= 2 && !(buf[end - 2] == 0xFF && buf[end - 1] == 0xD9)) {
+        end--;
+      }
+      if (end < 2 || buf + end - 2 < info->scan) {
+        return false;
+      }
+      info->scan_len = buf + end - 2 - info->scan;
+      if (info->dri) {
+        info->type += 64;
+      }
+      return info->qt[0] && info->qt[1] && info->width && info->height && info->width <= 2040 && info->height <= 2040;
+    }
+    i += 2 + seglen;
+  }
+  return false;
+}
+
+static bool send_all(int sock, const uint8_t *data, size_t len) {
+  while (len) {
+    int n = send(sock, data, len, 0);
+    if (n <= 0) {
+      return false;
+    }
+    data += n;
+    len -= n;
+  }
+  return true;
+}
+
+static bool rtp_send(rtsp_session_t *s, size_t len) {
+  if (s->udp >= 0) {
+    return sendto(s->udp, s->pkt + 4, len, 0, (struct sockaddr *)&s->rtp_peer, sizeof(s->rtp_peer)) == (int)len;
+  }
+  s->pkt[0] = '$';
+  s->pkt[1] = s->channel;
+  s->pkt[2] = len >> 8;
+  s->pkt[3] = len & 0xFF;
+  return send_all(s->sock, s->pkt, len + 4);
+}
+
+// RFC 2435 packetization of one frame
+static bool rtp_send_jpeg(rtsp_session_t *s, const jpeg_info_t *j, uint32_t ts) {
+  size_t off = 0;
+  while (off < j->scan_len) {
+    uint8_t *p = s->pkt + 4;
+    p[0] = 0x80;
+    p[1] = RTP_PT_JPEG;
+    p[2] = s->seq >> 8;
+    p[3] = s->seq & 0xFF;
+    p[4] = ts >> 24;
+    p[5] = ts >> 16;
+    p[6] = ts >> 8;
+    p[7] = ts;
+    p[8] = s->ssrc >> 24;
+    p[9] = s->ssrc >> 16;
+    p[10] = s->ssrc >> 8;
+    p[11] = s->ssrc;
+    s->seq++;
+
+    // main JPEG header
+    p[12] = 0;
+    p[13] = off >> 16;
+    p[14] = off >> 8;
+    p[15] = off;
+    p[16] = j->type;
+    p[17] = 255;  // tables in band
+    p[18] = j->width / 8;
+    p[19] = j->height / 8;
+    size_t hlen = 20;
+
+    if (j->dri) {
+      // packets do not follow restart intervals: F = L = 1, count = 0x3FFF
+      p[hlen++] = j->dri >> 8;
+      p[hlen++] = j->dri & 0xFF;
+      p[hlen++] = 0xFF;
+      p[hlen++] = 0xFF;
+    }
+    if (off == 0) {
+      p[hlen++] = 0;  // MBZ
+      p[hlen++] = 0;  // precision: 8-bit
+      p[hlen++] = 0;
+      p[hlen++] = 128;
+      memcpy(p + hlen, j->qt[0], 64);
+      memcpy(p + hlen + 64, j->qt[1], 64);
+      hlen += 128;
+    }
+
+    size_t n = j->scan_len - off;
+    if (n > RTP_MAX_PACKET - hlen) {
+      n = RTP_MAX_PACKET - hlen;
+    }
+    memcpy(p + hlen, j->scan + off, n);
+    off += n;
+    if (off == j->scan_len) {
+      p[1] |= 0x80;  // marker: last packet of the frame
+    }
+    if (!rtp_send(s, hlen + n)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Case-insensitive header lookup; copies the trimmed value
+static bool header_value(const char *req, const char *name, char *out, size_t n) {
+  size_t nlen = strlen(name);
+  const char *line = strstr(req, "\r\n");
+  while (line && line[2] != '\r') {
+    line += 2;
+    if (!strncasecmp(line, name, nlen) && line[nlen] == ':') {
+      const char *v = line + nlen + 1;
+      while (*v == ' ') {
+        v++;
+      }
+      size_t l = strcspn(v, "\r\n");
+      if (l >= n) {
+        l = n - 1;
+      }
+      memcpy(out, v, l);
+      out[l] = 0;
+      return true;
+    }
+    line = strstr(line, "\r\n");
+  }
+  return false;
+}
+
+static void respond(rtsp_session_t *s, int cseq, const char *status, const char *extra, const char *body) {
+  char resp[RTSP_RESP_MAX];
+  size_t blen = body ? strlen(body) : 0;
+  int n = snprintf(resp, sizeof(resp), "RTSP/1.0 %s\r\nCSeq: %d\r\n%s", status, cseq, extra ? extra : "");
+  if (blen) {
+    n += snprintf(resp + n, sizeof(resp) - n, "Content-Length: %u\r\n", (unsigned)blen);
+  }
+  n += snprintf(resp + n, sizeof(resp) - n, "\r\n%s", body ? body : "");
+  if (n >= (int)sizeof(resp)) {
+    n = sizeof(resp) - 1;
+  }
+  if (!send_all(s->sock, (const uint8_t *)resp, n)) {
+    s->closing = true;
+  }
+}
+
+static void handle_describe(rtsp_session_t *s, int cseq, const char *url) {
+  struct sockaddr_in local;
+  socklen_t alen = sizeof(local);
+  getsockname(s->sock, (struct sockaddr *)&local, &alen);
+  char ip[16];
+  inet_ntop(AF_INET, &local.sin_addr, ip, sizeof(ip));
+
+  char sdp[256];
+  snprintf(
+    sdp, sizeof(sdp),
+    "v=0\r\no=- %lu 1 IN IP4 %s\r\ns=ESP32 Camera\r\nc=IN IP4 0.0.0.0\r\nt=0 0\r\n"
+    "m=video 0 RTP/AVP %d\r\na=rtpmap:%d JPEG/%d\r\na=control:track1\r\n",
+    (unsigned long)s->id, ip, RTP_PT_JPEG, RTP_PT_JPEG, RTP_CLOCK_HZ
+  );
+  char extra[192];
+  snprintf(extra, sizeof(extra), "Content-Base: %s%s\r\nContent-Type: application/sdp\r\n", url, url[strlen(url) - 1] == '/' ? "" : "/");
+  respond(s, cseq, "200 OK", extra, sdp);
+}
+
+static void handle_setup(rtsp_session_t *s, int cseq) {
+  char transport[128];
+  char extra[256];
+  if (!header_value(s->req, "Transport", transport, sizeof(transport))) {
+    respond(s, cseq, "461 Unsupported Transport", NULL, NULL);
+    return;
+  }
+
+  if (strstr(transport, "RTP/AVP/TCP")) {
+    int a = 0, b = 1;
+    const char *il = strstr(transport, "interleaved=");
+    if (il) {
+      sscanf(il + 12, "%d-%d", &a, &b);
+    }
+    s->channel = a;
+    snprintf(extra, sizeof(extra), "Transport: RTP/AVP/TCP;unicast;interleaved=%d-%d;ssrc=%08lX\r\nSession: %08lX;timeout=%d\r\n", a, b,
+             (unsigned long)s->ssrc, (unsigned long)s->id, RTSP_SESSION_TIMEOUT_S);
+    respond(s, cseq, "200 OK", extra, NULL);
+    return;
+  }
+
+  const char *cp = strstr(transport, "client_port=");
+  int rtp_port = 0, rtcp_port = 0;
+  if (!cp || sscanf(cp + 12, "%d-%d", &rtp_port, &rtcp_port) < 1) {
+    respond(s, cseq, "461 Unsupported Transport", NULL, NULL);
+    return;
+  }
+  if (!rtcp_port) {
+    rtcp_port = rtp_port + 1;
+  }
+
+  if (s->udp < 0) {
+    s->udp = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    struct sockaddr_in local = {};
+    local.sin_family = AF_INET;
+    local.sin_port = htons(RTSP_UDP_BASE_PORT + 2 * s->index);
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (s->udp < 0 || bind(s->udp, (struct sockaddr *)&local, sizeof(local)) < 0) {
+      log_e("RTSP: UDP socket failed");
+      if (s->udp >= 0) {
+        close(s->udp);
+        s->udp = -1;
+      }
+      respond(s, cseq, "500 Internal Server Error", NULL, NULL);
+      return;
+    }
+  }
+  socklen_t alen = sizeof(s->rtp_peer);
+  getpeername(s->sock, (struct sockaddr *)&s->rtp_peer, &alen);
+  s->rtp_peer.sin_port = htons(rtp_port);
+
+  snprintf(extra, sizeof(extra), "Transport: RTP/AVP;unicast;client_port=%d-%d;server_port=%d-%d;ssrc=%08lX\r\nSession: %08lX;timeout=%d\r\n", rtp_port,
+           rtcp_port, RTSP_UDP_BASE_PORT + 2 * s->index, RTSP_UDP_BASE_PORT + 2 * s->index + 1, (unsigned long)s->ssrc, (unsigned long)s->id,
+           RTSP_SESSION_TIMEOUT_S);
+  respond(s, cseq, "200 OK", extra, NULL);
+}
+
+static void handle_request(rtsp_session_t *s) {
+  char method[16] = {0};
+  char url[128] = {0};
+  char value[32];
+  // method and URL from the request line alone
+  sscanf(s->req, "%15[^ \r\n]%*[ ]%127[^ \r\n]", method, url);
+  int cseq = header_value(s->req, "CSeq", value, sizeof(value)) ? atoi(value) : 0;
+  char session_hdr[48];
+  snprintf(session_hdr, sizeof(session_hdr), "Session: %08lX\r\n", (unsigned long)s->id);
+  log_i("RTSP: %s %s", method, url);
+
+  if (!url[0]) {
+    respond(s, cseq, "400 Bad Request", NULL, NULL);
+  } else if (!strcmp(method, "OPTIONS")) {
+    respond(s, cseq, "200 OK", "Public: OPTIONS, DESCRIBE, SETUP, PLAY, TEARDOWN, GET_PARAMETER\r\n", NULL);
+  } else if (!strcmp(method, "DESCRIBE")) {
+    handle_describe(s, cseq, url);
+  } else if (!strcmp(method, "SETUP")) {
+    handle_setup(s, cseq);
+  } else if (!strcmp(method, "PLAY")) {
+    char extra[96];
+    snprintf(extra, sizeof(extra), "%sRange: npt=0.000-\r\n", session_hdr);
+    respond(s, cseq, "200 OK", extra, NULL);
+    s->playing = true;
+  } else if (!strcmp(method, "GET_PARAMETER")) {
+    respond(s, cseq, "200 OK", session_hdr, NULL);
+  } else if (!strcmp(method, "TEARDOWN")) {
+    respond(s, cseq, "200 OK", session_hdr, NULL);
+    s->closing = true;
+  } else {
+    respond(s, cseq, "405 Method Not Allowed", NULL, NULL);
+  }
+}
+
+// Consume complete requests (and interleaved RTCP packets) from the buffer
+static void process_input(rtsp_session_t *s) {
+  while (s->req_len && !s->closing) {
+    if (s->req[0] == '$') {
+      if (s->req_len < 4) {
+        return;
+      }
+      size_t plen = 4 + (((uint8_t)s->req[2] << 8) | (uint8_t)s->req[3]);
+      if (plen > sizeof(s->req)) {
+        s->closing = true;
+        return;
+      }
+      if (s->req_len < plen) {
+        return;
+      }
+      memmove(s->req, s->req + plen, s->req_len - plen);
+      s->req_len -= plen;
+      continue;
+    }
+    s->req[s->req_len] = 0;
+    char *end = strstr(s->req, "\r\n\r\n");
+    if (!end) {
+      if (s->req_len >= sizeof(s->req) - 1) {
+        log_w("RTSP: request too long");
+        s->closing = true;
+      }
+      return;
+    }
+    size_t used = end + 4 - s->req;
+    char clen[12];
+    if (header_value(s->req, "Content-Length", clen, sizeof(clen))) {
+      used += atoi(clen);
+      if (used > s->req_len) {
+        return;
+      }
+    }
+    *end = 0;
+    handle_request(s);
+    memmove(s->req, s->req + used, s->req_len - used);
+    s->req_len -= used;
+  }
+}
+
+// Read whatever is pending, waiting at most timeout_ms. Returns false when the
+// peer went away.
+static bool read_input(rtsp_session_t *s, int timeout_ms) {
+  fd_set rfds;
+  FD_ZERO(&rfds);
+  FD_SET(s->sock, &rfds);
+  struct timeval tv = {timeout_ms / 1000, (timeout_ms % 1000) * 1000};
+  int r = select(s->sock + 1, &rfds, NULL, NULL, &tv);
+  if (r < 0) {
+    return false;
+  }
+  if (r == 0) {
+    return true;
+  }
+  int n = recv(s->sock, s->req + s->req_len, sizeof(s->req) - 1 - s->req_len, 0);
+  if (n <= 0) {
+    return false;
+  }
+  s->req_len += n;
+  return true;
+}
+
+static void session_task(void *arg) {
+  rtsp_session_t *s = (rtsp_session_t *)arg;
+  uint32_t last_seq = 0;
+  int64_t last_input = esp_timer_get_time();
+  uint32_t frames = 0;
+
+  while (!s->closing) {
+    size_t before = s->req_len;
+    if (!read_input(s, s->playing ? 0 : 1000)) {
+      break;
+    }
+    if (s->req_len != before) {
+      last_input = esp_timer_get_time();
+    }
+    process_input(s);
+
+    // TCP sessions fail on send once the client is gone; idle and UDP sessions
+    // must keep themselves alive with RTSP requests (e.g. GET_PARAMETER)
+    if ((!s->playing || s->udp >= 0) && esp_timer_get_time() - last_input > RTSP_SESSION_TIMEOUT_S * 1000000LL) {
+      log_i("RTSP: session %08lX timed out", (unsigned long)s->id);
+      break;
+    }
+    if (!s->playing || s->closing) {
+      continue;
+    }
+
+    frame_t *f = frame_pipe_acquire(last_seq, 1000);
+    if (!f) {
+      continue;
+    }
+    last_seq = f->seq;
+    jpeg_info_t j;
+    bool ok = true;
+    if (jpeg_parse(f->buf, f->len, &j)) {
+      ok = rtp_send_jpeg(s, &j, (uint32_t)(f->capture_us * (RTP_CLOCK_HZ / 1000) / 1000));
+      frames++;
+    } else if (!frames) {
+      log_w("RTSP: frame %lu cannot be sent as RFC 2435", (unsigned long)f->seq);
+    }
+    frame_pipe_release(f);
+    if (!ok) {
+      log_i("RTSP: send failed, closing session");
+      break;
+    }
+  }
+
+  log_i("RTSP: session %08lX closed after %lu frames", (unsigned long)s->id, (unsigned long)frames);
+  close(s->sock);
+  if (s->udp >= 0) {
+    close(s->udp);
+  }
+  portENTER_CRITICAL(&_lock);
+  s->used = false;
+  portEXIT_CRITICAL(&_lock);
+  vTaskDelete(NULL);
+}
+
+static rtsp_session_t *session_alloc() {
+  rtsp_session_t *s = NULL;
+  portENTER_CRITICAL(&_lock);
+  for (int i = 0; i < RTSP_MAX_SESSIONS; i++) {
+    if (!_sessions[i].used) {
+      s = &_sessions[i];
+      s->used = true;
+      s->index = i;
+      break;
+    }
+  }
+  portEXIT_CRITICAL(&_lock);
+  return s;
+}
+
+static void listen_task(void *arg) {
+  while (true) {
+    struct sockaddr_in peer;
+    socklen_t alen = sizeof(peer);
+    int sock = accept(_listen_sock, (struct sockaddr *)&peer, &alen);
+    if (sock < 0) {
+      vTaskDelay(pdMS_TO_TICKS(100));
+      continue;
+    }
+    rtsp_session_t *s = session_alloc();
+    if (!s) {
+      const char *busy = "RTSP/1.0 453 Not Enough Bandwidth\r\n\r\n";
+      send(sock, busy, strlen(busy), 0);
+      close(sock);
+      continue;
+    }
+
+    int one = 1;
+    setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    struct timeval tv = {3, 0};
+    setsockopt(sock, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+
+    s->sock = sock;
+    s->udp = -1;
+    s->channel = 0;
+    s->playing = false;
+    s->closing = false;
+    s->req_len = 0;
+    s->seq = (uint16_t)esp_random();
+    s->ssrc = esp_random();
+    s->id = esp_random();
+    if (xTaskCreatePinnedToCore(session_task, "rtsp_session", RTSP_TASK_STACK, s, RTSP_TASK_PRIORITY, NULL, 0) != pdPASS) {
+      log_e("RTSP: failed to start session task");
+      close(sock);
+      s->used = false;
+    }
+  }
+}
+
+bool rtsp_server_begin(uint16_t port) {
+  if (_listen_sock >= 0) {
+    return true;
+  }
+  int sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if (sock < 0) {
+    log_e("RTSP: socket failed");
+    return false;
+  }
+  int one = 1;
+  setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  struct sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(sock, RTSP_MAX_SESSIONS) < 0) {
+    log_e("RTSP: cannot listen on port %u", port);
+    close(sock);
+    return false;
+  }
+  _listen_sock = sock;
+  if (xTaskCreatePinnedToCore(listen_task, "rtsp", 3072, NULL, RTSP_TASK_PRIORITY, NULL, 0) != pdPASS) {
+    log_e("RTSP: failed to start listener task");
+    close(sock);
+    _listen_sock = -1;
+    return false;
+  }
+  log_i("Starting RTSP server on port: '%u'", port);
+  return true;
+}
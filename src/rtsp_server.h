@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stdint.h>
+
+// Minimal RTSP server (RFC 2326) streaming the frame pipe as RTP/JPEG
+// (RFC 2435, payload type 26).
+//
+// Supports OPTIONS, DESCRIBE, SETUP, PLAY, GET_PARAMETER and TEARDOWN with
+// either TCP interleaved or UDP unicast transport. JPEG frames are split at the
+// scan data: markers are stripped and the quantization tables are carried in
+// the RTP/JPEG quantization table header (Q = 255), so receivers rebuild the
+// JFIF headers themselves.
+//
+//   ffplay -rtsp_transport tcp rtsp://<ip>:8554/
+//   ffplay rtsp://<ip>:8554/
+
+#ifndef RTSP_PORT
+#define RTSP_PORT 8554
+#endif
+// One session by default so the lwIP socket budget (see startCameraServer)
+// fits the stock CONFIG_LWIP_MAX_SOCKETS of 16
+#ifndef RTSP_MAX_SESSIONS
+#define RTSP_MAX_SESSIONS 1
+#endif
+// Listener, plus a TCP socket and a UDP socket (UDP transport) per session
+#define RTSP_MAX_SOCKETS (1 + 2 * RTSP_MAX_SESSIONS)
+
+// Start the listener task. Returns false if the socket or task could not be
+// created.
+bool rtsp_server_begin(uint16_t port = RTSP_PORT);
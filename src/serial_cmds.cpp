@@ -1,128 +1,40 @@
 #include "serial_cmds.h"
-#include "esp_camera.h"
-#include <WiFi.h>
-#include <Preferences.h>
+#include "cmd_registry.h"
+#include "serial_proto.h"
 
-extern String wifi_ssid;
-extern String wifi_password;
-extern Preferences prefs;
+#ifndef SERIAL_CMDS_LINE_MAX
+#define SERIAL_CMDS_LINE_MAX 256
+#endif
 
-static String incoming = "";
+static char incoming[SERIAL_CMDS_LINE_MAX + 1];
+static size_t incoming_len = 0;
 
-void serialCmdsBegin() {
-  // nothing to init currently
+static void serial_write(void *ctx, const char *s, size_t len) {
+  Serial.write((const uint8_t *)s, len);
 }
 
-static void saveCredentials() {
-  prefs.begin("wifi", false);
-  prefs.putString("ssid", wifi_ssid);
-  prefs.putString("pass", wifi_password);
-  prefs.end();
-  Serial.println("Credentials saved to NVS");
-}
-
-static void eraseCredentials() {
-  prefs.begin("wifi", false);
-  prefs.remove("ssid");
-  prefs.remove("pass");
-  prefs.end();
-  Serial.println("Credentials removed from NVS");
-}
+static const cmd_out_t serial_out = {serial_write, NULL};
 
-static bool connectWiFi(unsigned long timeoutMs = 15000) {
-  Serial.printf("Connecting to WiFi '%s'...\n", wifi_ssid.c_str());
-  WiFi.disconnect(true);
-  WiFi.begin(wifi_ssid.c_str(), wifi_password.c_str());
-  unsigned long start = millis();
-  while (WiFi.status() != WL_CONNECTED && (millis() - start) < timeoutMs) {
-    delay(500);
-    Serial.print('.');
-  }
-  Serial.println();
-  if (WiFi.status() == WL_CONNECTED) {
-    Serial.println("WiFi connected");
-    Serial.print("IP: ");
-    Serial.println(WiFi.localIP());
-    return true;
-  }
-  Serial.println("WiFi connection failed");
-  return false;
+void serialCmdsBegin() {
+  // nothing to init currently
 }
 
 void serialCmdsPrintHelp() {
-  Serial.println("Serial commands:");
-  Serial.println("  setssid <ssid>    - Set SSID and save");
-  Serial.println("  setpass <pass>    - Set password and save");
-  Serial.println("  show              - Show current SSID and masked password");
-  Serial.println("  showip            - Show current IP if connected");
-  Serial.println("  connect           - Attempt to connect using current credentials");
-  Serial.println("  del               - Remove saved credentials from NVS (resets to defaults)");
-  Serial.println("  help              - Show this message");
-}
-
-void handleSerialCommand(String cmd) {
-  cmd.trim();
-  if (cmd.length() == 0) return;
-  if (cmd.equalsIgnoreCase("help")) {
-    serialCmdsPrintHelp();
-    return;
-  }
-  if (cmd.startsWith("setssid ")) {
-    String v = cmd.substring(8);
-    v.trim();
-    if (v.length() > 0) {
-      wifi_ssid = v;
-      saveCredentials();
-      Serial.println("SSID updated");
-    } else Serial.println("Usage: setssid <ssid>");
-    return;
-  }
-  if (cmd.startsWith("setpass ")) {
-    String v = cmd.substring(8);
-    v.trim();
-    if (v.length() > 0) {
-      wifi_password = v;
-      saveCredentials();
-      Serial.println("Password updated");
-    } else Serial.println("Usage: setpass <password>");
-    return;
-  }
-  if (cmd.equalsIgnoreCase("show")) {
-    Serial.printf("SSID: %s\n", wifi_ssid.c_str());
-    String masked = "";
-    for (size_t i = 0; i < wifi_password.length(); ++i) masked += '*';
-    Serial.printf("Password: %s\n", masked.c_str());
-    return;
-  }
-  if (cmd.equalsIgnoreCase("showip")) {
-    if (WiFi.status() == WL_CONNECTED) {
-      Serial.print("IP: ");
-      Serial.println(WiFi.localIP());
-    } else {
-      Serial.println("Not connected to WiFi");
-    }
-    return;
-  }
-  if (cmd.equalsIgnoreCase("connect")) {
-    connectWiFi();
-    return;
-  }
-  if (cmd.equalsIgnoreCase("del")) {
-    eraseCredentials();
-    // reload defaults from secrets/example will be handled by main
-    return;
-  }
-  Serial.println("Unknown command. Type 'help' for commands.");
+  cmd_print_help(&serial_out);
 }
 
 void serialCmdsLoop() {
+  serial_proto_poll();
   while (Serial.available()) {
     int c = Serial.read();
 
+    // A zero byte starts the binary protocol, which then owns the input
+    if (serial_proto_feed((uint8_t)c)) continue;
+
     // Handle backspace/delete locally so user sees correction
     if (c == 8 || c == 127) { // backspace
-      if (incoming.length() > 0) {
-        incoming.remove(incoming.length() - 1);
+      if (incoming_len > 0) {
+        incoming_len--;
         // erase char on terminal: move back, print space, move back
         Serial.print("\b \b");
       }
@@ -136,12 +48,11 @@ void serialCmdsLoop() {
     if (c == '\n') {
       // ensure a newline is printed on echo
       Serial.write('\n');
-      handleSerialCommand(incoming);
-      incoming = "";
-    } else {
-      incoming += (char)c;
-      // prevent runaway memory usage
-      if (incoming.length() > 256) incoming.remove(0, incoming.length() - 256);
+      incoming[incoming_len] = '\0';
+      incoming_len = 0;
+      cmd_run(incoming, &serial_out);
+    } else if (incoming_len < SERIAL_CMDS_LINE_MAX) {
+      incoming[incoming_len++] = (char)c;
     }
   }
 }
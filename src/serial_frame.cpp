@@ -0,0 +1,84 @@
+#include "serial_frame.h"
+#include "esp_rom_crc.h"
+
+typedef struct {
+  uint8_t *out;
+  size_t n;
+  size_t code_at;
+  uint8_t code;
+} cobs_t;
+
+static void cobs_put(cobs_t *c, uint8_t b) {
+  if (b) {
+    c->out[c->n++] = b;
+    c->code++;
+  }
+  if (!b || c->code == 0xFF) {
+    c->out[c->code_at] = c->code;
+    c->code_at = c->n++;
+    c->code = 1;
+  }
+}
+
+static void cobs_put_all(cobs_t *c, const uint8_t *p, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    cobs_put(c, p[i]);
+  }
+}
+
+size_t serial_frame_encode(uint8_t type, uint8_t seq, const uint8_t *head, size_t head_len, const uint8_t *body, size_t body_len, uint8_t *out,
+                           size_t cap) {
+  size_t raw = 2 + head_len + body_len + 4;
+  if (head_len + body_len > SERIAL_FRAME_MAX_PAYLOAD || raw + raw / 254 + 3 > cap) {
+    return 0;
+  }
+  uint8_t hdr[2] = {type, seq};
+  uint32_t crc = esp_rom_crc32_le(0, hdr, 2);
+  if (head_len) {
+    crc = esp_rom_crc32_le(crc, head, head_len);
+  }
+  if (body_len) {
+    crc = esp_rom_crc32_le(crc, body, body_len);
+  }
+  uint8_t tail[4] = {(uint8_t)crc, (uint8_t)(crc >> 8), (uint8_t)(crc >> 16), (uint8_t)(crc >> 24)};
+
+  out[0] = 0;
+  cobs_t c = {out, 2, 1, 1};
+  cobs_put_all(&c, hdr, 2);
+  cobs_put_all(&c, head, head_len);
+  cobs_put_all(&c, body, body_len);
+  cobs_put_all(&c, tail, 4);
+  out[c.code_at] = c.code;
+  out[c.n++] = 0;
+  return c.n;
+}
+
+bool serial_frame_decode(uint8_t *buf, size_t len, uint8_t *type, uint8_t *seq, const uint8_t **payload, size_t *payload_len) {
+  // in place: the write position stays behind the read position
+  size_t r = 0, w = 0;
+  while (r < len) {
+    uint8_t code = buf[r++];
+    if (!code || r + code - 1 > len) {
+      return false;
+    }
+    for (uint8_t k = 1; k < code; k++) {
+      buf[w++] = buf[r++];
+    }
+    if (code < 0xFF && r < len) {
+      buf[w++] = 0;
+    }
+  }
+  if (w < 6) {
+    return false;
+  }
+  size_t body = w - 4;
+  uint32_t crc = buf[body] | buf[body + 1] << 8 | buf[body + 2] << 16 | (uint32_t)buf[body + 3] << 24;
+  if (esp_rom_crc32_le(0, buf, body) != crc) {
+    return false;
+  }
+  *type = buf[0];
+  *seq = buf[1];
+  *payload = buf + 2;
+  *payload_len = body - 2;
+  return true;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Framing for the binary serial protocol (serial_proto.h).
+//
+// A frame is type (1 byte), seq (1 byte), payload and the CRC-32 of those
+// three (zlib polynomial, little endian), COBS encoded so it contains no zero
+// byte and delimited by zeros on both sides:
+//
+//   00 | COBS(type seq payload crc32) | 00
+//
+// Anything between two zeros that does not decode with a valid CRC (e.g. log
+// text printed while the binary mode is active) is dropped by the receiver.
+
+#ifndef SERIAL_FRAME_MAX_PAYLOAD
+#define SERIAL_FRAME_MAX_PAYLOAD 1040
+#endif
+
+// Worst case size of an encoded frame with an n byte payload, delimiters included
+#define SERIAL_FRAME_ENCODED_MAX(n) ((n) + 6 + ((n) + 6) / 254 + 3)
+
+// Encode a frame whose payload is head followed by body (either may be empty).
+// Returns the encoded length, or 0 if it does not fit in cap.
+size_t serial_frame_encode(uint8_t type, uint8_t seq, const uint8_t *head, size_t head_len, const uint8_t *body, size_t body_len, uint8_t *out,
+                           size_t cap);
+
+// Decode the bytes between two delimiters in place. On success *payload points
+// into buf. Returns false for a bad encoding or CRC.
+bool serial_frame_decode(uint8_t *buf, size_t len, uint8_t *type, uint8_t *seq, const uint8_t **payload, size_t *payload_len);
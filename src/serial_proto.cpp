@@ -0,0 +1,316 @@
+#include "serial_proto.h"
+#include <Arduino.h>
+#include <WiFi.h>
+#include <Preferences.h>
+#include "esp_camera.h"
+#include "esp_rom_crc.h"
+#include "esp_heap_caps.h"
+#include "serial_frame.h"
+#include "camera_settings.h"
+#include "cam_watchdog.h"
+#include "frame_pipe.h"
+#include "wifi_link.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+extern String wifi_ssid;
+extern String wifi_password;
+
+static uint8_t _rx[SERIAL_FRAME_ENCODED_MAX(SERIAL_FRAME_MAX_PAYLOAD)];
+static uint8_t _tx[SERIAL_FRAME_ENCODED_MAX(SERIAL_FRAME_MAX_PAYLOAD)];
+static uint8_t _reply[SERIAL_FRAME_MAX_PAYLOAD];
+static size_t _rx_len = 0;
+static bool _rx_overflow = false;
+static bool _active = false;
+static uint32_t _last_ms = 0;
+static uint32_t _boot_baud = 0;   // text shell rate, restored when the mode ends
+static uint32_t _prev_baud = 0;   // rate before an unconfirmed SP_CMD_BAUD
+static uint32_t _confirm_by = 0;  // millis() deadline for that confirmation, 0 = none
+
+static inline uint32_t get_u32(const uint8_t *p) {
+  return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static inline uint8_t *put_u32(uint8_t *p, uint32_t v) {
+  p[0] = v;
+  p[1] = v >> 8;
+  p[2] = v >> 16;
+  p[3] = v >> 24;
+  return p + 4;
+}
+
+static inline uint8_t *put_u16(uint8_t *p, uint16_t v) {
+  p[0] = v;
+  p[1] = v >> 8;
+  return p + 2;
+}
+
+static void send(uint8_t type, uint8_t seq, const uint8_t *head, size_t head_len, const uint8_t *body, size_t body_len) {
+  size_t n = serial_frame_encode(type, seq, head, head_len, body, body_len, _tx, sizeof(_tx));
+  if (n) {
+    Serial.write(_tx, n);
+  }
+}
+
+static void reply(uint8_t cmd, uint8_t seq, sp_status_t status, size_t len = 0) {
+  _reply[0] = status;
+  send(cmd | SP_REPLY, seq, _reply, status == SP_OK ? len + 1 : 1, NULL, 0);
+}
+
+static void set_baud(uint32_t baud) {
+  Serial.flush();
+  Serial.updateBaudRate(baud);
+}
+
+// Change rate until a valid frame confirms it (see serial_proto_poll)
+static void switch_baud(uint32_t baud) {
+  if (baud == Serial.baudRate()) {
+    return;
+  }
+  _prev_baud = Serial.baudRate();
+  set_baud(baud);
+  _confirm_by = millis() + SERIAL_PROTO_BAUD_CONFIRM_MS;
+}
+
+static void begin_session() {
+  _active = true;
+  if (!_boot_baud) {
+    _boot_baud = Serial.baudRate();
+  }
+  _rx_len = 0;
+  _rx_overflow = false;
+  _last_ms = millis();
+}
+
+static void end_session() {
+  _active = false;
+  _confirm_by = 0;
+  if (_boot_baud && Serial.baudRate() != _boot_baud) {
+    set_baud(_boot_baud);
+  }
+}
+
+static void cmd_ping(uint8_t seq) {
+  uint8_t *p = _reply + 1;
+  *p++ = SERIAL_PROTO_VERSION;
+  p = put_u32(p, Serial.baudRate());
+  p = put_u16(p, SERIAL_FRAME_MAX_PAYLOAD);
+  reply(SP_CMD_PING, seq, SP_OK, p - _reply - 1);
+}
+
+static void cmd_creds(uint8_t seq, const uint8_t *p, size_t len) {
+  char ssid[33], pass[65];
+  size_t sl = len ? p[0] : 0;
+  if (!len || !sl || sl > 32 || 1 + sl + 1 > len) {
+    return reply(SP_CMD_CREDS, seq, SP_ERR_REQUEST);
+  }
+  size_t pl = p[1 + sl];
+  if (pl > 64 || 2 + sl + pl + 1 > len) {
+    return reply(SP_CMD_CREDS, seq, SP_ERR_REQUEST);
+  }
+  memcpy(ssid, p + 1, sl);
+  ssid[sl] = 0;
+  memcpy(pass, p + 2 + sl, pl);
+  pass[pl] = 0;
+  uint8_t flags = p[2 + sl + pl];
+
+  Preferences prefs;
+  prefs.begin("wifi", false);
+  prefs.putString("ssid", ssid);
+  prefs.putString("pass", pass);
+  prefs.end();
+  wifi_ssid = ssid;
+  wifi_password = pass;
+  if (flags & SP_CREDS_CONNECT) {
+    wifi_link_begin(ssid, pass);
+  }
+  reply(SP_CMD_CREDS, seq, SP_OK);
+}
+
+static void cmd_settings(uint8_t seq, const uint8_t *p, size_t len) {
+  uint8_t *out = _reply + 1;
+  size_t i = 0;
+  while (i < len) {
+    size_t nl = p[i];
+    if (!nl || nl > 31 || i + 1 + nl + 4 > len) {
+      return reply(SP_CMD_SETTINGS, seq, SP_ERR_REQUEST);
+    }
+    char name[32];
+    memcpy(name, p + i + 1, nl);
+    name[nl] = 0;
+    int32_t val = (int32_t)get_u32(p + i + 1 + nl);
+    out = put_u32(out, (uint32_t)camera_setting_apply(name, val));
+    i += 1 + nl + 4;
+  }
+  reply(SP_CMD_SETTINGS, seq, SP_OK, out - _reply - 1);
+}
+
+static void cmd_regs(uint8_t seq, const uint8_t *p, size_t len) {
+  const size_t item = 11;
+  if (len % item) {
+    return reply(SP_CMD_REGS, seq, SP_ERR_REQUEST);
+  }
+  sensor_t *s = cam_sensor_take();
+  if (!s) {
+    return reply(SP_CMD_REGS, seq, SP_ERR_FAILED);
+  }
+  uint8_t *out = _reply + 1;
+  for (size_t i = 0; i < len; i += item) {
+    int reg = p[i + 1] | p[i + 2] << 8;
+    int mask = (int)get_u32(p + i + 3);
+    int val = (int)get_u32(p + i + 7);
+    int res = p[i] ? s->set_reg(s, reg, mask, val) : s->get_reg(s, reg, mask);
+    out = put_u32(out, (uint32_t)res);
+  }
+  cam_sensor_give();
+  reply(SP_CMD_REGS, seq, SP_OK, out - _reply - 1);
+}
+
+static uint8_t *put_entry(uint8_t *p, const uint8_t *end, const char *name, int32_t val) {
+  size_t nl = strlen(name);
+  if (p + 1 + nl + 4 > end) {
+    return NULL;
+  }
+  *p++ = nl;
+  memcpy(p, name, nl);
+  return put_u32(p + nl, (uint32_t)val);
+}
+
+static void cmd_status(uint8_t seq) {
+  frame_pipe_stats_t ps;
+  frame_pipe_get_stats(&ps);
+  wifi_link_stats_t ws;
+  wifi_link_get_stats(&ws);
+
+  const uint8_t *end = _reply + sizeof(_reply);
+  uint8_t *p = _reply + 2;
+  uint8_t n = 0;
+  for (int i = 0; i < camera_setting_count() && p; i++, n++) {
+    p = put_entry(p, end, camera_setting_name(i), camera_setting_read(i));
+  }
+  struct {
+    const char *name;
+    int32_t val;
+  } extra[] = {
+    {"wifi.connected", wifi_link_connected()},
+    {"wifi.ip", (int32_t)(uint32_t)WiFi.localIP()},
+    {"wifi.rssi", ws.rssi},
+    {"wifi.disconnects", (int32_t)ws.disconnects},
+    {"pipe.frames", (int32_t)ps.frames},
+    {"pipe.fps_x100", (int32_t)(ps.fps * 100)},
+    {"heap.free", (int32_t)heap_caps_get_free_size(MALLOC_CAP_INTERNAL)},
+    {"psram.free", (int32_t)heap_caps_get_free_size(MALLOC_CAP_SPIRAM)},
+    {"uptime_ms", (int32_t)millis()},
+  };
+  for (size_t i = 0; i < sizeof(extra) / sizeof(extra[0]) && p; i++, n++) {
+    p = put_entry(p, end, extra[i].name, extra[i].val);
+  }
+  if (!p) {
+    return reply(SP_CMD_STATUS, seq, SP_ERR_FAILED);
+  }
+  _reply[1] = n;
+  reply(SP_CMD_STATUS, seq, SP_OK, p - _reply - 1);
+}
+
+// Stream the newest frame straight from the pipeline buffer, one chunk per frame
+static void cmd_snap(uint8_t seq, const uint8_t *p, size_t len) {
+  uint32_t timeout = len >= 4 ? get_u32(p) : 2000;
+  frame_t *f = frame_pipe_acquire(0, timeout);
+  if (!f) {
+    return reply(SP_CMD_SNAP, seq, SP_ERR_TIMEOUT);
+  }
+  uint8_t *o = _reply + 1;
+  o = put_u32(o, f->seq);
+  o = put_u32(o, f->len);
+  o = put_u16(o, f->width);
+  o = put_u16(o, f->height);
+  o = put_u32(o, esp_rom_crc32_le(0, f->buf, f->len));
+  reply(SP_CMD_SNAP, seq, SP_OK, o - _reply - 1);
+
+  for (size_t off = 0; off < f->len; off += SERIAL_PROTO_CHUNK) {
+    uint8_t head[4];
+    put_u32(head, off);
+    size_t n = f->len - off < SERIAL_PROTO_CHUNK ? f->len - off : SERIAL_PROTO_CHUNK;
+    send(SP_DATA, seq, head, 4, f->buf + off, n);
+  }
+  frame_pipe_release(f);
+  _last_ms = millis();
+}
+
+static void cmd_baud(uint8_t seq, const uint8_t *p, size_t len) {
+  uint32_t baud = len >= 4 ? get_u32(p) : 0;
+  if (baud < SERIAL_PROTO_BAUD_MIN || baud > SERIAL_PROTO_BAUD_MAX) {
+    return reply(SP_CMD_BAUD, seq, SP_ERR_REQUEST);
+  }
+  reply(SP_CMD_BAUD, seq, SP_OK);
+  switch_baud(baud);
+}
+
+static void handle_frame(uint8_t *buf, size_t len) {
+  uint8_t type, seq;
+  const uint8_t *p;
+  size_t plen;
+  if (!serial_frame_decode(buf, len, &type, &seq, &p, &plen)) {
+    return;
+  }
+  // a valid frame at the new rate confirms it
+  _confirm_by = 0;
+  switch (type) {
+    case SP_CMD_PING:     cmd_ping(seq); break;
+    case SP_CMD_CREDS:    cmd_creds(seq, p, plen); break;
+    case SP_CMD_SETTINGS: cmd_settings(seq, p, plen); break;
+    case SP_CMD_REGS:     cmd_regs(seq, p, plen); break;
+    case SP_CMD_STATUS:   cmd_status(seq); break;
+    case SP_CMD_SNAP:     cmd_snap(seq, p, plen); break;
+    case SP_CMD_BAUD:     cmd_baud(seq, p, plen); break;
+    case SP_CMD_BYE:
+      reply(SP_CMD_BYE, seq, SP_OK);
+      end_session();
+      break;
+    default: reply(type, seq, SP_ERR_UNKNOWN); break;
+  }
+}
+
+bool serial_proto_feed(uint8_t c) {
+  if (!_active) {
+    if (c) {
+      return false;
+    }
+    begin_session();
+  }
+  _last_ms = millis();
+  if (!c) {
+    if (_rx_len && !_rx_overflow) {
+      handle_frame(_rx, _rx_len);
+    }
+    _rx_len = 0;
+    _rx_overflow = false;
+  } else if (_rx_len < sizeof(_rx)) {
+    _rx[_rx_len++] = c;
+  } else {
+    _rx_overflow = true;
+  }
+  return true;
+}
+
+bool serial_proto_start(uint32_t baud) {
+  if (baud < SERIAL_PROTO_BAUD_MIN || baud > SERIAL_PROTO_BAUD_MAX) {
+    return false;
+  }
+  begin_session();
+  switch_baud(baud);
+  return true;
+}
+
+void serial_proto_poll() {
+  if (_confirm_by && (int32_t)(millis() - _confirm_by) > 0) {
+    log_w("Serial: baud change not confirmed, back to %lu", (unsigned long)_prev_baud);
+    _confirm_by = 0;
+    set_baud(_prev_baud);
+  }
+  if (_active && millis() - _last_ms > SERIAL_PROTO_IDLE_MS) {
+    end_session();
+  }
+}
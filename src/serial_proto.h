@@ -0,0 +1,82 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Binary serial protocol, next to the text shell (serial_cmds.h).
+//
+// A zero byte on the console switches it to binary mode: from then on input is
+// read as serial_frame.h frames and nothing is echoed. The mode ends with
+// SP_CMD_BYE, or after SERIAL_PROTO_IDLE_MS without input, when the text shell
+// takes over again at the boot baud rate.
+//
+// Every request is answered by one frame of type (request | SP_REPLY), same
+// seq, whose payload starts with a status byte (sp_status_t). Integers are
+// little endian.
+//
+//   SP_CMD_PING      -                                -> u8 version, u32 baud, u16 max payload
+//   SP_CMD_CREDS     u8 len, ssid, u8 len, pass,      -> -
+//                    u8 flags (SP_CREDS_CONNECT)
+//   SP_CMD_SETTINGS  n x (u8 len, name, i32 value)    -> n x i32 result (< 0 failed)
+//   SP_CMD_REGS      n x (u8 op, u16 reg, u32 mask,   -> n x i32 (value read, or set result)
+//                         u32 value)   op 0 get, 1 set
+//   SP_CMD_STATUS    -                                -> u8 n, n x (u8 len, name, i32 value)
+//   SP_CMD_SNAP      u32 timeout ms (optional)        -> u32 seq, u32 len, u16 w, u16 h, u32 crc32
+//                    then SP_DATA frames (same seq): u32 offset, up to SERIAL_PROTO_CHUNK bytes
+//   SP_CMD_BAUD      u32 baud                         -> -, then the port switches baud
+//   SP_CMD_BYE       -                                -> -, back to text mode
+//
+// After SP_CMD_BAUD the host has SERIAL_PROTO_BAUD_CONFIRM_MS to send a valid
+// frame at the new rate (e.g. a ping), or the device falls back to the old one.
+
+#ifndef SERIAL_PROTO_IDLE_MS
+#define SERIAL_PROTO_IDLE_MS 5000
+#endif
+#ifndef SERIAL_PROTO_BAUD_CONFIRM_MS
+#define SERIAL_PROTO_BAUD_CONFIRM_MS 1000
+#endif
+#ifndef SERIAL_PROTO_SNAP_BAUD
+#define SERIAL_PROTO_SNAP_BAUD 2000000
+#endif
+#ifndef SERIAL_PROTO_CHUNK
+#define SERIAL_PROTO_CHUNK 1024
+#endif
+
+#define SERIAL_PROTO_VERSION 1
+#define SERIAL_PROTO_BAUD_MIN 9600
+#define SERIAL_PROTO_BAUD_MAX 5000000
+
+enum {
+  SP_CMD_PING = 0x01,
+  SP_CMD_CREDS = 0x02,
+  SP_CMD_SETTINGS = 0x03,
+  SP_CMD_REGS = 0x04,
+  SP_CMD_STATUS = 0x05,
+  SP_CMD_SNAP = 0x06,
+  SP_CMD_BAUD = 0x07,
+  SP_CMD_BYE = 0x0F,
+  SP_DATA = 0x40,
+  SP_REPLY = 0x80,
+};
+
+typedef enum {
+  SP_OK = 0,
+  SP_ERR_REQUEST = 1,  // malformed payload
+  SP_ERR_UNKNOWN = 2,  // unknown command
+  SP_ERR_FAILED = 3,
+  SP_ERR_TIMEOUT = 4,
+} sp_status_t;
+
+#define SP_CREDS_CONNECT 0x01
+
+// Feed one byte read from the console. Returns true if the binary protocol
+// consumed it, false if it belongs to the text shell.
+bool serial_proto_feed(uint8_t c);
+
+// Enter the binary mode from the text shell (the "snap" command) and switch
+// to baud, which the host must confirm as after SP_CMD_BAUD. Returns false for
+// a rate out of range.
+bool serial_proto_start(uint32_t baud);
+
+// Baud confirmation and idle timeouts; call from the serial loop
+void serial_proto_poll();
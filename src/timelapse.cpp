@@ -0,0 +1,524 @@
+#include "timelapse.h"
+#include <Arduino.h>
+#include <Preferences.h>
+#include <time.h>
+#include "esp_camera.h"
+#include "esp_timer.h"
+#include "soc/soc_caps.h"
+#include "board_config.h"
+#include "frame_pipe.h"
+#include "avi_writer.h"
+#include "prerecord.h"
+#include "heap_mon.h"
+#include "cam_watchdog.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#if SOC_SDMMC_HOST_SUPPORTED
+#include "SD_MMC.h"
+#endif
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+#define TIMELAPSE_AVI_BUF   (16 * 1024)
+#define TIMELAPSE_STALE_MAX 4  // frames from before standby to skip per shot
+#define EXP_MAX_REGS        11
+
+typedef struct {
+  int reg;
+  int mask;
+} exp_reg_t;
+
+typedef struct {
+  int reg;
+  int mask;
+  int manual;  // value of the masked bits that selects manual control
+} exp_ctrl_t;
+
+typedef struct {
+  uint16_t pid;
+  const exp_reg_t *values;
+  uint8_t n_values;
+  const exp_ctrl_t *ctrl;
+  uint8_t n_ctrl;
+  int standby_reg;
+  int standby_mask;
+} sensor_profile_t;
+
+// OV2640 sensor bank registers are addressed as 0x100 | reg
+static const exp_reg_t ov2640_values[] = {
+  {0x110, 0xFF},  // AEC[9:2]
+  {0x104, 0x03},  // AEC[1:0]
+  {0x145, 0x3F},  // AEC[15:10]
+  {0x100, 0xFF},  // GAIN
+};
+static const exp_ctrl_t ov2640_ctrl[] = {
+  {0x113, 0x05, 0x00},  // COM8 AEC and AGC enable
+};
+
+static const exp_reg_t ov5640_values[] = {
+  {0x3500, 0x0F}, {0x3501, 0xFF}, {0x3502, 0xFF},  // exposure
+  {0x350A, 0x03}, {0x350B, 0xFF},                  // gain
+  {0x3400, 0x0F}, {0x3401, 0xFF},                  // AWB red gain
+  {0x3402, 0x0F}, {0x3403, 0xFF},                  // AWB green gain
+  {0x3404, 0x0F}, {0x3405, 0xFF},                  // AWB blue gain
+};
+static const exp_ctrl_t ov5640_ctrl[] = {
+  {0x3503, 0x03, 0x03},  // AEC/AGC manual
+  {0x3406, 0x01, 0x01},  // AWB manual
+};
+
+static const sensor_profile_t _profiles[] = {
+  {OV2640_PID, ov2640_values, 4, ov2640_ctrl, 1, 0x109, 0x10},    // COM2 standby
+  {OV3660_PID, ov5640_values, 11, ov5640_ctrl, 2, 0x3008, 0x40},  // software power down
+  {OV5640_PID, ov5640_values, 11, ov5640_ctrl, 2, 0x3008, 0x40},
+};
+
+static TaskHandle_t _task = NULL;
+static volatile bool _enabled = false;
+static uint32_t _interval_s = 60;
+static uint8_t _from_h = 0;
+static uint8_t _to_h = 0;
+static uint8_t _track = TIMELAPSE_TRACK_FRAMES;
+static int64_t _next_us = 0;
+
+// sensor state, changed from the capture task's power hook
+static bool _standby = false;
+static volatile bool _manual = false;
+static bool _have_saved = false;
+static int _saved[EXP_MAX_REGS];
+static int _saved_ctrl[2];
+static volatile int64_t _wake_us = 0;
+static uint32_t _standbys = 0;
+
+static uint32_t _shots = 0;
+static uint32_t _failures = 0;
+static uint32_t _stale = 0;
+static uint32_t _warmup_us = 0;
+static uint32_t _warmup_avg_us = 0;
+static uint32_t _awake_us = 0;
+
+static avi_writer_t _avi;
+static uint8_t *_avi_buf = NULL;
+static bool _seg_open = false;
+static uint32_t _seg_frames = 0;
+static uint32_t _seg_part = 0;
+static size_t _seg_width = 0;
+static char _seg_tag[16] = "";
+static char _seg_name[40] = "";
+
+static const sensor_profile_t *sensor_profile(sensor_t *s) {
+  for (size_t i = 0; s && i < sizeof(_profiles) / sizeof(_profiles[0]); i++) {
+    if (_profiles[i].pid == s->id.PID) {
+      return &_profiles[i];
+    }
+  }
+  return NULL;
+}
+
+static const char *standby_mode() {
+#if PWDN_GPIO_NUM >= 0
+  return "pwdn";
+#else
+  sensor_t *s = cam_sensor_take();
+  if (!s) {
+    return "none";
+  }
+  const char *mode = sensor_profile(s) ? "soft" : "none";
+  cam_sensor_give();
+  return mode;
+#endif
+}
+
+static void sensor_standby(sensor_t *s, const sensor_profile_t *p, bool enter) {
+#if PWDN_GPIO_NUM >= 0
+  digitalWrite(PWDN_GPIO_NUM, enter ? HIGH : LOW);
+  if (!enter) {
+    vTaskDelay(pdMS_TO_TICKS(TIMELAPSE_PWDN_SETTLE_MS));
+  }
+#else
+  if (p) {
+    s->set_reg(s, p->standby_reg, p->standby_mask, enter ? p->standby_mask : 0);
+  }
+#endif
+}
+
+static void exposure_save(sensor_t *s, const sensor_profile_t *p) {
+  for (int i = 0; i < p->n_values; i++) {
+    _saved[i] = s->get_reg(s, p->values[i].reg, p->values[i].mask);
+  }
+  _have_saved = true;
+}
+
+// Switch to manual control with the saved values; the user's control bits are
+// kept for exposure_release()
+static void exposure_lock(sensor_t *s, const sensor_profile_t *p) {
+  for (int i = 0; i < p->n_ctrl; i++) {
+    _saved_ctrl[i] = s->get_reg(s, p->ctrl[i].reg, p->ctrl[i].mask);
+    s->set_reg(s, p->ctrl[i].reg, p->ctrl[i].mask, p->ctrl[i].manual);
+  }
+  for (int i = 0; i < p->n_values; i++) {
+    s->set_reg(s, p->values[i].reg, p->values[i].mask, _saved[i]);
+  }
+  _manual = true;
+}
+
+// Runs on the timelapse task, power_hook() on the capture task: both change
+// _manual and the exposure control registers only with the sensor lock held.
+static void exposure_release() {
+  if (!_manual) {
+    return;
+  }
+  sensor_t *s = cam_sensor_take();
+  if (!s) {
+    return;
+  }
+  const sensor_profile_t *p = sensor_profile(s);
+  for (int i = 0; p && i < p->n_ctrl; i++) {
+    s->set_reg(s, p->ctrl[i].reg, p->ctrl[i].mask, _saved_ctrl[i]);
+  }
+  _manual = false;
+  cam_sensor_give();
+}
+
+static void power_hook_locked(sensor_t *s, bool on) {
+  const sensor_profile_t *p = sensor_profile(s);
+  if (!on) {
+    if (!_enabled || !s) {
+      return;
+    }
+    if (p && !_manual) {
+      exposure_save(s, p);
+    }
+    sensor_standby(s, p, true);
+    _standby = true;
+    _standbys++;
+    return;
+  }
+  if (!_standby) {
+    return;
+  }
+#if PWDN_GPIO_NUM >= 0
+  sensor_standby(s, p, false);
+  if (p && _have_saved) {
+    exposure_lock(s, p);
+  }
+#else
+  // registers stay writable in software standby, so the first frame out
+  // already uses the stored exposure
+  if (p && _have_saved) {
+    exposure_lock(s, p);
+  }
+  sensor_standby(s, p, false);
+#endif
+  _standby = false;
+  _wake_us = esp_timer_get_time();
+  if (_task) {
+    xTaskNotifyGive(_task);
+  }
+}
+
+// Runs on the capture task whenever the pipeline goes idle or wakes up. Without
+// a sensor only the PWDN pin is driven on wake.
+static void power_hook(bool on) {
+  sensor_t *s = cam_sensor_take();
+  power_hook_locked(s, on);
+  if (s) {
+    cam_sensor_give();
+  }
+}
+
+#if SOC_SDMMC_HOST_SUPPORTED
+static File _file;
+
+static size_t file_write(void *ctx, const uint8_t *data, size_t len) {
+  return ((File *)ctx)->write(data, len);
+}
+
+static bool file_seek(void *ctx, uint64_t pos) {
+  return ((File *)ctx)->seek(pos);
+}
+
+static void segment_close() {
+  if (!_seg_open) {
+    return;
+  }
+  if (!avi_writer_end(&_avi)) {
+    log_e("Timelapse: write failed, %s is truncated", _seg_name);
+  }
+  _file.close();
+  _seg_open = false;
+  log_i("Timelapse: closed %s, %lu frames", _seg_name, (unsigned long)_seg_frames);
+}
+
+static bool segment_open(const frame_t *f) {
+  if (!record_sd_mount()) {
+    return false;
+  }
+  if (!_avi_buf) {
+    _avi_buf = (uint8_t *)heap_mon_malloc(HEAP_TAG_AVI, TIMELAPSE_AVI_BUF, 0);
+    if (!_avi_buf) {
+      return false;
+    }
+  }
+  snprintf(_seg_name, sizeof(_seg_name), "/tl_%s_%03lu.avi", _seg_tag, (unsigned long)_seg_part++);
+  _file = SD_MMC.open(_seg_name, FILE_WRITE);
+  if (!_file) {
+    log_e("Timelapse: cannot create %s", _seg_name);
+    return false;
+  }
+  avi_sink_t sink = {file_write, file_seek, &_file};
+  if (!avi_writer_begin(&_avi, &sink, f->width, f->height, TIMELAPSE_PLAYBACK_FPS * 1000, _avi_buf, TIMELAPSE_AVI_BUF, TIMELAPSE_SEGMENT_FRAMES)) {
+    _file.close();
+    return false;
+  }
+  _seg_open = true;
+  _seg_frames = 0;
+  _seg_width = f->width;
+  return true;
+}
+
+static bool shot_store(const frame_t *f) {
+  if (_seg_open && f->width != _seg_width) {
+    segment_close();
+  }
+  if (!_seg_open && !segment_open(f)) {
+    return false;
+  }
+  // timestamps at the playback rate, so the header keeps TIMELAPSE_PLAYBACK_FPS
+  bool ok = avi_writer_add_frame(&_avi, f->buf, f->len, (int64_t)_seg_frames * 1000000 / TIMELAPSE_PLAYBACK_FPS);
+  uint32_t frame = _seg_frames++;
+
+  File csv = SD_MMC.open("/timelapse.csv", FILE_APPEND);
+  if (csv) {
+    time_t now = time(NULL);
+    csv.printf(
+      "%s,%lu,%lu,%lu,%u,%lu\n", _seg_name, (unsigned long)frame, (unsigned long)(now > 1600000000 ? now : millis() / 1000),
+      (unsigned long)f->len, (unsigned)f->width, (unsigned long)(_warmup_us / 1000)
+    );
+    csv.close();
+  }
+  if (!ok || _seg_frames >= TIMELAPSE_SEGMENT_FRAMES) {
+    segment_close();
+  }
+  return ok;
+}
+#else
+static void segment_close() {}
+static bool shot_store(const frame_t *f) {
+  log_e("Timelapse: no SD_MMC host on this target");
+  return false;
+}
+#endif
+
+static bool in_window() {
+  if (_from_h == _to_h) {
+    return true;
+  }
+  time_t now = time(NULL);
+  struct tm tm;
+  if (now < 1600000000 || !localtime_r(&now, &tm)) {
+    return true;
+  }
+  if (_from_h < _to_h) {
+    return tm.tm_hour >= _from_h && tm.tm_hour < _to_h;
+  }
+  return tm.tm_hour >= _from_h || tm.tm_hour < _to_h;
+}
+
+static void shoot() {
+  int64_t t0 = esp_timer_get_time();
+  uint32_t after = frame_pipe_seq();
+  frame_t *f = NULL;
+  // the driver may still hold a frame captured before standby
+  for (int i = 0; i < TIMELAPSE_STALE_MAX; i++) {
+    f = frame_pipe_acquire(after, 3000);
+    if (!f || (int64_t)f->timestamp.tv_sec * 1000000LL + f->timestamp.tv_usec >= _wake_us) {
+      break;
+    }
+    after = f->seq;
+    frame_pipe_release(f);
+    f = NULL;
+    _stale++;
+  }
+  exposure_release();
+  if (!f) {
+    _failures++;
+    log_e("Timelapse: no frame");
+    return;
+  }
+
+  _warmup_us = (uint32_t)(f->capture_us - t0);
+  _warmup_avg_us = _warmup_avg_us ? (_warmup_avg_us * 7 + _warmup_us) / 8 : _warmup_us;
+  after = f->seq;
+  if (!shot_store(f)) {
+    _failures++;
+  }
+  frame_pipe_release(f);
+
+  // let auto exposure follow the scene before the values are saved again
+  for (int i = 0; i < _track; i++) {
+    f = frame_pipe_acquire(after, 1000);
+    if (!f) {
+      break;
+    }
+    after = f->seq;
+    frame_pipe_release(f);
+  }
+  _awake_us = (uint32_t)(esp_timer_get_time() - t0);
+  _shots++;
+  log_i("Timelapse: shot %lu, warm-up %lu ms, awake %lu ms", (unsigned long)_shots, (unsigned long)(_warmup_us / 1000), (unsigned long)(_awake_us / 1000));
+}
+
+static void timelapse_task(void *arg) {
+  while (true) {
+    if (_manual) {
+      // a live viewer woke the sensor: hand exposure back once frames flow
+      vTaskDelay(pdMS_TO_TICKS(200));
+      exposure_release();
+    }
+    if (!_enabled) {
+      segment_close();
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      continue;
+    }
+    int64_t now = esp_timer_get_time();
+    if (now < _next_us) {
+      int64_t wait_ms = (_next_us - now) / 1000 + 1;
+      ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait_ms > 60000 ? 60000 : wait_ms));
+      continue;
+    }
+    // missed slots are skipped, not caught up
+    _next_us += (int64_t)_interval_s * 1000000LL;
+    if (_next_us < now) {
+      _next_us = now + (int64_t)_interval_s * 1000000LL;
+    }
+    if (in_window()) {
+      shoot();
+    }
+  }
+}
+
+static void save_schedule() {
+  Preferences prefs;
+  prefs.begin("timelapse", false);
+  prefs.putBool("on", _enabled);
+  prefs.putUInt("interval", _interval_s);
+  prefs.putUChar("from", _from_h);
+  prefs.putUChar("to", _to_h);
+  prefs.putUChar("track", _track);
+  prefs.end();
+}
+
+bool timelapse_start(uint32_t interval_s, uint8_t from_h, uint8_t to_h) {
+  if (!_task && xTaskCreatePinnedToCore(timelapse_task, "timelapse", 4096, NULL, tskIDLE_PRIORITY + 3, &_task, 0) != pdPASS) {
+    log_e("Timelapse: failed to start task");
+    return false;
+  }
+  _interval_s = interval_s < 1 ? 1 : interval_s;
+  _from_h = from_h % 24;
+  _to_h = to_h % 24;
+  if (!_enabled) {
+    time_t now = time(NULL);
+    struct tm tm;
+    if (now > 1600000000 && localtime_r(&now, &tm)) {
+      strftime(_seg_tag, sizeof(_seg_tag), "%Y%m%d%H%M", &tm);
+    } else {
+      snprintf(_seg_tag, sizeof(_seg_tag), "%08lu", (unsigned long)millis());
+    }
+    _seg_part = 0;
+    _next_us = esp_timer_get_time();
+  }
+  frame_pipe_set_power_hook(power_hook);
+  _enabled = true;
+  save_schedule();
+  xTaskNotifyGive(_task);
+  log_i("Timelapse: every %lus, standby %s", (unsigned long)_interval_s, standby_mode());
+  return true;
+}
+
+void timelapse_stop() {
+  _enabled = false;
+  save_schedule();
+  if (_task) {
+    xTaskNotifyGive(_task);
+  }
+}
+
+void timelapse_begin() {
+  Preferences prefs;
+  prefs.begin("timelapse", true);
+  bool on = prefs.getBool("on", false);
+  uint32_t interval = prefs.getUInt("interval", 60);
+  uint8_t from = prefs.getUChar("from", 0);
+  uint8_t to = prefs.getUChar("to", 0);
+  _track = prefs.getUChar("track", TIMELAPSE_TRACK_FRAMES);
+  prefs.end();
+  if (on) {
+    timelapse_start(interval, from, to);
+  }
+}
+
+static esp_err_t timelapse_handler(httpd_req_t *req) {
+  char query[128] = "";
+  char value[16];
+  httpd_req_get_url_query_str(req, query, sizeof(query));
+
+  uint32_t interval = _interval_s;
+  uint8_t from = _from_h;
+  uint8_t to = _to_h;
+  if (httpd_query_key_value(query, "interval", value, sizeof(value)) == ESP_OK) {
+    interval = atoi(value);
+  }
+  if (httpd_query_key_value(query, "window", value, sizeof(value)) == ESP_OK) {
+    unsigned a = 0, b = 0;
+    if (sscanf(value, "%u-%u", &a, &b) == 2) {
+      from = a;
+      to = b;
+    }
+  }
+  bool changed = false;
+  if (httpd_query_key_value(query, "track", value, sizeof(value)) == ESP_OK) {
+    uint8_t track = atoi(value);
+    changed = track != _track;
+    _track = track;
+  }
+  bool enable = _enabled;
+  if (httpd_query_key_value(query, "enable", value, sizeof(value)) == ESP_OK) {
+    enable = atoi(value);
+  }
+  if (enable && (!_enabled || interval != _interval_s || from != _from_h || to != _to_h)) {
+    if (!timelapse_start(interval, from, to)) {
+      return httpd_resp_send_500(req);
+    }
+  } else if (!enable && _enabled) {
+    timelapse_stop();
+  } else if (changed) {
+    save_schedule();
+  }
+
+  int64_t next = _enabled ? (_next_us - esp_timer_get_time()) / 1000000 : 0;
+  char json[448];
+  int n = snprintf(
+    json, sizeof(json),
+    "{\"enabled\":%d,\"interval\":%lu,\"window\":\"%u-%u\",\"track\":%u,\"next_s\":%ld,\"shots\":%lu,\"failures\":%lu,\"stale\":%lu,"
+    "\"warmup_ms\":%lu,\"warmup_avg_ms\":%lu,\"awake_ms\":%lu,\"standby\":\"%s\",\"standbys\":%lu,\"exposure_saved\":%d,\"file\":\"%s\"}",
+    _enabled ? 1 : 0, (unsigned long)_interval_s, _from_h, _to_h, _track, (long)(next > 0 ? next : 0), (unsigned long)_shots,
+    (unsigned long)_failures, (unsigned long)_stale, (unsigned long)(_warmup_us / 1000), (unsigned long)(_warmup_avg_us / 1000),
+    (unsigned long)(_awake_us / 1000), standby_mode(), (unsigned long)_standbys, _have_saved ? 1 : 0, _seg_name
+  );
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  return httpd_resp_send(req, json, n);
+}
+
+void timelapse_register(httpd_handle_t server) {
+  httpd_uri_t timelapse_uri = {
+    .uri = "/timelapse",
+    .method = HTTP_GET,
+    .handler = timelapse_handler,
+    .user_ctx = NULL
+  };
+  httpd_register_uri_handler(server, &timelapse_uri);
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdint.h>
+#include "esp_http_server.h"
+
+// Timelapse recording with the sensor in standby between shots.
+//
+// While the capture pipeline is idle the sensor is put in standby, through
+// PWDN_GPIO_NUM when the board wires it or the sensor's software standby bit
+// otherwise. Before standby the auto exposure, gain and white balance registers
+// are saved; on wake-up they are written back in manual mode so the first frame
+// is usable without settling frames, then the user's auto modes are restored
+// for a few tracking frames so the stored values follow the daylight.
+//
+// Shots are appended to AVI segments on the SD card (/tl_<start>_<part>.avi,
+// played back at TIMELAPSE_PLAYBACK_FPS) and logged to /timelapse.csv with the
+// wake-to-frame latency. The schedule persists in NVS and resumes on boot.
+//
+//   GET /timelapse?enable=1&interval=60&window=7-19&track=2
+
+#ifndef TIMELAPSE_PLAYBACK_FPS
+#define TIMELAPSE_PLAYBACK_FPS 10
+#endif
+#ifndef TIMELAPSE_SEGMENT_FRAMES
+#define TIMELAPSE_SEGMENT_FRAMES 60
+#endif
+#ifndef TIMELAPSE_TRACK_FRAMES
+#define TIMELAPSE_TRACK_FRAMES 2
+#endif
+#ifndef TIMELAPSE_PWDN_SETTLE_MS
+#define TIMELAPSE_PWDN_SETTLE_MS 10
+#endif
+
+// Load the schedule from NVS and resume if it was enabled
+void timelapse_begin();
+
+// interval_s between shots; shots only between from_h and to_h local time
+// (ignored while the clock is not set, from_h == to_h means all day)
+bool timelapse_start(uint32_t interval_s, uint8_t from_h = 0, uint8_t to_h = 0);
+
+void timelapse_stop();
+
+// Register GET /timelapse (configure and status as JSON)
+void timelapse_register(httpd_handle_t server);
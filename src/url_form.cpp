@@ -0,0 +1,69 @@
+#include "url_form.h"
+#include <string.h>
+
+static int hex_value(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+size_t url_decode(char *s, size_t len) {
+  char *out = s;
+  for (size_t i = 0; i < len; i++) {
+    char c = s[i];
+    if (c == '+') {
+      c = ' ';
+    } else if (c == '%' && i + 2 < len) {
+      // out never passes i, so the digits ahead are still intact
+      int hi = hex_value(s[i + 1]);
+      int lo = hex_value(s[i + 2]);
+      if (hi >= 0 && lo >= 0) {
+        c = (char)(hi << 4 | lo);
+        i += 2;
+      }
+    }
+    *out++ = c;
+  }
+  return out - s;
+}
+
+void url_form_init(url_form_t *form, char *buf) {
+  form->cur = buf;
+  form->end = buf + strlen(buf);
+}
+
+bool url_form_next(url_form_t *form, url_span_t *key, url_span_t *val) {
+  while (form->cur < form->end) {
+    char *pair = form->cur;
+    char *amp = (char *)memchr(pair, '&', form->end - pair);
+    char *stop = amp ? amp : form->end;
+    form->cur = amp ? amp + 1 : form->end;
+    if (stop == pair) {
+      continue;  // "&&"
+    }
+    char *eq = (char *)memchr(pair, '=', stop - pair);
+    char *key_end = eq ? eq : stop;
+    size_t klen = url_decode(pair, key_end - pair);
+    size_t vlen = 0;
+    char *value = key_end;
+    if (eq) {
+      value = eq + 1;
+      vlen = url_decode(value, stop - value);
+    }
+    // both terminators land at or before the separators that ended them
+    pair[klen] = '\0';
+    value[vlen] = '\0';
+    key->p = pair;
+    key->len = klen;
+    val->p = value;
+    val->len = vlen;
+    return true;
+  }
+  return false;
+}
+
+bool url_span_eq(const url_span_t *span, const char *str) {
+  size_t n = strlen(str);
+  return span->len == n && !memcmp(span->p, str, n);
+}
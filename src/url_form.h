@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+// In-place parsing of application/x-www-form-urlencoded data (query strings
+// and POST bodies).
+//
+// url_form_next() walks "k1=v1&k2=v2..." one pair at a time. Each key and
+// value is percent-decoded ('+' is a space) over its own bytes and NUL
+// terminated, so the returned spans point into the caller's buffer and can be
+// used as C strings. Nothing is allocated or copied; decoding never grows the
+// data, and a '%' not followed by two hex digits is kept as is. The buffer is
+// consumed: the iterator must not be restarted over the same data.
+//
+//   char query[URL_FORM_QUERY_MAX];
+//   httpd_req_get_url_query_str(req, query, sizeof(query));
+//   url_form_t form;
+//   url_span_t key, val;
+//   url_form_init(&form, query);
+//   while (url_form_next(&form, &key, &val)) {
+//     if (url_span_eq(&key, "val")) value = atoi(val.p);
+//   }
+
+#ifndef URL_FORM_QUERY_MAX
+#define URL_FORM_QUERY_MAX 256
+#endif
+
+typedef struct {
+  const char *p;  // NUL terminated
+  size_t len;     // may be shorter than strlen(p) if the data held %00
+} url_span_t;
+
+typedef struct {
+  char *cur;
+  char *end;
+} url_form_t;
+
+// buf is a NUL-terminated string
+void url_form_init(url_form_t *form, char *buf);
+
+// Next key/value pair; a key without '=' gets an empty value.
+// Empty pairs ("&&") are skipped. Returns false at the end.
+bool url_form_next(url_form_t *form, url_span_t *key, url_span_t *val);
+
+// Decode s[0..len) in place; returns the decoded length (not terminated)
+size_t url_decode(char *s, size_t len);
+
+bool url_span_eq(const url_span_t *span, const char *str);
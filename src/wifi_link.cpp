@@ -0,0 +1,380 @@
+#include "wifi_link.h"
+#include <Arduino.h>
+#include <WiFi.h>
+#include <Preferences.h>
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/event_groups.h"
+#include "ap_mode.h"
+#include "portal.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+#define LINK_EVT_GOT_IP     BIT0
+#define LINK_EVT_DISCONNECT BIT1
+#define LINK_EVT_TIMER      BIT2  // attempt timeout or end of backoff
+#define LINK_EVT_CONNECT    BIT3  // new credentials
+#define LINK_EVT_ALL        (LINK_EVT_GOT_IP | LINK_EVT_DISCONNECT | LINK_EVT_TIMER | LINK_EVT_CONNECT)
+
+// Disconnects we cause ourselves (WIFI_REASON_ASSOC_LEAVE) are not failures
+#define LINK_REASON_LEAVE 8
+
+static EventGroupHandle_t _events = NULL;
+static esp_timer_handle_t _timer = NULL;
+static portMUX_TYPE _lock = portMUX_INITIALIZER_UNLOCKED;
+static volatile bool _connected = false;
+static volatile uint8_t _reason = 0;
+
+// owned by the supervisor task
+static wifi_link_state_t _state = WIFI_LINK_IDLE;
+static bool _ap_started = false;
+static bool _fast = false;  // current attempt uses the cached BSSID and channel
+static int64_t _begin_us = 0;
+static int64_t _down_us = 0;  // when the link was lost, 0 while up or never connected
+static int32_t _rssi_acc = 0;
+static wifi_link_stats_t _stats;
+
+// credentials, written by wifi_link_begin()
+static char _ssid[33];
+static char _pass[65];
+
+// Link details of the last successful association, from NVS ("wifi" namespace,
+// next to ssid and pass); only used for the SSID they were recorded with.
+typedef struct {
+  uint8_t bssid[6];
+  uint8_t channel;
+  bool valid;
+} link_cache_t;
+
+static link_cache_t _cache;
+
+static void load_cache(const char *ssid) {
+  Preferences prefs;
+  prefs.begin("wifi", true);
+  String owner = prefs.getString("bssid_for", "");
+  _cache.channel = prefs.getUChar("chan", 0);
+  _cache.valid = owner == ssid && _cache.channel && prefs.getBytes("bssid", _cache.bssid, 6) == 6;
+  prefs.end();
+}
+
+static void save_cache(const char *ssid) {
+  uint8_t *bssid = WiFi.BSSID();
+  uint8_t channel = WiFi.channel();
+  if (!bssid || (_cache.valid && _cache.channel == channel && !memcmp(_cache.bssid, bssid, 6))) {
+    return;
+  }
+  memcpy(_cache.bssid, bssid, 6);
+  _cache.channel = channel;
+  _cache.valid = true;
+  Preferences prefs;
+  prefs.begin("wifi", false);
+  prefs.putBytes("bssid", _cache.bssid, 6);
+  prefs.putUChar("chan", _cache.channel);
+  prefs.putString("bssid_for", ssid);
+  prefs.end();
+}
+
+// Static address from NVS, or DHCP when "ip" is unset
+static void apply_ip_config() {
+  Preferences prefs;
+  prefs.begin("wifi", true);
+  uint32_t ip = prefs.getUInt("ip", 0);
+  uint32_t gw = prefs.getUInt("gw", 0);
+  uint32_t mask = prefs.getUInt("mask", 0);
+  uint32_t dns = prefs.getUInt("dns", 0);
+  prefs.end();
+  _stats.static_ip = ip != 0;
+  if (ip) {
+    WiFi.config(IPAddress(ip), IPAddress(gw), IPAddress(mask), IPAddress(dns ? dns : gw));
+  } else {
+    WiFi.config(IPAddress((uint32_t)0), IPAddress((uint32_t)0), IPAddress((uint32_t)0));
+  }
+}
+
+static void timer_restart(uint32_t ms) {
+  esp_timer_stop(_timer);
+  esp_timer_start_once(_timer, (uint64_t)ms * 1000);
+}
+
+static void attempt(bool fast) {
+  char ssid[33], pass[65];
+  portENTER_CRITICAL(&_lock);
+  memcpy(ssid, _ssid, sizeof(ssid));
+  memcpy(pass, _pass, sizeof(pass));
+  portEXIT_CRITICAL(&_lock);
+
+  _state = WIFI_LINK_CONNECTING;
+  _fast = fast && _cache.valid;
+  _stats.attempts++;
+  if (_fast) {
+    // direct association: no channel scan
+    WiFi.begin(ssid, pass, _cache.channel, _cache.bssid);
+  } else {
+    WiFi.begin(ssid, pass);
+  }
+  timer_restart(WIFI_LINK_CONNECT_TIMEOUT_MS);
+}
+
+static void attempt_failed() {
+  _stats.failures++;
+  WiFi.disconnect();
+  if (_stats.failures >= WIFI_LINK_AP_AFTER_FAILURES && !_ap_started) {
+    Serial.println("WiFi connection failed");
+    // Start AP portal so user can configure WiFi; the station keeps trying
+    if (apModeStart(WIFI_LINK_AP_SSID, NULL)) {
+      _ap_started = true;
+      _stats.ap_fallbacks++;
+      portal_scan_begin();
+      Serial.printf("Started AP '%s' at %s - visit http://%s/portal\n", WIFI_LINK_AP_SSID, apModeIP(), apModeIP());
+    } else {
+      Serial.println("Failed to start AP portal");
+    }
+  }
+  uint32_t shift = _stats.failures - 1 < 16 ? _stats.failures - 1 : 16;
+  uint32_t backoff = (uint32_t)WIFI_LINK_BACKOFF_MIN_MS << shift;
+  _stats.backoff_ms = backoff < WIFI_LINK_BACKOFF_MAX_MS ? backoff : WIFI_LINK_BACKOFF_MAX_MS;
+  _state = WIFI_LINK_BACKOFF;
+  log_i("WiFi: attempt %lu failed, retry in %lu ms", (unsigned long)_stats.failures, (unsigned long)_stats.backoff_ms);
+  timer_restart(_stats.backoff_ms);
+}
+
+static void connected() {
+  char ssid[33];
+  portENTER_CRITICAL(&_lock);
+  memcpy(ssid, _ssid, sizeof(ssid));
+  portEXIT_CRITICAL(&_lock);
+
+  int64_t now = esp_timer_get_time();
+  esp_timer_stop(_timer);
+  _state = WIFI_LINK_CONNECTED;
+  _stats.failures = 0;
+  _stats.backoff_ms = 0;
+  _stats.last_ms = (uint32_t)((now - _begin_us) / 1000);
+  _stats.last_fast = _fast;
+  if (_fast) {
+    _stats.fast++;
+    _stats.fast_ms_total += _stats.last_ms;
+  } else {
+    _stats.full++;
+    _stats.full_ms_total += _stats.last_ms;
+  }
+  if (_down_us) {
+    _stats.last_down_ms = (uint32_t)((now - _down_us) / 1000);
+    _stats.down_ms_total += _stats.last_down_ms;
+    _down_us = 0;
+    Serial.printf("WiFi reconnected after %lu ms offline\n", (unsigned long)_stats.last_down_ms);
+  }
+  WiFi.setSleep(false);
+  save_cache(ssid);
+  _stats.rssi = _stats.rssi_min = _stats.rssi_avg = WiFi.RSSI();
+  _rssi_acc = _stats.rssi * 8;
+  if (_ap_started) {
+    // let portal clients see the new address before the AP goes away
+    timer_restart(WIFI_LINK_AP_LINGER_MS);
+  }
+  Serial.printf("WiFi connected in %lu ms (%s)\n", (unsigned long)_stats.last_ms, _fast ? "cached BSSID" : "scan");
+  Serial.printf("Camera Ready! Use 'http://%s' to connect\n", WiFi.localIP().toString().c_str());
+}
+
+static void sample_rssi() {
+  int8_t rssi = WiFi.RSSI();
+  if (!rssi) {
+    return;
+  }
+  _stats.rssi = rssi;
+  _stats.rssi_min = rssi < _stats.rssi_min ? rssi : _stats.rssi_min;
+  _rssi_acc += rssi - _rssi_acc / 8;
+  _stats.rssi_avg = _rssi_acc / 8;
+}
+
+// Runs in the Wi-Fi event task: record and hand over, never block here
+static void on_event(arduino_event_id_t event, arduino_event_info_t info) {
+  switch (event) {
+    case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+      _connected = true;
+      xEventGroupSetBits(_events, LINK_EVT_GOT_IP);
+      break;
+    case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+      _connected = false;
+      _reason = info.wifi_sta_disconnected.reason;
+      if (_reason != LINK_REASON_LEAVE) {
+        xEventGroupSetBits(_events, LINK_EVT_DISCONNECT);
+      }
+      break;
+    case ARDUINO_EVENT_WIFI_STA_LOST_IP:
+      _connected = false;
+      xEventGroupSetBits(_events, LINK_EVT_DISCONNECT);
+      break;
+    default: break;
+  }
+}
+
+static void on_timer(void *arg) {
+  xEventGroupSetBits(_events, LINK_EVT_TIMER);
+}
+
+static void link_task(void *arg) {
+  while (true) {
+    TickType_t wait = _state == WIFI_LINK_CONNECTED ? pdMS_TO_TICKS(WIFI_LINK_RSSI_PERIOD_MS) : portMAX_DELAY;
+    EventBits_t bits = xEventGroupWaitBits(_events, LINK_EVT_ALL, pdTRUE, pdFALSE, wait);
+
+    if (bits & LINK_EVT_CONNECT) {
+      // new credentials: start over
+      portENTER_CRITICAL(&_lock);
+      char ssid[33];
+      memcpy(ssid, _ssid, sizeof(ssid));
+      portEXIT_CRITICAL(&_lock);
+      if (_state == WIFI_LINK_CONNECTED) {
+        WiFi.disconnect();
+      }
+      load_cache(ssid);
+      apply_ip_config();
+      _stats.failures = 0;
+      _begin_us = esp_timer_get_time();
+      attempt(true);
+      continue;
+    }
+
+    switch (_state) {
+      case WIFI_LINK_CONNECTING:
+        if (bits & LINK_EVT_GOT_IP) {
+          connected();
+        } else if ((bits & LINK_EVT_DISCONNECT) && _fast) {
+          log_i("WiFi: cached BSSID failed (reason %u), scanning", _reason);
+          _stats.fallbacks++;
+          attempt(false);
+        } else if (bits & (LINK_EVT_DISCONNECT | LINK_EVT_TIMER)) {
+          attempt_failed();
+        }
+        break;
+      case WIFI_LINK_CONNECTED:
+        if (bits & LINK_EVT_DISCONNECT) {
+          log_w("WiFi: link lost (reason %u)", _reason);
+          _stats.disconnects++;
+          _down_us = _begin_us = esp_timer_get_time();
+          attempt(true);
+        } else if ((bits & LINK_EVT_TIMER) && _ap_started) {
+          // reachable through the station address now
+          portal_scan_end();
+          apModeStop();
+          _ap_started = false;
+        } else if (!bits) {
+          sample_rssi();
+        }
+        break;
+      case WIFI_LINK_BACKOFF:
+        if (bits & LINK_EVT_TIMER) {
+          attempt(true);
+        }
+        break;
+      default: break;
+    }
+  }
+}
+
+void wifi_link_begin(const char *ssid, const char *pass) {
+  portENTER_CRITICAL(&_lock);
+  strlcpy(_ssid, ssid, sizeof(_ssid));
+  strlcpy(_pass, pass, sizeof(_pass));
+  portEXIT_CRITICAL(&_lock);
+
+  if (!_events) {
+    _events = xEventGroupCreate();
+    esp_timer_create_args_t args = {};
+    args.callback = on_timer;
+    args.name = "wifi_link";
+    esp_timer_create(&args, &_timer);
+    // the supervisor owns reconnects and the link details in NVS
+    WiFi.persistent(false);
+    WiFi.setAutoReconnect(false);
+    WiFi.onEvent(on_event);
+    // bring up the network stack now so the servers can start
+    WiFi.mode(WIFI_STA);
+    xTaskCreatePinnedToCore(link_task, "wifi_link", 4096, NULL, tskIDLE_PRIORITY + 2, NULL, 0);
+  }
+  xEventGroupSetBits(_events, LINK_EVT_CONNECT);
+}
+
+bool wifi_link_connected() {
+  return _connected;
+}
+
+uint32_t wifi_link_connect_ms() {
+  return _stats.last_ms;
+}
+
+bool wifi_link_set_static(uint32_t ip, uint32_t gw, uint32_t mask, uint32_t dns) {
+  if (ip && (!gw || !mask)) {
+    return false;
+  }
+  Preferences prefs;
+  prefs.begin("wifi", false);
+  if (ip) {
+    prefs.putUInt("ip", ip);
+    prefs.putUInt("gw", gw);
+    prefs.putUInt("mask", mask);
+    prefs.putUInt("dns", dns);
+  } else {
+    prefs.remove("ip");
+    prefs.remove("gw");
+    prefs.remove("mask");
+    prefs.remove("dns");
+  }
+  prefs.end();
+  return true;
+}
+
+void wifi_link_get_stats(wifi_link_stats_t *out) {
+  *out = _stats;
+  out->state = _state;
+  out->reason = _reason;
+  out->ap = _ap_started;
+  out->cached = _cache.valid;
+  out->channel = _cache.channel;
+  memcpy(out->bssid, _cache.bssid, 6);
+  if (_down_us) {
+    // include the outage in progress
+    out->down_ms_total += (uint32_t)((esp_timer_get_time() - _down_us) / 1000);
+  }
+}
+
+const char *wifi_link_state_name(wifi_link_state_t state) {
+  switch (state) {
+    case WIFI_LINK_CONNECTING: return "connecting";
+    case WIFI_LINK_CONNECTED:  return "connected";
+    case WIFI_LINK_BACKOFF:    return "backoff";
+    default:                   return "idle";
+  }
+}
+
+static esp_err_t wifi_handler(httpd_req_t *req) {
+  wifi_link_stats_t st;
+  wifi_link_get_stats(&st);
+  char json[512];
+  int n = snprintf(
+    json, sizeof(json),
+    "{\"state\":\"%s\",\"rssi\":%d,\"rssi_avg\":%d,\"rssi_min\":%d,\"attempts\":%lu,\"failures\":%lu,\"backoff_ms\":%lu,\"fast\":%lu,"
+    "\"full\":%lu,\"fallbacks\":%lu,\"last_connect_ms\":%lu,\"disconnects\":%lu,\"down_ms\":%lu,\"last_down_ms\":%lu,\"ap_fallbacks\":%lu,"
+    "\"static_ip\":%d,\"channel\":%u}",
+    wifi_link_state_name(st.state), st.rssi, st.rssi_avg, st.rssi_min, (unsigned long)st.attempts, (unsigned long)st.failures,
+    (unsigned long)st.backoff_ms, (unsigned long)st.fast, (unsigned long)st.full, (unsigned long)st.fallbacks, (unsigned long)st.last_ms,
+    (unsigned long)st.disconnects, (unsigned long)st.down_ms_total, (unsigned long)st.last_down_ms, (unsigned long)st.ap_fallbacks,
+    st.static_ip ? 1 : 0, st.channel
+  );
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  return httpd_resp_send(req, json, n);
+}
+
+void wifi_link_register(httpd_handle_t server) {
+  httpd_uri_t wifi_uri = {
+    .uri = "/debug/wifi",
+    .method = HTTP_GET,
+    .handler = wifi_handler,
+    .user_ctx = NULL
+  };
+  httpd_register_uri_handler(server, &wifi_uri);
+}
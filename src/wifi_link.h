@@ -0,0 +1,103 @@
+#pragma once
+
+#include <stdint.h>
+#include "esp_http_server.h"
+
+// Station link supervisor.
+//
+// wifi_link_begin() hands the credentials to a supervisor task and returns at
+// once, so the camera and HTTP servers come up while Wi-Fi is still connecting
+// and neither the serial loop nor HTTP workers ever wait on a connect. The task
+// is driven by WiFi.onEvent() callbacks and a timer:
+//
+//   CONNECTING --got IP--> CONNECTED --link lost--> CONNECTING
+//       | disconnect, or no address in WIFI_LINK_CONNECT_TIMEOUT_MS
+//       v
+//   BACKOFF --1 s, 2 s, 4 s ... WIFI_LINK_BACKOFF_MAX_MS--> CONNECTING
+//
+// After WIFI_LINK_AP_AFTER_FAILURES failed attempts in a row the configuration
+// portal (AP WIFI_LINK_AP_SSID) comes up alongside the station, which keeps
+// retrying. The AP goes down WIFI_LINK_AP_LINGER_MS after the station connects,
+// so a client that sent new credentials through the portal can still read the
+// result and the new address.
+//
+// The BSSID and channel of the last successful association are kept in NVS
+// ("wifi" namespace, next to ssid and pass), and the next connect associates
+// directly with them, skipping the channel scan; a full scan is only the
+// fallback when that fails. An optional static address skips DHCP as well.
+
+#ifndef WIFI_LINK_CONNECT_TIMEOUT_MS
+#define WIFI_LINK_CONNECT_TIMEOUT_MS 10000
+#endif
+#ifndef WIFI_LINK_BACKOFF_MIN_MS
+#define WIFI_LINK_BACKOFF_MIN_MS 1000
+#endif
+#ifndef WIFI_LINK_BACKOFF_MAX_MS
+#define WIFI_LINK_BACKOFF_MAX_MS 60000
+#endif
+#ifndef WIFI_LINK_AP_AFTER_FAILURES
+#define WIFI_LINK_AP_AFTER_FAILURES 2
+#endif
+#ifndef WIFI_LINK_AP_LINGER_MS
+#define WIFI_LINK_AP_LINGER_MS 30000
+#endif
+#ifndef WIFI_LINK_RSSI_PERIOD_MS
+#define WIFI_LINK_RSSI_PERIOD_MS 5000
+#endif
+#ifndef WIFI_LINK_AP_SSID
+#define WIFI_LINK_AP_SSID "CameraPortal"
+#endif
+
+typedef enum {
+  WIFI_LINK_IDLE,
+  WIFI_LINK_CONNECTING,
+  WIFI_LINK_CONNECTED,
+  WIFI_LINK_BACKOFF,
+} wifi_link_state_t;
+
+typedef struct {
+  wifi_link_state_t state;
+  uint32_t attempts;       // association attempts
+  uint32_t fast;           // connects with the cached BSSID
+  uint32_t full;           // connects after a scan
+  uint32_t fallbacks;      // cached BSSID failed, scanned instead
+  uint32_t failures;       // failed attempts in a row
+  uint32_t fast_ms_total;  // sum of connect times, for averages
+  uint32_t full_ms_total;
+  uint32_t last_ms;        // last connect time
+  uint32_t backoff_ms;     // current retry delay
+  uint32_t disconnects;    // links lost after being connected
+  uint32_t down_ms_total;  // time offline after losing the link
+  uint32_t last_down_ms;
+  uint32_t ap_fallbacks;   // times the portal AP was started
+  int8_t rssi;             // dBm, sampled every WIFI_LINK_RSSI_PERIOD_MS
+  int8_t rssi_avg;
+  int8_t rssi_min;
+  uint8_t reason;          // last disconnect reason (wifi_err_reason_t)
+  bool ap;                 // portal AP is up
+  bool last_fast;
+  bool static_ip;
+  bool cached;             // a BSSID is cached for the current SSID
+  uint8_t bssid[6];
+  uint8_t channel;
+} wifi_link_stats_t;
+
+// Connect, or reconnect with new credentials (non-blocking)
+void wifi_link_begin(const char *ssid, const char *pass);
+
+bool wifi_link_connected();
+
+// Time from the start of the last connect to the station getting an address
+uint32_t wifi_link_connect_ms();
+
+// Store a static address ((uint32_t)IPAddress values, dns 0 = gateway),
+// or go back to DHCP with ip = 0. Applies on the next connect.
+bool wifi_link_set_static(uint32_t ip, uint32_t gw, uint32_t mask, uint32_t dns);
+
+// Includes the outage in progress in down_ms_total
+void wifi_link_get_stats(wifi_link_stats_t *out);
+
+const char *wifi_link_state_name(wifi_link_state_t state);
+
+// Register GET /debug/wifi (link state and statistics as JSON)
+void wifi_link_register(httpd_handle_t server);
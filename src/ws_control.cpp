@@ -0,0 +1,325 @@
+#include "ws_control.h"
+#include <Arduino.h>
+#include "sdkconfig.h"
+#include "esp_heap_caps.h"
+#include "camera_settings.h"
+#include "cam_watchdog.h"
+#include "cmd_registry.h"
+#include "frame_pipe.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+
+#define WS_CTRL_MAX_SETTINGS  64
+#define WS_CTRL_POLL_MS       100
+#define WS_CTRL_TELEMETRY_MS  1000
+
+static httpd_handle_t _server = NULL;
+static TaskHandle_t _task = NULL;
+static int _clients[WS_CTRL_MAX_CLIENTS];
+static portMUX_TYPE _lock = portMUX_INITIALIZER_UNLOCKED;
+
+// last values pushed to clients
+static int16_t _last[WS_CTRL_MAX_SETTINGS];
+static bool _have_last = false;
+
+// message the push task hands to the httpd task
+static uint8_t _push_msg[2 + 3 * WS_CTRL_MAX_SETTINGS];
+static size_t _push_len = 0;
+static SemaphoreHandle_t _push_done = NULL;
+
+static int settings_count() {
+  int n = camera_setting_count();
+  return n > WS_CTRL_MAX_SETTINGS ? WS_CTRL_MAX_SETTINGS : n;
+}
+
+static void client_add(int fd) {
+  portENTER_CRITICAL(&_lock);
+  int slot = -1;
+  for (int i = 0; i < WS_CTRL_MAX_CLIENTS; i++) {
+    if (_clients[i] == fd) {
+      slot = i;
+      break;
+    }
+    if (slot < 0 && _clients[i] < 0) {
+      slot = i;
+    }
+  }
+  if (slot >= 0) {
+    _clients[slot] = fd;
+  }
+  portEXIT_CRITICAL(&_lock);
+  if (slot < 0) {
+    log_w("WS control: too many clients, fd %d ignored", fd);
+    httpd_sess_trigger_close(_server, fd);
+  }
+}
+
+static void client_remove(int fd) {
+  portENTER_CRITICAL(&_lock);
+  for (int i = 0; i < WS_CTRL_MAX_CLIENTS; i++) {
+    if (_clients[i] == fd) {
+      _clients[i] = -1;
+    }
+  }
+  portEXIT_CRITICAL(&_lock);
+}
+
+static void broadcast(uint8_t *data, size_t len) {
+  int fds[WS_CTRL_MAX_CLIENTS];
+  portENTER_CRITICAL(&_lock);
+  memcpy(fds, _clients, sizeof(fds));
+  portEXIT_CRITICAL(&_lock);
+
+  httpd_ws_frame_t pkt;
+  memset(&pkt, 0, sizeof(pkt));
+  pkt.type = HTTPD_WS_TYPE_BINARY;
+  pkt.payload = data;
+  pkt.len = len;
+  for (int i = 0; i < WS_CTRL_MAX_CLIENTS; i++) {
+    if (fds[i] < 0) {
+      continue;
+    }
+    if (httpd_ws_get_fd_info(_server, fds[i]) != HTTPD_WS_CLIENT_WEBSOCKET || httpd_ws_send_frame_async(_server, fds[i], &pkt) != ESP_OK) {
+      client_remove(fds[i]);
+    }
+  }
+}
+
+// Runs on the httpd task, where the handler sends its replies too, so the
+// header and payload writes of two frames to one client never interleave
+static void push_work(void *arg) {
+  broadcast(_push_msg, _push_len);
+  xSemaphoreGive(_push_done);
+}
+
+// Push task: send _push_msg to every client and wait until it went out
+static void push(size_t len) {
+  _push_len = len;
+  if (httpd_queue_work(_server, push_work, NULL) == ESP_OK) {
+    xSemaphoreTake(_push_done, portMAX_DELAY);
+  }
+}
+
+static bool have_clients() {
+  bool any = false;
+  portENTER_CRITICAL(&_lock);
+  for (int i = 0; i < WS_CTRL_MAX_CLIENTS; i++) {
+    any |= _clients[i] >= 0;
+  }
+  portEXIT_CRITICAL(&_lock);
+  return any;
+}
+
+static inline uint8_t *put_u16(uint8_t *p, uint16_t v) {
+  memcpy(p, &v, sizeof(v));
+  return p + sizeof(v);
+}
+
+static inline uint8_t *put_u32(uint8_t *p, uint32_t v) {
+  memcpy(p, &v, sizeof(v));
+  return p + sizeof(v);
+}
+
+// Build a delta against the last pushed values and remember the new ones. With
+// full set, every setting is included and the pushed state is left untouched
+// (used to answer a single client). Returns the length, or 0 if nothing changed
+// or the camera is offline.
+static size_t build_delta(uint8_t *msg, bool full) {
+  // one snapshot, not a mix from before and after a driver restart
+  if (!cam_sensor_take()) {
+    return 0;
+  }
+  int n = settings_count();
+  uint8_t *p = msg + 2;
+  uint8_t count = 0;
+  for (int i = 0; i < n; i++) {
+    int16_t v = (int16_t)camera_setting_read(i);
+    if (full || !_have_last || v != _last[i]) {
+      *p++ = (uint8_t)i;
+      p = put_u16(p, (uint16_t)v);
+      count++;
+    }
+    if (!full) {
+      _last[i] = v;
+    }
+  }
+  cam_sensor_give();
+  if (!full) {
+    _have_last = true;
+  }
+  if (!count) {
+    return 0;
+  }
+  msg[0] = WS_CTRL_DELTA;
+  msg[1] = count;
+  return p - msg;
+}
+
+static size_t build_telemetry(uint8_t *msg) {
+  frame_pipe_stats_t st;
+  frame_pipe_get_stats(&st);
+  uint8_t *p = msg;
+  *p++ = WS_CTRL_TELEMETRY;
+  p = put_u16(p, (uint16_t)(st.fps * 10));
+  p = put_u32(p, st.seq);
+  p = put_u32(p, heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
+  p = put_u32(p, heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL));
+  p = put_u32(p, heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+  return p - msg;
+}
+
+static void ws_control_task(void *arg) {
+  TickType_t last_telemetry = xTaskGetTickCount();
+
+  while (true) {
+    // woken early after a set command so the delta goes out right away
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(WS_CTRL_POLL_MS));
+    if (!have_clients()) {
+      _have_last = false;
+      continue;
+    }
+    size_t len = build_delta(_push_msg, false);
+    if (len) {
+      push(len);
+    }
+    if (xTaskGetTickCount() - last_telemetry >= pdMS_TO_TICKS(WS_CTRL_TELEMETRY_MS)) {
+      last_telemetry = xTaskGetTickCount();
+      push(build_telemetry(_push_msg));
+    }
+  }
+}
+
+static esp_err_t send_hello(httpd_req_t *req) {
+  static char schema[640];
+  static uint8_t msg[2 + 3 * WS_CTRL_MAX_SETTINGS];
+
+  char *p = schema;
+  char *end = schema + sizeof(schema) - 3;
+  p += snprintf(p, end - p, "{\"settings\":[");
+  int n = settings_count();
+  for (int i = 0; i < n && p < end; i++) {
+    int w = snprintf(p, end - p, "%s\"%s\"", i ? "," : "", camera_setting_name(i));
+    p = (w < 0 || p + w > end) ? end : p + w;
+  }
+  *p++ = ']';
+  *p++ = '}';
+  *p = 0;
+
+  httpd_ws_frame_t pkt;
+  memset(&pkt, 0, sizeof(pkt));
+  pkt.type = HTTPD_WS_TYPE_TEXT;
+  pkt.payload = (uint8_t *)schema;
+  pkt.len = p - schema;
+  esp_err_t res = httpd_ws_send_frame(req, &pkt);
+  if (res != ESP_OK) {
+    return res;
+  }
+
+  pkt.type = HTTPD_WS_TYPE_BINARY;
+  pkt.payload = msg;
+  pkt.len = build_delta(msg, true);
+  if (!pkt.len) {
+    return ESP_OK;
+  }
+  return httpd_ws_send_frame(req, &pkt);
+}
+
+// Each setting goes through the registry's "set", like /control and the
+// serial console
+static esp_err_t apply_settings(httpd_req_t *req, const uint8_t *buf, size_t len) {
+  for (size_t off = 1; off + 3 <= len; off += 3) {
+    int16_t val;
+    memcpy(&val, buf + off + 1, sizeof(val));
+    const char *name = camera_setting_name(buf[off]);
+    char value[8];
+    snprintf(value, sizeof(value), "%d", val);
+    const char *args[] = {name, value};
+    int res = name ? cmd_call("set", 2, args, NULL) : -1;
+    if (res < 0) {
+      res = res < INT8_MIN ? INT8_MIN : res;
+      uint8_t err[3] = {WS_CTRL_ERROR, buf[off], (uint8_t)(int8_t)res};
+      httpd_ws_frame_t pkt;
+      memset(&pkt, 0, sizeof(pkt));
+      pkt.type = HTTPD_WS_TYPE_BINARY;
+      pkt.payload = err;
+      pkt.len = sizeof(err);
+      httpd_ws_send_frame(req, &pkt);
+    }
+  }
+  xTaskNotifyGive(_task);
+  return ESP_OK;
+}
+
+static esp_err_t ws_control_handler(httpd_req_t *req) {
+  if (req->method == HTTP_GET) {
+    client_add(httpd_req_to_sockfd(req));
+    return ESP_OK;
+  }
+
+  uint8_t buf[1 + 3 * WS_CTRL_MAX_SETTINGS];
+  httpd_ws_frame_t pkt;
+  memset(&pkt, 0, sizeof(pkt));
+  esp_err_t res = httpd_ws_recv_frame(req, &pkt, 0);
+  if (res != ESP_OK) {
+    return res;
+  }
+  if (pkt.len > sizeof(buf)) {
+    log_w("WS control: oversized message (%u bytes)", (unsigned)pkt.len);
+    return ESP_FAIL;
+  }
+  pkt.payload = buf;
+  res = httpd_ws_recv_frame(req, &pkt, sizeof(buf));
+  if (res != ESP_OK || pkt.len == 0 || pkt.type != HTTPD_WS_TYPE_BINARY) {
+    return res;
+  }
+
+  switch (buf[0]) {
+    case WS_CTRL_SET:   return apply_settings(req, buf, pkt.len);
+    case WS_CTRL_HELLO: return send_hello(req);
+    default:            log_w("WS control: unknown op 0x%02x", buf[0]); return ESP_OK;
+  }
+}
+
+void ws_control_register(httpd_handle_t server) {
+  for (int i = 0; i < WS_CTRL_MAX_CLIENTS; i++) {
+    _clients[i] = -1;
+  }
+  _server = server;
+  if (!_push_done) {
+    _push_done = xSemaphoreCreateBinary();
+  }
+  if (!_push_done) {
+    log_e("WS control: out of memory");
+    return;
+  }
+  if (!_task && xTaskCreatePinnedToCore(ws_control_task, "ws_control", 3072, NULL, tskIDLE_PRIORITY + 4, &_task, 0) != pdPASS) {
+    log_e("WS control: failed to start push task");
+    return;
+  }
+
+  httpd_uri_t ws_uri = {
+    .uri = "/ws/control",
+    .method = HTTP_GET,
+    .handler = ws_control_handler,
+    .user_ctx = NULL,
+    .is_websocket = true,
+    .handle_ws_control_frames = false,
+    .supported_subprotocol = NULL
+  };
+  httpd_register_uri_handler(server, &ws_uri);
+}
+
+#else
+
+void ws_control_register(httpd_handle_t server) {
+  log_w("WS control disabled: CONFIG_HTTPD_WS_SUPPORT is not set");
+}
+
+#endif
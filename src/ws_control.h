@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdint.h>
+#include "esp_http_server.h"
+
+// Persistent WebSocket control channel on /ws/control.
+//
+// Replaces one HTTP request per slider move (/control) plus /status polling
+// with a single socket. Settings are addressed by their index in the
+// camera_settings table; clients fetch the index -> name mapping once.
+//
+// Client -> server (binary, little endian):
+//   0x01 (<u8 index> <i16 value>)*     apply one or more settings
+//   0x02                               request the schema and a full status
+//
+// Server -> client:
+//   text  {"settings":["framesize","quality",...]}   reply to 0x02
+//   0x81 <u8 n> (<u8 index> <i16 value>)*n            status delta
+//   0x82 <u16 fps*10> <u32 seq> <u32 heap_free> <u32 heap_min> <u32 psram_free>
+//                                                     telemetry, once per second
+//   0x83 <u8 index> <i8 result>                       a setting was rejected
+//                                                     (-128: by the registry)
+//
+// Settings are applied with the command registry's "set", as /control does.
+
+#define WS_CTRL_SET       0x01
+#define WS_CTRL_HELLO     0x02
+#define WS_CTRL_DELTA     0x81
+#define WS_CTRL_TELEMETRY 0x82
+#define WS_CTRL_ERROR     0x83
+
+#define WS_CTRL_MAX_CLIENTS 4
+
+// Register /ws/control and start the status/telemetry push task
+void ws_control_register(httpd_handle_t server);
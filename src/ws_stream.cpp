@@ -0,0 +1,282 @@
+#include "ws_stream.h"
+#include <Arduino.h>
+#include "sdkconfig.h"
+#include "frame_pipe.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+
+#ifndef WS_STREAM_CORE
+#define WS_STREAM_CORE 0
+#endif
+#ifndef WS_STREAM_PRIORITY
+#define WS_STREAM_PRIORITY (tskIDLE_PRIORITY + 5)
+#endif
+
+typedef struct {
+  int fd;  // -1 when the slot is free
+  uint8_t window;
+  uint8_t unacked;
+  uint32_t sent[WS_STREAM_MAX_WINDOW];  // seqs sent and not yet acknowledged, oldest first
+} ws_client_t;
+
+static httpd_handle_t _server = NULL;
+static TaskHandle_t _task = NULL;
+static ws_client_t _clients[WS_STREAM_MAX_CLIENTS];
+static portMUX_TYPE _lock = portMUX_INITIALIZER_UNLOCKED;
+
+static void client_add(int fd) {
+  portENTER_CRITICAL(&_lock);
+  int slot = -1;
+  for (int i = 0; i < WS_STREAM_MAX_CLIENTS; i++) {
+    if (_clients[i].fd == fd) {
+      slot = i;
+      break;
+    }
+    if (slot < 0 && _clients[i].fd < 0) {
+      slot = i;
+    }
+  }
+  if (slot >= 0) {
+    _clients[slot].fd = fd;
+    _clients[slot].window = WS_STREAM_DEFAULT_WINDOW;
+    _clients[slot].unacked = 0;
+  }
+  portEXIT_CRITICAL(&_lock);
+  if (slot < 0) {
+    log_w("WS stream: too many clients, fd %d ignored", fd);
+    httpd_sess_trigger_close(_server, fd);
+    return;
+  }
+  log_i("WS stream: client fd %d connected", fd);
+  xTaskNotifyGive(_task);
+}
+
+static void client_remove(int fd) {
+  portENTER_CRITICAL(&_lock);
+  for (int i = 0; i < WS_STREAM_MAX_CLIENTS; i++) {
+    if (_clients[i].fd == fd) {
+      _clients[i].fd = -1;
+    }
+  }
+  portEXIT_CRITICAL(&_lock);
+  log_i("WS stream: client fd %d gone", fd);
+}
+
+static ws_client_t *client_find(int fd) {
+  for (int i = 0; i < WS_STREAM_MAX_CLIENTS; i++) {
+    if (_clients[i].fd == fd) {
+      return &_clients[i];
+    }
+  }
+  return NULL;
+}
+
+static void client_ack(int fd, uint32_t seq) {
+  portENTER_CRITICAL(&_lock);
+  ws_client_t *c = client_find(fd);
+  if (c) {
+    uint8_t n = 0;
+    while (n < c->unacked && c->sent[n] <= seq) {
+      n++;
+    }
+    memmove(c->sent, c->sent + n, (c->unacked - n) * sizeof(uint32_t));
+    c->unacked -= n;
+  }
+  portEXIT_CRITICAL(&_lock);
+  xTaskNotifyGive(_task);
+}
+
+static void client_set_window(int fd, uint8_t window) {
+  if (window < 1) {
+    window = 1;
+  } else if (window > WS_STREAM_MAX_WINDOW) {
+    window = WS_STREAM_MAX_WINDOW;
+  }
+  portENTER_CRITICAL(&_lock);
+  ws_client_t *c = client_find(fd);
+  if (c) {
+    c->window = window;
+  }
+  portEXIT_CRITICAL(&_lock);
+  xTaskNotifyGive(_task);
+}
+
+// Free the slots of clients that went away. Runs over every occupied slot: a
+// client that drops while out of credit is never sent to, so the send path
+// alone would keep its slot forever.
+static void sweep_clients() {
+  int fds[WS_STREAM_MAX_CLIENTS];
+  int n = 0;
+  portENTER_CRITICAL(&_lock);
+  for (int i = 0; i < WS_STREAM_MAX_CLIENTS; i++) {
+    if (_clients[i].fd >= 0) {
+      fds[n++] = _clients[i].fd;
+    }
+  }
+  portEXIT_CRITICAL(&_lock);
+  for (int i = 0; i < n; i++) {
+    if (httpd_ws_get_fd_info(_server, fds[i]) != HTTPD_WS_CLIENT_WEBSOCKET) {
+      client_remove(fds[i]);
+    }
+  }
+}
+
+// Collect the clients that still have credit; returns how many
+static int ready_clients(int *fds) {
+  int n = 0;
+  portENTER_CRITICAL(&_lock);
+  for (int i = 0; i < WS_STREAM_MAX_CLIENTS; i++) {
+    if (_clients[i].fd >= 0 && _clients[i].unacked < _clients[i].window) {
+      fds[n++] = _clients[i].fd;
+    }
+  }
+  portEXIT_CRITICAL(&_lock);
+  return n;
+}
+
+static void mark_sent(int fd, uint32_t seq) {
+  portENTER_CRITICAL(&_lock);
+  ws_client_t *c = client_find(fd);
+  if (c && c->unacked < WS_STREAM_MAX_WINDOW) {
+    c->sent[c->unacked++] = seq;
+  }
+  portEXIT_CRITICAL(&_lock);
+}
+
+// Header and JPEG go out as two fragments of one binary message, so the frame
+// buffer is sent in place.
+static esp_err_t send_frame(int fd, const ws_frame_hdr_t *hdr, const frame_t *f) {
+  httpd_ws_frame_t pkt;
+  memset(&pkt, 0, sizeof(pkt));
+  pkt.type = HTTPD_WS_TYPE_BINARY;
+  pkt.fragmented = true;
+  pkt.final = false;
+  pkt.payload = (uint8_t *)hdr;
+  pkt.len = sizeof(*hdr);
+  esp_err_t res = httpd_ws_send_frame_async(_server, fd, &pkt);
+  if (res != ESP_OK) {
+    return res;
+  }
+  pkt.type = HTTPD_WS_TYPE_CONTINUE;
+  pkt.final = true;
+  pkt.payload = f->buf;
+  pkt.len = f->len;
+  return httpd_ws_send_frame_async(_server, fd, &pkt);
+}
+
+// Frames are sent from this task rather than via httpd_queue_work(), so a large
+// frame going to a slow client never stalls the control server's task.
+static void ws_stream_task(void *arg) {
+  uint32_t last_seq = 0;
+  int fds[WS_STREAM_MAX_CLIENTS];
+
+  while (true) {
+    sweep_clients();
+    if (ready_clients(fds) == 0) {
+      ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(1000));
+      continue;
+    }
+    frame_t *f = frame_pipe_acquire(last_seq, 1000);
+    if (!f) {
+      continue;
+    }
+    frame_pipe_trace(f, esp_timer_get_time(), last_seq ? f->seq - last_seq - 1 : 0);
+    last_seq = f->seq;
+
+    ws_frame_hdr_t hdr;
+    hdr.magic = WS_STREAM_MAGIC;
+    hdr.version = WS_STREAM_VERSION;
+    hdr.flags = 0;
+    hdr.seq = f->seq;
+    hdr.timestamp_us = (uint64_t)f->timestamp.tv_sec * 1000000ULL + f->timestamp.tv_usec;
+    hdr.size = f->len;
+
+    // re-read: acks may have arrived while waiting for the frame
+    int n = ready_clients(fds);
+    for (int i = 0; i < n; i++) {
+      if (httpd_ws_get_fd_info(_server, fds[i]) != HTTPD_WS_CLIENT_WEBSOCKET) {
+        client_remove(fds[i]);
+        continue;
+      }
+      if (send_frame(fds[i], &hdr, f) != ESP_OK) {
+        client_remove(fds[i]);
+        httpd_sess_trigger_close(_server, fds[i]);
+        continue;
+      }
+      mark_sent(fds[i], f->seq);
+    }
+    frame_pipe_release(f);
+  }
+}
+
+static esp_err_t ws_stream_handler(httpd_req_t *req) {
+  int fd = httpd_req_to_sockfd(req);
+  if (req->method == HTTP_GET) {
+    // handshake done
+    client_add(fd);
+    return ESP_OK;
+  }
+
+  uint8_t buf[8];
+  httpd_ws_frame_t pkt;
+  memset(&pkt, 0, sizeof(pkt));
+  esp_err_t res = httpd_ws_recv_frame(req, &pkt, 0);
+  if (res != ESP_OK) {
+    return res;
+  }
+  if (pkt.len > sizeof(buf)) {
+    log_w("WS stream: oversized client message (%u bytes)", (unsigned)pkt.len);
+    return ESP_FAIL;
+  }
+  pkt.payload = buf;
+  res = httpd_ws_recv_frame(req, &pkt, sizeof(buf));
+  if (res != ESP_OK || pkt.len == 0) {
+    return res;
+  }
+
+  if (buf[0] == WS_STREAM_ACK && pkt.len >= 5) {
+    uint32_t seq;
+    memcpy(&seq, buf + 1, sizeof(seq));
+    client_ack(fd, seq);
+  } else if (buf[0] == WS_STREAM_WINDOW && pkt.len >= 2) {
+    client_set_window(fd, buf[1]);
+  }
+  return ESP_OK;
+}
+
+void ws_stream_register(httpd_handle_t server) {
+  for (int i = 0; i < WS_STREAM_MAX_CLIENTS; i++) {
+    _clients[i].fd = -1;
+  }
+  _server = server;
+  if (!_task && xTaskCreatePinnedToCore(ws_stream_task, "ws_stream", 4096, NULL, WS_STREAM_PRIORITY, &_task, WS_STREAM_CORE) != pdPASS) {
+    log_e("WS stream: failed to start sender task");
+    return;
+  }
+
+  httpd_uri_t ws_uri = {
+    .uri = "/ws/stream",
+    .method = HTTP_GET,
+    .handler = ws_stream_handler,
+    .user_ctx = NULL,
+    .is_websocket = true,
+    .handle_ws_control_frames = false,
+    .supported_subprotocol = NULL
+  };
+  httpd_register_uri_handler(server, &ws_uri);
+}
+
+#else
+
+void ws_stream_register(httpd_handle_t server) {
+  log_w("WS stream disabled: CONFIG_HTTPD_WS_SUPPORT is not set");
+}
+
+#endif
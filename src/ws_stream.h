@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stdint.h>
+#include "esp_http_server.h"
+
+// WebSocket frame streaming on /ws/stream.
+//
+// Registered on the control server: the stream server's single task is
+// occupied for as long as an MJPEG viewer is connected, which would block the
+// WebSocket handshake. Frames are pushed from a dedicated sender task.
+//
+// Every JPEG is pushed as one binary WebSocket message: a ws_frame_hdr_t
+// followed by the JPEG data. Flow control is credit based: the server never has
+// more than `window` unacknowledged frames outstanding to a client. A client
+// that stops acknowledging simply stops receiving frames; when it acknowledges
+// again it gets the newest frame, never a backlog.
+//
+// Client -> server messages (binary, little endian):
+//   'A' <u32 seq>      acknowledge every frame up to and including seq
+//   'W' <u8 window>    set the credit window (1..WS_STREAM_MAX_WINDOW)
+
+#define WS_STREAM_MAGIC          0x5743  // "CW"
+#define WS_STREAM_VERSION        1
+#define WS_STREAM_MAX_CLIENTS    4
+#define WS_STREAM_DEFAULT_WINDOW 2
+#define WS_STREAM_MAX_WINDOW     8
+
+#define WS_STREAM_ACK    'A'
+#define WS_STREAM_WINDOW 'W'
+
+typedef struct __attribute__((packed)) {
+  uint16_t magic;
+  uint8_t version;
+  uint8_t flags;
+  uint32_t seq;           // frame sequence number
+  uint64_t timestamp_us;  // capture timestamp (fb->timestamp)
+  uint32_t size;          // JPEG bytes following the header
+} ws_frame_hdr_t;
+
+// Register /ws/stream and start the sender task
+void ws_stream_register(httpd_handle_t server);
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <string>
+#include "esp_err.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+
+// The clock is esp_timer's simulated one
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+
+// The hardware RNG; a fixed sequence here
+uint32_t esp_random();
+
+class String {
+public:
+  String(const char *s = "") : _s(s ? s : "") {}
+  String(const std::string &s) : _s(s) {}
+  String(int v) : _s(std::to_string(v)) {}
+  String(unsigned int v) : _s(std::to_string(v)) {}
+  String(long v) : _s(std::to_string(v)) {}
+  String(unsigned long v) : _s(std::to_string(v)) {}
+
+  const char *c_str() const {
+    return _s.c_str();
+  }
+  unsigned int length() const {
+    return _s.size();
+  }
+  bool isEmpty() const {
+    return _s.empty();
+  }
+  bool operator==(const char *s) const {
+    return _s == (s ? s : "");
+  }
+  bool operator==(const String &s) const {
+    return _s == s._s;
+  }
+  bool operator!=(const char *s) const {
+    return !(*this == s);
+  }
+  String &operator+=(const String &s) {
+    _s += s._s;
+    return *this;
+  }
+  String &operator+=(char c) {
+    _s += c;
+    return *this;
+  }
+  friend String operator+(const String &a, const String &b) {
+    return String(a._s + b._s);
+  }
+
+private:
+  std::string _s;
+};
+
+// Console output goes to stdout until a test attaches a file descriptor (e.g.
+// one end of a pty), which then carries both directions. The baud rate is
+// only recorded.
+class HardwareSerial {
+public:
+  size_t printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+  size_t print(const char *s);
+  size_t print(const String &s) {
+    return print(s.c_str());
+  }
+  size_t println(const char *s = "");
+  size_t println(const String &s) {
+    return println(s.c_str());
+  }
+  size_t write(const uint8_t *p, size_t n);
+  size_t write(uint8_t c) {
+    return write(&c, 1);
+  }
+  int available();
+  int read();
+  void flush() {}
+  void updateBaudRate(unsigned long baud) {
+    _baud = baud;
+  }
+  uint32_t baudRate() {
+    return _baud;
+  }
+
+  // Host only
+  void host_attach(int fd) {
+    _fd = fd;
+  }
+
+private:
+  int _fd = -1;
+  std::atomic<uint32_t> _baud{115200};
+};
+
+extern HardwareSerial Serial;
+
+#define log_e(...) do {} while (0)
+#define log_w(...) do {} while (0)
+#define log_i(...) do {} while (0)
+#define log_d(...) do {} while (0)
+#define log_v(...) do {} while (0)
+
+// glibc only has strlcpy from 2.38 on
+static inline size_t host_strlcpy(char *dst, const char *src, size_t size) {
+  size_t len = strlen(src);
+  if (size) {
+    size_t n = len < size - 1 ? len : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = 0;
+  }
+  return len;
+}
+#define strlcpy host_strlcpy
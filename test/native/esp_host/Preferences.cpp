@@ -0,0 +1,132 @@
+#include <Preferences.h>
+#include <map>
+#include <vector>
+
+typedef std::map<std::string, std::vector<uint8_t>> nvs_ns_t;
+
+static std::map<std::string, nvs_ns_t> &store() {
+  static std::map<std::string, nvs_ns_t> s;
+  return s;
+}
+
+void host_nvs_erase() {
+  store().clear();
+}
+
+bool Preferences::begin(const char *name, bool readOnly, const char *partition) {
+  _ns = name;
+  _open = true;
+  _ro = readOnly;
+  return true;
+}
+
+void Preferences::end() {
+  _open = false;
+}
+
+bool Preferences::clear() {
+  if (!_open || _ro) {
+    return false;
+  }
+  store()[_ns].clear();
+  return true;
+}
+
+bool Preferences::remove(const char *key) {
+  if (!_open || _ro) {
+    return false;
+  }
+  return store()[_ns].erase(key) > 0;
+}
+
+bool Preferences::isKey(const char *key) {
+  return _open && store()[_ns].count(key);
+}
+
+size_t Preferences::putBytes(const char *key, const void *value, size_t len) {
+  if (!_open || _ro) {
+    return 0;
+  }
+  const uint8_t *p = (const uint8_t *)value;
+  store()[_ns][key].assign(p, p + len);
+  return len;
+}
+
+size_t Preferences::getBytes(const char *key, void *buf, size_t maxLen) {
+  if (!_open) {
+    return 0;
+  }
+  nvs_ns_t &ns = store()[_ns];
+  auto it = ns.find(key);
+  // like NVS: a value that does not fit is not read at all
+  if (it == ns.end() || it->second.size() > maxLen) {
+    return 0;
+  }
+  memcpy(buf, it->second.data(), it->second.size());
+  return it->second.size();
+}
+
+size_t Preferences::getBytesLength(const char *key) {
+  if (!_open) {
+    return 0;
+  }
+  nvs_ns_t &ns = store()[_ns];
+  auto it = ns.find(key);
+  return it == ns.end() ? 0 : it->second.size();
+}
+
+size_t Preferences::putString(const char *key, const char *value) {
+  return putBytes(key, value, strlen(value) + 1);
+}
+
+size_t Preferences::putString(const char *key, const String &value) {
+  return putString(key, value.c_str());
+}
+
+String Preferences::getString(const char *key, const String &defaultValue) {
+  size_t n = getBytesLength(key);
+  if (!n) {
+    return defaultValue;
+  }
+  std::vector<char> buf(n);
+  getBytes(key, buf.data(), n);
+  buf[n - 1] = 0;
+  return String(buf.data());
+}
+
+template <typename T> static T get_value(Preferences *p, const char *key, T defaultValue) {
+  T v;
+  return p->getBytesLength(key) == sizeof(T) && p->getBytes(key, &v, sizeof(T)) ? v : defaultValue;
+}
+
+size_t Preferences::putUChar(const char *key, uint8_t value) {
+  return putBytes(key, &value, sizeof(value));
+}
+
+uint8_t Preferences::getUChar(const char *key, uint8_t defaultValue) {
+  return get_value(this, key, defaultValue);
+}
+
+size_t Preferences::putUInt(const char *key, uint32_t value) {
+  return putBytes(key, &value, sizeof(value));
+}
+
+uint32_t Preferences::getUInt(const char *key, uint32_t defaultValue) {
+  return get_value(this, key, defaultValue);
+}
+
+size_t Preferences::putInt(const char *key, int32_t value) {
+  return putBytes(key, &value, sizeof(value));
+}
+
+int32_t Preferences::getInt(const char *key, int32_t defaultValue) {
+  return get_value(this, key, defaultValue);
+}
+
+size_t Preferences::putBool(const char *key, bool value) {
+  return putUChar(key, value);
+}
+
+bool Preferences::getBool(const char *key, bool defaultValue) {
+  return getUChar(key, defaultValue) != 0;
+}
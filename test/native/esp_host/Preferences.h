@@ -0,0 +1,37 @@
+#pragma once
+
+#include <Arduino.h>
+
+// NVS kept in memory for the life of the test program. Namespaces are shared
+// between instances, as on the device.
+class Preferences {
+public:
+  bool begin(const char *name, bool readOnly = false, const char *partition = NULL);
+  void end();
+  bool clear();
+  bool remove(const char *key);
+  bool isKey(const char *key);
+
+  size_t putBytes(const char *key, const void *value, size_t len);
+  size_t getBytes(const char *key, void *buf, size_t maxLen);
+  size_t getBytesLength(const char *key);
+  size_t putString(const char *key, const char *value);
+  size_t putString(const char *key, const String &value);
+  String getString(const char *key, const String &defaultValue = String());
+  size_t putUChar(const char *key, uint8_t value);
+  uint8_t getUChar(const char *key, uint8_t defaultValue = 0);
+  size_t putUInt(const char *key, uint32_t value);
+  uint32_t getUInt(const char *key, uint32_t defaultValue = 0);
+  size_t putInt(const char *key, int32_t value);
+  int32_t getInt(const char *key, int32_t defaultValue = 0);
+  size_t putBool(const char *key, bool value);
+  bool getBool(const char *key, bool defaultValue = false);
+
+private:
+  std::string _ns;
+  bool _open = false;
+  bool _ro = false;
+};
+
+// Host only: drop every namespace
+void host_nvs_erase();
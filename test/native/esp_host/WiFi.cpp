@@ -0,0 +1,101 @@
+#include <WiFi.h>
+#include "freertos/task.h"
+
+WiFiClass WiFi;
+host_wifi_t host_wifi = {0, false, 0, 0, false, 0, false, 0, {0x24, 0x0a, 0xc4, 0x12, 0x34, 0x56}, 6, -58};
+
+static WiFiEventFuncCb _handlers[4];
+static bool _up = false;
+
+bool IPAddress::fromString(const char *s) {
+  unsigned a, b, c, d;
+  char tail;
+  if (sscanf(s, "%u.%u.%u.%u%c", &a, &b, &c, &d, &tail) != 4 || a > 255 || b > 255 || c > 255 || d > 255) {
+    return false;
+  }
+  _addr = a | b << 8 | c << 16 | (uint32_t)d << 24;
+  return true;
+}
+
+String IPAddress::toString() const {
+  char buf[16];
+  snprintf(buf, sizeof(buf), "%u.%u.%u.%u", _addr & 0xFF, (_addr >> 8) & 0xFF, (_addr >> 16) & 0xFF, _addr >> 24);
+  return String(buf);
+}
+
+wl_status_t WiFiClass::begin(const char *ssid, const char *pass, int32_t channel, const uint8_t *bssid, bool connect) {
+  host_wifi.begins++;
+  host_wifi.direct = bssid && channel;
+  host_wifi.channel = channel;
+  return WL_DISCONNECTED;
+}
+
+bool WiFiClass::disconnect(bool wifioff, bool eraseap) {
+  host_wifi.disconnects++;
+  _up = false;
+  return true;
+}
+
+bool WiFiClass::config(IPAddress local_ip, IPAddress gateway, IPAddress subnet, IPAddress dns1, IPAddress dns2) {
+  host_wifi.static_ip = local_ip;
+  return true;
+}
+
+bool WiFiClass::mode(wifi_mode_t m) {
+  return true;
+}
+
+void WiFiClass::persistent(bool persistent) {}
+
+bool WiFiClass::setAutoReconnect(bool autoReconnect) {
+  return true;
+}
+
+bool WiFiClass::setSleep(bool enabled) {
+  return true;
+}
+
+int WiFiClass::onEvent(WiFiEventFuncCb cb, arduino_event_id_t event) {
+  for (int i = 0; i < 4; i++) {
+    if (!_handlers[i]) {
+      _handlers[i] = cb;
+      return i + 1;
+    }
+  }
+  return 0;
+}
+
+wl_status_t WiFiClass::status() {
+  return _up ? WL_CONNECTED : WL_DISCONNECTED;
+}
+
+IPAddress WiFiClass::localIP() {
+  return _up ? IPAddress(192, 168, 1, 42) : IPAddress();
+}
+
+uint8_t *WiFiClass::BSSID() {
+  return _up ? host_wifi.ap_bssid : NULL;
+}
+
+int32_t WiFiClass::channel() {
+  return host_wifi.ap_channel;
+}
+
+int8_t WiFiClass::RSSI() {
+  return _up ? host_wifi.rssi : 0;
+}
+
+void host_wifi_event(arduino_event_id_t event, uint8_t reason) {
+  host_settle();
+  if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP) {
+    _up = true;
+  } else if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED || event == ARDUINO_EVENT_WIFI_STA_LOST_IP) {
+    _up = false;
+  }
+  arduino_event_info_t info = {};
+  info.wifi_sta_disconnected.reason = reason;
+  for (int i = 0; i < 4 && _handlers[i]; i++) {
+    _handlers[i](event, info);
+  }
+  host_settle();
+}
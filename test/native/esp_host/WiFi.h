@@ -0,0 +1,101 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Station side of the Arduino WiFi class. Nothing goes on the air: a test
+// drives the link with host_wifi_event() and sees what the code asked for in
+// host_wifi.
+
+class IPAddress {
+public:
+  IPAddress() : _addr(0) {}
+  IPAddress(uint32_t addr) : _addr(addr) {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _addr(a | b << 8 | c << 16 | (uint32_t)d << 24) {}
+  bool fromString(const char *s);
+  String toString() const;
+  operator uint32_t() const {
+    return _addr;
+  }
+
+private:
+  uint32_t _addr;  // network order, as on the device
+};
+
+typedef enum {
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_DISCONNECTED = 6,
+} wl_status_t;
+
+typedef enum {
+  WIFI_OFF = 0,
+  WIFI_STA = 1,
+  WIFI_AP = 2,
+  WIFI_AP_STA = 3,
+} wifi_mode_t;
+
+typedef enum {
+  ARDUINO_EVENT_WIFI_STA_START = 2,
+  ARDUINO_EVENT_WIFI_STA_CONNECTED = 4,
+  ARDUINO_EVENT_WIFI_STA_DISCONNECTED = 5,
+  ARDUINO_EVENT_WIFI_STA_GOT_IP = 7,
+  ARDUINO_EVENT_WIFI_STA_LOST_IP = 9,
+  ARDUINO_EVENT_MAX = 64,
+} arduino_event_id_t;
+
+typedef union {
+  struct {
+    uint8_t ssid[32];
+    uint8_t ssid_len;
+    uint8_t bssid[6];
+    uint8_t reason;
+    int8_t rssi;
+  } wifi_sta_disconnected;
+} arduino_event_info_t;
+
+typedef void (*WiFiEventFuncCb)(arduino_event_id_t event, arduino_event_info_t info);
+
+class WiFiClass {
+public:
+  wl_status_t begin(const char *ssid, const char *pass = NULL, int32_t channel = 0, const uint8_t *bssid = NULL, bool connect = true);
+  bool disconnect(bool wifioff = false, bool eraseap = false);
+  bool config(IPAddress local_ip, IPAddress gateway, IPAddress subnet, IPAddress dns1 = IPAddress(), IPAddress dns2 = IPAddress());
+  bool mode(wifi_mode_t m);
+  void persistent(bool persistent);
+  bool setAutoReconnect(bool autoReconnect);
+  bool setSleep(bool enabled);
+  int onEvent(WiFiEventFuncCb cb, arduino_event_id_t event = ARDUINO_EVENT_MAX);
+  wl_status_t status();
+  IPAddress localIP();
+  uint8_t *BSSID();
+  int32_t channel();
+  int8_t RSSI();
+};
+
+extern WiFiClass WiFi;
+
+// Host only
+
+typedef struct {
+  uint32_t begins;        // WiFi.begin() calls
+  bool direct;            // the last one passed a BSSID and channel
+  uint8_t channel;        // the channel it passed
+  uint32_t disconnects;   // WiFi.disconnect() calls
+  bool ap;                // apModeStart() succeeded and apModeStop() not called yet
+  uint32_t ap_starts;
+  bool portal_scanning;   // between portal_scan_begin() and portal_scan_end()
+  uint32_t static_ip;     // from WiFi.config(), 0 for DHCP
+  // the access point a connect reports
+  uint8_t ap_bssid[6];
+  uint8_t ap_channel;
+  int8_t rssi;
+} host_wifi_t;
+
+extern host_wifi_t host_wifi;
+
+// Deliver a station event to the onEvent() handlers, as the Wi-Fi event task
+// does, then let the tasks react. GOT_IP brings the link up, DISCONNECTED and
+// LOST_IP take it down.
+void host_wifi_event(arduino_event_id_t event, uint8_t reason = 0);
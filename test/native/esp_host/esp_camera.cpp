@@ -0,0 +1,65 @@
+#include "esp_camera.h"
+#include "img_converters.h"
+#include "esp_timer.h"
+#include "freertos/event_groups.h"
+#include "host_internal.h"
+
+host_camera_t host_camera;
+
+// The newest shot, kept apart from host_camera so that a shot the capture task
+// is copying out is never half written
+static const uint8_t *_jpeg = NULL;
+static size_t _len = 0;
+static size_t _width = 0;
+static size_t _height = 0;
+static uint32_t _taken = 0;  // shots the driver has handed out or skipped
+
+static EventGroupHandle_t shot_ready() {
+  static EventGroupHandle_t g = xEventGroupCreate();  // BIT0 while a shot is waiting
+  return g;
+}
+
+void host_camera_shoot(const uint8_t *jpeg, size_t len, size_t width, size_t height) {
+  std::lock_guard<std::recursive_mutex> g(host_lock());
+  _jpeg = jpeg;
+  _len = len;
+  _width = width;
+  _height = height;
+  host_camera.shots++;
+  xEventGroupSetBits(shot_ready(), BIT0);
+}
+
+camera_fb_t *esp_camera_fb_get() {
+  xEventGroupWaitBits(shot_ready(), BIT0, pdFALSE, pdTRUE, pdMS_TO_TICKS(HOST_CAMERA_FB_TIMEOUT_MS));
+  std::lock_guard<std::recursive_mutex> g(host_lock());
+  xEventGroupClearBits(shot_ready(), BIT0);
+  if (_taken == host_camera.shots) {
+    return NULL;
+  }
+  _taken = host_camera.shots;
+  if (!_jpeg) {
+    return NULL;
+  }
+  int64_t now = esp_timer_get_time();
+  camera_fb_t *fb = new camera_fb_t;
+  fb->buf = (uint8_t *)_jpeg;
+  fb->len = _len;
+  fb->width = _width;
+  fb->height = _height;
+  fb->format = PIXFORMAT_JPEG;
+  fb->timestamp.tv_sec = now / 1000000;
+  fb->timestamp.tv_usec = now % 1000000;
+  host_camera.grabs++;
+  host_camera.fbs_held++;
+  return fb;
+}
+
+void esp_camera_fb_return(camera_fb_t *fb) {
+  std::lock_guard<std::recursive_mutex> g(host_lock());
+  host_camera.fbs_held--;
+  delete fb;
+}
+
+bool frame2jpg(camera_fb_t *fb, uint8_t quality, uint8_t **out, size_t *out_len) {
+  return false;
+}
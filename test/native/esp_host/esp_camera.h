@@ -0,0 +1,73 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <sys/time.h>
+#include "esp_err.h"
+
+// The camera driver as the frame pipe sees it: esp_camera_fb_get() hands out
+// the frames a test shoots with host_camera_shoot(). host_modules.cpp fakes the
+// other modules that own the camera (camera_settings, cam_watchdog) on top of
+// host_camera.
+
+typedef enum {
+  PIXFORMAT_RGB565,
+  PIXFORMAT_YUV422,
+  PIXFORMAT_GRAYSCALE,
+  PIXFORMAT_JPEG,
+} pixformat_t;
+
+typedef struct {
+  uint8_t *buf;
+  size_t len;
+  size_t width;
+  size_t height;
+  pixformat_t format;
+  struct timeval timestamp;
+} camera_fb_t;
+
+typedef struct {
+  pixformat_t pixel_format;
+  int jpeg_quality;
+  size_t fb_count;
+} camera_config_t;
+
+typedef struct _sensor sensor_t;
+struct _sensor {
+  int (*get_reg)(sensor_t *sensor, int reg, int mask);
+  int (*set_reg)(sensor_t *sensor, int reg, int mask, int value);
+};
+
+// Waits up to HOST_CAMERA_FB_TIMEOUT_MS (simulated) for a frame the capture
+// task has not had yet, as the driver does; NULL on timeout or for a failed
+// shot
+camera_fb_t *esp_camera_fb_get();
+void esp_camera_fb_return(camera_fb_t *fb);
+
+// Host only
+
+#define HOST_CAMERA_FB_TIMEOUT_MS 4000
+
+#define HOST_CAMERA_SETTINGS 6
+
+typedef struct {
+  uint8_t regs[0x10000];                // sensor registers behind get_reg/set_reg
+  int settings[HOST_CAMERA_SETTINGS];   // camera_settings.h table: framesize, quality,
+                                        // brightness, contrast, hmirror, vflip
+  bool offline;                         // no sensor: cam_sensor_take() returns NULL
+  int sensor_held;                      // cam_sensor_take() without cam_sensor_give()
+  uint32_t shots;                       // frames the sensor delivered
+  uint32_t grabs;                       // of those, handed out by esp_camera_fb_get()
+  int fbs_held;                         // driver buffers not returned yet
+  int watchdog_action;                  // cam_watchdog_check() answer to a failed
+                                        // grab (cam_watchdog_action_t)
+  int restarts;                         // cam_watchdog_recover() calls
+} host_camera_t;
+
+extern host_camera_t host_camera;
+
+// The sensor delivers a JPEG frame (not copied), or a failed grab for NULL.
+// Frames nobody grabbed in time are overwritten, as in the driver's
+// CAMERA_GRAB_LATEST mode.
+void host_camera_shoot(const uint8_t *jpeg, size_t len, size_t width, size_t height);
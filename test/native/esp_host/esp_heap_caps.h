@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MALLOC_CAP_EXEC     (1 << 0)
+#define MALLOC_CAP_32BIT    (1 << 1)
+#define MALLOC_CAP_8BIT     (1 << 2)
+#define MALLOC_CAP_DMA      (1 << 3)
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_DEFAULT  (1 << 12)
+
+// Two simulated regions, internal RAM and PSRAM (caps with MALLOC_CAP_SPIRAM),
+// of the sizes below. Their free size, minimum free size and largest free
+// block follow the allocations made with heap_caps_malloc(), which takes the
+// first block that fits, from the lowest address up.
+#define HOST_HEAP_INTERNAL_SIZE (320 << 10)
+#define HOST_HEAP_PSRAM_SIZE    (8 << 20)
+
+void *heap_caps_malloc(size_t size, uint32_t caps);
+void *heap_caps_calloc(size_t n, size_t size, uint32_t caps);
+void heap_caps_free(void *p);
+size_t heap_caps_get_allocated_size(void *p);
+size_t heap_caps_get_free_size(uint32_t caps);
+size_t heap_caps_get_minimum_free_size(uint32_t caps);
+size_t heap_caps_get_largest_free_block(uint32_t caps);
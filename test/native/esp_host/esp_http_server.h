@@ -0,0 +1,75 @@
+#pragma once
+
+#include <stddef.h>
+#include "esp_err.h"
+
+// Types and no-op calls for the modules' handler registration; the handlers
+// themselves are not exercised on the host.
+
+typedef void *httpd_handle_t;
+
+typedef enum {
+  HTTP_GET = 1,
+  HTTP_POST = 3,
+} httpd_method_t;
+
+typedef struct httpd_req {
+  httpd_handle_t handle;
+  int method;
+  char uri[513];
+  size_t content_len;
+  void *user_ctx;
+  void *sess_ctx;
+} httpd_req_t;
+
+typedef struct {
+  const char *uri;
+  httpd_method_t method;
+  esp_err_t (*handler)(httpd_req_t *r);
+  void *user_ctx;
+} httpd_uri_t;
+
+#define HTTPD_RESP_USE_STRLEN -1
+
+typedef enum {
+  HTTPD_400_BAD_REQUEST,
+  HTTPD_404_NOT_FOUND,
+  HTTPD_500_INTERNAL_SERVER_ERROR,
+} httpd_err_code_t;
+
+static inline esp_err_t httpd_register_uri_handler(httpd_handle_t, const httpd_uri_t *) {
+  return ESP_OK;
+}
+static inline esp_err_t httpd_resp_set_type(httpd_req_t *, const char *) {
+  return ESP_OK;
+}
+static inline esp_err_t httpd_resp_set_hdr(httpd_req_t *, const char *, const char *) {
+  return ESP_OK;
+}
+static inline esp_err_t httpd_resp_set_status(httpd_req_t *, const char *) {
+  return ESP_OK;
+}
+static inline esp_err_t httpd_resp_send(httpd_req_t *, const char *, long) {
+  return ESP_OK;
+}
+static inline esp_err_t httpd_resp_send_err(httpd_req_t *, httpd_err_code_t, const char *) {
+  return ESP_FAIL;
+}
+static inline esp_err_t httpd_resp_sendstr(httpd_req_t *, const char *) {
+  return ESP_OK;
+}
+static inline esp_err_t httpd_resp_send_404(httpd_req_t *) {
+  return ESP_FAIL;
+}
+static inline esp_err_t httpd_resp_send_500(httpd_req_t *) {
+  return ESP_FAIL;
+}
+static inline size_t httpd_req_get_url_query_len(httpd_req_t *) {
+  return 0;
+}
+static inline esp_err_t httpd_req_get_url_query_str(httpd_req_t *, char *, size_t) {
+  return ESP_ERR_NOT_FOUND;
+}
+static inline esp_err_t httpd_query_key_value(const char *, const char *, char *, size_t) {
+  return ESP_ERR_NOT_FOUND;
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+#include <stdint.h>
+
+// Same convention as the ROM (and zlib's crc32()): pass the previous result,
+// or 0 to start
+uint32_t esp_rom_crc32_le(uint32_t crc, uint8_t const *buf, uint32_t len);
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stdint.h>
+#include <mutex>
+
+// One tick per millisecond
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define portMAX_DELAY      ((TickType_t)0xFFFFFFFF)
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms)  ((TickType_t)(ms))
+#define pdTRUE             1
+#define pdFALSE            0
+#define pdPASS             pdTRUE
+#define pdFAIL             pdFALSE
+
+#ifndef BIT0
+#define BIT0 0x00000001
+#define BIT1 0x00000002
+#define BIT2 0x00000004
+#define BIT3 0x00000008
+#define BIT4 0x00000010
+#define BIT5 0x00000020
+#define BIT6 0x00000040
+#define BIT7 0x00000080
+#endif
+
+// Critical sections become a recursive mutex: on the host the "ISR" side
+// (timer callbacks) runs on an ordinary thread
+typedef struct {
+  std::recursive_mutex m;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED {}
+#define portENTER_CRITICAL(mux)     ((mux)->m.lock())
+#define portEXIT_CRITICAL(mux)      ((mux)->m.unlock())
+#define portENTER_CRITICAL_ISR(mux) portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL_ISR(mux)  portEXIT_CRITICAL(mux)
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+// Tasks are host threads. They only run freely while a test waits in
+// host_settle() or host_time_advance_ms(); both return once every task is
+// blocked with nothing to do, so each test step is deterministic.
+
+typedef void (*TaskFunction_t)(void *arg);
+typedef struct host_task *TaskHandle_t;
+
+#define tskIDLE_PRIORITY 0
+#define tskNO_AFFINITY   0x7FFFFFFF
+
+BaseType_t xTaskCreatePinnedToCore(
+  TaskFunction_t fn, const char *name, uint32_t stack, void *arg, UBaseType_t prio, TaskHandle_t *out, BaseType_t core
+);
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack, void *arg, UBaseType_t prio, TaskHandle_t *out);
+
+// Self-deletion only; the task's function must return right after it, as
+// they all do
+void vTaskDelete(TaskHandle_t task);
+
+// Delays and timeouts are in simulated time (esp_timer.h)
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount();
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+// Tasks only
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks);
+
+// Host only
+void host_settle();
@@ -0,0 +1,412 @@
+#include <Arduino.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <stdarg.h>
+#include <sys/ioctl.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <iterator>
+#include <map>
+#include <vector>
+#include "esp_heap_caps.h"
+#include "esp_rom_crc.h"
+#include "freertos/task.h"
+#include "host_internal.h"
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+HardwareSerial Serial;
+
+size_t HardwareSerial::printf(const char *fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  char *s = NULL;
+  int n = vasprintf(&s, fmt, ap);
+  va_end(ap);
+  if (n < 0) {
+    return 0;
+  }
+  size_t w = write((const uint8_t *)s, n);
+  free(s);
+  return w;
+}
+
+size_t HardwareSerial::print(const char *s) {
+  return write((const uint8_t *)s, strlen(s));
+}
+
+size_t HardwareSerial::println(const char *s) {
+  return print(s) + print("\n");
+}
+
+size_t HardwareSerial::write(const uint8_t *p, size_t n) {
+  if (_fd < 0) {
+    return fwrite(p, 1, n, stdout);
+  }
+  for (size_t done = 0; done < n;) {
+    ssize_t r = ::write(_fd, p + done, n - done);
+    if (r > 0) {
+      done += r;
+    } else if (r < 0 && errno != EAGAIN && errno != EINTR) {
+      return done;
+    } else {
+      usleep(100);
+    }
+  }
+  return n;
+}
+
+int HardwareSerial::available() {
+  int n = 0;
+  return _fd >= 0 && ioctl(_fd, FIONREAD, &n) == 0 ? n : 0;
+}
+
+int HardwareSerial::read() {
+  uint8_t c;
+  return _fd >= 0 && ::read(_fd, &c, 1) == 1 ? c : -1;
+}
+
+// ROM CRC
+
+uint32_t esp_rom_crc32_le(uint32_t crc, uint8_t const *buf, uint32_t len) {
+  crc = ~crc;
+  while (len--) {
+    crc ^= *buf++;
+    for (int k = 0; k < 8; k++) {
+      crc = crc >> 1 ^ (0xEDB88320 & -(crc & 1));
+    }
+  }
+  return ~crc;
+}
+
+// Random numbers
+
+uint32_t esp_random() {
+  static uint32_t x = 0x2545F491;
+  std::lock_guard<std::recursive_mutex> g(host_lock());
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  return x;
+}
+
+// Sockets (lwip/sockets.h)
+
+int host_socket(int domain, int type, int protocol) {
+  int fd = ::socket(domain, type, protocol);
+  if (fd >= 0 && domain == AF_INET && type == SOCK_DGRAM) {
+    struct in_addr lo;
+    lo.s_addr = htonl(INADDR_LOOPBACK);
+    setsockopt(fd, IPPROTO_IP, IP_MULTICAST_IF, &lo, sizeof(lo));
+  }
+  return fd;
+}
+
+int host_accept(int fd, struct sockaddr *addr, socklen_t *len) {
+  host_rtos_socket_wait(true);
+  int r = ::accept(fd, addr, len);
+  int e = errno;
+  host_rtos_socket_wait(false);
+  errno = e;
+  return r;
+}
+
+int host_select(int n, fd_set *rfds, fd_set *wfds, fd_set *efds, struct timeval *tv) {
+  host_rtos_socket_wait(true);
+  int r = ::select(n, rfds, wfds, efds, tv);
+  int e = errno;
+  host_rtos_socket_wait(false);
+  errno = e;
+  return r;
+}
+
+ssize_t host_recv(int fd, void *buf, size_t len, int flags) {
+  host_rtos_socket_wait(true);
+  ssize_t r = ::recv(fd, buf, len, flags);
+  int e = errno;
+  host_rtos_socket_wait(false);
+  errno = e;
+  return r;
+}
+
+// lwIP has no signals: a peer that went away is an error from send()
+ssize_t host_send(int fd, const void *buf, size_t len, int flags) {
+  host_rtos_socket_wait(true);
+  ssize_t r = ::send(fd, buf, len, flags | MSG_NOSIGNAL);
+  int e = errno;
+  host_rtos_socket_wait(false);
+  errno = e;
+  return r;
+}
+
+// Clock and timers
+
+struct host_timer {
+  esp_timer_cb_t callback;
+  void *arg;
+  int64_t due;     // 0 while stopped
+  uint64_t period;
+};
+
+static int64_t _now_us = 1000000;
+static std::vector<host_timer *> _timers;
+
+std::recursive_mutex &host_lock() {
+  static std::recursive_mutex *m = new std::recursive_mutex();
+  return *m;
+}
+
+std::condition_variable_any &host_cond() {
+  static std::condition_variable_any *c = new std::condition_variable_any();
+  return *c;
+}
+
+int64_t esp_timer_get_time() {
+  std::lock_guard<std::recursive_mutex> g(host_lock());
+  return _now_us;
+}
+
+unsigned long millis() {
+  return (unsigned long)(esp_timer_get_time() / 1000);
+}
+
+unsigned long micros() {
+  return (unsigned long)esp_timer_get_time();
+}
+
+void delay(uint32_t ms) {
+  host_time_advance_ms(ms);
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *out) {
+  host_timer *t = new host_timer{args->callback, args->arg, 0, 0};
+  std::lock_guard<std::recursive_mutex> g(host_lock());
+  _timers.push_back(t);
+  *out = t;
+  return ESP_OK;
+}
+
+static esp_err_t timer_start(esp_timer_handle_t t, uint64_t us, uint64_t period) {
+  std::lock_guard<std::recursive_mutex> g(host_lock());
+  if (t->due) {
+    return ESP_ERR_INVALID_STATE;
+  }
+  t->due = _now_us + (int64_t)(us ? us : 1);
+  t->period = period;
+  return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t t, uint64_t timeout_us) {
+  return timer_start(t, timeout_us, 0);
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t t, uint64_t period_us) {
+  return timer_start(t, period_us, period_us);
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t t) {
+  std::lock_guard<std::recursive_mutex> g(host_lock());
+  if (!t->due) {
+    return ESP_ERR_INVALID_STATE;
+  }
+  t->due = 0;
+  return ESP_OK;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t t) {
+  std::lock_guard<std::recursive_mutex> g(host_lock());
+  for (size_t i = 0; i < _timers.size(); i++) {
+    if (_timers[i] == t) {
+      _timers.erase(_timers.begin() + i);
+      break;
+    }
+  }
+  delete t;
+  return ESP_OK;
+}
+
+bool esp_timer_is_active(esp_timer_handle_t t) {
+  std::lock_guard<std::recursive_mutex> g(host_lock());
+  return t->due != 0;
+}
+
+// Step from one event to the next (a timer falling due, or a task's wait
+// timing out) and let the tasks react to each before moving on
+void host_time_advance_ms(uint32_t ms) {
+  host_settle();
+  int64_t end = esp_timer_get_time() + (int64_t)ms * 1000;
+  while (true) {
+    host_timer *next = NULL;
+    {
+      std::lock_guard<std::recursive_mutex> g(host_lock());
+      int64_t at = end;
+      for (host_timer *t : _timers) {
+        if (t->due && t->due <= at && (!next || t->due < next->due)) {
+          next = t;
+          at = t->due;
+        }
+      }
+      int64_t wake = host_rtos_next_deadline_locked();
+      if (wake > _now_us && wake < at) {
+        at = wake;
+        next = NULL;
+      }
+      _now_us = at;
+      if (next) {
+        next->due = next->period ? next->due + (int64_t)next->period : 0;
+      }
+      host_cond().notify_all();
+    }
+    if (next) {
+      next->callback(next->arg);
+    }
+    host_settle();
+    if (!next && esp_timer_get_time() >= end) {
+      return;
+    }
+  }
+}
+
+// Heap: two simulated regions, so that free size, minimum free size and the
+// largest free block move as allocations come and go. heap_caps_malloc()
+// takes the lowest block that fits. Pointers from the host's malloc() (e.g.
+// heap_mon_malloc() with caps 0) pass through heap_caps_free() and
+// heap_caps_get_allocated_size().
+
+#define HEAP_ALIGN 8
+
+struct host_region {
+  size_t size;
+  uint8_t *base;
+  std::map<size_t, size_t> free_blocks;  // offset -> size, never adjacent
+  std::map<size_t, size_t> used;
+  size_t free_bytes;
+  size_t min_free;
+};
+
+static host_region *region_for(uint32_t caps) {
+  static host_region regions[2];
+  host_region *r = &regions[caps & MALLOC_CAP_SPIRAM ? 1 : 0];
+  if (!r->base) {
+    r->size = caps & MALLOC_CAP_SPIRAM ? HOST_HEAP_PSRAM_SIZE : HOST_HEAP_INTERNAL_SIZE;
+    r->base = (uint8_t *)malloc(r->size);
+    r->free_blocks[0] = r->size;
+    r->free_bytes = r->min_free = r->size;
+  }
+  return r;
+}
+
+// The region p was allocated from, if any
+static host_region *region_of(void *p, size_t *off) {
+  for (uint32_t caps : {(uint32_t)MALLOC_CAP_INTERNAL, (uint32_t)MALLOC_CAP_SPIRAM}) {
+    host_region *r = region_for(caps);
+    if ((uint8_t *)p >= r->base && (uint8_t *)p < r->base + r->size) {
+      *off = (uint8_t *)p - r->base;
+      return r;
+    }
+  }
+  return NULL;
+}
+
+void *heap_caps_malloc(size_t size, uint32_t caps) {
+  std::lock_guard<std::recursive_mutex> g(host_lock());
+  host_region *r = region_for(caps);
+  size_t need = size ? (size + HEAP_ALIGN - 1) & ~(size_t)(HEAP_ALIGN - 1) : HEAP_ALIGN;
+  for (auto it = r->free_blocks.begin(); it != r->free_blocks.end(); ++it) {
+    if (it->second < need) {
+      continue;
+    }
+    size_t off = it->first, left = it->second - need;
+    r->free_blocks.erase(it);
+    if (left) {
+      r->free_blocks[off + need] = left;
+    }
+    r->used[off] = need;
+    r->free_bytes -= need;
+    if (r->free_bytes < r->min_free) {
+      r->min_free = r->free_bytes;
+    }
+    return r->base + off;
+  }
+  return NULL;
+}
+
+void *heap_caps_calloc(size_t n, size_t size, uint32_t caps) {
+  if (size && n > SIZE_MAX / size) {
+    return NULL;
+  }
+  void *p = heap_caps_malloc(n * size, caps);
+  if (p) {
+    memset(p, 0, n * size);
+  }
+  return p;
+}
+
+void heap_caps_free(void *p) {
+  std::lock_guard<std::recursive_mutex> g(host_lock());
+  size_t off;
+  host_region *r = p ? region_of(p, &off) : NULL;
+  if (!r) {
+    free(p);
+    return;
+  }
+  auto u = r->used.find(off);
+  if (u == r->used.end()) {
+    fprintf(stderr, "heap_caps_free(%p): not an allocated block\n", p);
+    abort();
+  }
+  size_t size = u->second;
+  r->used.erase(u);
+  r->free_bytes += size;
+  // merge with the free neighbours
+  auto next = r->free_blocks.lower_bound(off);
+  if (next != r->free_blocks.end() && next->first == off + size) {
+    size += next->second;
+    next = r->free_blocks.erase(next);
+  }
+  if (next != r->free_blocks.begin()) {
+    auto prev = std::prev(next);
+    if (prev->first + prev->second == off) {
+      prev->second += size;
+      return;
+    }
+  }
+  r->free_blocks[off] = size;
+}
+
+size_t heap_caps_get_allocated_size(void *p) {
+  std::lock_guard<std::recursive_mutex> g(host_lock());
+  size_t off;
+  host_region *r = region_of(p, &off);
+  if (r) {
+    auto u = r->used.find(off);
+    return u != r->used.end() ? u->second : 0;
+  }
+#if defined(__GLIBC__)
+  return malloc_usable_size(p);
+#else
+  return 0;
+#endif
+}
+
+size_t heap_caps_get_free_size(uint32_t caps) {
+  std::lock_guard<std::recursive_mutex> g(host_lock());
+  return region_for(caps)->free_bytes;
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps) {
+  std::lock_guard<std::recursive_mutex> g(host_lock());
+  return region_for(caps)->min_free;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps) {
+  std::lock_guard<std::recursive_mutex> g(host_lock());
+  size_t largest = 0;
+  for (auto &b : region_for(caps)->free_blocks) {
+    largest = b.second > largest ? b.second : largest;
+  }
+  return largest;
+}
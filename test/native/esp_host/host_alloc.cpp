@@ -0,0 +1,40 @@
+#include "host_alloc.h"
+#include <atomic>
+
+static std::atomic<size_t> _allocs{0};
+
+size_t host_allocs() {
+  return _allocs.load(std::memory_order_relaxed);
+}
+
+void host_allocs_reset() {
+  _allocs.store(0, std::memory_order_relaxed);
+}
+
+#if defined(__GLIBC__)
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t n, size_t size);
+void *__libc_realloc(void *p, size_t size);
+void __libc_free(void *p);
+}
+
+extern "C" void *malloc(size_t size) {
+  _allocs.fetch_add(1, std::memory_order_relaxed);
+  return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t n, size_t size) {
+  _allocs.fetch_add(1, std::memory_order_relaxed);
+  return __libc_calloc(n, size);
+}
+
+extern "C" void *realloc(void *p, size_t size) {
+  _allocs.fetch_add(1, std::memory_order_relaxed);
+  return __libc_realloc(p, size);
+}
+
+extern "C" void free(void *p) {
+  __libc_free(p);
+}
+#endif
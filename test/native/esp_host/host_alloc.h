@@ -0,0 +1,18 @@
+#pragma once
+
+#include <stddef.h>
+
+// Allocation counter for the tests that check a path does not allocate. On
+// glibc, host_alloc.cpp replaces the C library's malloc family, so every
+// allocation (std::string included) is counted; elsewhere the count stays 0
+// and HOST_ALLOCS_COUNTED is false.
+
+#if defined(__GLIBC__)
+#define HOST_ALLOCS_COUNTED true
+#else
+#define HOST_ALLOCS_COUNTED false
+#endif
+
+// malloc(), calloc() and realloc() calls since the last reset, on any thread
+size_t host_allocs();
+void host_allocs_reset();
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <stdint.h>
+#include <condition_variable>
+#include <mutex>
+
+// Shared by the clock (host.cpp) and the tasks (host_rtos.cpp): one lock for
+// all simulated state, and a condition that is signalled whenever event bits
+// are set or the clock moves.
+std::recursive_mutex &host_lock();
+std::condition_variable_any &host_cond();
+
+// With host_lock() held: the earliest timeout a blocked task waits for
+int64_t host_rtos_next_deadline_locked();
+
+// The calling task enters (true) or leaves a socket call that blocks in real
+// time; host_settle() counts it as blocked meanwhile
+void host_rtos_socket_wait(bool waiting);
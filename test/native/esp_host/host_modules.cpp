@@ -0,0 +1,111 @@
+// Device-only modules that the natively built ones call into; they record the
+// calls in host_wifi and host_camera instead of touching the radio, the HTTP
+// server or the sensor
+#include <WiFi.h>
+#include <Preferences.h>
+#include "esp_camera.h"
+#include "ap_mode.h"
+#include "portal.h"
+#include "camera_settings.h"
+#include "cam_watchdog.h"
+#include "host_internal.h"
+
+// main.cpp
+String wifi_ssid;
+String wifi_password;
+Preferences prefs;
+
+bool apModeStart(const char *ssid, const char *pass) {
+  host_wifi.ap = true;
+  host_wifi.ap_starts++;
+  return true;
+}
+
+void apModeStop() {
+  host_wifi.ap = false;
+}
+
+const char *apModeIP() {
+  return "192.168.4.1";
+}
+
+void portal_scan_begin() {
+  host_wifi.portal_scanning = true;
+}
+
+void portal_scan_end() {
+  host_wifi.portal_scanning = false;
+}
+
+static const char *const _setting_names[HOST_CAMERA_SETTINGS] = {"framesize", "quality", "brightness", "contrast", "hmirror", "vflip"};
+
+int camera_setting_count() {
+  return HOST_CAMERA_SETTINGS;
+}
+
+const char *camera_setting_name(int i) {
+  return i >= 0 && i < HOST_CAMERA_SETTINGS ? _setting_names[i] : NULL;
+}
+
+int camera_setting_index(const char *name) {
+  for (int i = 0; i < HOST_CAMERA_SETTINGS; i++) {
+    if (!strcmp(name, _setting_names[i])) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+int camera_setting_write(int i, int val) {
+  if (i < 0 || i >= HOST_CAMERA_SETTINGS || host_camera.offline) {
+    return -1;
+  }
+  host_camera.settings[i] = val;
+  return 0;
+}
+
+int camera_setting_read(int i) {
+  return i >= 0 && i < HOST_CAMERA_SETTINGS && !host_camera.offline ? host_camera.settings[i] : 0;
+}
+
+int camera_setting_apply(const char *name, int val) {
+  return camera_setting_write(camera_setting_index(name), val);
+}
+
+static int get_reg(sensor_t *s, int reg, int mask) {
+  return host_camera.regs[reg & 0xFFFF] & mask;
+}
+
+static int set_reg(sensor_t *s, int reg, int mask, int value) {
+  uint8_t *r = &host_camera.regs[reg & 0xFFFF];
+  *r = (*r & ~mask) | (value & mask);
+  return 0;
+}
+
+static sensor_t _sensor = {get_reg, set_reg};
+
+sensor_t *cam_sensor_take() {
+  if (host_camera.offline) {
+    return NULL;
+  }
+  host_camera.sensor_held++;
+  return &_sensor;
+}
+
+void cam_sensor_give() {
+  host_camera.sensor_held--;
+}
+
+cam_watchdog_action_t cam_watchdog_check(bool ok, int64_t wait_us) {
+  return ok ? CAM_WATCHDOG_NONE : (cam_watchdog_action_t)host_camera.watchdog_action;
+}
+
+bool cam_watchdog_recover(cam_watchdog_action_t action) {
+  std::lock_guard<std::recursive_mutex> g(host_lock());
+  if (host_camera.fbs_held) {
+    fprintf(stderr, "cam_watchdog_recover: %d frame buffers still out\n", host_camera.fbs_held);
+    abort();
+  }
+  host_camera.restarts++;
+  return true;
+}
@@ -0,0 +1,272 @@
+#include "freertos/task.h"
+#include "freertos/event_groups.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "host_internal.h"
+#include <chrono>
+#include <list>
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+
+// Semaphores, notifications and delays are all waits on event bits, so one
+// list of waiters is all host_settle() and the clock have to look at.
+
+struct host_event_group {
+  EventBits_t bits;
+};
+
+typedef struct {
+  host_event_group *group;
+  EventBits_t mask;
+  bool all;
+  bool clear;
+  bool task;         // a task waits, not a test thread
+  bool woken;        // the bits were set: FreeRTOS unblocks the task right there
+  EventBits_t value;  // the bits it was woken with
+  int64_t deadline;  // INT64_MAX without a timeout
+} waiter_t;
+
+struct host_task {
+  uint32_t notified;
+  host_event_group *note;  // BIT0 while notified
+};
+
+struct host_semaphore {
+  UBaseType_t max;
+  UBaseType_t count;
+  host_event_group *ready;  // BIT0 while count is not 0
+};
+
+// Never destroyed: tasks stay blocked in them while the program exits
+static std::list<waiter_t> &waiters() {
+  static std::list<waiter_t> *w = new std::list<waiter_t>();
+  return *w;
+}
+
+static int _tasks = 0;
+static int _in_sockets = 0;  // tasks in a blocking socket call
+static thread_local host_task *_self = NULL;
+
+static bool satisfied(const host_event_group *group, const waiter_t *w) {
+  EventBits_t hit = group->bits & w->mask;
+  return w->all ? hit == w->mask : hit != 0;
+}
+
+// Ticks to wait for until deadline_us, rounded up
+static TickType_t ticks_until(int64_t deadline_us) {
+  int64_t left = deadline_us - esp_timer_get_time();
+  return left <= 0 ? 0 : (TickType_t)((left + 999) / 1000);
+}
+
+static int64_t deadline_after(TickType_t ticks) {
+  return ticks == portMAX_DELAY ? INT64_MAX : esp_timer_get_time() + (int64_t)ticks * 1000;
+}
+
+int64_t host_rtos_next_deadline_locked() {
+  int64_t next = INT64_MAX;
+  for (const waiter_t &w : waiters()) {
+    if (!w.woken) {
+      next = w.deadline < next ? w.deadline : next;
+    }
+  }
+  return next;
+}
+
+void host_settle() {
+  std::unique_lock<std::recursive_mutex> g(host_lock());
+  auto give_up = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (true) {
+    int idle = 0;
+    int64_t now = esp_timer_get_time();
+    for (const waiter_t &w : waiters()) {
+      idle += w.task && !w.woken && now < w.deadline;
+    }
+    if (idle + _in_sockets == _tasks) {
+      return;
+    }
+    if (host_cond().wait_until(g, give_up) == std::cv_status::timeout) {
+      fprintf(stderr, "host_settle: a task never blocked\n");
+      abort();
+    }
+  }
+}
+
+void host_rtos_socket_wait(bool waiting) {
+  if (!_self) {
+    return;
+  }
+  std::lock_guard<std::recursive_mutex> g(host_lock());
+  _in_sockets += waiting ? 1 : -1;
+  host_cond().notify_all();
+}
+
+BaseType_t xTaskCreatePinnedToCore(
+  TaskFunction_t fn, const char *name, uint32_t stack, void *arg, UBaseType_t prio, TaskHandle_t *out, BaseType_t core
+) {
+  host_task *t = new host_task{0, new host_event_group{0}};
+  {
+    std::lock_guard<std::recursive_mutex> g(host_lock());
+    _tasks++;
+  }
+  std::thread([fn, arg, t] {
+    _self = t;
+    fn(arg);
+  }).detach();
+  if (out) {
+    *out = t;
+  }
+  return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack, void *arg, UBaseType_t prio, TaskHandle_t *out) {
+  return xTaskCreatePinnedToCore(fn, name, stack, arg, prio, out, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t task) {
+  if (!_self || (task && task != _self)) {
+    fprintf(stderr, "vTaskDelete: only a task can delete itself\n");
+    abort();
+  }
+  std::lock_guard<std::recursive_mutex> g(host_lock());
+  _tasks--;
+  _self = NULL;
+  host_cond().notify_all();
+}
+
+void vTaskDelay(TickType_t ticks) {
+  static host_event_group never = {0};
+  if (ticks) {
+    xEventGroupWaitBits(&never, BIT0, pdFALSE, pdTRUE, ticks);
+  }
+}
+
+TickType_t xTaskGetTickCount() {
+  return (TickType_t)(esp_timer_get_time() / 1000);
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+  std::lock_guard<std::recursive_mutex> g(host_lock());
+  task->notified++;
+  xEventGroupSetBits(task->note, BIT0);
+  return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks) {
+  host_task *t = _self;
+  if (!t) {
+    fprintf(stderr, "ulTaskNotifyTake: not called from a task\n");
+    abort();
+  }
+  int64_t deadline = deadline_after(ticks);
+  while (true) {
+    {
+      std::lock_guard<std::recursive_mutex> g(host_lock());
+      uint32_t value = t->notified;
+      if (value) {
+        t->notified = clear ? 0 : value - 1;
+        if (!t->notified) {
+          xEventGroupClearBits(t->note, BIT0);
+        }
+        return value;
+      }
+    }
+    if (deadline != INT64_MAX && esp_timer_get_time() >= deadline) {
+      return 0;
+    }
+    xEventGroupWaitBits(t->note, BIT0, pdFALSE, pdTRUE, deadline == INT64_MAX ? portMAX_DELAY : ticks_until(deadline));
+  }
+}
+
+EventGroupHandle_t xEventGroupCreate() {
+  return new host_event_group{0};
+}
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits) {
+  std::lock_guard<std::recursive_mutex> g(host_lock());
+  group->bits |= bits;
+  EventBits_t value = group->bits;
+  EventBits_t cleared = 0;
+  for (waiter_t &w : waiters()) {
+    if (w.group == group && !w.woken && satisfied(group, &w)) {
+      w.woken = true;
+      w.value = group->bits;
+      cleared |= w.clear ? w.mask : 0;
+    }
+  }
+  group->bits &= ~cleared;
+  host_cond().notify_all();
+  return value;
+}
+
+EventBits_t xEventGroupClearBits(EventGroupHandle_t group, EventBits_t bits) {
+  std::lock_guard<std::recursive_mutex> g(host_lock());
+  EventBits_t old = group->bits;
+  group->bits &= ~bits;
+  return old;
+}
+
+EventBits_t xEventGroupGetBits(EventGroupHandle_t group) {
+  std::lock_guard<std::recursive_mutex> g(host_lock());
+  return group->bits;
+}
+
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits, BaseType_t clear, BaseType_t all, TickType_t ticks) {
+  std::unique_lock<std::recursive_mutex> g(host_lock());
+  waiter_t entry = {group, bits, all != pdFALSE, clear != pdFALSE, _self != NULL, false, 0, deadline_after(ticks)};
+  if (satisfied(group, &entry)) {
+    EventBits_t value = group->bits;
+    group->bits &= clear ? ~bits : ~(EventBits_t)0;
+    return value;
+  }
+  auto w = waiters().insert(waiters().end(), entry);
+  host_cond().notify_all();
+  while (!w->woken && esp_timer_get_time() < w->deadline) {
+    host_cond().wait(g);
+  }
+  EventBits_t value = w->woken ? w->value : group->bits;
+  waiters().erase(w);
+  return value;
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max, UBaseType_t initial) {
+  return new host_semaphore{max, initial, new host_event_group{initial ? (EventBits_t)BIT0 : 0}};
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary() {
+  return xSemaphoreCreateCounting(1, 0);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks) {
+  int64_t deadline = deadline_after(ticks);
+  while (true) {
+    {
+      std::lock_guard<std::recursive_mutex> g(host_lock());
+      if (sem->count) {
+        if (!--sem->count) {
+          xEventGroupClearBits(sem->ready, BIT0);
+        }
+        return pdTRUE;
+      }
+    }
+    if (deadline != INT64_MAX && esp_timer_get_time() >= deadline) {
+      return pdFALSE;
+    }
+    xEventGroupWaitBits(sem->ready, BIT0, pdFALSE, pdTRUE, deadline == INT64_MAX ? portMAX_DELAY : ticks_until(deadline));
+  }
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+  std::lock_guard<std::recursive_mutex> g(host_lock());
+  if (sem->count >= sem->max) {
+    return pdFALSE;
+  }
+  sem->count++;
+  xEventGroupSetBits(sem->ready, BIT0);
+  return pdTRUE;
+}
+
+UBaseType_t uxSemaphoreGetCount(SemaphoreHandle_t sem) {
+  std::lock_guard<std::recursive_mutex> g(host_lock());
+  return sem->count;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+// lwIP's BSD socket API is the host's
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// Multicast from the natively built modules goes out on the loopback
+// interface: a test receives it without a multicast route, and none of it
+// leaves the machine
+int host_socket(int domain, int type, int protocol);
+#define socket host_socket
+
+// A task waiting on the network is blocked as far as the simulated clock is
+// concerned: host_settle() does not wait for it to come back
+int host_accept(int fd, struct sockaddr *addr, socklen_t *len);
+int host_select(int n, fd_set *rfds, fd_set *wfds, fd_set *efds, struct timeval *tv);
+ssize_t host_recv(int fd, void *buf, size_t len, int flags);
+ssize_t host_send(int fd, const void *buf, size_t len, int flags);
+#define accept host_accept
+#define select host_select
+#define recv   host_recv
+#define send   host_send
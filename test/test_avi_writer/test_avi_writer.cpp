@@ -0,0 +1,333 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <vector>
+#include "avi_writer.h"
+#include "heap_mon.h"
+#include "sample_frames.h"
+
+// Memory sink; fail_at > 0 makes every write beyond that many bytes fail
+typedef struct {
+  std::vector<uint8_t> data;
+  size_t pos;
+  size_t fail_at;
+} mem_sink_t;
+
+static size_t mem_write(void *ctx, const uint8_t *p, size_t len) {
+  mem_sink_t *m = (mem_sink_t *)ctx;
+  if (m->fail_at && m->pos + len > m->fail_at) {
+    return 0;
+  }
+  if (m->pos + len > m->data.size()) {
+    m->data.resize(m->pos + len);
+  }
+  memcpy(m->data.data() + m->pos, p, len);
+  m->pos += len;
+  return len;
+}
+
+static bool mem_seek(void *ctx, uint64_t pos) {
+  mem_sink_t *m = (mem_sink_t *)ctx;
+  if (pos > m->data.size()) {
+    return false;
+  }
+  m->pos = pos;
+  return true;
+}
+
+static const uint8_t *frame_data(int i, size_t *len) {
+  *len = i & 1 ? sizeof(frame_b) : sizeof(frame_a);
+  return i & 1 ? frame_b : frame_a;
+}
+
+// Record n frames 100 ms apart (10 fps) with a buf_size write buffer
+static bool record(mem_sink_t *m, bool seekable, int n, uint32_t max_frames, size_t buf_size) {
+  avi_sink_t sink = {mem_write, seekable ? mem_seek : NULL, m};
+  std::vector<uint8_t> buf(buf_size);
+  avi_writer_t w;
+  if (!avi_writer_begin(&w, &sink, 32, 24, 15000, buf.data(), buf.size(), max_frames)) {
+    return false;
+  }
+  bool ok = true;
+  for (int i = 0; i < n && ok; i++) {
+    size_t len;
+    const uint8_t *p = frame_data(i, &len);
+    ok = avi_writer_add_frame(&w, p, len, 5000000 + (int64_t)i * 100000);
+  }
+  return avi_writer_end(&w) && ok;
+}
+
+static uint32_t rd16(const uint8_t *p) {
+  return p[0] | p[1] << 8;
+}
+
+static uint32_t rd32(const uint8_t *p) {
+  return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static uint64_t rd64(const uint8_t *p) {
+  return rd32(p) | (uint64_t)rd32(p + 4) << 32;
+}
+
+static bool is_cc(const uint8_t *p, const char *cc) {
+  return !memcmp(p, cc, 4);
+}
+
+// First chunk in [pos, end) whose fourcc, or list type, is cc; 0 if none
+static size_t find_chunk(const std::vector<uint8_t> &d, size_t pos, size_t end, const char *cc) {
+  while (pos + 8 <= end) {
+    const uint8_t *p = d.data() + pos;
+    bool list = is_cc(p, "LIST") || is_cc(p, "RIFF");
+    if (is_cc(p, cc) || (list && is_cc(p + 8, cc))) {
+      return pos;
+    }
+    uint32_t size = rd32(p + 4);
+    pos += 8 + size + (size & 1);
+  }
+  return 0;
+}
+
+static void check_frame_at(const std::vector<uint8_t> &d, uint64_t pos, uint32_t size, int i) {
+  size_t len;
+  const uint8_t *p = frame_data(i, &len);
+  TEST_ASSERT_EQUAL_UINT32(len, size);
+  TEST_ASSERT_TRUE(pos + len <= d.size());
+  TEST_ASSERT_EQUAL_MEMORY(p, d.data() + pos, len);
+}
+
+// Walk a file from a seekable sink and check every header, size and index
+// against the n frames that record() wrote; returns the number of RIFFs
+static uint32_t check_indexed(const std::vector<uint8_t> &d, int n) {
+  // the RIFFs tile the file exactly
+  uint32_t riffs = 0;
+  size_t pos = 0;
+  while (pos < d.size()) {
+    TEST_ASSERT_TRUE(is_cc(&d[pos], "RIFF"));
+    TEST_ASSERT_TRUE(is_cc(&d[pos + 8], riffs ? "AVIX" : "AVI "));
+    pos += 8 + rd32(&d[pos + 4]);
+    riffs++;
+  }
+  TEST_ASSERT_EQUAL_size_t(d.size(), pos);
+  size_t riff0_end = 8 + rd32(&d[4]);
+
+  size_t hdrl = find_chunk(d, 12, riff0_end, "hdrl");
+  TEST_ASSERT_EQUAL_size_t(12, hdrl);
+  size_t hdrl_end = hdrl + 8 + rd32(&d[hdrl + 4]);
+  size_t avih = find_chunk(d, hdrl + 12, hdrl_end, "avih");
+  TEST_ASSERT_NOT_EQUAL(0, avih);
+  TEST_ASSERT_EQUAL_UINT32(100000, rd32(&d[avih + 8]));  // us per frame, from the timestamps
+  TEST_ASSERT_EQUAL_UINT32(0x10, rd32(&d[avih + 20]) & 0x10);  // AVIF_HASINDEX
+  TEST_ASSERT_EQUAL_UINT32(32, rd32(&d[avih + 40]));
+  TEST_ASSERT_EQUAL_UINT32(24, rd32(&d[avih + 44]));
+  uint32_t riff0_frames = rd32(&d[avih + 24]);
+
+  size_t strl = find_chunk(d, hdrl + 12, hdrl_end, "strl");
+  size_t strl_end = strl + 8 + rd32(&d[strl + 4]);
+  size_t strh = find_chunk(d, strl + 12, strl_end, "strh");
+  TEST_ASSERT_TRUE(is_cc(&d[strh + 8], "vids"));
+  TEST_ASSERT_TRUE(is_cc(&d[strh + 12], "MJPG"));
+  TEST_ASSERT_EQUAL_UINT32(1000, rd32(&d[strh + 28]));   // dwScale
+  TEST_ASSERT_EQUAL_UINT32(10000, rd32(&d[strh + 32]));  // dwRate: 10 fps measured, not the nominal 15
+  TEST_ASSERT_EQUAL_UINT32(n, rd32(&d[strh + 40]));      // dwLength
+
+  // super index: one entry per RIFF pointing at its ix00
+  size_t indx = find_chunk(d, strl + 12, strl_end, "indx");
+  TEST_ASSERT_NOT_EQUAL(0, indx);
+  TEST_ASSERT_EQUAL_UINT32(4, rd16(&d[indx + 8]));
+  TEST_ASSERT_EQUAL_UINT8(0x00, d[indx + 11]);  // AVI_INDEX_OF_INDEXES
+  TEST_ASSERT_EQUAL_UINT32(riffs, rd32(&d[indx + 12]));
+  TEST_ASSERT_TRUE(is_cc(&d[indx + 16], "00dc"));
+  int frame = 0;
+  for (uint32_t r = 0; r < riffs; r++) {
+    const uint8_t *e = &d[indx + 32 + 16 * r];
+    uint64_t ix = rd64(e);
+    uint32_t ix_frames = rd32(e + 12);
+    TEST_ASSERT_TRUE(ix + rd32(e + 8) <= d.size());
+    TEST_ASSERT_TRUE(is_cc(&d[ix], "ix00"));
+    TEST_ASSERT_EQUAL_UINT32(rd32(e + 8), 8 + rd32(&d[ix + 4]));
+    TEST_ASSERT_EQUAL_UINT8(0x01, d[ix + 11]);  // AVI_INDEX_OF_CHUNKS
+    TEST_ASSERT_EQUAL_UINT32(ix_frames, rd32(&d[ix + 12]));
+    if (r == 0) {
+      TEST_ASSERT_EQUAL_UINT32(riff0_frames, ix_frames);
+    }
+    // standard index entries point at the JPEG data
+    uint64_t base = rd64(&d[ix + 20]);
+    TEST_ASSERT_TRUE(is_cc(&d[base], "movi"));
+    for (uint32_t i = 0; i < ix_frames; i++) {
+      const uint8_t *ie = &d[ix + 32 + 8 * i];
+      check_frame_at(d, base + rd32(ie), rd32(ie + 4), frame++);
+    }
+  }
+  TEST_ASSERT_EQUAL_INT(n, frame);
+
+  size_t odml = find_chunk(d, hdrl + 12, hdrl_end, "odml");
+  TEST_ASSERT_NOT_EQUAL(0, odml);
+  TEST_ASSERT_TRUE(is_cc(&d[odml + 12], "dmlh"));
+  TEST_ASSERT_EQUAL_UINT32(n, rd32(&d[odml + 20]));
+
+  // legacy idx1 of the first RIFF, offsets relative to the 'movi' fourcc
+  size_t movi = find_chunk(d, hdrl_end, riff0_end, "movi");
+  TEST_ASSERT_EQUAL_size_t(AVI_HEADER_SIZE - 12, movi);
+  size_t idx1 = find_chunk(d, movi, riff0_end, "idx1");
+  TEST_ASSERT_NOT_EQUAL(0, idx1);
+  TEST_ASSERT_EQUAL_UINT32(16 * riff0_frames, rd32(&d[idx1 + 4]));
+  for (uint32_t i = 0; i < riff0_frames; i++) {
+    const uint8_t *e = &d[idx1 + 8 + 16 * i];
+    TEST_ASSERT_TRUE(is_cc(e, "00dc"));
+    TEST_ASSERT_EQUAL_UINT32(0x10, rd32(e + 4));  // AVIIF_KEYFRAME
+    size_t chunk = movi + 8 + rd32(e + 8);
+    TEST_ASSERT_TRUE(is_cc(&d[chunk], "00dc"));
+    TEST_ASSERT_EQUAL_UINT32(rd32(e + 12), rd32(&d[chunk + 4]));
+    check_frame_at(d, chunk + 8, rd32(e + 12), i);
+  }
+  return riffs;
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_single_riff() {
+  mem_sink_t m = {};
+  TEST_ASSERT_TRUE(record(&m, true, 5, 16, 4096));
+  TEST_ASSERT_EQUAL_UINT32(1, check_indexed(m.data, 5));
+}
+
+void test_avix_riffs_when_the_index_fills() {
+  mem_sink_t m = {};
+  TEST_ASSERT_TRUE(record(&m, true, 8, 3, 4096));
+  TEST_ASSERT_EQUAL_UINT32(3, check_indexed(m.data, 8));
+}
+
+void test_output_does_not_depend_on_the_buffer_size() {
+  mem_sink_t big = {}, small = {};
+  TEST_ASSERT_TRUE(record(&big, true, 7, 3, 64 * 1024));
+  TEST_ASSERT_TRUE(record(&small, true, 7, 3, 16));
+  TEST_ASSERT_EQUAL_size_t(big.data.size(), small.data.size());
+  TEST_ASSERT_EQUAL_MEMORY(big.data.data(), small.data.data(), big.data.size());
+}
+
+void test_stream_has_open_ended_sizes_and_no_index() {
+  mem_sink_t m = {};
+  TEST_ASSERT_TRUE(record(&m, false, 4, 0, 4096));
+  const std::vector<uint8_t> &d = m.data;
+  TEST_ASSERT_EQUAL_UINT32(0, rd32(&d[4]));                    // RIFF size
+  TEST_ASSERT_EQUAL_UINT32(0, rd32(&d[AVI_HEADER_SIZE - 8]));  // movi size
+  TEST_ASSERT_TRUE(is_cc(&d[AVI_HEADER_SIZE - 4], "movi"));
+  size_t pos = AVI_HEADER_SIZE;
+  for (int i = 0; i < 4; i++) {
+    TEST_ASSERT_TRUE(is_cc(&d[pos], "00dc"));
+    uint32_t size = rd32(&d[pos + 4]);
+    check_frame_at(d, pos + 8, size, i);
+    pos += 8 + size + (size & 1);
+  }
+  TEST_ASSERT_EQUAL_size_t(d.size(), pos);
+}
+
+// What /record.avi does: a stream's header is never patched, so its rate is
+// measured on the first two frames before the header goes out
+void test_stream_header_has_the_measured_rate() {
+  mem_sink_t m = {};
+  avi_sink_t sink = {mem_write, NULL, &m};
+  uint8_t buf[4096];
+  avi_writer_t w;
+  const int64_t t0 = 5000000, t1 = t0 + 50000;  // 20 fps
+  uint32_t fps_milli = avi_fps_milli(2, t0, t1);
+  TEST_ASSERT_EQUAL_UINT32(20000, fps_milli);
+  TEST_ASSERT_TRUE(avi_writer_begin(&w, &sink, 32, 24, fps_milli, buf, sizeof(buf), 0));
+  for (int i = 0; i < 6; i++) {
+    size_t len;
+    const uint8_t *p = frame_data(i, &len);
+    // later frames come slower: the header keeps the rate it started with
+    TEST_ASSERT_TRUE(avi_writer_add_frame(&w, p, len, t0 + (int64_t)i * 100000));
+  }
+  TEST_ASSERT_TRUE(avi_writer_end(&w));
+
+  const std::vector<uint8_t> &d = m.data;
+  size_t hdrl_end = 12 + 8 + rd32(&d[16]);
+  size_t avih = find_chunk(d, 24, hdrl_end, "avih");
+  TEST_ASSERT_NOT_EQUAL(0, avih);
+  TEST_ASSERT_EQUAL_UINT32(50000, rd32(&d[avih + 8]));  // dwMicroSecPerFrame
+  TEST_ASSERT_EQUAL_UINT32(0, rd32(&d[avih + 20]) & 0x10);  // no AVIF_HASINDEX
+  size_t strl = find_chunk(d, 24, hdrl_end, "strl");
+  size_t strh = find_chunk(d, strl + 12, strl + 8 + rd32(&d[strl + 4]), "strh");
+  TEST_ASSERT_EQUAL_UINT32(1000, rd32(&d[strh + 28]));   // dwScale
+  TEST_ASSERT_EQUAL_UINT32(20000, rd32(&d[strh + 32]));  // dwRate
+  TEST_ASSERT_EQUAL_UINT32(0, rd32(&d[strh + 40]));      // dwLength, open ended
+
+  // without a rate the header says 1 fps, which is what an idle pipe's fps of
+  // 0 used to produce
+  TEST_ASSERT_EQUAL_UINT32(0, avi_fps_milli(1, t0, t0));
+  TEST_ASSERT_EQUAL_UINT32(0, avi_fps_milli(2, t1, t0));
+  mem_sink_t nominal = {};
+  sink.ctx = &nominal;
+  TEST_ASSERT_TRUE(avi_writer_begin(&w, &sink, 32, 24, 0, buf, sizeof(buf), 0));
+  TEST_ASSERT_TRUE(avi_writer_end(&w));
+  TEST_ASSERT_EQUAL_UINT32(1000000, rd32(&nominal.data[avih + 8]));
+  TEST_ASSERT_EQUAL_UINT32(1000, rd32(&nominal.data[strh + 32]));
+}
+
+void test_write_failure_is_reported_and_the_index_freed() {
+  mem_sink_t m = {};
+  m.fail_at = AVI_HEADER_SIZE + 2000;
+  TEST_ASSERT_FALSE(record(&m, true, 6, 16, 256));
+  heap_tag_stats_t t;
+  heap_mon_get_tag(HEAP_TAG_AVI, &t);
+  TEST_ASSERT_EQUAL_UINT32(0, t.live_count);
+  TEST_ASSERT_EQUAL_UINT32(0, t.live_bytes);
+}
+
+// Count the frames with ffprobe: that is, decode the file the way players do
+static int ffprobe_frames(const std::vector<uint8_t> &d, char *info, size_t info_len) {
+  char path[] = "/tmp/avi_writer_XXXXXX";
+  int fd = mkstemp(path);
+  TEST_ASSERT_TRUE(fd >= 0);
+  TEST_ASSERT_EQUAL_INT((int)d.size(), (int)write(fd, d.data(), d.size()));
+  close(fd);
+  char cmd[256];
+  snprintf(cmd, sizeof(cmd),
+           "ffprobe -v error -select_streams v:0 -count_frames -show_entries stream=codec_name,width,height,nb_read_frames -of csv=p=0 %s",
+           path);
+  FILE *p = popen(cmd, "r");
+  TEST_ASSERT_NOT_NULL(p);
+  info[0] = 0;
+  if (!fgets(info, info_len, p)) {
+    info[0] = 0;
+  }
+  int status = pclose(p);
+  unlink(path);
+  info[strcspn(info, "\r\n")] = 0;
+  return status;
+}
+
+void test_ffprobe_reads_every_frame() {
+  if (system("ffprobe -version > /dev/null 2>&1") != 0) {
+    TEST_IGNORE_MESSAGE("ffprobe not on PATH");
+  }
+  char info[128];
+  mem_sink_t single = {}, multi = {}, stream = {};
+  TEST_ASSERT_TRUE(record(&single, true, 5, 16, 4096));
+  TEST_ASSERT_TRUE(record(&multi, true, 8, 3, 4096));
+  TEST_ASSERT_TRUE(record(&stream, false, 4, 0, 4096));
+
+  TEST_ASSERT_EQUAL_INT(0, ffprobe_frames(single.data, info, sizeof(info)));
+  TEST_ASSERT_EQUAL_STRING("mjpeg,32,24,5", info);
+  TEST_ASSERT_EQUAL_INT(0, ffprobe_frames(multi.data, info, sizeof(info)));
+  TEST_ASSERT_EQUAL_STRING("mjpeg,32,24,8", info);
+  TEST_ASSERT_EQUAL_INT(0, ffprobe_frames(stream.data, info, sizeof(info)));
+  TEST_ASSERT_EQUAL_STRING("mjpeg,32,24,4", info);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_single_riff);
+  RUN_TEST(test_avix_riffs_when_the_index_fills);
+  RUN_TEST(test_output_does_not_depend_on_the_buffer_size);
+  RUN_TEST(test_stream_has_open_ended_sizes_and_no_index);
+  RUN_TEST(test_stream_header_has_the_measured_rate);
+  RUN_TEST(test_write_failure_is_reported_and_the_index_freed);
+  RUN_TEST(test_ffprobe_reads_every_frame);
+  return UNITY_END();
+}
@@ -0,0 +1,341 @@
+#include <unity.h>
+#include <Arduino.h>
+#include <Preferences.h>
+#include <host_alloc.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include "cmd_registry.h"
+#include "camera_settings.h"
+#include "serial_cmds.h"
+#include "serial_proto.h"
+
+extern String wifi_ssid;
+extern String wifi_password;
+
+static void to_string(void *ctx, const char *s, size_t len) {
+  ((std::string *)ctx)->append(s, len);
+}
+
+static int run(const char *line, std::string *text = NULL) {
+  std::string sink;
+  char buf[256];
+  strlcpy(buf, line, sizeof(buf));
+  cmd_out_t out = {to_string, text ? text : &sink};
+  if (text) {
+    text->clear();
+  }
+  return cmd_run(buf, &out);
+}
+
+// The table's names, in order, as help lists them
+static std::vector<std::string> command_names() {
+  std::string help;
+  cmd_out_t out = {to_string, &help};
+  cmd_print_help(&out);
+  std::vector<std::string> names;
+  for (size_t at = help.find("\n  "); at != std::string::npos; at = help.find("\n  ", at + 1)) {
+    size_t end = help.find_first_of(" \n", at + 3);
+    names.push_back(help.substr(at + 3, end - at - 3));
+  }
+  return names;
+}
+
+// Reference lookup: scan the whole table
+static const char *linear_find(const std::vector<std::string> &names, const std::string &key, bool *ambiguous) {
+  const char *found = NULL;
+  int matches = 0;
+  *ambiguous = false;
+  for (const std::string &n : names) {
+    if (!strcasecmp(n.c_str(), key.c_str())) {
+      return n.c_str();
+    }
+    if (key.size() && !strncasecmp(n.c_str(), key.c_str(), key.size())) {
+      found = n.c_str();
+      matches++;
+    }
+  }
+  *ambiguous = matches > 1;
+  return matches == 1 ? found : NULL;
+}
+
+static void check_lookup(const std::vector<std::string> &names, const std::string &key) {
+  bool amb_ref, amb;
+  const char *want = linear_find(names, key, &amb_ref);
+  const cmd_t *got = cmd_find(key.c_str(), key.size(), &amb);
+  char msg[96];
+  snprintf(msg, sizeof(msg), "lookup of '%s'", key.c_str());
+  TEST_ASSERT_TRUE_MESSAGE((want == NULL) == (got == NULL), msg);
+  TEST_ASSERT_TRUE_MESSAGE(!want || !strcmp(want, got->name), msg);
+  TEST_ASSERT_TRUE_MESSAGE(amb_ref == amb, msg);
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_table_is_sorted_and_complete() {
+  std::vector<std::string> names = command_names();
+  TEST_ASSERT_EQUAL_size_t(14, names.size());
+  for (size_t i = 1; i < names.size(); i++) {
+    TEST_ASSERT_TRUE(names[i - 1] < names[i]);
+  }
+  for (const std::string &n : names) {
+    bool amb;
+    const cmd_t *c = cmd_find(n.c_str(), n.size(), &amb);
+    TEST_ASSERT_NOT_NULL(c);
+    TEST_ASSERT_EQUAL_STRING(n.c_str(), c->name);
+    TEST_ASSERT_NOT_NULL(c->run);
+  }
+}
+
+void test_lookup_matches_a_linear_scan() {
+  std::vector<std::string> names = command_names();
+  // every prefix of every name, in both cases, and one past the end
+  for (const std::string &n : names) {
+    for (size_t len = 0; len <= n.size(); len++) {
+      std::string key = n.substr(0, len), upper = key;
+      for (char &c : upper) {
+        c = toupper(c);
+      }
+      check_lookup(names, key);
+      check_lookup(names, upper);
+      check_lookup(names, key + "x");
+      check_lookup(names, key + " ");
+    }
+  }
+  // and random words over the letters the names use
+  std::mt19937 rng(48);
+  const char letters[] = "acdeghilnopstwfSHW";
+  for (int it = 0; it < 100000; it++) {
+    std::string key;
+    int n = rng() % 10;
+    for (int i = 0; i < n; i++) {
+      key += letters[rng() % (sizeof(letters) - 1)];
+    }
+    check_lookup(names, key);
+  }
+}
+
+void test_prefixes_and_unknown_names() {
+  std::string text;
+  TEST_ASSERT_EQUAL_INT(0, run("wifis", &text));
+  TEST_ASSERT_TRUE(text.find("Link: ") != std::string::npos);
+  TEST_ASSERT_EQUAL_INT(CMD_ERR_AMBIGUOUS, run("se", &text));
+  TEST_ASSERT_EQUAL_STRING("Ambiguous command 'se'\n", text.c_str());
+  TEST_ASSERT_EQUAL_INT(CMD_ERR_AMBIGUOUS, run("sh", &text));
+  TEST_ASSERT_EQUAL_INT(CMD_ERR_UNKNOWN, run("reboot now", &text));
+  TEST_ASSERT_EQUAL_STRING("Unknown command 'reboot'. Type 'help' for commands.\n", text.c_str());
+  TEST_ASSERT_EQUAL_INT(0, run("", &text));
+  TEST_ASSERT_EQUAL_INT(0, run(" \t ", &text));
+  TEST_ASSERT_EQUAL_STRING("", text.c_str());
+  // an exact name wins over the longer ones it prefixes
+  TEST_ASSERT_EQUAL_INT(0, run("  SHOW  ", &text));
+  TEST_ASSERT_TRUE(text.find("SSID: ") == 0);
+}
+
+void test_arguments_are_checked_against_the_schema() {
+  std::string text;
+  TEST_ASSERT_EQUAL_INT(CMD_ERR_USAGE, run("set", &text));
+  TEST_ASSERT_EQUAL_STRING("Usage: set <setting> <value>\n", text.c_str());
+  TEST_ASSERT_EQUAL_INT(CMD_ERR_USAGE, run("set quality", &text));
+  TEST_ASSERT_EQUAL_INT(CMD_ERR_USAGE, run("set quality 1x", &text));
+  TEST_ASSERT_EQUAL_INT(CMD_ERR_USAGE, run("set quality 10 more", &text));
+  TEST_ASSERT_EQUAL_INT(CMD_ERR_USAGE, run("get quality more", &text));
+  TEST_ASSERT_EQUAL_STRING("Usage: get [setting]\n", text.c_str());
+  TEST_ASSERT_EQUAL_INT(CMD_ERR_USAGE, run("help me", &text));
+
+  TEST_ASSERT_EQUAL_INT(0, run("set quality 0x0c", &text));
+  TEST_ASSERT_EQUAL_INT(12, camera_setting_read(camera_setting_index("quality")));
+  TEST_ASSERT_EQUAL_INT(0, run("set\tbrightness   -2", &text));
+  TEST_ASSERT_EQUAL_INT(-2, camera_setting_read(camera_setting_index("brightness")));
+  TEST_ASSERT_EQUAL_INT(0, run("get quality", &text));
+  TEST_ASSERT_EQUAL_STRING("quality = 12\n", text.c_str());
+  TEST_ASSERT_EQUAL_INT(-1, run("set nope 1", &text));
+  TEST_ASSERT_EQUAL_STRING("Failed to set 'nope' (-1)\n", text.c_str());
+
+  // handler side checks come back as usage errors too
+  TEST_ASSERT_EQUAL_INT(CMD_ERR_USAGE, run("snap 9", &text));
+  TEST_ASSERT_EQUAL_STRING("Usage: snap [baud]\n", text.c_str());
+  TEST_ASSERT_EQUAL_INT(CMD_ERR_USAGE, run("setip 10.0.0.2 10.0.0.1 bad", &text));
+  TEST_ASSERT_EQUAL_INT(CMD_ERR_USAGE, run("setip 10.0.0.2", &text));
+}
+
+void test_rest_of_line_arguments() {
+  std::string text;
+  TEST_ASSERT_EQUAL_INT(0, run("setssid   My Home Net  ", &text));
+  TEST_ASSERT_EQUAL_STRING("My Home Net", wifi_ssid.c_str());
+  TEST_ASSERT_EQUAL_INT(0, run("setpass pa ss", &text));
+  TEST_ASSERT_EQUAL_STRING("pa ss", wifi_password.c_str());
+  TEST_ASSERT_EQUAL_INT(CMD_ERR_USAGE, run("setpass   ", &text));
+
+  Preferences p;
+  p.begin("wifi", true);
+  TEST_ASSERT_EQUAL_STRING("My Home Net", p.getString("ssid", "").c_str());
+  TEST_ASSERT_EQUAL_STRING("pa ss", p.getString("pass", "").c_str());
+  p.end();
+
+  TEST_ASSERT_EQUAL_INT(0, run("show", &text));
+  TEST_ASSERT_EQUAL_STRING("SSID: My Home Net\nPassword: *****\n", text.c_str());
+
+  TEST_ASSERT_EQUAL_INT(0, run("del", &text));
+  p.begin("wifi", true);
+  TEST_ASSERT_FALSE(p.isKey("ssid"));
+  TEST_ASSERT_FALSE(p.isKey("pass"));
+  p.end();
+}
+
+// /control runs "set" with the query's var and val
+void test_call_with_split_arguments() {
+  const char *ok[] = {"framesize", "9"};
+  TEST_ASSERT_EQUAL_INT(0, cmd_call("set", 2, ok, NULL));
+  TEST_ASSERT_EQUAL_INT(9, camera_setting_read(camera_setting_index("framesize")));
+  // no splitting happens: spaces are part of the value
+  const char *spaced[] = {"framesize", "9 9"};
+  TEST_ASSERT_EQUAL_INT(CMD_ERR_USAGE, cmd_call("set", 2, spaced, NULL));
+  const char *bad[] = {"quality", "abc"};
+  TEST_ASSERT_EQUAL_INT(CMD_ERR_USAGE, cmd_call("set", 2, bad, NULL));
+  TEST_ASSERT_EQUAL_INT(CMD_ERR_USAGE, cmd_call("set", 1, bad, NULL));
+  const char *three[] = {"quality", "1", "2"};
+  TEST_ASSERT_EQUAL_INT(CMD_ERR_USAGE, cmd_call("set", 3, three, NULL));
+  TEST_ASSERT_EQUAL_INT(CMD_ERR_UNKNOWN, cmd_call("se", 2, ok, NULL));
+  TEST_ASSERT_EQUAL_INT(CMD_ERR_UNKNOWN, cmd_call("bogus", 0, NULL, NULL));
+}
+
+// The console: bytes in through Serial, one line at a time into the registry
+void test_serial_console_dispatches_lines() {
+  int sv[2];
+  TEST_ASSERT_EQUAL_INT(0, socketpair(AF_UNIX, SOCK_STREAM, 0, sv));
+  Serial.host_attach(sv[1]);
+
+  // typed with a correction and a CRLF ending
+  const char typed[] = "sEt qualityy\x7f 7\r\nget quality\n";
+  TEST_ASSERT_EQUAL_INT((int)sizeof(typed) - 1, (int)write(sv[0], typed, sizeof(typed) - 1));
+  serialCmdsLoop();
+  TEST_ASSERT_EQUAL_INT(7, camera_setting_read(camera_setting_index("quality")));
+
+  char buf[512];
+  ssize_t n = read(sv[0], buf, sizeof(buf) - 1);
+  TEST_ASSERT_TRUE(n > 0);
+  buf[n] = 0;
+  // echo without the CR, the erased character rubbed out, then the output
+  TEST_ASSERT_EQUAL_STRING("sEt qualityy\b \b 7\n\nget quality\n\nquality = 7\n", buf);
+
+  // "snap" hands the console to the binary protocol at the new rate
+  const char snap[] = "snap 921600\n";
+  TEST_ASSERT_EQUAL_INT((int)sizeof(snap) - 1, (int)write(sv[0], snap, sizeof(snap) - 1));
+  serialCmdsLoop();
+  n = read(sv[0], buf, sizeof(buf) - 1);
+  buf[n > 0 ? n : 0] = 0;
+  TEST_ASSERT_TRUE(strstr(buf, "SNAP 921600\n") != NULL);
+  TEST_ASSERT_EQUAL_UINT32(921600, Serial.baudRate());
+  TEST_ASSERT_TRUE(serial_proto_feed('h'));
+
+  Serial.host_attach(-1);
+  close(sv[0]);
+  close(sv[1]);
+}
+
+// What the serial shell did before the registry: trim a String copy of the
+// line, then a chain of equalsIgnoreCase()/startsWith() (std::string stands
+// in for String)
+static bool equals_ignore_case(const std::string &a, const char *b) {
+  return !strcasecmp(a.c_str(), b);
+}
+
+static int legacy_handle(std::string cmd) {
+  size_t b = cmd.find_first_not_of(" \t\r\n"), e = cmd.find_last_not_of(" \t\r\n");
+  cmd = b == std::string::npos ? "" : cmd.substr(b, e - b + 1);
+  if (cmd.empty()) return 0;
+  if (equals_ignore_case(cmd, "help")) return 1;
+  if (cmd.rfind("setssid ", 0) == 0) return 2;
+  if (cmd.rfind("setpass ", 0) == 0) return 3;
+  if (equals_ignore_case(cmd, "show")) {
+    std::string masked = "";
+    for (size_t i = 0; i < wifi_password.length(); ++i) masked += '*';
+    return 4 + (int)masked.size();
+  }
+  if (equals_ignore_case(cmd, "showip")) return 5;
+  if (equals_ignore_case(cmd, "connect")) return 6;
+  if (equals_ignore_case(cmd, "del")) return 7;
+  return -1;
+}
+
+template <typename F>
+static void measure(const char *what, int n, F fn) {
+  host_allocs_reset();
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < n; i++) {
+    fn(i);
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / n;
+  char msg[128];
+  if (HOST_ALLOCS_COUNTED) {
+    snprintf(msg, sizeof(msg), "%-34s %7.1f ns, %.2f allocs", what, ns, (double)host_allocs() / n);
+  } else {
+    snprintf(msg, sizeof(msg), "%-34s %7.1f ns", what, ns);
+  }
+  TEST_MESSAGE(msg);
+}
+
+void test_benchmark() {
+  std::vector<std::string> names = command_names();
+  std::vector<std::string> keys;
+  for (const std::string &n : names) {
+    for (size_t len = 1; len <= n.size(); len++) {
+      keys.push_back(n.substr(0, len));
+    }
+  }
+  const int n = 200000;
+  volatile uintptr_t sink = 0;
+  measure("lookup, binary search (cmd_find)", n, [&](int i) {
+    const std::string &k = keys[i % keys.size()];
+    bool amb;
+    sink = sink + (uintptr_t)cmd_find(k.c_str(), k.size(), &amb);
+  });
+  measure("lookup, linear scan", n, [&](int i) {
+    const std::string &k = keys[i % keys.size()];
+    bool amb;
+    sink = sink + (uintptr_t)linear_find(names, k, &amb);
+  });
+
+  wifi_password = "password";
+  cmd_out_t none = {NULL, NULL};
+  measure("\"show\", String chain (before)", n, [&](int i) { sink = sink + legacy_handle("  show \r"); });
+  measure("\"show\", cmd_run", n, [&](int i) {
+    char line[] = "  show \r";
+    sink = sink + cmd_run(line, &none);
+  });
+
+  // the parsing path allocates nothing
+  static const char *const lines[] = {"set quality 10", "get framesize", "wifis", "sh", "setip 10.0.0.2 10.0.0.1 255.0.0.0 bad", "set quality 1x"};
+  for (const char *line : lines) {
+    char buf[64];
+    std::string what = std::string("cmd_run \"") + line + "\"";
+    measure(what.c_str(), n / 4, [&](int i) {
+      strlcpy(buf, line, sizeof(buf));
+      sink = sink + cmd_run(buf, &none);
+    });
+    if (HOST_ALLOCS_COUNTED) {
+      TEST_ASSERT_EQUAL_size_t(0, host_allocs());
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_table_is_sorted_and_complete);
+  RUN_TEST(test_lookup_matches_a_linear_scan);
+  RUN_TEST(test_prefixes_and_unknown_names);
+  RUN_TEST(test_arguments_are_checked_against_the_schema);
+  RUN_TEST(test_rest_of_line_arguments);
+  RUN_TEST(test_call_with_split_arguments);
+  RUN_TEST(test_serial_console_dispatches_lines);
+  RUN_TEST(test_benchmark);
+  return UNITY_END();
+}
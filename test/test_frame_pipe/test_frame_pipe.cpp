@@ -0,0 +1,249 @@
+#include <unity.h>
+#include <Arduino.h>
+#include "esp_camera.h"
+#include "esp_timer.h"
+#include "freertos/task.h"
+#include "cam_watchdog.h"
+#include "frame_pipe.h"
+
+// The capture task and the consumers (stand-ins for the HTTP handlers) run as
+// host tasks against the fake driver in esp_host; a periodic timer is the
+// sensor. Everything moves in simulated time, but tasks that wake at the same
+// instant still race as they do on the two cores: a consumer may pick up a
+// frame just before or just after the next one replaces it, so the counts of
+// the slow runs vary by a frame or two.
+
+#define DEPTH      2
+#define SENSOR_MS  40  // 25 fps
+#define CONSUMERS  2
+
+typedef struct {
+  bool active;
+  uint32_t hold_ms;   // time one frame takes to go out
+  uint32_t last_seq;
+  uint32_t sent;
+  uint32_t skipped;   // frames replaced before this consumer got to them
+  bool holding;
+} consumer_t;
+
+static consumer_t _consumers[CONSUMERS];
+static TaskHandle_t _consumer_tasks[CONSUMERS];
+static esp_timer_handle_t _sensor;
+static uint8_t _jpeg[2048];
+
+static void consumer_task(void *arg) {
+  consumer_t *c = (consumer_t *)arg;
+  while (true) {
+    if (!c->active) {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      continue;
+    }
+    frame_t *f = frame_pipe_acquire(c->last_seq, 1000);
+    if (!f) {
+      continue;
+    }
+    c->skipped += c->last_seq ? f->seq - c->last_seq - 1 : 0;
+    c->last_seq = f->seq;
+    c->holding = true;
+    vTaskDelay(pdMS_TO_TICKS(c->hold_ms));
+    c->holding = false;
+    c->sent++;
+    frame_pipe_release(f);
+  }
+}
+
+static void shoot(void *arg) {
+  host_camera_shoot(_jpeg, sizeof(_jpeg), 640, 480);
+}
+
+static void consume(int i, uint32_t hold_ms) {
+  _consumers[i].active = true;
+  _consumers[i].hold_ms = hold_ms;
+  xTaskNotifyGive(_consumer_tasks[i]);
+}
+
+static frame_pipe_stats_t stats() {
+  frame_pipe_stats_t st;
+  host_settle();
+  frame_pipe_get_stats(&st);
+  return st;
+}
+
+// Counters at the start of a measurement; consumer counts start over
+typedef struct {
+  frame_pipe_stats_t st;
+  uint32_t shots;
+  uint32_t grabs;
+} mark_t;
+
+static mark_t mark() {
+  mark_t m = {stats(), host_camera.shots, host_camera.grabs};
+  for (consumer_t &c : _consumers) {
+    c.sent = 0;
+    c.skipped = 0;
+  }
+  return m;
+}
+
+// What happened since m
+typedef struct {
+  uint32_t shots;      // frames the sensor delivered
+  uint32_t grabs;      // of those, taken by the capture task
+  uint32_t published;
+  uint32_t slot_waits;
+  uint32_t most;       // most frames in flight seen
+} window_t;
+
+// Run for ms with the sensor on, sampling the frames in flight every 10 ms
+static window_t run_ms(const mark_t &m, uint32_t ms, const char *what) {
+  window_t w = {};
+  for (uint32_t t = 0; t < ms; t += 10) {
+    host_time_advance_ms(10);
+    uint32_t n = stats().in_flight;
+    w.most = n > w.most ? n : w.most;
+  }
+  frame_pipe_stats_t st = stats();
+  w.shots = host_camera.shots - m.shots;
+  w.grabs = host_camera.grabs - m.grabs;
+  w.published = st.frames - m.st.frames;
+  w.slot_waits = st.slot_waits - m.st.slot_waits;
+
+  char msg[192];
+  snprintf(
+    msg, sizeof(msg), "%-18s shots %3lu, grabbed %3lu, published %3lu, slot waits %3lu, in flight <= %lu, sent %3lu/%3lu, skipped %lu/%lu",
+    what, (unsigned long)w.shots, (unsigned long)w.grabs, (unsigned long)w.published, (unsigned long)w.slot_waits, (unsigned long)w.most,
+    (unsigned long)_consumers[0].sent, (unsigned long)_consumers[1].sent, (unsigned long)_consumers[0].skipped,
+    (unsigned long)_consumers[1].skipped
+  );
+  TEST_MESSAGE(msg);
+  return w;
+}
+
+static void start_sensor() {
+  esp_timer_start_periodic(_sensor, SENSOR_MS * 1000);
+  // past the first frames, which find the pipe idle
+  for (int i = 0; i < 20; i++) {
+    host_time_advance_ms(10);
+  }
+}
+
+// Consumers off and the pipe idle again, with every driver buffer back
+void setUp() {
+  for (consumer_t &c : _consumers) {
+    c.active = false;
+  }
+  esp_timer_stop(_sensor);
+  host_time_advance_ms(HOST_CAMERA_FB_TIMEOUT_MS + 2000);
+  TEST_ASSERT_EQUAL_INT(0, host_camera.fbs_held);
+  for (consumer_t &c : _consumers) {
+    c = consumer_t{};
+  }
+  host_camera.watchdog_action = CAM_WATCHDOG_NONE;
+}
+
+void tearDown() {}
+
+void test_fast_consumer_gets_every_frame() {
+  consume(0, 5);
+  start_sensor();
+  window_t w = run_ms(mark(), 2000, "fast consumer");
+  TEST_ASSERT_EQUAL_UINT32(2000 / SENSOR_MS, w.shots);
+  TEST_ASSERT_EQUAL_UINT32(w.shots, w.published);
+  TEST_ASSERT_EQUAL_UINT32(w.shots, _consumers[0].sent);
+  TEST_ASSERT_EQUAL_UINT32(0, _consumers[0].skipped);
+  TEST_ASSERT_EQUAL_UINT32(0, w.slot_waits);
+  TEST_ASSERT_TRUE(w.most <= DEPTH);
+}
+
+void test_slow_consumer_holds_back_the_capture_task() {
+  // 90 ms per frame against a 40 ms sensor: while it sends one frame and
+  // another is published, both slots are taken
+  consume(0, 90);
+  start_sensor();
+  window_t w = run_ms(mark(), 2000, "slow consumer");
+  TEST_ASSERT_EQUAL_UINT32(DEPTH, w.most);
+  TEST_ASSERT_TRUE(w.slot_waits >= _consumers[0].sent - 1);
+  // the consumer sets the pace; the frames it has no time for mostly stay in
+  // the driver, where the next grab overwrites them
+  TEST_ASSERT_UINT32_WITHIN(2, 2000 / 90, _consumers[0].sent);
+  TEST_ASSERT_EQUAL_UINT32(w.grabs, w.published);
+  TEST_ASSERT_TRUE(w.grabs < w.shots * 2 / 3);
+  TEST_ASSERT_UINT32_WITHIN(1, w.published, _consumers[0].sent + _consumers[0].skipped);
+}
+
+void test_two_slow_consumers_never_exceed_the_depth() {
+  consume(0, 90);
+  consume(1, 65);
+  start_sensor();
+  window_t w = run_ms(mark(), 2000, "two slow consumers");
+  TEST_ASSERT_EQUAL_UINT32(DEPTH, w.most);
+  TEST_ASSERT_TRUE(w.slot_waits > 0);
+  TEST_ASSERT_TRUE(host_camera.fbs_held <= DEPTH);
+  TEST_ASSERT_TRUE(w.grabs < w.shots * 2 / 3);
+  TEST_ASSERT_TRUE(_consumers[0].sent >= 2000 / 90 - 2);
+  TEST_ASSERT_TRUE(_consumers[1].sent >= _consumers[0].sent);
+}
+
+void test_stuck_consumer_stalls_the_others() {
+  // at depth 2, a frame that stays out plus the published one fill the pipe:
+  // the fast consumer gets nothing new until the slow one lets go
+  consume(0, 1505);
+  consume(1, 5);
+  start_sensor();
+  TEST_ASSERT_TRUE(_consumers[0].holding);
+  window_t w = run_ms(mark(), 1000, "stuck consumer");
+  TEST_ASSERT_EQUAL_UINT32(0, w.published);
+  TEST_ASSERT_EQUAL_UINT32(0, _consumers[1].sent);
+  TEST_ASSERT_EQUAL_UINT32(DEPTH, w.most);
+  frame_pipe_stats_t st = stats();
+  TEST_ASSERT_EQUAL_UINT32(DEPTH, st.in_flight);
+  TEST_ASSERT_EQUAL_UINT32(1, st.consumers);
+  // the capture task retries every 100 ms
+  TEST_ASSERT_UINT32_WITHIN(1, 10, w.slot_waits);
+
+  w = run_ms(mark(), 500, "stuck consumer done");
+  TEST_ASSERT_EQUAL_UINT32(1, _consumers[0].sent);
+  TEST_ASSERT_TRUE(_consumers[1].sent > 0);
+}
+
+void test_restart_waits_for_held_frames() {
+  consume(0, 3000);
+  host_camera_shoot(_jpeg, sizeof(_jpeg), 640, 480);
+  host_time_advance_ms(10);
+  TEST_ASSERT_TRUE(_consumers[0].holding);
+
+  // a failed grab asks for a restart while the consumer holds its frame
+  host_camera.watchdog_action = CAM_WATCHDOG_REINIT;
+  host_camera_shoot(NULL, 0, 0, 0);
+  host_time_advance_ms(2100);
+  TEST_ASSERT_EQUAL_INT(0, host_camera.restarts);
+  TEST_ASSERT_EQUAL_INT(1, host_camera.fbs_held);
+
+  // once it is back, the next failure restarts the driver
+  host_time_advance_ms(1000);
+  TEST_ASSERT_FALSE(_consumers[0].holding);
+  host_camera_shoot(NULL, 0, 0, 0);
+  host_time_advance_ms(10);
+  TEST_ASSERT_EQUAL_INT(1, host_camera.restarts);
+  TEST_ASSERT_EQUAL_INT(0, host_camera.fbs_held);
+  TEST_ASSERT_TRUE(stats().failures >= 2);
+}
+
+int main(int argc, char **argv) {
+  esp_timer_create_args_t args = {};
+  args.callback = shoot;
+  args.name = "sensor";
+  esp_timer_create(&args, &_sensor);
+  for (int i = 0; i < CONSUMERS; i++) {
+    xTaskCreate(consumer_task, "consumer", 4096, &_consumers[i], 5, &_consumer_tasks[i]);
+  }
+  frame_pipe_begin(DEPTH);
+
+  UNITY_BEGIN();
+  RUN_TEST(test_fast_consumer_gets_every_frame);
+  RUN_TEST(test_slow_consumer_holds_back_the_capture_task);
+  RUN_TEST(test_two_slow_consumers_never_exceed_the_depth);
+  RUN_TEST(test_stuck_consumer_stalls_the_others);
+  RUN_TEST(test_restart_waits_for_held_frames);
+  return UNITY_END();
+}
@@ -0,0 +1,258 @@
+#include <unity.h>
+#include <Arduino.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <random>
+#include <string>
+#include <vector>
+#include "cmd_registry.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "heap_mon.h"
+
+// The native env builds heap_mon in soak mode; the simulated regions in
+// esp_host give the free size and largest block it samples
+
+#define CAPS_PSRAM    MALLOC_CAP_SPIRAM
+#define CAPS_INTERNAL (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+#define UXGA_BMP_SIZE (1600 * 1200 * 3 + 54)
+
+static std::mt19937 _rng(49);
+
+static size_t between(size_t lo, size_t hi) {
+  return std::uniform_int_distribution<size_t>(lo, hi)(_rng);
+}
+
+static heap_tag_stats_t tag(heap_tag_t t) {
+  heap_tag_stats_t st;
+  heap_mon_get_tag(t, &st);
+  return st;
+}
+
+static heap_mon_stats_t stats() {
+  heap_mon_stats_t st;
+  heap_mon_get_stats(&st);
+  return st;
+}
+
+// What the timer sampled last, without the extra sample heap_mon_get_stats()
+// takes: the samples count only moves when the timer fires
+static uint32_t timer_samples = 0;
+
+static void advance_period() {
+  host_time_advance_ms(HEAP_MON_PERIOD_MS);
+  timer_samples++;
+}
+
+static void to_string(void *ctx, const char *s, size_t len) {
+  ((std::string *)ctx)->append(s, len);
+}
+
+static std::string run(const char *line) {
+  std::string text;
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%s", line);
+  cmd_out_t out = {to_string, &text};
+  cmd_run(buf, &out);
+  return text;
+}
+
+// Everything the console has been sent so far
+static std::string drain(int fd) {
+  std::string text;
+  char buf[512];
+  ssize_t n;
+  while ((n = recv(fd, buf, sizeof(buf), MSG_DONTWAIT)) > 0) {
+    text.append(buf, n);
+  }
+  return text;
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+// Before heap_mon_begin(): nothing here may be left allocated, the soak
+// baseline is taken by the next test
+void test_tag_accounting() {
+  size_t psram_free = heap_caps_get_free_size(CAPS_PSRAM);
+
+  void *p = heap_mon_malloc(HEAP_TAG_FRAME, 1001, CAPS_PSRAM);
+  TEST_ASSERT_NOT_NULL(p);
+  heap_tag_stats_t t = tag(HEAP_TAG_FRAME);
+  // accounted at the allocated size, not the requested one
+  TEST_ASSERT_EQUAL_UINT32(heap_caps_get_allocated_size(p), t.live_bytes);
+  TEST_ASSERT_EQUAL_UINT32(1008, t.live_bytes);
+  TEST_ASSERT_EQUAL_UINT32(1, t.live_count);
+  TEST_ASSERT_EQUAL_UINT32(1, t.allocs);
+  TEST_ASSERT_EQUAL_UINT32(psram_free - 1008, heap_caps_get_free_size(CAPS_PSRAM));
+
+  heap_mon_free(HEAP_TAG_FRAME, p);
+  t = tag(HEAP_TAG_FRAME);
+  TEST_ASSERT_EQUAL_UINT32(0, t.live_bytes);
+  TEST_ASSERT_EQUAL_UINT32(0, t.live_count);
+  TEST_ASSERT_EQUAL_UINT32(1008, t.peak_bytes);
+  TEST_ASSERT_EQUAL_UINT32(psram_free, heap_caps_get_free_size(CAPS_PSRAM));
+  TEST_ASSERT_EQUAL_UINT32(psram_free, heap_caps_get_largest_free_block(CAPS_PSRAM));
+
+  // caps 0 is plain malloc(), outside the monitored regions
+  p = heap_mon_malloc(HEAP_TAG_HTTP, 100, 0);
+  TEST_ASSERT_NOT_NULL(p);
+  TEST_ASSERT_GREATER_OR_EQUAL(100, tag(HEAP_TAG_HTTP).live_bytes);
+  heap_mon_free(HEAP_TAG_HTTP, p);
+  TEST_ASSERT_EQUAL_UINT32(0, tag(HEAP_TAG_HTTP).live_bytes);
+
+  // a library that failed: adopted NULL counts as a failure of that size
+  heap_mon_adopt(HEAP_TAG_AVI, NULL, 4096);
+  t = tag(HEAP_TAG_AVI);
+  TEST_ASSERT_EQUAL_UINT32(1, t.failures);
+  TEST_ASSERT_EQUAL_UINT32(4096, t.last_fail_size);
+  TEST_ASSERT_EQUAL_UINT32(0, t.allocs);
+  heap_mon_free(HEAP_TAG_AVI, NULL);
+
+  // more than the region holds
+  TEST_ASSERT_NULL(heap_mon_malloc(HEAP_TAG_BURST, HOST_HEAP_PSRAM_SIZE + 1, CAPS_PSRAM));
+  t = tag(HEAP_TAG_BURST);
+  TEST_ASSERT_EQUAL_UINT32(1, t.failures);
+  TEST_ASSERT_EQUAL_UINT32(HOST_HEAP_PSRAM_SIZE + 1, t.last_fail_size);
+  TEST_ASSERT_EQUAL_UINT32(0, t.live_bytes);
+}
+
+// The streaming and capture paths: long-lived buffers first, then per-request
+// outputs that are all gone by the end of the request. Fragmentation comes
+// and goes with the live frame but never builds up.
+void test_device_like_workload_passes_soak() {
+  // setup's scratch buffer goes once the long-lived ones are in, so the
+  // baseline starts out fragmented
+  void *scratch = heap_mon_malloc(HEAP_TAG_FRAME, 1 << 20, CAPS_PSRAM);
+  void *ring = heap_mon_malloc(HEAP_TAG_PRERECORD, 1 << 20, CAPS_PSRAM);
+  void *avi_index = heap_mon_malloc(HEAP_TAG_AVI, 64 << 10, CAPS_PSRAM);
+  void *filter = heap_mon_malloc(HEAP_TAG_HTTP, 2 << 10, CAPS_INTERNAL);
+  TEST_ASSERT_NOT_NULL(scratch);
+  TEST_ASSERT_NOT_NULL(ring);
+  TEST_ASSERT_NOT_NULL(avi_index);
+  TEST_ASSERT_NOT_NULL(filter);
+  heap_mon_free(HEAP_TAG_FRAME, scratch);
+
+  heap_mon_begin();
+  heap_mon_stats_t st = stats();
+  TEST_ASSERT_FALSE(st.soak_failed);
+  uint8_t psram_base = st.psram.frag_base, internal_base = st.internal.frag_base;
+  TEST_ASSERT_GREATER_THAN(0, psram_base);
+
+  uint32_t bmp_failures = tag(HEAP_TAG_BMP).failures;
+  void *prev = NULL;
+  for (int cycle = 0; cycle < 400; cycle++) {
+    // the next frame is encoded while the last one is still being sent
+    void *frame = heap_mon_malloc(HEAP_TAG_FRAME, between(40 << 10, 250 << 10), CAPS_PSRAM);
+    TEST_ASSERT_NOT_NULL(frame);
+    void *http = heap_mon_malloc(HEAP_TAG_HTTP, between(256, 4096), CAPS_INTERNAL);
+    TEST_ASSERT_NOT_NULL(http);
+    heap_mon_free(HEAP_TAG_FRAME, prev);
+    prev = frame;
+    if (cycle % 25 == 0) {
+      void *bmp = heap_mon_malloc(HEAP_TAG_BMP, UXGA_BMP_SIZE, CAPS_PSRAM);
+      TEST_ASSERT_NOT_NULL(bmp);
+      heap_mon_free(HEAP_TAG_BMP, bmp);
+    }
+    heap_mon_free(HEAP_TAG_HTTP, http);
+    if (cycle % 10 == 9) {
+      advance_period();
+    }
+  }
+  heap_mon_free(HEAP_TAG_FRAME, prev);
+  advance_period();
+
+  st = stats();
+  // the timer did the sampling, begin() and each stats() add one
+  TEST_ASSERT_EQUAL_UINT32(timer_samples + 3, st.samples);
+  TEST_ASSERT_FALSE(st.soak_failed);
+  TEST_ASSERT_EQUAL_UINT8(psram_base, st.psram.frag);
+  TEST_ASSERT_EQUAL_UINT8(internal_base, st.internal.frag);
+  TEST_ASSERT_LESS_OR_EQUAL(psram_base + HEAP_MON_SOAK_FRAG_PCT, st.psram.frag_max);
+  TEST_ASSERT_LESS_OR_EQUAL(internal_base + HEAP_MON_SOAK_FRAG_PCT, st.internal.frag_max);
+  TEST_ASSERT_GREATER_THAN(0, st.psram.frag_max);
+  TEST_ASSERT_EQUAL_UINT32(bmp_failures, tag(HEAP_TAG_BMP).failures);
+  TEST_ASSERT_EQUAL_UINT32(0, tag(HEAP_TAG_FRAME).live_bytes);
+  TEST_ASSERT_EQUAL_UINT32(2 << 10, tag(HEAP_TAG_HTTP).live_bytes);
+  TEST_ASSERT_TRUE(run("heap").find("FAILED") == std::string::npos);
+
+  heap_mon_free(HEAP_TAG_PRERECORD, ring);
+  heap_mon_free(HEAP_TAG_AVI, avi_index);
+  heap_mon_free(HEAP_TAG_HTTP, filter);
+}
+
+// Motion events that keep their trigger frame: the frame encoded just before
+// it is released and leaves a hole below the one that stays. As the scene gets
+// busier the frames grow, no longer fit the older holes and go further up.
+// Free PSRAM stays plentiful, the largest block does not, and the UXGA BMP
+// stops fitting.
+void test_fragmenting_workload_trips_soak() {
+  int sv[2];
+  TEST_ASSERT_EQUAL_INT(0, socketpair(AF_UNIX, SOCK_STREAM, 0, sv));
+  Serial.host_attach(sv[1]);
+
+  uint32_t bmp_failures = tag(HEAP_TAG_BMP).failures;
+  std::vector<void *> kept;
+  size_t kept_bytes = 0;
+  std::string console;
+  int tripped = -1;
+  for (int cycle = 0; cycle < 10; cycle++) {
+    size_t size = (160 << 10) + cycle * (8 << 10);
+    void *frame = heap_mon_malloc(HEAP_TAG_FRAME, size, CAPS_PSRAM);
+    TEST_ASSERT_NOT_NULL(frame);
+    void *trigger = heap_mon_malloc(HEAP_TAG_BURST, size + (4 << 10), CAPS_PSRAM);
+    TEST_ASSERT_NOT_NULL(trigger);
+    kept.push_back(trigger);
+    kept_bytes += size + (4 << 10);
+    heap_mon_free(HEAP_TAG_FRAME, frame);
+    void *bmp = heap_mon_malloc(HEAP_TAG_BMP, UXGA_BMP_SIZE, CAPS_PSRAM);
+    heap_mon_free(HEAP_TAG_BMP, bmp);
+    advance_period();
+    console += drain(sv[0]);
+    if (tripped < 0 && !console.empty()) {
+      tripped = cycle;
+    }
+  }
+  Serial.host_attach(-1);
+  close(sv[0]);
+  close(sv[1]);
+
+  // reported from the timer, before anyone asked, and only once
+  TEST_ASSERT_GREATER_THAN(0, tripped);
+  TEST_ASSERT_EQUAL_UINT32(0, console.find("HEAP SOAK FAIL: psram fragmentation "));
+  TEST_ASSERT_EQUAL_UINT32(console.size() - 1, console.find('\n'));
+  heap_mon_stats_t st = stats();
+  TEST_ASSERT_TRUE(st.soak_failed);
+  TEST_ASSERT_GREATER_THAN(st.psram.frag_base + HEAP_MON_SOAK_FRAG_PCT, st.psram.frag_max);
+  // still plenty free in total
+  TEST_ASSERT_GREATER_THAN(UXGA_BMP_SIZE, st.psram.free);
+
+  heap_tag_stats_t bmp = tag(HEAP_TAG_BMP);
+  TEST_ASSERT_GREATER_THAN(bmp_failures, bmp.failures);
+  TEST_ASSERT_EQUAL_UINT32(UXGA_BMP_SIZE, bmp.last_fail_size);
+  TEST_ASSERT_EQUAL_UINT32(0, bmp.live_bytes);
+  TEST_ASSERT_EQUAL_UINT32(kept_bytes, tag(HEAP_TAG_BURST).live_bytes);
+
+  std::string text = run("heap");
+  TEST_ASSERT_TRUE(text.find("Soak check FAILED") != std::string::npos);
+  TEST_ASSERT_TRUE(text.find("bmp") != std::string::npos);
+
+  // the failure stays latched after the heap recovers
+  for (void *p : kept) {
+    heap_mon_free(HEAP_TAG_BURST, p);
+  }
+  st = stats();
+  TEST_ASSERT_EQUAL_UINT8(0, st.psram.frag);
+  TEST_ASSERT_EQUAL_UINT32(HOST_HEAP_PSRAM_SIZE, st.psram.largest);
+  TEST_ASSERT_TRUE(st.soak_failed);
+  TEST_ASSERT_TRUE(run("heap").find("Soak check FAILED") != std::string::npos);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_tag_accounting);
+  RUN_TEST(test_device_like_workload_passes_soak);
+  RUN_TEST(test_fragmenting_workload_trips_soak);
+  return UNITY_END();
+}
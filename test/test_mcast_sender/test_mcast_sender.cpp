@@ -0,0 +1,317 @@
+#include <unity.h>
+#include <Arduino.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <random>
+#include <thread>
+#include <vector>
+#include "esp_camera.h"
+#include "frame_pipe.h"
+#include "mcast_sender.h"
+
+// The sender runs as in the device: the frame pipe hands it the frames a test
+// shoots, and it sends them to the group on the loopback interface (esp_host's
+// lwip/sockets.h). The test receives every datagram, drops the ones a case
+// names and reassembles the rest as tools/mcast_recv.py does.
+
+#define GROUP "239.255.0.1"
+
+typedef std::vector<uint8_t> bytes_t;
+
+// Frame sizes around the fragment and group boundaries
+static const size_t SIZES[] = {1, MCAST_PAYLOAD - 1, MCAST_PAYLOAD, MCAST_PAYLOAD + 1, 3 * MCAST_PAYLOAD, 8 * MCAST_PAYLOAD,
+                               8 * MCAST_PAYLOAD + 1, 20000, 45000};
+#define FRAMES (sizeof(SIZES) / sizeof(SIZES[0]))
+
+static int _rx = -1;
+static uint16_t _port = 0;
+static bytes_t _sent[FRAMES];
+static std::mt19937 _rng(32);
+
+// tools/mcast_recv.py's Frame
+struct frame_rx_t {
+  uint32_t frame_len = 0;
+  uint16_t count = 0;
+  uint16_t fec = 0;
+  bytes_t data;
+  std::vector<bool> have;
+  std::map<uint16_t, bytes_t> parity;
+  uint32_t recovered = 0;
+
+  void add(uint16_t frag, uint32_t offset, const uint8_t *p, size_t n) {
+    if (frag < count && !have[frag]) {
+      memcpy(&data[offset], p, n);
+      have[frag] = true;
+    }
+  }
+
+  void repair() {
+    for (auto it = parity.begin(); it != parity.end();) {
+      uint16_t first = it->first * fec;
+      uint16_t end = first + fec < count ? first + fec : count;
+      int missing = 0, lost = -1;
+      for (uint16_t i = first; i < end; i++) {
+        if (!have[i]) {
+          missing++;
+          lost = i;
+        }
+      }
+      if (missing != 1) {
+        ++it;
+        continue;
+      }
+      bytes_t buf = it->second;
+      for (uint16_t i = first; i < end; i++) {
+        size_t off = (size_t)i * MCAST_PAYLOAD;
+        size_t n = frame_len - off < MCAST_PAYLOAD ? frame_len - off : MCAST_PAYLOAD;
+        for (size_t k = 0; i != lost && k < n; k++) {
+          buf[k] ^= data[off + k];
+        }
+      }
+      size_t off = (size_t)lost * MCAST_PAYLOAD;
+      size_t n = frame_len - off < MCAST_PAYLOAD ? frame_len - off : MCAST_PAYLOAD;
+      add(lost, off, buf.data(), n);
+      recovered++;
+      it = parity.erase(it);
+    }
+  }
+
+  bool complete() const {
+    for (bool h : have) {
+      if (!h) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+typedef struct {
+  uint32_t datagrams;  // received, before the drops
+  uint32_t parities;
+  uint32_t dropped;
+  uint32_t frames;     // rebuilt and equal to what was shot
+  uint32_t recovered;  // fragments rebuilt from parity
+  uint32_t lost;       // frames that could not be rebuilt
+  uint32_t seq_gaps;
+} rx_stats_t;
+
+// Whether to drop a datagram: fragment index (or group for parity) of frame k
+typedef std::function<bool(size_t k, const mcast_hdr_t &h)> drop_fn;
+
+// The sender notices a stop request between frame waits, in simulated time,
+// so the clock keeps going while another thread waits for it
+static void restart(uint8_t fec) {
+  std::atomic<bool> done{false};
+  bool ok = false;
+  std::thread t([&] {
+    ok = mcast_sender_start(GROUP, _port, fec, 1);
+    done = true;
+  });
+  while (!done) {
+    host_time_advance_ms(10);
+  }
+  t.join();
+  TEST_ASSERT_TRUE(ok);
+  // a new sender starts with the frame the pipe still holds from the last run
+  host_time_advance_ms(40);
+  uint8_t pkt[2048];
+  while (recv(_rx, pkt, sizeof(pkt), 0) > 0) {
+  }
+}
+
+static bytes_t make_frame(size_t k) {
+  bytes_t b(SIZES[k]);
+  for (uint8_t &c : b) {
+    c = _rng();
+  }
+  b[0] = k;  // which frame this is, for the receiver
+  return b;
+}
+
+// Shoot every frame, receive what the sender makes of each and reassemble it
+// without the datagrams drop names
+static rx_stats_t run(uint8_t fec, drop_fn drop) {
+  restart(fec);
+  rx_stats_t st = {};
+  uint32_t last_seq = 0;
+  bool first = true;
+  for (size_t k = 0; k < FRAMES; k++) {
+    _sent[k] = make_frame(k);
+    host_camera_shoot(_sent[k].data(), _sent[k].size(), 640, 480);
+    host_time_advance_ms(40);
+
+    frame_rx_t f;
+    uint32_t frame_id = 0;
+    uint8_t pkt[2048];
+    ssize_t n;
+    while ((n = recv(_rx, pkt, sizeof(pkt), 0)) > 0) {
+      mcast_hdr_t h;
+      TEST_ASSERT_TRUE((size_t)n >= sizeof(h));
+      memcpy(&h, pkt, sizeof(h));
+      TEST_ASSERT_EQUAL_HEX16(MCAST_MAGIC, h.magic);
+      TEST_ASSERT_EQUAL_UINT8(MCAST_VERSION, h.version);
+      TEST_ASSERT_EQUAL_size_t(sizeof(h) + h.payload_len, (size_t)n);
+      TEST_ASSERT_EQUAL_UINT32(SIZES[k], h.frame_len);
+      TEST_ASSERT_EQUAL_UINT16(fec, h.fec_group);
+      st.seq_gaps += !first && h.seq != last_seq + 1;
+      last_seq = h.seq;
+      first = false;
+      st.datagrams++;
+      st.parities += (h.flags & MCAST_FLAG_PARITY) != 0;
+      if (drop(k, h)) {
+        st.dropped++;
+        continue;
+      }
+      if (f.data.empty()) {
+        frame_id = h.frame_id;
+        f.frame_len = h.frame_len;
+        f.count = h.frag_count;
+        f.fec = h.fec_group;
+        f.data.resize(h.frame_len);
+        f.have.assign(h.frag_count, false);
+      }
+      TEST_ASSERT_EQUAL_UINT32(frame_id, h.frame_id);
+      if (h.flags & MCAST_FLAG_PARITY) {
+        f.parity[h.frag] = bytes_t(pkt + sizeof(h), pkt + n);
+      } else {
+        TEST_ASSERT_EQUAL_UINT32((uint32_t)h.frag * MCAST_PAYLOAD, h.offset);
+        f.add(h.frag, h.offset, pkt + sizeof(h), h.payload_len);
+      }
+      if (f.fec) {
+        f.repair();
+      }
+    }
+    if (!f.data.empty() && f.complete()) {
+      TEST_ASSERT_TRUE_MESSAGE(f.data == _sent[k], "rebuilt frame differs");
+      st.frames++;
+      st.recovered += f.recovered;
+    } else {
+      st.lost++;
+    }
+  }
+  return st;
+}
+
+static uint16_t frags(size_t k) {
+  return (SIZES[k] + MCAST_PAYLOAD - 1) / MCAST_PAYLOAD;
+}
+
+static uint16_t groups(size_t k, uint8_t fec) {
+  return (frags(k) + fec - 1) / fec;
+}
+
+// Fragments of group g of frame k
+static uint16_t group_size(size_t k, uint8_t fec, uint16_t g) {
+  uint16_t left = frags(k) - g * fec;
+  return left < fec ? left : fec;
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_frames_arrive_whole() {
+  rx_stats_t st = run(8, [](size_t, const mcast_hdr_t &) { return false; });
+  uint32_t datagrams = 0, parities = 0;
+  for (size_t k = 0; k < FRAMES; k++) {
+    datagrams += frags(k) + groups(k, 8);
+    parities += groups(k, 8);
+  }
+  TEST_ASSERT_EQUAL_UINT32(datagrams, st.datagrams);
+  TEST_ASSERT_EQUAL_UINT32(parities, st.parities);
+  TEST_ASSERT_EQUAL_UINT32(FRAMES, st.frames);
+  TEST_ASSERT_EQUAL_UINT32(0, st.recovered);
+  TEST_ASSERT_EQUAL_UINT32(0, st.seq_gaps);
+}
+
+void test_one_loss_per_group_is_rebuilt() {
+  static const uint8_t fecs[] = {1, 3, 8, 32};
+  for (uint8_t fec : fecs) {
+    // a different member of every group, the short last fragment included
+    uint32_t expect = 0;
+    for (size_t k = 0; k < FRAMES; k++) {
+      expect += groups(k, fec);
+    }
+    rx_stats_t st = run(fec, [fec](size_t k, const mcast_hdr_t &h) {
+      if (h.flags & MCAST_FLAG_PARITY) {
+        return false;
+      }
+      uint16_t g = h.frag / fec;
+      return h.frag % fec == (k + g) % group_size(k, fec, g);
+    });
+    char msg[96];
+    snprintf(msg, sizeof(msg), "fec %u: %lu datagrams, %lu dropped, %lu rebuilt", fec, (unsigned long)st.datagrams, (unsigned long)st.dropped,
+             (unsigned long)st.recovered);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_EQUAL_UINT32(expect, st.dropped);
+    TEST_ASSERT_EQUAL_UINT32(expect, st.recovered);
+    TEST_ASSERT_EQUAL_UINT32(FRAMES, st.frames);
+    TEST_ASSERT_EQUAL_UINT32(0, st.lost);
+  }
+
+  // a lost parity datagram costs nothing when the data all arrived
+  rx_stats_t st = run(8, [](size_t k, const mcast_hdr_t &h) { return (h.flags & MCAST_FLAG_PARITY) != 0; });
+  TEST_ASSERT_EQUAL_UINT32(FRAMES, st.frames);
+  TEST_ASSERT_EQUAL_UINT32(0, st.recovered);
+}
+
+void test_two_losses_in_a_group_lose_the_frame() {
+  // odd frames lose the first two fragments of their last group
+  rx_stats_t st = run(8, [](size_t k, const mcast_hdr_t &h) {
+    uint16_t last = groups(k, 8) - 1;
+    return k % 2 && !(h.flags & MCAST_FLAG_PARITY) && h.frag / 8 == last && h.frag % 8 < 2 && group_size(k, 8, last) >= 2;
+  });
+  uint32_t lost = 0;
+  for (size_t k = 1; k < FRAMES; k += 2) {
+    lost += group_size(k, 8, groups(k, 8) - 1) >= 2;
+  }
+  TEST_ASSERT_TRUE(lost > 0);
+  TEST_ASSERT_EQUAL_UINT32(lost, st.lost);
+  TEST_ASSERT_EQUAL_UINT32(FRAMES - lost, st.frames);
+
+  // a fragment and the parity of its group
+  st = run(8, [](size_t k, const mcast_hdr_t &h) { return k == 7 && h.frag == 0; });
+  TEST_ASSERT_EQUAL_UINT32(1, st.lost);
+  TEST_ASSERT_EQUAL_UINT32(FRAMES - 1, st.frames);
+}
+
+void test_without_fec_any_loss_loses_the_frame() {
+  rx_stats_t st = run(0, [](size_t k, const mcast_hdr_t &h) { return k == 4 && h.frag == 1; });
+  TEST_ASSERT_EQUAL_UINT32(0, st.parities);
+  TEST_ASSERT_EQUAL_UINT32(1, st.lost);
+  TEST_ASSERT_EQUAL_UINT32(FRAMES - 1, st.frames);
+  TEST_ASSERT_EQUAL_UINT32(0, st.seq_gaps);
+}
+
+int main(int argc, char **argv) {
+  _rx = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+  int buf = 1 << 20;
+  setsockopt(_rx, SOL_SOCKET, SO_RCVBUF, &buf, sizeof(buf));
+  struct sockaddr_in local = {};
+  local.sin_family = AF_INET;
+  local.sin_addr.s_addr = htonl(INADDR_ANY);
+  bind(_rx, (struct sockaddr *)&local, sizeof(local));
+  socklen_t len = sizeof(local);
+  getsockname(_rx, (struct sockaddr *)&local, &len);
+  _port = ntohs(local.sin_port);
+  struct ip_mreq mreq = {};
+  inet_pton(AF_INET, GROUP, &mreq.imr_multiaddr);
+  mreq.imr_interface.s_addr = htonl(INADDR_LOOPBACK);
+  setsockopt(_rx, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq));
+  fcntl(_rx, F_SETFL, fcntl(_rx, F_GETFL) | O_NONBLOCK);
+  frame_pipe_begin(2);
+
+  UNITY_BEGIN();
+  RUN_TEST(test_frames_arrive_whole);
+  RUN_TEST(test_one_loss_per_group_is_rebuilt);
+  RUN_TEST(test_two_losses_in_a_group_lose_the_frame);
+  RUN_TEST(test_without_fec_any_loss_loses_the_frame);
+  return UNITY_END();
+}
@@ -0,0 +1,240 @@
+#include "coef_decoder.h"
+#include <string.h>
+
+typedef struct {
+  // canonical decoding: codes of each length are consecutive
+  int32_t maxcode[17];
+  int32_t valptr[17];
+  int32_t mincode[17];
+  uint8_t vals[256];
+  bool defined;
+} table_t;
+
+typedef struct {
+  const uint8_t *p;
+  const uint8_t *end;
+  uint32_t acc;
+  int n;
+  bool marker;  // hit a marker: feed zeros from here on
+} reader_t;
+
+static int bit(reader_t *r) {
+  if (!r->n) {
+    uint8_t b = 0;
+    if (!r->marker && r->p < r->end) {
+      b = *r->p;
+      if (b == 0xFF) {
+        if (r->p + 1 < r->end && r->p[1] == 0x00) {
+          r->p += 2;
+        } else {
+          r->marker = true;
+          b = 0;
+        }
+      } else {
+        r->p++;
+      }
+    }
+    r->acc = b;
+    r->n = 8;
+  }
+  r->n--;
+  return (r->acc >> r->n) & 1;
+}
+
+static uint32_t bits(reader_t *r, int n) {
+  uint32_t v = 0;
+  while (n--) {
+    v = (v << 1) | bit(r);
+  }
+  return v;
+}
+
+static int decode(reader_t *r, const table_t *t) {
+  int32_t code = 0;
+  for (int len = 1; len <= 16; len++) {
+    code = (code << 1) | bit(r);
+    if (code <= t->maxcode[len]) {
+      return t->vals[t->valptr[len] + code - t->mincode[len]];
+    }
+  }
+  return -1;
+}
+
+static int extend(uint32_t v, int s) {
+  return s && v < (1u << (s - 1)) ? (int)v - (1 << s) + 1 : (int)v;
+}
+
+static bool build_table(const uint8_t *counts, const uint8_t *vals, table_t *t) {
+  int k = 0, code = 0;
+  for (int len = 1; len <= 16; len++) {
+    t->valptr[len] = k;
+    t->mincode[len] = code;
+    code += counts[len - 1];
+    k += counts[len - 1];
+    t->maxcode[len] = counts[len - 1] ? code - 1 : -1;
+    code <<= 1;
+  }
+  if (k > 256) {
+    return false;
+  }
+  memcpy(t->vals, vals, k);
+  t->defined = true;
+  return true;
+}
+
+static uint16_t be16(const uint8_t *p) {
+  return p[0] << 8 | p[1];
+}
+
+bool coef_decode(const uint8_t *p, size_t len, coef_image_t *img) {
+  table_t dc[4] = {}, ac[4] = {};
+  const uint8_t *end = p + len;
+  img->dri = 0;
+  img->ncomps = 0;
+  if (len < 4 || p[0] != 0xFF || p[1] != 0xD8) {
+    return false;
+  }
+  const uint8_t *q = p + 2;
+  int scan[3], nscan = 0;
+  while (true) {
+    if (q + 4 > end || q[0] != 0xFF) {
+      return false;
+    }
+    uint8_t m = q[1];
+    const uint8_t *seg = q + 4;
+    size_t seg_len = be16(q + 2) - 2;
+    if (seg + seg_len > end) {
+      return false;
+    }
+    if (m == 0xC0) {
+      img->height = be16(seg + 1);
+      img->width = be16(seg + 3);
+      img->ncomps = seg[5];
+      if (img->ncomps != 1 && img->ncomps != 3) {
+        return false;
+      }
+      img->h_max = img->v_max = 1;
+      for (int i = 0; i < img->ncomps; i++) {
+        coef_comp_t *c = &img->comps[i];
+        c->id = seg[6 + 3 * i];
+        c->h = seg[7 + 3 * i] >> 4;
+        c->v = seg[7 + 3 * i] & 15;
+        c->tq = seg[8 + 3 * i];
+        img->h_max = c->h > img->h_max ? c->h : img->h_max;
+        img->v_max = c->v > img->v_max ? c->v : img->v_max;
+      }
+    } else if ((m >= 0xC1 && m <= 0xCF) && m != 0xC4 && m != 0xC8 && m != 0xCC) {
+      return false;  // not baseline
+    } else if (m == 0xC4) {
+      for (size_t i = 0; i < seg_len;) {
+        int cls = seg[i] >> 4, id = seg[i] & 3;
+        const uint8_t *counts = seg + i + 1;
+        int n = 0;
+        for (int k = 0; k < 16; k++) {
+          n += counts[k];
+        }
+        if (!build_table(counts, counts + 16, cls ? &ac[id] : &dc[id])) {
+          return false;
+        }
+        i += 17 + n;
+      }
+    } else if (m == 0xDB) {
+      for (size_t i = 0; i < seg_len;) {
+        int prec = seg[i] >> 4, id = seg[i] & 3;
+        for (int k = 0; k < 64; k++) {
+          img->q[id][k] = prec ? be16(seg + i + 1 + 2 * k) : seg[i + 1 + k];
+        }
+        i += 1 + 64 * (prec ? 2 : 1);
+      }
+    } else if (m == 0xDD) {
+      img->dri = be16(seg);
+    } else if (m == 0xDA) {
+      nscan = seg[0];
+      for (int i = 0; i < nscan; i++) {
+        for (int c = 0; c < img->ncomps; c++) {
+          if (img->comps[c].id == seg[1 + 2 * i]) {
+            scan[i] = c;
+            img->comps[c].td = seg[2 + 2 * i] >> 4;
+            img->comps[c].ta = seg[2 + 2 * i] & 15;
+          }
+        }
+      }
+      q = seg + seg_len;
+      break;
+    }
+    q = seg + seg_len;
+  }
+  if (!img->ncomps || nscan != img->ncomps) {
+    return false;
+  }
+
+  bool single = nscan == 1;
+  int mcu_w = single ? 8 : 8 * img->h_max;
+  int mcu_h = single ? 8 : 8 * img->v_max;
+  int mcus_x = (img->width + mcu_w - 1) / mcu_w;
+  int mcus_y = (img->height + mcu_h - 1) / mcu_h;
+  int pred[3] = {0, 0, 0};
+  for (int c = 0; c < img->ncomps; c++) {
+    coef_comp_t *cp = &img->comps[c];
+    cp->blocks_w = mcus_x * (single ? 1 : cp->h);
+    cp->blocks_h = mcus_y * (single ? 1 : cp->v);
+    cp->coef.assign((size_t)cp->blocks_w * cp->blocks_h * 64, 0);
+  }
+
+  reader_t r = {q, end, 0, 0, false};
+  int mcu = 0, rst = 0;
+  for (int my = 0; my < mcus_y; my++) {
+    for (int mx = 0; mx < mcus_x; mx++, mcu++) {
+      if (img->dri && mcu && mcu % img->dri == 0) {
+        // byte align, then the next restart marker in sequence
+        r.n = 0;
+        if (r.p + 2 > end || r.p[0] != 0xFF || r.p[1] != 0xD0 + rst) {
+          return false;
+        }
+        r.p += 2;
+        r.marker = false;
+        rst = (rst + 1) & 7;
+        pred[0] = pred[1] = pred[2] = 0;
+      }
+      for (int k = 0; k < nscan; k++) {
+        int c = scan[k];
+        coef_comp_t *cp = &img->comps[c];
+        int bh = single ? 1 : cp->h, bv = single ? 1 : cp->v;
+        for (int by = 0; by < bv; by++) {
+          for (int bx = 0; bx < bh; bx++) {
+            int16_t *blk = &cp->coef[((size_t)(my * bv + by) * cp->blocks_w + mx * bh + bx) * 64];
+            if (!dc[cp->td].defined || !ac[cp->ta].defined) {
+              return false;
+            }
+            int s = decode(&r, &dc[cp->td]);
+            if (s < 0 || s > 11) {
+              return false;
+            }
+            pred[c] += extend(bits(&r, s), s);
+            blk[0] = pred[c];
+            for (int i = 1; i < 64;) {
+              int sym = decode(&r, &ac[cp->ta]);
+              if (sym < 0) {
+                return false;
+              }
+              int run = sym >> 4, size = sym & 15;
+              if (size) {
+                i += run;
+                if (i > 63) {
+                  return false;
+                }
+                blk[i++] = extend(bits(&r, size), size);
+              } else if (run == 15) {
+                i += 16;
+              } else {
+                break;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  // the scan must end in EOI, not run into it
+  return !r.marker && r.p + 2 <= end && r.p[0] == 0xFF && r.p[1] == 0xD9;
+}
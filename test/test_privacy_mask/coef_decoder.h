@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+// Reference entropy decoder for the tests: a baseline Huffman JPEG to its
+// quantized DCT coefficients, written independently of jpeg_blocks.cpp. The
+// coefficients are compared directly, so no IDCT is involved and equality is
+// exact.
+
+typedef struct {
+  int id;
+  int h;
+  int v;
+  int tq;
+  int td;
+  int ta;
+  int blocks_w;  // blocks per row and column, padded to whole MCUs
+  int blocks_h;
+  std::vector<int16_t> coef;  // 64 per block, zigzag order, absolute DC
+} coef_comp_t;
+
+typedef struct {
+  int width;
+  int height;
+  int ncomps;
+  int h_max;
+  int v_max;
+  int dri;
+  uint16_t q[4][64];  // zigzag order
+  coef_comp_t comps[3];
+} coef_image_t;
+
+bool coef_decode(const uint8_t *p, size_t len, coef_image_t *img);
+
+// Coefficients of block (bx, by) of component c
+static inline const int16_t *coef_block(const coef_image_t *img, int c, int bx, int by) {
+  const coef_comp_t *cp = &img->comps[c];
+  return &cp->coef[((size_t)by * cp->blocks_w + bx) * 64];
+}
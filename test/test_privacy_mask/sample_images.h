@@ -0,0 +1,483 @@
+#pragma once
+
+#include <stdint.h>
+
+// Baseline JPEGs from libjpeg, quality 50, with texture in every block:
+// 120x80 4:2:2 (the sensor's sampling) with a restart every 4 MCUs,
+// 100x76 4:2:0 and 48x40 grayscale. The odd sizes leave partial MCUs.
+
+static const uint8_t sample_422[] = {
+  0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x10, 0x0b, 0x0c, 0x0e, 0x0c, 0x0a, 0x10,
+  0x0e, 0x0d, 0x0e, 0x12, 0x11, 0x10, 0x13, 0x18, 0x28, 0x1a, 0x18, 0x16, 0x16, 0x18, 0x31, 0x23,
+  0x25, 0x1d, 0x28, 0x3a, 0x33, 0x3d, 0x3c, 0x39, 0x33, 0x38, 0x37, 0x40, 0x48, 0x5c, 0x4e, 0x40,
+  0x44, 0x57, 0x45, 0x37, 0x38, 0x50, 0x6d, 0x51, 0x57, 0x5f, 0x62, 0x67, 0x68, 0x67, 0x3e, 0x4d,
+  0x71, 0x79, 0x70, 0x64, 0x78, 0x5c, 0x65, 0x67, 0x63, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x11, 0x12,
+  0x12, 0x18, 0x15, 0x18, 0x2f, 0x1a, 0x1a, 0x2f, 0x63, 0x42, 0x38, 0x42, 0x63, 0x63, 0x63, 0x63,
+  0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+  0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+  0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0xff, 0xc0,
+  0x00, 0x11, 0x08, 0x00, 0x50, 0x00, 0x78, 0x03, 0x01, 0x21, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+  0x01, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+  0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05,
+  0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,
+  0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23,
+  0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17,
+  0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a,
+  0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a,
+  0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
+  0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+  0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+  0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5,
+  0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1,
+  0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00, 0x1f, 0x01, 0x00, 0x03,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00,
+  0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00,
+  0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13,
+  0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15,
+  0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27,
+  0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+  0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+  0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+  0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+  0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4,
+  0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2,
+  0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9,
+  0xfa, 0xff, 0xdd, 0x00, 0x04, 0x00, 0x04, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11,
+  0x03, 0x11, 0x00, 0x3f, 0x00, 0xc0, 0xb2, 0x53, 0x14, 0xa5, 0xa4, 0x05, 0x06, 0xdc, 0x65, 0xb8,
+  0xa8, 0x0a, 0x96, 0xbb, 0x12, 0x00, 0x4a, 0x64, 0x1d, 0xc3, 0xa7, 0xe7, 0x5e, 0x9e, 0x73, 0x2f,
+  0x7a, 0x2f, 0xd7, 0xf4, 0x3d, 0x2a, 0x69, 0xfb, 0x15, 0x1e, 0xa9, 0xde, 0xde, 0x46, 0xad, 0xcf,
+  0xef, 0x76, 0x79, 0x7f, 0x3e, 0x33, 0x9d, 0xbc, 0xe2, 0xa3, 0x24, 0x35, 0xa0, 0x8c, 0x10, 0x5f,
+  0x68, 0x1b, 0x47, 0x5f, 0xca, 0xb9, 0xf3, 0x89, 0x69, 0x4f, 0xe7, 0xfa, 0x16, 0x9a, 0x73, 0xa8,
+  0xfa, 0x35, 0xa7, 0x9e, 0x9d, 0x0d, 0x2b, 0x22, 0x22, 0x88, 0xac, 0x84, 0x21, 0xce, 0x70, 0xdc,
+  0x55, 0x4b, 0x25, 0x31, 0x4a, 0x5a, 0x40, 0x50, 0x63, 0x19, 0x6e, 0x2b, 0x2c, 0xe6, 0x5f, 0x0f,
+  0xcf, 0xf4, 0x32, 0xa7, 0xff, 0x00, 0x2e, 0xfc, 0xb7, 0xf2, 0xf5, 0xec, 0x5d, 0x95, 0x4b, 0x5f,
+  0x79, 0x80, 0x12, 0x99, 0x07, 0x70, 0xe9, 0xdb, 0xbd, 0x41, 0x73, 0xfb, 0xdd, 0x9e, 0x5f, 0xcf,
+  0x8c, 0xe7, 0x6f, 0x38, 0xa8, 0xcd, 0xe5, 0xad, 0x3f, 0x9f, 0xe8, 0x70, 0xd9, 0xb8, 0xd5, 0x5d,
+  0x5b, 0xd3, 0xcf, 0x5e, 0x87, 0xff, 0xd0, 0xba, 0x48, 0x6b, 0x41, 0x18, 0x20, 0xbe, 0x00, 0xda,
+  0x3a, 0xfe, 0x55, 0x0d, 0x91, 0x11, 0x44, 0x56, 0x42, 0x10, 0xe7, 0x38, 0x6e, 0x2b, 0x3c, 0xe5,
+  0xfb, 0xb1, 0x5e, 0xbf, 0xa1, 0x74, 0xe4, 0xbd, 0xb2, 0x95, 0xf4, 0x4a, 0xd7, 0xf3, 0x2f, 0x59,
+  0x29, 0x8a, 0x52, 0xd2, 0x02, 0x83, 0x18, 0xcb, 0x71, 0x50, 0x15, 0x2d, 0x76, 0x24, 0x00, 0x94,
+  0xdc, 0x0e, 0xe1, 0xd3, 0xf3, 0xac, 0xf3, 0x99, 0x7b, 0xd1, 0x7e, 0xbf, 0xa1, 0xcb, 0x4d, 0x3f,
+  0x62, 0xa3, 0xd5, 0x3b, 0xdb, 0xc8, 0xd1, 0xbe, 0xfd, 0xef, 0x97, 0xe5, 0xfc, 0xf8, 0xce, 0x76,
+  0xf3, 0x8e, 0x95, 0x5c, 0x90, 0xd6, 0x82, 0x30, 0x41, 0x7c, 0x01, 0xb4, 0x75, 0xfc, 0xab, 0x2c,
+  0xda, 0x5e, 0xed, 0x3f, 0x9f, 0xe8, 0x63, 0x26, 0x9d, 0x5a, 0xaf, 0xa3, 0x5a, 0x79, 0xe9, 0xd0,
+  0xd2, 0xb2, 0x22, 0x28, 0x8a, 0xc8, 0x42, 0x1c, 0xe7, 0x0d, 0xc5, 0x15, 0xea, 0x4d, 0xb7, 0x2b,
+  0xa2, 0x68, 0xd4, 0x84, 0x29, 0xa8, 0xc9, 0xa4, 0xcf, 0xff, 0xd1, 0xc5, 0x95, 0x96, 0xe5, 0x02,
+  0x42, 0x77, 0x30, 0x39, 0xc7, 0x4e, 0x29, 0xd1, 0x43, 0x1a, 0x5b, 0xf9, 0x0c, 0xcc, 0x24, 0xc1,
+  0x1b, 0x7d, 0xcf, 0x4a, 0xf7, 0x71, 0x18, 0x48, 0x62, 0x52, 0x53, 0x6f, 0x4e, 0xc7, 0xa9, 0xed,
+  0x52, 0xa8, 0xea, 0x2d, 0x9a, 0xb7, 0xcc, 0xb1, 0x6b, 0xfe, 0x8d, 0xbb, 0xce, 0xf9, 0x77, 0x63,
+  0x1d, 0xff, 0x00, 0x95, 0x2c, 0x56, 0x81, 0x2e, 0x3c, 0xf6, 0xdc, 0x23, 0xc9, 0x3b, 0xb2, 0x3a,
+  0x1e, 0x95, 0x96, 0x23, 0x0b, 0x4f, 0x14, 0xef, 0x36, 0xfc, 0xac, 0x62, 0x9b, 0x84, 0x63, 0x1e,
+  0xb1, 0x77, 0x7e, 0x4b, 0x72, 0xd4, 0xa8, 0xd7, 0x2e, 0x1e, 0x11, 0xb9, 0x40, 0xc6, 0x7a, 0x73,
+  0x52, 0xcb, 0x0c, 0x77, 0x28, 0x12, 0x16, 0x66, 0x60, 0x73, 0x8e, 0x9c, 0x56, 0x38, 0x8c, 0x2c,
+  0x31, 0x3c, 0xbc, 0xed, 0xfb, 0xbd, 0xbc, 0xc5, 0xcc, 0xd7, 0x3d, 0xbe, 0xde, 0xde, 0x7f, 0xd7,
+  0x99, 0x22, 0xb2, 0xa4, 0x46, 0x06, 0x38, 0x93, 0x04, 0x6d, 0xf7, 0x3d, 0x29, 0x2d, 0x6d, 0x92,
+  0xdb, 0x77, 0x9c, 0x59, 0x77, 0x63, 0x1d, 0xff, 0x00, 0x95, 0x67, 0x88, 0xc2, 0x43, 0x14, 0xad,
+  0x36, 0xfc, 0xac, 0x71, 0xba, 0x9c, 0x93, 0x8c, 0xba, 0x47, 0x47, 0xe4, 0xf6, 0x3f, 0xff, 0xd2,
+  0xb7, 0x12, 0x32, 0x5c, 0x79, 0xec, 0x31, 0x1e, 0x49, 0xdd, 0xec, 0x7a, 0x53, 0xa5, 0xb4, 0x17,
+  0x2e, 0x1e, 0x1d, 0xcc, 0xa0, 0x63, 0x39, 0x03, 0x9a, 0xea, 0xc4, 0x61, 0xa9, 0xe2, 0x5a, 0x73,
+  0x6f, 0x4e, 0xc6, 0x16, 0x92, 0xa6, 0xe9, 0xad, 0xdb, 0xbf, 0xc8, 0xb9, 0x2b, 0x2d, 0xca, 0x04,
+  0x84, 0xee, 0x60, 0x73, 0x8e, 0x9c, 0x53, 0xe2, 0x86, 0x34, 0xb7, 0xf2, 0x19, 0x98, 0x49, 0x82,
+  0x36, 0xfb, 0x9e, 0x95, 0xcf, 0x88, 0xc2, 0x43, 0x12, 0x92, 0x9b, 0x7a, 0x76, 0x2b, 0xda, 0xa5,
+  0x51, 0xd4, 0x5b, 0x35, 0x6f, 0x99, 0x24, 0x5f, 0xe8, 0xd9, 0xf3, 0xbe, 0x5d, 0xdd, 0x3b, 0xff,
+  0x00, 0x2a, 0x64, 0x56, 0x81, 0x2e, 0x3c, 0xf6, 0xdc, 0x23, 0xc9, 0x3b, 0xb2, 0x3a, 0x1e, 0x95,
+  0x35, 0xf0, 0xb4, 0xf1, 0x5a, 0xcd, 0xbf, 0x2b, 0x1c, 0x32, 0x6e, 0x1c, 0xb1, 0xeb, 0x17, 0x77,
+  0xe4, 0xb7, 0x2d, 0x4a, 0x8d, 0x72, 0xe1, 0xe1, 0x1b, 0x94, 0x0c, 0x67, 0xa7, 0x34, 0x56, 0xaa,
+  0xa2, 0x8a, 0xb3, 0x39, 0x2a, 0xd0, 0xa9, 0x56, 0x6e, 0x70, 0x57, 0x4c, 0xff, 0xd3, 0xc4, 0x86,
+  0x33, 0x68, 0xde, 0x64, 0x98, 0x20, 0x8d, 0xbf, 0x2d, 0x4e, 0x23, 0x32, 0x49, 0xf6, 0x91, 0x8d,
+  0x80, 0xee, 0xc1, 0xeb, 0xc7, 0xff, 0x00, 0xaa, 0xbe, 0x8d, 0x4f, 0x57, 0x23, 0xb9, 0xd3, 0x6a,
+  0x2a, 0x8f, 0x55, 0xaf, 0xc8, 0x95, 0xbf, 0xd3, 0x31, 0xe5, 0xf1, 0xb3, 0xae, 0xef, 0x7f, 0xff,
+  0x00, 0x55, 0x59, 0x0e, 0x24, 0x8f, 0xec, 0xc3, 0x3b, 0xc0, 0xdb, 0x93, 0xd3, 0x8f, 0xff, 0x00,
+  0x55, 0x61, 0x17, 0x6d, 0x3b, 0x0a, 0x52, 0x4d, 0xb9, 0xf4, 0x9e, 0x8b, 0xf2, 0xd4, 0x92, 0x17,
+  0x16, 0x8b, 0xe5, 0xc9, 0x92, 0x4f, 0xcd, 0xf2, 0xd4, 0xd0, 0xc6, 0x6d, 0x1b, 0xcc, 0x93, 0x04,
+  0x11, 0xb7, 0xe5, 0xac, 0x54, 0xb7, 0xf3, 0x21, 0xe9, 0x6f, 0xee, 0x6f, 0xff, 0x00, 0x00, 0x6b,
+  0x46, 0x64, 0x9f, 0xed, 0x23, 0x1b, 0x06, 0x1b, 0x07, 0xaf, 0x1f, 0xfe, 0xaa, 0x9c, 0xff, 0x00,
+  0xa6, 0x63, 0xcb, 0xe3, 0x67, 0x5d, 0xde, 0xff, 0x00, 0xfe, 0xaa, 0x88, 0xca, 0xda, 0xf6, 0x38,
+  0xaa, 0x45, 0xbe, 0x68, 0x75, 0x9b, 0xba, 0xfc, 0xf5, 0x3f, 0xff, 0xd4, 0xbc, 0x1c, 0x49, 0x1f,
+  0xd9, 0x86, 0x77, 0x8f, 0x97, 0x27, 0xa7, 0x1f, 0xfe, 0xaa, 0xb1, 0x0b, 0x8b, 0x45, 0xf2, 0xe4,
+  0xc9, 0x27, 0xe6, 0xf9, 0x6b, 0xb5, 0x3d, 0x1c, 0x4c, 0x5d, 0x44, 0xa4, 0xab, 0x74, 0x5a, 0x7c,
+  0xc7, 0x43, 0x19, 0xb4, 0x6f, 0x32, 0x4c, 0x10, 0x46, 0xdf, 0x96, 0xac, 0x08, 0xcc, 0x92, 0x7d,
+  0xa4, 0x63, 0x60, 0xf9, 0xb0, 0x7a, 0xf1, 0xff, 0x00, 0xea, 0xac, 0x94, 0xf5, 0x72, 0x32, 0x74,
+  0xda, 0x8a, 0xa3, 0xd5, 0x6b, 0xf2, 0x16, 0x6f, 0xf4, 0xcd, 0xbe, 0x5f, 0x1b, 0x33, 0x9d, 0xde,
+  0xff, 0x00, 0xfe, 0xaa, 0x94, 0x38, 0x92, 0x3f, 0xb3, 0x0c, 0xef, 0x03, 0x6e, 0x4f, 0x4e, 0x3f,
+  0xfd, 0x55, 0x9c, 0x1e, 0x96, 0xec, 0x73, 0x55, 0x92, 0x73, 0x94, 0xfa, 0x4f, 0x45, 0xf9, 0x6a,
+  0x55, 0xd4, 0xf5, 0x11, 0xa2, 0x69, 0xb2, 0x33, 0x64, 0xca, 0xe7, 0x11, 0xed, 0xe7, 0x93, 0xfe,
+  0x18, 0x27, 0xf0, 0xa2, 0xba, 0x70, 0xb8, 0x58, 0xd6, 0x8b, 0x9c, 0x96, 0xe7, 0xab, 0x97, 0xaa,
+  0x11, 0xa5, 0xcb, 0x5a, 0x2d, 0xb5, 0xa7, 0xf5, 0xa9, 0xff, 0xd5, 0xc5, 0x57, 0xfb, 0x67, 0xee,
+  0xf1, 0xb3, 0x1f, 0x36, 0x7a, 0xff, 0x00, 0x9e, 0xb5, 0x61, 0x5f, 0xcb, 0xff, 0x00, 0x45, 0xc6,
+  0x73, 0xf2, 0xee, 0xfa, 0xfb, 0x7e, 0x35, 0xee, 0x47, 0xf9, 0x4e, 0xe7, 0x52, 0xff, 0x00, 0xbe,
+  0xb6, 0xfa, 0x5b, 0xf5, 0x24, 0x5f, 0xf4, 0x2f, 0xf6, 0xf7, 0xfe, 0x18, 0xc7, 0xff, 0x00, 0xae,
+  0xac, 0x2c, 0x7e, 0x5f, 0xfa, 0x56, 0x73, 0x9f, 0x9b, 0x6f, 0xd7, 0xdf, 0xf1, 0xac, 0x23, 0x3b,
+  0xeb, 0xdc, 0x97, 0x1e, 0x5f, 0x73, 0xf9, 0x35, 0xf5, 0xeb, 0xf2, 0x24, 0x58, 0xfe, 0xd9, 0xfb,
+  0xcc, 0xec, 0xc7, 0xcb, 0x8e, 0xbf, 0xe7, 0xad, 0x58, 0x57, 0xfb, 0x67, 0xee, 0xf1, 0xb3, 0x1f,
+  0x36, 0x7a, 0xff, 0x00, 0x9e, 0xb5, 0x8c, 0x65, 0xf8, 0x10, 0xf5, 0xff, 0x00, 0xb8, 0x9f, 0x87,
+  0xf9, 0x8d, 0x2f, 0xe5, 0xb9, 0xb5, 0xc6, 0x73, 0xf2, 0xee, 0xfa, 0xfb, 0x7e, 0x35, 0x32, 0xff,
+  0x00, 0xa1, 0x7f, 0xb7, 0xbf, 0xf0, 0xc6, 0x3f, 0xfd, 0x75, 0x11, 0x77, 0xd3, 0xb9, 0xc7, 0x39,
+  0x72, 0xb7, 0x3f, 0xe4, 0xd3, 0xd7, 0xa7, 0xc8, 0xff, 0xd6, 0xbc, 0xb1, 0xf9, 0x7f, 0xe9, 0x59,
+  0xce, 0x7e, 0x6d, 0xbf, 0x5f, 0x7f, 0xc6, 0xac, 0x2c, 0x7f, 0x6c, 0xfd, 0xe6, 0x76, 0x63, 0xe5,
+  0xc7, 0x5f, 0xf3, 0xd6, 0xb7, 0x8c, 0xfe, 0xd1, 0xce, 0xe9, 0xdf, 0xf7, 0x37, 0xdf, 0x5b, 0xfe,
+  0x84, 0x8a, 0xff, 0x00, 0x6c, 0xfd, 0xde, 0x36, 0x63, 0xe6, 0xcf, 0x5f, 0xf3, 0xd6, 0xac, 0x2b,
+  0xf9, 0x7f, 0xe8, 0xb8, 0xce, 0x7e, 0x5d, 0xdf, 0x5f, 0x6f, 0xc6, 0xb0, 0x8f, 0xf2, 0x92, 0xea,
+  0x5f, 0xf7, 0xd6, 0xdf, 0x4b, 0x7e, 0xa0, 0xff, 0x00, 0xe8, 0x58, 0xfe, 0x3d, 0xff, 0x00, 0x86,
+  0x31, 0xff, 0x00, 0xeb, 0xa9, 0x16, 0x3f, 0x2f, 0xfd, 0x2b, 0x39, 0xcf, 0xcd, 0xb7, 0xeb, 0xef,
+  0xf8, 0xd4, 0x42, 0x77, 0x57, 0xee, 0x72, 0x55, 0x8f, 0x2c, 0xb9, 0x3f, 0x93, 0x5f, 0x5e, 0xbf,
+  0x23, 0x8f, 0xf1, 0x1d, 0xd7, 0xf6, 0xb6, 0xa2, 0x42, 0xb6, 0xc8, 0xed, 0xb3, 0x18, 0x18, 0xce,
+  0x5b, 0xf8, 0x8f, 0x6f, 0xa7, 0xe1, 0xef, 0x45, 0x7b, 0x54, 0x27, 0xec, 0xa9, 0xc6, 0x07, 0xd3,
+  0x61, 0x70, 0x5c, 0xf4, 0x63, 0x3b, 0xda, 0xea, 0xff, 0x00, 0x79, 0xff, 0xd7, 0xc7, 0x31, 0x8b,
+  0x45, 0x12, 0x47, 0x92, 0x49, 0xdb, 0xf3, 0x55, 0x88, 0xe3, 0x12, 0x47, 0xf6, 0x93, 0x9d, 0xe3,
+  0xe6, 0xc0, 0xe9, 0xc7, 0xff, 0x00, 0xaa, 0xbd, 0x48, 0xcf, 0x4e, 0x63, 0xbe, 0x54, 0xd2, 0x93,
+  0xa3, 0xd1, 0x6b, 0xf3, 0x1f, 0x0f, 0xfa, 0x66, 0x7c, 0xce, 0x36, 0x74, 0xdb, 0xef, 0xff, 0x00,
+  0xea, 0xa9, 0xe3, 0x73, 0x24, 0x9f, 0x66, 0x38, 0xd8, 0x3e, 0x5c, 0x8e, 0xbc, 0x7f, 0xfa, 0xab,
+  0x24, 0xed, 0x75, 0xd8, 0xcd, 0xc9, 0xb4, 0xa7, 0xd6, 0x7a, 0x3f, 0xcb, 0x42, 0x42, 0xe6, 0xd1,
+  0x84, 0x71, 0xe0, 0x82, 0x37, 0x7c, 0xd5, 0x64, 0xc6, 0x2d, 0x14, 0x49, 0x1e, 0x49, 0x3f, 0x2f,
+  0xcd, 0x58, 0x46, 0x5f, 0x89, 0x32, 0xd2, 0xff, 0x00, 0xdc, 0xdb, 0xfe, 0x08, 0x9e, 0x58, 0x90,
+  0x1b, 0x93, 0x9d, 0xe3, 0xe6, 0xc0, 0xe9, 0xc7, 0xff, 0x00, 0xaa, 0xa5, 0x87, 0xfd, 0x33, 0x3e,
+  0x67, 0x1b, 0x3a, 0x6d, 0xf7, 0xff, 0x00, 0xf5, 0x54, 0x46, 0x5a, 0x37, 0xd8, 0xe2, 0x9c, 0x53,
+  0x92, 0x87, 0x49, 0xea, 0xff, 0x00, 0x3d, 0x0f, 0xff, 0xd0, 0xbd, 0x1b, 0x99, 0x24, 0xfb, 0x31,
+  0xc6, 0xc0, 0x76, 0xe4, 0x75, 0xe3, 0xff, 0x00, 0xd5, 0x56, 0x0b, 0x9b, 0x46, 0x11, 0xc7, 0x82,
+  0x08, 0xdd, 0xf3, 0x51, 0x17, 0xaf, 0x29, 0xcd, 0x2a, 0x8d, 0x47, 0xdb, 0x75, 0x5a, 0x7c, 0x89,
+  0x8c, 0x62, 0xd1, 0x44, 0x91, 0xe4, 0x93, 0xf2, 0xfc, 0xd5, 0x3c, 0x71, 0x89, 0x23, 0xfb, 0x49,
+  0xce, 0xf0, 0x37, 0x60, 0x74, 0xe3, 0xff, 0x00, 0xd5, 0x58, 0x46, 0x7a, 0x73, 0x0a, 0x54, 0xd2,
+  0x93, 0xa3, 0xd1, 0x6b, 0xf3, 0x01, 0xfe, 0x99, 0xfe, 0xb3, 0x8d, 0x9d, 0x36, 0xfb, 0xff, 0x00,
+  0xfa, 0xaa, 0xa6, 0xab, 0xa8, 0x9b, 0x4b, 0x29, 0x23, 0xe0, 0x13, 0xfb, 0xb8, 0xc8, 0xeb, 0x9e,
+  0xc7, 0xb8, 0xed, 0x9f, 0xc2, 0x9d, 0x05, 0xcd, 0x35, 0x03, 0x9e, 0x29, 0xd5, 0xab, 0x16, 0xff,
+  0x00, 0xe5, 0xe3, 0xb3, 0xf4, 0xdb, 0x4f, 0x91, 0xc3, 0x17, 0x36, 0x8c, 0x23, 0x8f, 0x04, 0x11,
+  0xbb, 0xe6, 0xa2, 0xbd, 0xdb, 0x29, 0x6a, 0xcf, 0xa7, 0x9e, 0x26, 0x74, 0x5f, 0xb3, 0x8d, 0xac,
+  0x8f, 0xff, 0xd1, 0xc6, 0xb5, 0x66, 0xb9, 0x72, 0x93, 0x1d, 0xca, 0x06, 0x71, 0xd3, 0x9a, 0xb1,
+  0xb9, 0x92, 0xe0, 0x40, 0xa7, 0x11, 0xe4, 0x0d, 0xbe, 0xc7, 0xad, 0x77, 0xa6, 0xae, 0xd1, 0xd6,
+  0xe7, 0x27, 0x4d, 0x54, 0xea, 0xdd, 0xbe, 0x44, 0xb2, 0xff, 0x00, 0xa3, 0x6d, 0xf2, 0x7e, 0x5d,
+  0xdd, 0x7b, 0xff, 0x00, 0x3a, 0xb3, 0xb1, 0x52, 0xdc, 0x4e, 0xa3, 0x12, 0x60, 0x1d, 0xde, 0xe7,
+  0xad, 0x73, 0xc6, 0x5a, 0x5f, 0xb8, 0xe4, 0x92, 0x94, 0xa2, 0xb6, 0x8a, 0xba, 0xf2, 0x7b, 0x92,
+  0x5a, 0xa2, 0xdc, 0xa1, 0x79, 0x86, 0xe6, 0x07, 0x19, 0xe9, 0xc5, 0x4b, 0x6a, 0xcd, 0x72, 0xe5,
+  0x26, 0x3b, 0x94, 0x0c, 0xe3, 0xa7, 0x35, 0x8a, 0x96, 0xfe, 0x46, 0x7b, 0xf2, 0x7f, 0x7f, 0x7f,
+  0x3f, 0xeb, 0xc8, 0x49, 0x19, 0x92, 0xeb, 0xc8, 0x53, 0x88, 0xf2, 0x06, 0xdf, 0x63, 0xd6, 0xa7,
+  0x97, 0xfd, 0x1b, 0x6f, 0x93, 0xf2, 0xee, 0xeb, 0xdf, 0xf9, 0xd4, 0xc1, 0xec, 0xbb, 0x9c, 0x35,
+  0x24, 0xd2, 0x9c, 0x96, 0xf1, 0x76, 0x5e, 0x4a, 0xf6, 0x3f, 0xff, 0xd2, 0xd2, 0xd8, 0xa9, 0x6e,
+  0x27, 0x51, 0x89, 0x30, 0x0e, 0xef, 0x73, 0xd6, 0xa7, 0xb5, 0x45, 0xb9, 0x42, 0xf3, 0x0d, 0xcc,
+  0x0e, 0x33, 0xd3, 0x8a, 0xe7, 0x53, 0x76, 0x6c, 0xc5, 0xc2, 0x2e, 0xa2, 0xa7, 0xd1, 0xab, 0xfc,
+  0xc5, 0xb5, 0x66, 0xb9, 0x72, 0x93, 0x1d, 0xca, 0x06, 0x71, 0xd3, 0x9a, 0xb1, 0xb9, 0x92, 0xe0,
+  0x40, 0xa7, 0x11, 0xe4, 0x0d, 0xbe, 0xc7, 0xad, 0x64, 0x9a, 0xbb, 0x47, 0x3b, 0x9c, 0x9d, 0x35,
+  0x53, 0xab, 0x76, 0xf9, 0x0e, 0xba, 0xff, 0x00, 0x46, 0xd9, 0xe4, 0xfc, 0xbb, 0xb3, 0x9e, 0xff,
+  0x00, 0xce, 0xb9, 0x1f, 0x12, 0xdd, 0xac, 0xf7, 0x3b, 0xa3, 0xff, 0x00, 0x96, 0x03, 0x1b, 0xbd,
+  0x58, 0xfd, 0xe3, 0xfd, 0x3f, 0x0a, 0xea, 0xcb, 0x7d, 0xe9, 0xf3, 0x7f, 0x5d, 0x8e, 0xac, 0x15,
+  0x24, 0xf1, 0x53, 0x5d, 0x20, 0xae, 0xbc, 0x9d, 0x8c, 0xbb, 0x54, 0x5b, 0x94, 0x2f, 0x30, 0xdc,
+  0xc0, 0xe3, 0x3d, 0x38, 0xa2, 0xbd, 0x09, 0x54, 0x71, 0x76, 0x47, 0xd0, 0xd3, 0xa1, 0x4e, 0xac,
+  0x14, 0xe6, 0xae, 0xd9, 0xff, 0xd3, 0xcb, 0xb8, 0x51, 0x14, 0x41, 0xa3, 0x01, 0x0e, 0xec, 0x65,
+  0x78, 0xa9, 0xe1, 0x50, 0xd6, 0x9e, 0x61, 0x00, 0xbe, 0x09, 0xdc, 0x7a, 0xfe, 0x75, 0xb4, 0x65,
+  0xee, 0xdc, 0xf4, 0x24, 0x97, 0xb6, 0x94, 0x7a, 0x25, 0x7b, 0x79, 0x8e, 0xb1, 0xfd, 0xee, 0xff,
+  0x00, 0x33, 0xe7, 0xc6, 0x31, 0xbb, 0x9c, 0x54, 0xd0, 0x92, 0xd7, 0x7e, 0x59, 0x24, 0xa6, 0x48,
+  0xda, 0x7a, 0x7e, 0x55, 0x92, 0x96, 0xb2, 0x39, 0xee, 0xdc, 0x29, 0xbe, 0xad, 0xeb, 0xe7, 0xaf,
+  0x52, 0x4b, 0x82, 0x62, 0x94, 0x2c, 0x64, 0xa0, 0xc6, 0x70, 0xbc, 0x55, 0xcb, 0x85, 0x11, 0x44,
+  0x1a, 0x30, 0x10, 0xee, 0xc6, 0x57, 0x8a, 0xc2, 0x32, 0xd8, 0x52, 0xff, 0x00, 0x97, 0x9e, 0x5b,
+  0x79, 0x7a, 0x76, 0x1a, 0x8a, 0x1a, 0xd8, 0xc8, 0x40, 0x2f, 0x82, 0x77, 0x1e, 0xbf, 0x9d, 0x49,
+  0x63, 0xfb, 0xdd, 0xfe, 0x67, 0xcf, 0x8c, 0x63, 0x77, 0x38, 0xa8, 0x8c, 0xb4, 0x91, 0xc9, 0x24,
+  0x9d, 0x48, 0x2e, 0x8d, 0x6b, 0xe7, 0xea, 0x7f, 0xff, 0xd4, 0xbf, 0x09, 0x2d, 0x77, 0xe5, 0x92,
+  0x4a, 0x64, 0x8d, 0xa7, 0xa7, 0xe5, 0x56, 0x2e, 0x09, 0x8a, 0x50, 0xb1, 0x92, 0x83, 0x19, 0xc2,
+  0xf1, 0x5c, 0x51, 0x7e, 0xf5, 0x8e, 0x29, 0x49, 0xfb, 0x19, 0x4a, 0xfa, 0xa7, 0x6b, 0xf9, 0x16,
+  0x2e, 0x54, 0x45, 0x10, 0x68, 0xc0, 0x43, 0xbb, 0x19, 0x5e, 0x2a, 0xc4, 0x2a, 0x1a, 0xd3, 0xcc,
+  0x20, 0x17, 0xc1, 0x3b, 0x8f, 0x5f, 0xce, 0xb9, 0xa3, 0x2f, 0x76, 0xe6, 0xb2, 0x4b, 0xdb, 0x4a,
+  0x3d, 0x12, 0xbd, 0xbc, 0xcc, 0xfd, 0x42, 0xf7, 0xec, 0xba, 0x74, 0xb2, 0xb9, 0xdd, 0x27, 0x09,
+  0x16, 0xee, 0x70, 0xc7, 0x3e, 0xb9, 0xf4, 0xcf, 0xe1, 0x5c, 0x1c, 0x24, 0xb5, 0xdf, 0x96, 0x49,
+  0x29, 0xb8, 0x8d, 0xa7, 0xa7, 0xe5, 0x5e, 0xbe, 0x5a, 0xad, 0x09, 0xc8, 0xed, 0xcb, 0xa2, 0xd5,
+  0x28, 0xd4, 0x7b, 0xc9, 0xd9, 0xf9, 0xa5, 0xdc, 0x96, 0xe4, 0x98, 0xa5, 0x0b, 0x19, 0x28, 0x31,
+  0x9c, 0x2f, 0x14, 0x57, 0x54, 0x5a, 0x6a, 0xec, 0xe9, 0xaf, 0x52, 0x70, 0xa8, 0xe3, 0x16, 0xd2,
+  0x3f, 0xff, 0xd5, 0xc7, 0xb2, 0x53, 0x14, 0xa5, 0xa4, 0x05, 0x06, 0x31, 0x96, 0xe2, 0xac, 0x15,
+  0x2d, 0x76, 0x24, 0x00, 0x94, 0xdc, 0x0e, 0xe1, 0xd3, 0xf3, 0xa6, 0xa5, 0xef, 0x36, 0x74, 0x59,
+  0xfb, 0x18, 0xc7, 0xaa, 0x77, 0xb7, 0x91, 0x35, 0xcf, 0xef, 0x76, 0x79, 0x7f, 0x3e, 0x33, 0x9d,
+  0xbc, 0xe2, 0xad, 0x12, 0x1a, 0xd0, 0x46, 0x08, 0x2f, 0xb4, 0x0d, 0xa3, 0xaf, 0xe5, 0x5c, 0xf1,
+  0x96, 0x88, 0xb9, 0xb4, 0xe7, 0x51, 0xf4, 0x6b, 0x4f, 0x3d, 0x3a, 0x12, 0x59, 0x11, 0x14, 0x45,
+  0x64, 0x21, 0x0e, 0x73, 0x86, 0xe2, 0x9f, 0x64, 0xa6, 0x29, 0x4b, 0x48, 0x0a, 0x0d, 0xb8, 0xcb,
+  0x71, 0x58, 0xa9, 0x7c, 0x46, 0x7f, 0xf3, 0xef, 0xcb, 0x7f, 0x2f, 0x5e, 0xc2, 0x4a, 0xa5, 0xaf,
+  0xbc, 0xc0, 0x09, 0x4c, 0x83, 0xb8, 0x74, 0xed, 0xde, 0xac, 0x5c, 0xfe, 0xf7, 0x67, 0x97, 0xf3,
+  0xe3, 0x39, 0xdb, 0xce, 0x2a, 0x61, 0x2d, 0x51, 0xc1, 0x55, 0x37, 0x1a, 0x8b, 0xab, 0x7a, 0x79,
+  0xeb, 0xd0, 0xff, 0xd6, 0xd4, 0x24, 0x35, 0xa0, 0x8c, 0x10, 0x5f, 0x00, 0x6d, 0x1d, 0x7f, 0x2a,
+  0xb1, 0x64, 0x44, 0x51, 0x15, 0x90, 0x84, 0x3b, 0xb3, 0x86, 0xe2, 0xbc, 0x94, 0xfd, 0xd6, 0x8c,
+  0x39, 0x97, 0xb6, 0x8c, 0xaf, 0xa2, 0x56, 0xbf, 0x98, 0x59, 0x29, 0x8a, 0x52, 0xd2, 0x02, 0x83,
+  0x18, 0xcb, 0x71, 0x53, 0x95, 0x2d, 0x76, 0x24, 0x00, 0x94, 0xc8, 0x3b, 0x87, 0x4f, 0xce, 0xb3,
+  0x52, 0xf7, 0x9b, 0x39, 0xac, 0xfd, 0x8c, 0x63, 0xd5, 0x3b, 0xdb, 0xc8, 0xe3, 0xbc, 0x69, 0x7b,
+  0xf6, 0xfd, 0x45, 0x22, 0x80, 0xef, 0x8e, 0xdb, 0x72, 0x7c, 0xbc, 0xfc, 0xdc, 0x67, 0xf9, 0x63,
+  0xf0, 0xac, 0xe2, 0x43, 0x5a, 0x08, 0xc1, 0x05, 0xf0, 0x06, 0xd1, 0xd7, 0xf2, 0xaf, 0x77, 0x08,
+  0xb9, 0x28, 0xc2, 0x3d, 0x8f, 0xa4, 0xa7, 0x15, 0x05, 0x2f, 0x35, 0xa7, 0x9b, 0xb7, 0x4e, 0xfa,
+  0x92, 0x59, 0x11, 0x14, 0x45, 0x64, 0x21, 0x0e, 0xec, 0xe1, 0xb8, 0xa2, 0xb2, 0x9b, 0x6e, 0x57,
+  0x47, 0x5d, 0x1a, 0x90, 0x85, 0x35, 0x19, 0x3b, 0x33, 0xff, 0xd7, 0xcc, 0x95, 0x96, 0xe5, 0x02,
+  0x42, 0x77, 0x30, 0x39, 0xc7, 0x4e, 0x2a, 0xc4, 0x4c, 0xa9, 0x6f, 0xe4, 0x31, 0xc4, 0x98, 0x23,
+  0x6f, 0xb9, 0xe9, 0x5c, 0xf1, 0x6e, 0xd6, 0xea, 0x76, 0xca, 0x71, 0x75, 0x1d, 0x4e, 0x8d, 0x5b,
+  0xe6, 0x3a, 0xd7, 0xfd, 0x1b, 0x77, 0x9d, 0xf2, 0xee, 0xc6, 0x3b, 0xff, 0x00, 0x2a, 0x9a, 0x24,
+  0x64, 0xb8, 0xf3, 0xd8, 0x62, 0x3c, 0x93, 0xbb, 0xd8, 0xf4, 0xac, 0x94, 0xb5, 0x6f, 0xb9, 0x8d,
+  0x9a, 0x8c, 0x22, 0xf7, 0x8b, 0xbb, 0xf2, 0x5b, 0x92, 0x4a, 0x8d, 0x72, 0xe1, 0xe1, 0x1b, 0x94,
+  0x0c, 0x67, 0xa7, 0x35, 0x6e, 0x56, 0x5b, 0x94, 0x09, 0x09, 0xdc, 0xc0, 0xe7, 0x1d, 0x38, 0xac,
+  0x63, 0x2f, 0xc0, 0x52, 0xd7, 0x9f, 0xfb, 0xfb, 0x79, 0xff, 0x00, 0x5e, 0x62, 0x2b, 0x2a, 0x44,
+  0x60, 0x63, 0x89, 0x30, 0x46, 0xdf, 0x73, 0xd2, 0xa4, 0xb5, 0xff, 0x00, 0x46, 0xdd, 0xe7, 0x7c,
+  0xbb, 0xb1, 0x8e, 0xff, 0x00, 0xca, 0xb3, 0x8b, 0xd1, 0xae, 0xe7, 0x1c, 0xa4, 0x94, 0xe3, 0x27,
+  0xb4, 0x74, 0x7e, 0x4f, 0x63, 0xff, 0xd0, 0xd1, 0x89, 0x19, 0x2e, 0x3c, 0xf6, 0x18, 0x8f, 0x24,
+  0xee, 0xf6, 0x3d, 0x2a, 0xc4, 0xa8, 0xd7, 0x2e, 0x1e, 0x11, 0xb9, 0x40, 0xc6, 0x7a, 0x73, 0x5e,
+  0x24, 0x66, 0xaf, 0x7e, 0x87, 0x14, 0xa1, 0x27, 0x4d, 0xd3, 0xea, 0xdd, 0xfe, 0x44, 0xf2, 0xb2,
+  0xdc, 0xa0, 0x48, 0x4e, 0xe6, 0x07, 0x38, 0xe9, 0xc5, 0x43, 0xaa, 0x6a, 0x0b, 0xa6, 0xe8, 0xf2,
+  0x2e, 0x71, 0x70, 0xc0, 0xc7, 0x1a, 0xe3, 0xf8, 0x8e, 0x71, 0xdb, 0x1e, 0xff, 0x00, 0x85, 0x67,
+  0x42, 0x2e, 0x72, 0x50, 0xf3, 0x37, 0xa7, 0xcb, 0x53, 0x10, 0xa5, 0xf6, 0x65, 0xa7, 0xcc, 0xe0,
+  0x62, 0xff, 0x00, 0x46, 0xcf, 0x9d, 0xf2, 0xee, 0xe9, 0xdf, 0xf9, 0x53, 0xa2, 0x46, 0x4b, 0x8f,
+  0x3d, 0x86, 0x23, 0xc9, 0x3b, 0xbd, 0x8f, 0x4a, 0xfa, 0x28, 0xcb, 0x77, 0xdc, 0xf7, 0xea, 0x26,
+  0xb9, 0x62, 0xf7, 0x8b, 0xbb, 0xf2, 0x5b, 0x92, 0x4a, 0x8d, 0x72, 0xe1, 0xe1, 0x1b, 0x94, 0x0c,
+  0x67, 0xa7, 0x34, 0x56, 0x0a, 0xa2, 0x8a, 0xb3, 0x39, 0x6a, 0xd0, 0xa9, 0x56, 0x6e, 0x70, 0x57,
+  0x4c, 0xff, 0xd1, 0xcb, 0x86, 0x33, 0x68, 0xde, 0x64, 0x98, 0x20, 0xfc, 0xbf, 0x2d, 0x4e, 0x23,
+  0x32, 0x49, 0xf6, 0x91, 0x8d, 0x80, 0xee, 0xc1, 0xeb, 0xc7, 0xff, 0x00, 0xaa, 0xb8, 0x94, 0xf5,
+  0x72, 0x3a, 0x5d, 0x36, 0xa2, 0xa8, 0xf5, 0x5a, 0xfc, 0x89, 0x4f, 0xfa, 0x66, 0x3c, 0xbe, 0x36,
+  0x75, 0xdd, 0xef, 0xff, 0x00, 0xea, 0xab, 0x21, 0xc4, 0x91, 0xfd, 0x98, 0x67, 0x78, 0x1b, 0x72,
+  0x7a, 0x71, 0xff, 0x00, 0xea, 0xac, 0x22, 0xed, 0xa7, 0x60, 0x94, 0x93, 0x6e, 0x7d, 0x27, 0xa2,
+  0xfc, 0xb5, 0x24, 0x85, 0xc5, 0xa2, 0xf9, 0x72, 0x64, 0x92, 0x77, 0x7c, 0xb5, 0x34, 0x31, 0x9b,
+  0x46, 0xf3, 0x24, 0xc1, 0x07, 0xe5, 0xf9, 0x6b, 0x18, 0xcb, 0x7f, 0x33, 0x37, 0xa5, 0xbf, 0xb9,
+  0xbf, 0xfc, 0x01, 0xad, 0x19, 0x92, 0x7f, 0xb4, 0x8c, 0x6c, 0x18, 0x6c, 0x1e, 0xbc, 0x7f, 0xfa,
+  0xaa, 0x76, 0xff, 0x00, 0x4c, 0xc7, 0x97, 0xc6, 0xce, 0xbb, 0xbd, 0xff, 0x00, 0xfd, 0x55, 0x11,
+  0x97, 0x5e, 0xc7, 0x15, 0x48, 0xb7, 0xcd, 0x0e, 0xb3, 0x77, 0x5f, 0x9e, 0xa7, 0xff, 0xd2, 0xd5,
+  0x0e, 0x24, 0x8f, 0xec, 0xc3, 0x3b, 0xc0, 0xdb, 0x93, 0xd3, 0x8f, 0xff, 0x00, 0x55, 0x4f, 0x0b,
+  0x8b, 0x45, 0xf2, 0xe4, 0xc9, 0x24, 0xee, 0xf9, 0x6b, 0xe7, 0x13, 0xd1, 0xc4, 0xe5, 0x75, 0x12,
+  0x92, 0xad, 0xd1, 0x69, 0xf3, 0x1f, 0x0c, 0x66, 0xd1, 0xbc, 0xc9, 0x30, 0x41, 0x1b, 0x7e, 0x5a,
+  0xe4, 0xfc, 0x49, 0x74, 0x6f, 0xb5, 0x5f, 0x32, 0x32, 0x3c, 0x8b, 0x7e, 0x00, 0x3d, 0x49, 0x1f,
+  0x7b, 0xb7, 0xb6, 0x3f, 0x0f, 0x7a, 0xe8, 0xcb, 0xdf, 0x35, 0x57, 0x3e, 0x96, 0x3b, 0x32, 0xda,
+  0x0d, 0xd4, 0xf6, 0x6f, 0x78, 0xfb, 0xdf, 0xa7, 0xea, 0x64, 0xcd, 0xfe, 0x99, 0xb7, 0xcb, 0xe3,
+  0x66, 0x73, 0xbb, 0xdf, 0xff, 0x00, 0xd5, 0x52, 0x07, 0x12, 0x47, 0xf6, 0x61, 0x9d, 0xe0, 0x6d,
+  0xc9, 0xe9, 0xc7, 0xff, 0x00, 0xaa, 0xbd, 0x68, 0x3d, 0x2d, 0xd8, 0xf6, 0x2a, 0xc9, 0x39, 0xca,
+  0x7d, 0x27, 0xa2, 0xfc, 0xb5, 0x24, 0x85, 0xc5, 0xa2, 0xf9, 0x72, 0x64, 0x92, 0x77, 0x7c, 0xb4,
+  0x57, 0x33, 0x4e, 0x4e, 0xe8, 0x98, 0xe2, 0x61, 0x45, 0x7b, 0x39, 0x5e, 0xe8, 0xff, 0xd9,
+};
+
+static const uint8_t sample_420[] = {
+  0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x10, 0x0b, 0x0c, 0x0e, 0x0c, 0x0a, 0x10,
+  0x0e, 0x0d, 0x0e, 0x12, 0x11, 0x10, 0x13, 0x18, 0x28, 0x1a, 0x18, 0x16, 0x16, 0x18, 0x31, 0x23,
+  0x25, 0x1d, 0x28, 0x3a, 0x33, 0x3d, 0x3c, 0x39, 0x33, 0x38, 0x37, 0x40, 0x48, 0x5c, 0x4e, 0x40,
+  0x44, 0x57, 0x45, 0x37, 0x38, 0x50, 0x6d, 0x51, 0x57, 0x5f, 0x62, 0x67, 0x68, 0x67, 0x3e, 0x4d,
+  0x71, 0x79, 0x70, 0x64, 0x78, 0x5c, 0x65, 0x67, 0x63, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x11, 0x12,
+  0x12, 0x18, 0x15, 0x18, 0x2f, 0x1a, 0x1a, 0x2f, 0x63, 0x42, 0x38, 0x42, 0x63, 0x63, 0x63, 0x63,
+  0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+  0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+  0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0xff, 0xc0,
+  0x00, 0x11, 0x08, 0x00, 0x4c, 0x00, 0x64, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+  0x01, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+  0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05,
+  0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,
+  0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23,
+  0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17,
+  0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a,
+  0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a,
+  0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
+  0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+  0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+  0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5,
+  0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1,
+  0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00, 0x1f, 0x01, 0x00, 0x03,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00,
+  0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00,
+  0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13,
+  0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15,
+  0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27,
+  0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+  0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+  0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+  0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+  0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4,
+  0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2,
+  0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9,
+  0xfa, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xc0,
+  0xb2, 0x53, 0x14, 0xa5, 0xa4, 0x05, 0x06, 0xdc, 0x65, 0xb8, 0xa8, 0x0a, 0x96, 0xbb, 0x12, 0x00,
+  0x4a, 0x64, 0x1d, 0xc3, 0xa7, 0xe7, 0x57, 0x25, 0x65, 0xb9, 0x40, 0x90, 0x9d, 0xcc, 0x0e, 0x71,
+  0xd3, 0x8a, 0x74, 0x50, 0xc6, 0x96, 0xfe, 0x43, 0x33, 0x09, 0x30, 0x46, 0xdf, 0x73, 0xd2, 0xbd,
+  0x8c, 0xc2, 0x8d, 0x5c, 0x47, 0x2b, 0x86, 0xea, 0xff, 0x00, 0xa1, 0xe9, 0xc7, 0x96, 0x2b, 0xd9,
+  0xdf, 0xdd, 0x5a, 0xa7, 0xdd, 0xf6, 0x27, 0xb9, 0xfd, 0xee, 0xcf, 0x2f, 0xe7, 0xc6, 0x73, 0xb7,
+  0x9c, 0x54, 0x64, 0x86, 0xb4, 0x11, 0x82, 0x0b, 0xed, 0x03, 0x68, 0xeb, 0xf9, 0x54, 0xb6, 0xbf,
+  0xe8, 0xdb, 0xbc, 0xef, 0x97, 0x76, 0x31, 0xdf, 0xf9, 0x52, 0xc5, 0x68, 0x12, 0xe3, 0xcf, 0x6d,
+  0xc2, 0x3c, 0x93, 0xbb, 0x23, 0xa1, 0xe9, 0x58, 0xe6, 0x14, 0x2a, 0x62, 0x39, 0x55, 0x3f, 0xb3,
+  0x7f, 0xd0, 0x95, 0x3d, 0xe4, 0xf7, 0x96, 0x8f, 0xc9, 0x77, 0x2e, 0x59, 0x11, 0x14, 0x45, 0x64,
+  0x21, 0x0e, 0x73, 0x86, 0xe2, 0xaa, 0x59, 0x29, 0x8a, 0x52, 0xd2, 0x02, 0x83, 0x18, 0xcb, 0x71,
+  0x56, 0x65, 0x46, 0xb9, 0x70, 0xf0, 0x8d, 0xca, 0x06, 0x33, 0xd3, 0x9a, 0x96, 0x58, 0x63, 0xb9,
+  0x40, 0x90, 0xb3, 0x33, 0x03, 0x9c, 0x74, 0xe2, 0xb1, 0xcc, 0x28, 0x54, 0xc4, 0x72, 0xf2, 0x79,
+  0xdf, 0xcb, 0x62, 0x23, 0x25, 0x1f, 0xfb, 0x77, 0x6f, 0x3f, 0xeb, 0xc8, 0x49, 0x54, 0xb5, 0xf7,
+  0x98, 0x01, 0x29, 0x90, 0x77, 0x0e, 0x9d, 0xbb, 0xd4, 0x17, 0x3f, 0xbd, 0xd9, 0xe5, 0xfc, 0xf8,
+  0xce, 0x76, 0xf3, 0x8a, 0xb8, 0xac, 0xa9, 0x11, 0x81, 0x8e, 0x24, 0xc1, 0x1b, 0x7d, 0xcf, 0x4a,
+  0x4b, 0x5b, 0x64, 0xb6, 0xdd, 0xe7, 0x16, 0x5d, 0xd8, 0xc7, 0x7f, 0xe5, 0x51, 0x8f, 0xa3, 0x53,
+  0x11, 0xca, 0xe9, 0xfd, 0x9b, 0xfe, 0x87, 0x13, 0x71, 0xbc, 0xa2, 0xf6, 0x96, 0xaf, 0xc9, 0xf6,
+  0x2d, 0x12, 0x1a, 0xd0, 0x46, 0x08, 0x2f, 0x80, 0x36, 0x8e, 0xbf, 0x95, 0x43, 0x64, 0x44, 0x51,
+  0x15, 0x90, 0x84, 0x39, 0xce, 0x1b, 0x8a, 0x92, 0x24, 0x64, 0xb8, 0xf3, 0xd8, 0x62, 0x3c, 0x93,
+  0xbb, 0xd8, 0xf4, 0xa7, 0x4b, 0x68, 0x2e, 0x5c, 0x3c, 0x3b, 0x99, 0x40, 0xc6, 0x72, 0x07, 0x35,
+  0x8e, 0x61, 0x87, 0xa9, 0x88, 0xe5, 0x50, 0xd9, 0x5f, 0xf4, 0x22, 0x35, 0x1c, 0x5f, 0xb4, 0xb7,
+  0xbc, 0xb4, 0x4b, 0xba, 0xee, 0x58, 0xb2, 0x53, 0x14, 0xa5, 0xa4, 0x05, 0x06, 0x31, 0x96, 0xe2,
+  0xa0, 0x2a, 0x5a, 0xec, 0x48, 0x01, 0x29, 0xb8, 0x1d, 0xc3, 0xa7, 0xe7, 0x56, 0xe5, 0x65, 0xb9,
+  0x40, 0x90, 0x9d, 0xcc, 0x0e, 0x71, 0xd3, 0x8a, 0x7c, 0x50, 0xc6, 0x96, 0xfe, 0x43, 0x33, 0x09,
+  0x30, 0x46, 0xdf, 0x73, 0xd2, 0xb1, 0xcc, 0x28, 0xd5, 0xc4, 0x72, 0xb8, 0x6e, 0xaf, 0xfa, 0x19,
+  0xc7, 0x96, 0x2b, 0xd9, 0xdf, 0xdd, 0x5a, 0xa7, 0xdd, 0xf6, 0x2f, 0x89, 0x63, 0xc7, 0xfa, 0xc4,
+  0xff, 0x00, 0xbe, 0x85, 0x15, 0x44, 0x5a, 0x4d, 0x8f, 0xb9, 0xfa, 0x8a, 0x2b, 0xb2, 0xf1, 0xee,
+  0x2f, 0xad, 0x57, 0xfe, 0x4f, 0xcc, 0xe1, 0xe1, 0x8c, 0xda, 0x37, 0x99, 0x26, 0x08, 0x23, 0x6f,
+  0xcb, 0x53, 0x88, 0xcc, 0x92, 0x7d, 0xa4, 0x63, 0x60, 0x3b, 0xb0, 0x7a, 0xf1, 0xff, 0x00, 0xea,
+  0xa8, 0x55, 0xfe, 0xd9, 0xfb, 0xbc, 0x6c, 0xc7, 0xcd, 0x9e, 0xbf, 0xe7, 0xad, 0x58, 0x57, 0xf2,
+  0xff, 0x00, 0xd1, 0x71, 0x9c, 0xfc, 0xbb, 0xbe, 0xbe, 0xdf, 0x8d, 0x7a, 0xca, 0xa3, 0xd7, 0xb9,
+  0xea, 0xbe, 0x4b, 0x59, 0x7c, 0x1d, 0x3d, 0x47, 0xb7, 0xfa, 0x66, 0x3c, 0xbe, 0x36, 0x75, 0xdd,
+  0xef, 0xff, 0x00, 0xea, 0xab, 0x21, 0xc4, 0x91, 0xfd, 0x98, 0x67, 0x78, 0x1b, 0x72, 0x7a, 0x71,
+  0xff, 0x00, 0xea, 0xaa, 0xeb, 0xfe, 0x85, 0xfe, 0xde, 0xff, 0x00, 0xc3, 0x18, 0xff, 0x00, 0xf5,
+  0xd5, 0x85, 0x8f, 0xcb, 0xff, 0x00, 0x4a, 0xce, 0x73, 0xf3, 0x6d, 0xfa, 0xfb, 0xfe, 0x35, 0x8c,
+  0x6a, 0x7f, 0xc0, 0x25, 0xb7, 0x77, 0x7d, 0xfe, 0xd7, 0xa7, 0xfc, 0x37, 0x62, 0x48, 0x5c, 0x5a,
+  0x2f, 0x97, 0x26, 0x49, 0x3f, 0x37, 0xcb, 0x53, 0x43, 0x19, 0xb4, 0x6f, 0x32, 0x4c, 0x10, 0x46,
+  0xdf, 0x96, 0xa1, 0x58, 0xfe, 0xd9, 0xfb, 0xcc, 0xec, 0xc7, 0xcb, 0x8e, 0xbf, 0xe7, 0xad, 0x58,
+  0x57, 0xfb, 0x67, 0xee, 0xf1, 0xb3, 0x1f, 0x36, 0x7a, 0xff, 0x00, 0x9e, 0xb5, 0x8c, 0x6a, 0x6f,
+  0xf8, 0x92, 0xfa, 0x5b, 0xfe, 0xdd, 0xfe, 0xbf, 0xcc, 0x8d, 0xa3, 0x32, 0x4f, 0xf6, 0x91, 0x8d,
+  0x83, 0x0d, 0x83, 0xd7, 0x8f, 0xff, 0x00, 0x55, 0x4e, 0x7f, 0xd3, 0x31, 0xe5, 0xf1, 0xb3, 0xae,
+  0xef, 0x7f, 0xff, 0x00, 0x55, 0x44, 0x5f, 0xcb, 0x73, 0x6b, 0x8c, 0xe7, 0xe5, 0xdd, 0xf5, 0xf6,
+  0xfc, 0x6a, 0x65, 0xff, 0x00, 0x42, 0xff, 0x00, 0x6f, 0x7f, 0xe1, 0x8c, 0x7f, 0xfa, 0xea, 0x23,
+  0x53, 0xfe, 0x01, 0xc5, 0x3b, 0x5d, 0xdf, 0x6f, 0xb5, 0xeb, 0xff, 0x00, 0x0f, 0xd8, 0x90, 0x38,
+  0x92, 0x3f, 0xb3, 0x0c, 0xef, 0x1f, 0x2e, 0x4f, 0x4e, 0x3f, 0xfd, 0x55, 0x62, 0x17, 0x16, 0x8b,
+  0xe5, 0xc9, 0x92, 0x4f, 0xcd, 0xf2, 0xd5, 0x75, 0x8f, 0xcb, 0xff, 0x00, 0x4a, 0xce, 0x73, 0xf3,
+  0x6d, 0xfa, 0xfb, 0xfe, 0x35, 0x61, 0x63, 0xfb, 0x67, 0xef, 0x33, 0xb3, 0x1f, 0x2e, 0x3a, 0xff,
+  0x00, 0x9e, 0xb5, 0x8a, 0xa8, 0xb5, 0xec, 0x66, 0xdc, 0xef, 0x75, 0xf1, 0xf4, 0xf4, 0x1d, 0x0c,
+  0x66, 0xd1, 0xbc, 0xc9, 0x30, 0x41, 0x1b, 0x7e, 0x5a, 0xb0, 0x23, 0x32, 0x49, 0xf6, 0x91, 0x8d,
+  0x83, 0xe6, 0xc1, 0xeb, 0xc7, 0xff, 0x00, 0xaa, 0xa1, 0x57, 0xfb, 0x67, 0xee, 0xf1, 0xb3, 0x1f,
+  0x36, 0x7a, 0xff, 0x00, 0x9e, 0xb5, 0x61, 0x5f, 0xcb, 0xff, 0x00, 0x45, 0xc6, 0x73, 0xf2, 0xee,
+  0xfa, 0xfb, 0x7e, 0x35, 0x8a, 0xa8, 0xf5, 0xee, 0x43, 0xe4, 0xb5, 0x97, 0xc1, 0xd3, 0xd4, 0x94,
+  0x5e, 0xc7, 0x8f, 0xba, 0xff, 0x00, 0x90, 0xa2, 0x9a, 0x2c, 0x38, 0xff, 0x00, 0x59, 0xff, 0x00,
+  0x8e, 0xd1, 0x5c, 0xdc, 0xf4, 0xfb, 0x8f, 0x9b, 0x17, 0xdb, 0xf2, 0x38, 0x23, 0x18, 0xb4, 0x51,
+  0x24, 0x79, 0x24, 0x9d, 0xbf, 0x35, 0x58, 0x8e, 0x31, 0x24, 0x7f, 0x69, 0x39, 0xde, 0x3e, 0x6c,
+  0x0e, 0x9c, 0x7f, 0xfa, 0xaa, 0xb5, 0xab, 0x35, 0xcb, 0x94, 0x98, 0xee, 0x50, 0x33, 0x8e, 0x9c,
+  0xd5, 0x8d, 0xcc, 0x97, 0x02, 0x05, 0x38, 0x8f, 0x20, 0x6d, 0xf6, 0x3d, 0x6b, 0xd7, 0x53, 0x7a,
+  0xae, 0xa7, 0xac, 0xe5, 0x1b, 0x73, 0x25, 0xee, 0xbd, 0x12, 0xf3, 0xee, 0x49, 0x0f, 0xfa, 0x66,
+  0x7c, 0xce, 0x36, 0x74, 0xdb, 0xef, 0xff, 0x00, 0xea, 0xa9, 0xe3, 0x73, 0x24, 0x9f, 0x66, 0x38,
+  0xd8, 0x3e, 0x5c, 0x8e, 0xbc, 0x7f, 0xfa, 0xaa, 0x19, 0x7f, 0xd1, 0xb6, 0xf9, 0x3f, 0x2e, 0xee,
+  0xbd, 0xff, 0x00, 0x9d, 0x59, 0xd8, 0xa9, 0x6e, 0x27, 0x51, 0x89, 0x30, 0x0e, 0xef, 0x73, 0xd6,
+  0xb0, 0x8d, 0x4f, 0xf8, 0x04, 0xbb, 0xab, 0xa7, 0xba, 0xf8, 0xbc, 0xd7, 0xfc, 0x30, 0xa5, 0xcd,
+  0xa3, 0x08, 0xe3, 0xc1, 0x04, 0x6e, 0xf9, 0xaa, 0xc9, 0x8c, 0x5a, 0x28, 0x92, 0x3c, 0x92, 0x7e,
+  0x5f, 0x9a, 0xa1, 0xb5, 0x45, 0xb9, 0x42, 0xf3, 0x0d, 0xcc, 0x0e, 0x33, 0xd3, 0x8a, 0x96, 0xd5,
+  0x9a, 0xe5, 0xca, 0x4c, 0x77, 0x28, 0x19, 0xc7, 0x4e, 0x6b, 0x18, 0xd4, 0xdf, 0xf1, 0x21, 0xf4,
+  0xb7, 0x5f, 0x87, 0xcb, 0xfa, 0xf9, 0x87, 0x96, 0x24, 0x06, 0xe4, 0xe7, 0x78, 0xf9, 0xb0, 0x3a,
+  0x71, 0xff, 0x00, 0xea, 0xa9, 0x61, 0xff, 0x00, 0x4c, 0xcf, 0x99, 0xc6, 0xce, 0x9b, 0x7d, 0xff,
+  0x00, 0xfd, 0x55, 0x0c, 0x8c, 0xc9, 0x75, 0xe4, 0x29, 0xc4, 0x79, 0x03, 0x6f, 0xb1, 0xeb, 0x53,
+  0xcb, 0xfe, 0x8d, 0xb7, 0xc9, 0xf9, 0x77, 0x75, 0xef, 0xfc, 0xea, 0x23, 0x3f, 0xf8, 0x07, 0x14,
+  0xda, 0x4d, 0xb7, 0xb2, 0xf8, 0xbc, 0xdf, 0xfc, 0x38, 0xe8, 0xdc, 0xc9, 0x27, 0xd9, 0x8e, 0x36,
+  0x03, 0xb7, 0x23, 0xaf, 0x1f, 0xfe, 0xaa, 0xb0, 0x5c, 0xda, 0x30, 0x8e, 0x3c, 0x10, 0x46, 0xef,
+  0x9a, 0xa3, 0xd8, 0xa9, 0x6e, 0x27, 0x51, 0x89, 0x30, 0x0e, 0xef, 0x73, 0xd6, 0xa7, 0xb5, 0x45,
+  0xb9, 0x42, 0xf3, 0x0d, 0xcc, 0x0e, 0x33, 0xd3, 0x8a, 0xc5, 0x54, 0x5a, 0xbe, 0x84, 0x35, 0x2b,
+  0xf2, 0xa7, 0xef, 0x3d, 0x53, 0xf2, 0xec, 0x3c, 0xc6, 0x2d, 0x14, 0x49, 0x1e, 0x49, 0x3f, 0x2f,
+  0xcd, 0x53, 0xc7, 0x18, 0x92, 0x3f, 0xb4, 0x9c, 0xef, 0x03, 0x76, 0x07, 0x4e, 0x3f, 0xfd, 0x55,
+  0x5a, 0xd5, 0x9a, 0xe5, 0xca, 0x4c, 0x77, 0x28, 0x19, 0xc7, 0x4e, 0x6a, 0xc6, 0xe6, 0x4b, 0x81,
+  0x02, 0x9c, 0x47, 0x90, 0x36, 0xfb, 0x1e, 0xb5, 0x8a, 0x9b, 0xd5, 0x75, 0x33, 0x72, 0x8d, 0xb9,
+  0x92, 0xf7, 0x5e, 0x89, 0x79, 0xf7, 0x14, 0x5e, 0xc9, 0x8f, 0xba, 0x9f, 0x91, 0xa2, 0xad, 0x0b,
+  0x48, 0x71, 0xf7, 0x3f, 0x53, 0x45, 0x73, 0x7b, 0x68, 0x76, 0x2b, 0xd8, 0xe2, 0xbf, 0x9f, 0xfa,
+  0xfb, 0x8f, 0x3e, 0xb8, 0x51, 0x14, 0x41, 0xa3, 0x01, 0x0e, 0xec, 0x65, 0x78, 0xa9, 0xe1, 0x50,
+  0xd6, 0x9e, 0x61, 0x00, 0xbe, 0x09, 0xdc, 0x7a, 0xfe, 0x75, 0x52, 0xc9, 0x4c, 0x52, 0x96, 0x90,
+  0x14, 0x18, 0xc6, 0x5b, 0x8a, 0xb0, 0x54, 0xb5, 0xd8, 0x90, 0x02, 0x53, 0x70, 0x3b, 0x87, 0x4f,
+  0xce, 0xbd, 0x68, 0xcf, 0xa5, 0xcf, 0x59, 0xce, 0xff, 0x00, 0xbc, 0xb6, 0xfa, 0x5b, 0xb7, 0x99,
+  0x2d, 0x8f, 0xef, 0x77, 0xf9, 0x9f, 0x3e, 0x31, 0x8d, 0xdc, 0xe2, 0xa6, 0x84, 0x96, 0xbb, 0xf2,
+  0xc9, 0x25, 0x32, 0x46, 0xd3, 0xd3, 0xf2, 0xa8, 0xae, 0x7f, 0x7b, 0xb3, 0xcb, 0xf9, 0xf1, 0x9c,
+  0xed, 0xe7, 0x15, 0x68, 0x90, 0xd6, 0x82, 0x30, 0x41, 0x7d, 0xa0, 0x6d, 0x1d, 0x7f, 0x2a, 0xc6,
+  0x35, 0x3a, 0xf7, 0x25, 0xab, 0x7b, 0xb7, 0xf8, 0x75, 0xbf, 0x7f, 0x2f, 0xd3, 0xa8, 0x97, 0x04,
+  0xc5, 0x28, 0x58, 0xc9, 0x41, 0x8c, 0xe1, 0x78, 0xab, 0x97, 0x0a, 0x22, 0x88, 0x34, 0x60, 0x21,
+  0xdd, 0x8c, 0xaf, 0x15, 0x05, 0x91, 0x11, 0x44, 0x56, 0x42, 0x10, 0xe7, 0x38, 0x6e, 0x29, 0xf6,
+  0x4a, 0x62, 0x94, 0xb4, 0x80, 0xa0, 0xdb, 0x8c, 0xb7, 0x15, 0x8c, 0x6a, 0x7e, 0x1f, 0x89, 0x0f,
+  0x5f, 0xfb, 0x7b, 0xff, 0x00, 0x25, 0xfe, 0xbe, 0x43, 0x91, 0x43, 0x5b, 0x19, 0x08, 0x05, 0xf0,
+  0x4e, 0xe3, 0xd7, 0xf3, 0xa9, 0x2c, 0x7f, 0x7b, 0xbf, 0xcc, 0xf9, 0xf1, 0x8c, 0x6e, 0xe7, 0x15,
+  0x04, 0xaa, 0x5a, 0xfb, 0xcc, 0x00, 0x94, 0xc8, 0x3b, 0x87, 0x4e, 0xdd, 0xea, 0xc5, 0xcf, 0xef,
+  0x76, 0x79, 0x7f, 0x3e, 0x33, 0x9d, 0xbc, 0xe2, 0xa2, 0x33, 0xe9, 0xdc, 0xe2, 0x9c, 0xac, 0xdc,
+  0xad, 0xf0, 0xe9, 0x6e, 0xfe, 0x7f, 0xaf, 0x51, 0x61, 0x25, 0xae, 0xfc, 0xb2, 0x49, 0x4c, 0x91,
+  0xb4, 0xf4, 0xfc, 0xaa, 0xc5, 0xc1, 0x31, 0x4a, 0x16, 0x32, 0x50, 0x63, 0x38, 0x5e, 0x29, 0x84,
+  0x86, 0xb4, 0x11, 0x82, 0x0b, 0xe0, 0x0d, 0xa3, 0xaf, 0xe5, 0x56, 0x2c, 0x88, 0x8a, 0x22, 0xb2,
+  0x10, 0x87, 0x76, 0x70, 0xdc, 0x56, 0x31, 0xab, 0xd4, 0xcd, 0xc6, 0xff, 0x00, 0xbb, 0xbe, 0xfa,
+  0xdf, 0xb7, 0x90, 0xfb, 0x95, 0x11, 0x44, 0x1a, 0x30, 0x10, 0xee, 0xc6, 0x57, 0x8a, 0xb1, 0x0a,
+  0x86, 0xb4, 0xf3, 0x08, 0x05, 0xf0, 0x4e, 0xe3, 0xd7, 0xf3, 0xaa, 0x96, 0x4a, 0x62, 0x94, 0xb4,
+  0x80, 0xa0, 0xc6, 0x32, 0xdc, 0x54, 0xe5, 0x4b, 0x5d, 0x89, 0x00, 0x25, 0x32, 0x0e, 0xe1, 0xd3,
+  0xf3, 0xac, 0x63, 0x3e, 0x97, 0x25, 0xce, 0xff, 0x00, 0xbc, 0xb6, 0xfa, 0x5b, 0xb7, 0x99, 0x18,
+  0x96, 0x4c, 0x7f, 0xac, 0x7f, 0xfb, 0xe8, 0xd1, 0x58, 0xfa, 0xc7, 0x88, 0xe5, 0x8f, 0x50, 0x92,
+  0x2b, 0x3b, 0x94, 0x48, 0xe3, 0xf9, 0x0f, 0x0a, 0x72, 0xc3, 0xaf, 0x51, 0xf8, 0x7e, 0x14, 0x56,
+  0xb1, 0xa1, 0x52, 0x49, 0x4a, 0xcb, 0xfa, 0xf9, 0x1d, 0xf0, 0xc9, 0x2b, 0x4e, 0x2a, 0x5e, 0xd5,
+  0x6a, 0x62, 0xca, 0xcb, 0x72, 0x81, 0x21, 0x3b, 0x98, 0x1c, 0xe3, 0xa7, 0x15, 0x62, 0x26, 0x54,
+  0xb7, 0xf2, 0x18, 0xe2, 0x4c, 0x11, 0xb7, 0xdc, 0xf4, 0xaa, 0x7a, 0x77, 0xfa, 0xe3, 0xfe, 0xef,
+  0xf5, 0x15, 0x61, 0xff, 0x00, 0xe3, 0xfc, 0x7f, 0xbc, 0xbf, 0xd2, 0xba, 0x94, 0xb5, 0x71, 0x37,
+  0x75, 0x1b, 0x8a, 0xad, 0xd5, 0xe9, 0xf2, 0x26, 0xb5, 0xff, 0x00, 0x46, 0xdd, 0xe7, 0x7c, 0xbb,
+  0xb1, 0x8e, 0xff, 0x00, 0xca, 0xa6, 0x89, 0x19, 0x2e, 0x3c, 0xf6, 0x18, 0x8f, 0x24, 0xee, 0xf6,
+  0x3d, 0x2a, 0x2b, 0xdf, 0xf9, 0x67, 0xf8, 0xff, 0x00, 0x4a, 0xb6, 0xff, 0x00, 0xf1, 0xe0, 0x3f,
+  0xdd, 0x5f, 0xe9, 0x58, 0x46, 0xa3, 0x7a, 0xf7, 0x14, 0xa3, 0xca, 0xdc, 0x3a, 0x43, 0x55, 0xf9,
+  0xea, 0x36, 0x54, 0x6b, 0x97, 0x0f, 0x08, 0xdc, 0xa0, 0x63, 0x3d, 0x39, 0xab, 0x72, 0xb2, 0xdc,
+  0xa0, 0x48, 0x4e, 0xe6, 0x07, 0x38, 0xe9, 0xc5, 0x45, 0xa7, 0x7f, 0xa9, 0x3f, 0xef, 0x7f, 0x41,
+  0x4b, 0xa7, 0x7f, 0xae, 0x3f, 0xee, 0xff, 0x00, 0x51, 0x58, 0xa9, 0xef, 0xe4, 0x43, 0xd6, 0xdf,
+  0xdf, 0xdf, 0xfe, 0x00, 0xf5, 0x65, 0x48, 0x8c, 0x0c, 0x71, 0x26, 0x08, 0xdb, 0xee, 0x7a, 0x54,
+  0x96, 0xbf, 0xe8, 0xdb, 0xbc, 0xef, 0x97, 0x76, 0x31, 0xdf, 0xf9, 0x55, 0x79, 0xbf, 0xe4, 0x25,
+  0xff, 0x00, 0x02, 0x5f, 0xe9, 0x56, 0x6f, 0x7f, 0xe5, 0x9f, 0xe3, 0xfd, 0x2a, 0x23, 0x2e, 0x9d,
+  0xce, 0x1a, 0x92, 0x6b, 0x9a, 0x7d, 0x60, 0xec, 0xbf, 0x2d, 0x45, 0x89, 0x19, 0x2e, 0x3c, 0xf6,
+  0x18, 0x8f, 0x24, 0xee, 0xf6, 0x3d, 0x2a, 0xc4, 0xa8, 0xd7, 0x2e, 0x1e, 0x11, 0xb9, 0x40, 0xc6,
+  0x7a, 0x73, 0x4d, 0x7f, 0xf8, 0xf0, 0x1f, 0xee, 0xaf, 0xf4, 0xa9, 0xf4, 0xef, 0xf5, 0x27, 0xfd,
+  0xef, 0xe8, 0x2b, 0x15, 0x51, 0xd9, 0xc8, 0x97, 0x04, 0xe4, 0xa8, 0xf4, 0x7a, 0xfc, 0xc7, 0x4a,
+  0xcb, 0x72, 0x81, 0x21, 0x3b, 0x98, 0x1c, 0xe3, 0xa7, 0x15, 0x0e, 0xa9, 0xa8, 0x2e, 0x9b, 0xa3,
+  0xc8, 0xb9, 0xc5, 0xc3, 0x03, 0x1c, 0x6b, 0x8f, 0xe2, 0x39, 0xc7, 0x6c, 0x7b, 0xfe, 0x14, 0xfd,
+  0x3b, 0xfd, 0x71, 0xff, 0x00, 0x77, 0xfa, 0x8a, 0xe6, 0xbc, 0x63, 0x23, 0x1d, 0x7a, 0x08, 0x89,
+  0xf9, 0x15, 0x15, 0x80, 0xf7, 0x27, 0x9f, 0xe4, 0x2a, 0xb0, 0x90, 0x55, 0x2a, 0xf2, 0x3d, 0x96,
+  0xa6, 0xb8, 0x45, 0xed, 0xaa, 0x46, 0xa4, 0xba, 0xe8, 0xfd, 0x0c, 0x01, 0x69, 0x36, 0x3e, 0xe7,
+  0xea, 0x28, 0xad, 0x21, 0xd2, 0x8a, 0xf5, 0xbe, 0xb1, 0x23, 0xeb, 0x7e, 0xa1, 0x4f, 0xbb, 0xfe,
+  0xbe, 0x47, 0xff, 0xd9,
+};
+
+static const uint8_t sample_gray[] = {
+  0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x10, 0x0b, 0x0c, 0x0e, 0x0c, 0x0a, 0x10,
+  0x0e, 0x0d, 0x0e, 0x12, 0x11, 0x10, 0x13, 0x18, 0x28, 0x1a, 0x18, 0x16, 0x16, 0x18, 0x31, 0x23,
+  0x25, 0x1d, 0x28, 0x3a, 0x33, 0x3d, 0x3c, 0x39, 0x33, 0x38, 0x37, 0x40, 0x48, 0x5c, 0x4e, 0x40,
+  0x44, 0x57, 0x45, 0x37, 0x38, 0x50, 0x6d, 0x51, 0x57, 0x5f, 0x62, 0x67, 0x68, 0x67, 0x3e, 0x4d,
+  0x71, 0x79, 0x70, 0x64, 0x78, 0x5c, 0x65, 0x67, 0x63, 0xff, 0xc0, 0x00, 0x0b, 0x08, 0x00, 0x28,
+  0x00, 0x30, 0x01, 0x01, 0x11, 0x00, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04,
+  0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03,
+  0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00,
+  0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32,
+  0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72,
+  0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35,
+  0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55,
+  0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75,
+  0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94,
+  0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2,
+  0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9,
+  0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+  0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xda,
+  0x00, 0x08, 0x01, 0x01, 0x00, 0x00, 0x3f, 0x00, 0x8b, 0xc2, 0xb0, 0xc9, 0x61, 0xa8, 0x3c, 0xb7,
+  0xb1, 0xb5, 0xb4, 0x66, 0x22, 0xa1, 0xe6, 0x1b, 0x01, 0x39, 0x07, 0x19, 0x3d, 0xf8, 0x3f, 0x95,
+  0x49, 0xaa, 0x24, 0x92, 0xf8, 0x92, 0x3b, 0xa8, 0x91, 0x9e, 0xd7, 0xcd, 0x8d, 0xcc, 0xea, 0x32,
+  0x81, 0x54, 0x2e, 0x4e, 0xee, 0x98, 0x18, 0x3f, 0x95, 0x58, 0xf1, 0x1a, 0xff, 0x00, 0x68, 0xfd,
+  0x97, 0xec, 0x1f, 0xe9, 0x5e, 0x5e, 0xfd, 0xfe, 0x47, 0xcf, 0xb7, 0x38, 0xc6, 0x71, 0xd3, 0xa1,
+  0xfc, 0xaa, 0x4d, 0x42, 0x68, 0xee, 0x3c, 0x3e, 0x2c, 0xe2, 0x75, 0x7b, 0xa5, 0x8a, 0x34, 0xf2,
+  0x14, 0x82, 0xe0, 0xa9, 0x5c, 0x8d, 0xbd, 0x72, 0x30, 0x6a, 0x5f, 0x0d, 0x4d, 0x1e, 0x99, 0xa6,
+  0x4a, 0x97, 0xce, 0x96, 0xd2, 0x19, 0x0b, 0x04, 0x98, 0xec, 0x24, 0x60, 0x00, 0x70, 0x7b, 0x64,
+  0x56, 0x57, 0x85, 0x61, 0x92, 0xc3, 0x50, 0x79, 0x6f, 0x63, 0x6b, 0x68, 0xcc, 0x45, 0x43, 0xcc,
+  0x36, 0x02, 0x72, 0x0e, 0x32, 0x7b, 0xf0, 0x7f, 0x2a, 0xd1, 0xd4, 0xe7, 0x8b, 0x5d, 0xb5, 0x4b,
+  0x5d, 0x31, 0xbc, 0xf9, 0x91, 0xc4, 0x8c, 0xb8, 0x2b, 0x85, 0x00, 0x8c, 0xe5, 0xb0, 0x3a, 0x91,
+  0x4c, 0x8a, 0xe6, 0x2b, 0x7d, 0x31, 0xf4, 0x89, 0xdf, 0x6d, 0xf6, 0xc7, 0x88, 0x45, 0x8c, 0xfc,
+  0xcd, 0x9d, 0xa3, 0x23, 0x8e, 0x77, 0x0e, 0xfd, 0xe8, 0xd1, 0x0f, 0xfc, 0x23, 0xb1, 0xdc, 0x36,
+  0xab, 0xfe, 0x8f, 0xe7, 0x05, 0xf2, 0xff, 0x00, 0x8f, 0x76, 0x33, 0x9f, 0xbb, 0x9f, 0x51, 0x55,
+  0x2c, 0x6d, 0x65, 0xb5, 0xd6, 0x4e, 0xaf, 0x3a, 0x6d, 0xb0, 0x2e, 0xf2, 0x09, 0x72, 0x0f, 0xca,
+  0xd9, 0xda, 0x70, 0x39, 0xe7, 0x23, 0xb5, 0x3f, 0xc4, 0x10, 0x4b, 0xae, 0x5c, 0x47, 0x3e, 0x96,
+  0xbe, 0x7c, 0x2a, 0x81, 0x19, 0xb2, 0x17, 0x0c, 0x09, 0x38, 0xc3, 0x60, 0xf7, 0x15, 0x6f, 0x53,
+  0x9e, 0x2d, 0x76, 0xd5, 0x2d, 0x74, 0xc6, 0xf3, 0xe6, 0x47, 0x12, 0x32, 0xe0, 0xae, 0x14, 0x02,
+  0x33, 0x96, 0xc0, 0xea, 0x45, 0x43, 0x65, 0x6b, 0x27, 0x85, 0x8b, 0xdf, 0xdf, 0x14, 0x92, 0x37,
+  0x5f, 0x28, 0x08, 0x72, 0x4e, 0xe3, 0xc8, 0xeb, 0x8e, 0x3e, 0x5a, 0x88, 0x59, 0x49, 0x7b, 0x7a,
+  0x35, 0xe8, 0x8a, 0x8b, 0x55, 0x61, 0x29, 0x46, 0x3f, 0x3e, 0x13, 0x00, 0xf1, 0xd3, 0x3f, 0x29,
+  0xc7, 0x35, 0x2e, 0xa8, 0x7f, 0xe1, 0x28, 0x58, 0x92, 0xc3, 0xf7, 0x7f, 0x67, 0xc9, 0x7f, 0x3b,
+  0x8c, 0xee, 0xe9, 0x8c, 0x67, 0xfb, 0xa6, 0xa4, 0x17, 0x51, 0xde, 0xd9, 0x0d, 0x06, 0x25, 0x61,
+  0x74, 0xaa, 0x22, 0x2e, 0xc3, 0xe4, 0xca, 0x60, 0x9e, 0x7a, 0xe3, 0xe5, 0x38, 0xe2, 0xa3, 0xb6,
+  0xbc, 0x8f, 0xc3, 0x85, 0xec, 0xef, 0x43, 0xc9, 0x23, 0x37, 0x98, 0xa6, 0x10, 0x08, 0x03, 0xa7,
+  0x7c, 0x73, 0x95, 0x34, 0x59, 0x5a, 0xc9, 0xe1, 0x62, 0xf7, 0xf7, 0xc5, 0x24, 0x8d, 0xd7, 0xca,
+  0x02, 0x1c, 0x93, 0xb8, 0xf2, 0x3a, 0xe3, 0x8f, 0x96, 0x89, 0xef, 0x7f, 0xe1, 0x28, 0x55, 0xd3,
+  0xc2, 0x7d, 0x97, 0x67, 0xef, 0x8b, 0xee, 0xdf, 0x9c, 0x71, 0x8c, 0x71, 0xfd, 0xef, 0xd2, 0x96,
+  0x2b, 0xbf, 0xb0, 0xff, 0x00, 0xc5, 0x3d, 0xe5, 0xf9, 0x9b, 0xbf, 0x73, 0xe7, 0xe7, 0x1f, 0x7f,
+  0x9c, 0xed, 0xf6, 0xdd, 0xeb, 0xda, 0x98, 0xe7, 0xfe, 0x11, 0x69, 0x8f, 0xfc, 0xbd, 0x8b, 0x9e,
+  0x3f, 0xe7, 0x9e, 0xdd, 0xbf, 0x9e, 0x73, 0xba, 0xa5, 0x16, 0x9f, 0xd9, 0xd1, 0x9f, 0x11, 0xf9,
+  0x9b, 0xf2, 0x3c, 0xef, 0x23, 0x6e, 0x3f, 0xd6, 0x71, 0x8d, 0xde, 0xdb, 0xbd, 0x3b, 0x54, 0x31,
+  0x58, 0xff, 0x00, 0xc2, 0x51, 0xfe, 0x9d, 0xe6, 0x7d, 0x97, 0xcb, 0xfd, 0xce, 0xcc, 0x6f, 0xce,
+  0x39, 0xce, 0x78, 0xfe, 0xf7, 0xe9, 0x4f, 0x9e, 0xf7, 0xfe, 0x12, 0x85, 0x5d, 0x3c, 0x27, 0xd9,
+  0x76, 0x7e, 0xf8, 0xbe, 0xed, 0xf9, 0xc7, 0x18, 0xc7, 0x1f, 0xde, 0xfd, 0x28, 0xd4, 0x2d, 0x63,
+  0xf0, 0xe1, 0xfb, 0x6d, 0x89, 0x79, 0x24, 0x66, 0xf2, 0x48, 0x9b, 0x04, 0x01, 0xd4, 0xf4, 0xc7,
+  0x39, 0x5a, 0x96, 0x2b, 0x58, 0xee, 0xb4, 0xf6, 0xf1, 0x04, 0xa5, 0x85, 0xda, 0x29, 0x94, 0x22,
+  0xff, 0x00, 0xab, 0xdc, 0x9c, 0x28, 0xc7, 0x5c, 0x7c, 0xa3, 0x3c, 0xd5, 0x7d, 0x35, 0x7f, 0xe1,
+  0x28, 0xdf, 0xf6, 0xff, 0x00, 0xdd, 0xfd, 0x9b, 0x1b, 0x3c, 0x8e, 0x33, 0xbb, 0xae, 0x73, 0x9f,
+  0xee, 0x8a, 0x57, 0xbc, 0x92, 0xf2, 0xe8, 0x78, 0x7a, 0x40, 0xa2, 0xd4, 0x31, 0x8f, 0x7a, 0xf1,
+  0x26, 0xd4, 0xce, 0x39, 0xe9, 0xfc, 0x23, 0xb5, 0x2c, 0xf7, 0x52, 0x78, 0x6a, 0x55, 0xb2, 0xb2,
+  0x55, 0x92, 0x37, 0x5f, 0x34, 0x99, 0x86, 0x4e, 0x4f, 0x1d, 0xb1, 0xc7, 0xca, 0x29, 0x75, 0x0b,
+  0x58, 0xfc, 0x38, 0x7e, 0xdb, 0x62, 0x5e, 0x49, 0x19, 0xbc, 0x92, 0x26, 0xc1, 0x00, 0x75, 0x3d,
+  0x31, 0xce, 0x56, 0xbf, 0xff, 0xd9,
+};
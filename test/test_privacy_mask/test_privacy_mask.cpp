@@ -0,0 +1,233 @@
+#include <unity.h>
+#include <string.h>
+#include <vector>
+#include <Preferences.h>
+#include "jpeg_blocks.h"
+#include "privacy_mask.h"
+#include "coef_decoder.h"
+#include "sample_images.h"
+
+static bool intersects(const jpeg_edit_t *e, int x, int y, int w, int h) {
+  return x < e->x + e->w && e->x < x + w && y < e->y + e->h && e->y < y + h;
+}
+
+// DC of a flat block of the given level, as jpeg_rewrite() quantizes it
+static int fill_dc(int level, int q0) {
+  int v = (level - 128) * 8;
+  return (v < 0 ? v - q0 / 2 : v + q0 / 2) / q0;
+}
+
+static void draw_white(void *ctx, int x, int y, uint8_t *pixels) {
+  memset(pixels, 255, 64);
+}
+
+// Mask jpeg with the current zones, plus an optional overlay drawn on top as
+// the frame pipe does, decode both, and check every block of every component:
+// blocks that touch a zone are flat at the fill color, all others outside the
+// overlay keep their coefficients exactly. Returns the number of masked blocks.
+static int check_masked(const uint8_t *jpeg, size_t len, const jpeg_edit_t *overlay = NULL) {
+  jpeg_info_t info;
+  TEST_ASSERT_TRUE(jpeg_info(jpeg, len, &info));
+  // the overlay goes first: precedence must not depend on the order
+  jpeg_edit_t all[PRIVACY_MASK_MAX_ZONES + 1];
+  jpeg_edit_t *edits = overlay ? all + 1 : all;
+  size_t n = privacy_mask_edits(info.width, info.height, edits, PRIVACY_MASK_MAX_ZONES);
+  if (overlay) {
+    all[0] = *overlay;
+  }
+
+  std::vector<uint8_t> out(len * 2 + 1024);
+  size_t out_len = jpeg_rewrite(jpeg, len, out.data(), out.size(), all, n + (overlay ? 1 : 0));
+  TEST_ASSERT_NOT_EQUAL(0, out_len);
+
+  coef_image_t before, after;
+  TEST_ASSERT_TRUE(coef_decode(jpeg, len, &before));
+  TEST_ASSERT_TRUE(coef_decode(out.data(), out_len, &after));
+  TEST_ASSERT_EQUAL_INT(before.width, after.width);
+  TEST_ASSERT_EQUAL_INT(before.height, after.height);
+  TEST_ASSERT_EQUAL_INT(before.ncomps, after.ncomps);
+  TEST_ASSERT_EQUAL_INT(info.h_max, before.ncomps > 1 ? before.h_max : 1);
+
+  int masked = 0;
+  for (int c = 0; c < before.ncomps; c++) {
+    const coef_comp_t *cp = &before.comps[c];
+    // pixels covered by one block of this component
+    int sx = before.ncomps > 1 ? before.h_max / cp->h : 1;
+    int sy = before.ncomps > 1 ? before.v_max / cp->v : 1;
+    const uint16_t *q = before.q[cp->tq];
+    for (int by = 0; by < cp->blocks_h; by++) {
+      for (int bx = 0; bx < cp->blocks_w; bx++) {
+        const int16_t *a = coef_block(&before, c, bx, by);
+        const int16_t *b = coef_block(&after, c, bx, by);
+        const jpeg_edit_t *hit = NULL;
+        for (size_t i = 0; i < n && !hit; i++) {
+          hit = intersects(&edits[i], bx * 8 * sx, by * 8 * sy, 8 * sx, 8 * sy) ? &edits[i] : NULL;
+        }
+        if (!hit) {
+          if (!overlay || !intersects(overlay, bx * 8 * sx, by * 8 * sy, 8 * sx, 8 * sy)) {
+            TEST_ASSERT_EQUAL_MEMORY(a, b, 64 * sizeof(int16_t));
+          }
+          continue;
+        }
+        int level = c == 0 ? hit->luma : (c == 1 ? hit->cb : hit->cr);
+        TEST_ASSERT_EQUAL_INT(fill_dc(level, q[0]), b[0]);
+        // flat: the block decodes to level everywhere, within rounding
+        TEST_ASSERT_INT_WITHIN(q[0] / 16 + 1, level, b[0] * q[0] / 8 + 128);
+        for (int k = 1; k < 64; k++) {
+          TEST_ASSERT_EQUAL_INT(0, b[k]);
+        }
+        masked++;
+      }
+    }
+  }
+  return masked;
+}
+
+void setUp() {
+  privacy_mask_clear();
+}
+
+void tearDown() {}
+
+void test_zones_scale_to_the_frame_and_round_outwards() {
+  mask_zone_t z = {100, 200, 250, 300};
+  TEST_ASSERT_TRUE(privacy_mask_add(&z));
+  jpeg_edit_t e[2];
+  TEST_ASSERT_EQUAL_size_t(1, privacy_mask_edits(120, 80, e, 2));
+  TEST_ASSERT_EQUAL_INT(JPEG_EDIT_FILL, e[0].type);
+  TEST_ASSERT_EQUAL_UINT16(12, e[0].x);  // 100 * 120 / 1000
+  TEST_ASSERT_EQUAL_UINT16(16, e[0].y);
+  TEST_ASSERT_EQUAL_UINT16(30, e[0].w);  // up to ceil(350 * 120 / 1000) = 42
+  TEST_ASSERT_EQUAL_UINT16(24, e[0].h);  // up to 40
+  TEST_ASSERT_EQUAL_size_t(1, privacy_mask_edits(1600, 1200, e, 2));
+  TEST_ASSERT_EQUAL_UINT16(160, e[0].x);
+  TEST_ASSERT_EQUAL_UINT16(240, e[0].y);
+  TEST_ASSERT_EQUAL_UINT16(400, e[0].w);
+  TEST_ASSERT_EQUAL_UINT16(360, e[0].h);
+}
+
+void test_zones_are_clipped_and_the_table_is_bounded() {
+  mask_zone_t z = {900, 950, 500, 500};
+  TEST_ASSERT_TRUE(privacy_mask_add(&z));
+  jpeg_edit_t e[1];
+  privacy_mask_edits(1000, 1000, e, 1);
+  TEST_ASSERT_EQUAL_UINT16(100, e[0].w);
+  TEST_ASSERT_EQUAL_UINT16(50, e[0].h);
+
+  mask_zone_t bad[] = {{1000, 0, 10, 10}, {0, 1000, 10, 10}, {0, 0, 0, 10}, {0, 0, 10, 0}};
+  for (size_t i = 0; i < sizeof(bad) / sizeof(bad[0]); i++) {
+    TEST_ASSERT_FALSE(privacy_mask_add(&bad[i]));
+  }
+  for (int i = 1; i < PRIVACY_MASK_MAX_ZONES; i++) {
+    TEST_ASSERT_TRUE(privacy_mask_add(&z));
+  }
+  TEST_ASSERT_FALSE(privacy_mask_add(&z));
+  TEST_ASSERT_EQUAL_size_t(PRIVACY_MASK_MAX_ZONES, privacy_mask_count());
+}
+
+void test_zones_persist_in_nvs() {
+  mask_zone_t a = {0, 0, 100, 100}, b = {500, 500, 200, 100};
+  TEST_ASSERT_TRUE(privacy_mask_add(&a));
+  TEST_ASSERT_TRUE(privacy_mask_add(&b));
+  TEST_ASSERT_TRUE(privacy_mask_remove(0));
+
+  Preferences prefs;
+  prefs.begin("mask", true);
+  mask_zone_t saved[PRIVACY_MASK_MAX_ZONES];
+  TEST_ASSERT_EQUAL_size_t(sizeof(mask_zone_t), prefs.getBytes("zones", saved, sizeof(saved)));
+  prefs.end();
+  TEST_ASSERT_EQUAL_MEMORY(&b, &saved[0], sizeof(mask_zone_t));
+
+  // a reboot loads them back
+  privacy_mask_begin();
+  TEST_ASSERT_EQUAL_size_t(1, privacy_mask_count());
+  privacy_mask_clear();
+  privacy_mask_begin();
+  TEST_ASSERT_EQUAL_size_t(0, privacy_mask_count());
+}
+
+void test_no_zones_keeps_every_block() {
+  TEST_ASSERT_EQUAL_INT(0, check_masked(sample_422, sizeof(sample_422)));
+  TEST_ASSERT_EQUAL_INT(0, check_masked(sample_420, sizeof(sample_420)));
+  TEST_ASSERT_EQUAL_INT(0, check_masked(sample_gray, sizeof(sample_gray)));
+}
+
+void test_mask_422_with_restart_markers() {
+  mask_zone_t a = {100, 200, 250, 300}, b = {800, 0, 200, 120};
+  TEST_ASSERT_TRUE(privacy_mask_add(&a));
+  TEST_ASSERT_TRUE(privacy_mask_add(&b));
+  TEST_ASSERT_GREATER_THAN(0, check_masked(sample_422, sizeof(sample_422)));
+}
+
+void test_mask_420_partial_mcus() {
+  // touches the right and bottom edges, where the MCUs are partial
+  mask_zone_t a = {700, 650, 300, 350};
+  TEST_ASSERT_TRUE(privacy_mask_add(&a));
+  TEST_ASSERT_GREATER_THAN(0, check_masked(sample_420, sizeof(sample_420)));
+}
+
+void test_mask_grayscale() {
+  mask_zone_t a = {300, 300, 200, 200};
+  TEST_ASSERT_TRUE(privacy_mask_add(&a));
+  TEST_ASSERT_GREATER_THAN(0, check_masked(sample_gray, sizeof(sample_gray)));
+}
+
+void test_whole_frame_mask() {
+  mask_zone_t a = {0, 0, 1000, 1000};
+  TEST_ASSERT_TRUE(privacy_mask_add(&a));
+  coef_image_t img;
+  TEST_ASSERT_TRUE(coef_decode(sample_422, sizeof(sample_422), &img));
+  // every block that shows any pixel; the padding beyond x = 120 shows none
+  int blocks = 0;
+  for (int c = 0; c < img.ncomps; c++) {
+    int bw = 8 * img.h_max / img.comps[c].h, bh = 8 * img.v_max / img.comps[c].v;
+    blocks += (img.width + bw - 1) / bw * ((img.height + bh - 1) / bh);
+  }
+  TEST_ASSERT_EQUAL_INT(blocks, check_masked(sample_422, sizeof(sample_422)));
+}
+
+void test_mask_wins_over_overlay_drawing() {
+  mask_zone_t a = {0, 0, 400, 1000};
+  TEST_ASSERT_TRUE(privacy_mask_add(&a));
+  jpeg_edit_t overlay = {};
+  overlay.type = JPEG_EDIT_DRAW;
+  overlay.w = 120;
+  overlay.h = 24;
+  overlay.draw = draw_white;
+  TEST_ASSERT_GREATER_THAN(0, check_masked(sample_422, sizeof(sample_422), &overlay));
+}
+
+void test_corrupt_or_oversized_frames_are_refused() {
+  mask_zone_t a = {0, 0, 500, 500};
+  TEST_ASSERT_TRUE(privacy_mask_add(&a));
+  jpeg_edit_t e[1];
+  privacy_mask_edits(120, 80, e, 1);
+  std::vector<uint8_t> out(sizeof(sample_422) * 2);
+  // a frame that cannot be masked must never go out as is
+  TEST_ASSERT_EQUAL_size_t(0, jpeg_rewrite(sample_422, sizeof(sample_422) / 2, out.data(), out.size(), e, 1));
+  TEST_ASSERT_EQUAL_size_t(0, jpeg_rewrite(sample_422, sizeof(sample_422), out.data(), sizeof(sample_422) / 2, e, 1));
+  uint8_t progressive[sizeof(sample_420)];
+  memcpy(progressive, sample_420, sizeof(progressive));
+  for (size_t i = 0; i + 1 < sizeof(progressive); i++) {
+    if (progressive[i] == 0xFF && progressive[i + 1] == 0xC0) {
+      progressive[i + 1] = 0xC2;
+      break;
+    }
+  }
+  TEST_ASSERT_EQUAL_size_t(0, jpeg_rewrite(progressive, sizeof(progressive), out.data(), out.size(), e, 1));
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_zones_scale_to_the_frame_and_round_outwards);
+  RUN_TEST(test_zones_are_clipped_and_the_table_is_bounded);
+  RUN_TEST(test_zones_persist_in_nvs);
+  RUN_TEST(test_no_zones_keeps_every_block);
+  RUN_TEST(test_mask_422_with_restart_markers);
+  RUN_TEST(test_mask_420_partial_mcus);
+  RUN_TEST(test_mask_grayscale);
+  RUN_TEST(test_whole_frame_mask);
+  RUN_TEST(test_mask_wins_over_overlay_drawing);
+  RUN_TEST(test_corrupt_or_oversized_frames_are_refused);
+  return UNITY_END();
+}
@@ -0,0 +1,543 @@
+#pragma once
+
+#include <stdint.h>
+
+// 160x120 baseline JPEGs (4:2:0) with the standard Huffman tables that
+// RFC 2435 receivers assume: two frames of a test pattern, a few packets each
+
+static const uint8_t frame_a[] = {
+  0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x02, 0x00, 0x00, 0x01,
+  0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x84, 0x00, 0x08, 0x10, 0x10, 0x13, 0x10, 0x13, 0x16,
+  0x16, 0x16, 0x16, 0x16, 0x16, 0x1a, 0x18, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a, 0x1a, 0x1a, 0x1a, 0x1b,
+  0x1b, 0x1b, 0x1d, 0x1d, 0x1d, 0x22, 0x22, 0x22, 0x1d, 0x1d, 0x1d, 0x1b, 0x1b, 0x1d, 0x1d, 0x20,
+  0x20, 0x22, 0x22, 0x25, 0x26, 0x25, 0x23, 0x23, 0x22, 0x23, 0x26, 0x26, 0x28, 0x28, 0x28, 0x30,
+  0x30, 0x2e, 0x2e, 0x38, 0x38, 0x3a, 0x45, 0x45, 0x53, 0x01, 0x08, 0x10, 0x10, 0x13, 0x10, 0x13,
+  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x1a, 0x18, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a, 0x1a, 0x1a, 0x1a,
+  0x1b, 0x1b, 0x1b, 0x1d, 0x1d, 0x1d, 0x22, 0x22, 0x22, 0x1d, 0x1d, 0x1d, 0x1b, 0x1b, 0x1d, 0x1d,
+  0x20, 0x20, 0x22, 0x22, 0x25, 0x26, 0x25, 0x23, 0x23, 0x22, 0x23, 0x26, 0x26, 0x28, 0x28, 0x28,
+  0x30, 0x30, 0x2e, 0x2e, 0x38, 0x38, 0x3a, 0x45, 0x45, 0x53, 0xff, 0xc4, 0x01, 0xa2, 0x00, 0x00,
+  0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x01, 0x00, 0x03, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03,
+  0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04,
+  0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05,
+  0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1,
+  0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a,
+  0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38,
+  0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+  0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+  0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+  0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5,
+  0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3,
+  0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9,
+  0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0x11, 0x00, 0x02, 0x01, 0x02,
+  0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00, 0x01, 0x02, 0x03,
+  0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13, 0x22, 0x32, 0x81,
+  0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15, 0x62, 0x72, 0xd1,
+  0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27, 0x28, 0x29, 0x2a,
+  0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54,
+  0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74,
+  0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92,
+  0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9,
+  0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+  0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2, 0xe3, 0xe4, 0xe5,
+  0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xc0,
+  0x00, 0x11, 0x08, 0x00, 0x78, 0x00, 0xa0, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+  0x01, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xf9,
+  0xfe, 0x8a, 0x28, 0xa0, 0x0e, 0x9b, 0x4e, 0xff, 0x00, 0x96, 0x9f, 0xf0, 0x1f, 0xeb, 0x5d, 0x35,
+  0x73, 0x3a, 0x77, 0xfc, 0xb4, 0xff, 0x00, 0x80, 0xff, 0x00, 0x5a, 0xef, 0xad, 0x2d, 0x1a, 0xe5,
+  0xbd, 0x10, 0x7d, 0xe6, 0xfe, 0x83, 0xdf, 0xf9, 0x57, 0x89, 0x52, 0x12, 0xa9, 0x59, 0xc6, 0x2a,
+  0xed, 0xdb, 0xf2, 0x47, 0xea, 0x18, 0x4c, 0x55, 0x1c, 0x1e, 0x5b, 0x1a, 0xd5, 0xa6, 0xa1, 0x08,
+  0x29, 0xb6, 0xdf, 0xf8, 0xe5, 0xa2, 0x5d, 0x5b, 0xe8, 0x96, 0xe3, 0x2d, 0xad, 0x24, 0xb9, 0x3c,
+  0x7c, 0xaa, 0x3a, 0xb1, 0xfe, 0x43, 0xd4, 0xe3, 0x9f, 0xeb, 0x57, 0x9d, 0xd9, 0xce, 0x49, 0xae,
+  0xfd, 0x11, 0x63, 0x50, 0xaa, 0x30, 0x07, 0x41, 0x5e, 0x75, 0x5f, 0xa1, 0xe5, 0xd8, 0x3a, 0x74,
+  0x6f, 0x26, 0x94, 0xaa, 0x24, 0xbd, 0xee, 0xd7, 0xbd, 0xf9, 0x7b, 0x7e, 0xa7, 0xca, 0x64, 0xf9,
+  0xab, 0xce, 0xb1, 0x38, 0xaa, 0xb2, 0xa7, 0x18, 0xc7, 0x0f, 0xc8, 0xb0, 0xf7, 0x49, 0xce, 0x11,
+  0xa9, 0xcf, 0xce, 0xdc, 0xbb, 0xcb, 0x96, 0x37, 0xb6, 0x8b, 0x60, 0xae, 0x67, 0x51, 0xff, 0x00,
+  0x96, 0x7f, 0xf0, 0x2f, 0xe9, 0x5d, 0x35, 0x73, 0x3a, 0x8f, 0xfc, 0xb3, 0xff, 0x00, 0x81, 0x7f,
+  0x4a, 0xfb, 0x7a, 0x1f, 0xc4, 0x8f, 0xcf, 0xf2, 0x67, 0xd3, 0x66, 0x9f, 0xee, 0x75, 0x7f, 0xed,
+  0xcf, 0xfd, 0x2e, 0x27, 0x33, 0x45, 0x14, 0x57, 0xd0, 0x1f, 0x8f, 0x9f, 0x62, 0xd1, 0x45, 0x15,
+  0xfc, 0x00, 0x7d, 0x51, 0xcc, 0xea, 0x3f, 0xf2, 0xcf, 0xfe, 0x05, 0xfd, 0x2b, 0x99, 0xae, 0x9b,
+  0x51, 0xff, 0x00, 0x96, 0x7f, 0xf0, 0x2f, 0xe9, 0x5c, 0xcd, 0x7d, 0x0d, 0x0f, 0xe1, 0xc7, 0xe7,
+  0xf9, 0xb3, 0xf1, 0xfc, 0xd3, 0xfd, 0xf2, 0xaf, 0xfd, 0xb9, 0xff, 0x00, 0xa4, 0x44, 0x8d, 0x94,
+  0x38, 0xc1, 0x19, 0xa9, 0x2d, 0x2f, 0x92, 0xe3, 0x0a, 0x7e, 0x57, 0xc7, 0x4e, 0xc7, 0xfd, 0xdf,
+  0xe7, 0x8f, 0xe7, 0x45, 0x79, 0xb8, 0x24, 0x10, 0x41, 0xc1, 0x1c, 0x82, 0x3b, 0x57, 0xd9, 0x65,
+  0xd8, 0xaa, 0x94, 0x39, 0x92, 0x6d, 0xc2, 0xea, 0xf0, 0x7b, 0x6b, 0xbb, 0x5d, 0x99, 0xf5, 0x59,
+  0x1e, 0x55, 0x4f, 0x39, 0xc3, 0xe2, 0xe9, 0x54, 0x94, 0xa3, 0x2a, 0x5e, 0xce, 0x54, 0x65, 0x76,
+  0xd5, 0x39, 0x4f, 0x9f, 0x9b, 0xdd, 0xd9, 0xa9, 0x72, 0xc7, 0x9b, 0xae, 0x8b, 0x53, 0xd9, 0x6b,
+  0xa6, 0xd3, 0xbf, 0xe5, 0xa7, 0xfc, 0x07, 0xfa, 0xd7, 0x9b, 0xd9, 0x5e, 0x89, 0xc6, 0xc7, 0xe2,
+  0x41, 0xff, 0x00, 0x8f, 0xfb, 0x8f, 0x7f, 0x51, 0xf8, 0x8a, 0xf4, 0x8d, 0x3b, 0xfe, 0x5a, 0x7f,
+  0xc0, 0x7f, 0xad, 0x7e, 0x8d, 0x2a, 0x91, 0xab, 0x45, 0xca, 0x2e, 0xe9, 0xdb, 0xe5, 0xaa, 0xd1,
+  0x9f, 0x2b, 0x87, 0xc1, 0x57, 0xc0, 0x66, 0x70, 0xa1, 0x5e, 0x3c, 0xb3, 0x8f, 0x3f, 0xa4, 0x97,
+  0x24, 0xad, 0x28, 0xbe, 0xb1, 0x7d, 0x1f, 0xea, 0x74, 0xd4, 0x51, 0x45, 0x78, 0xc7, 0xe9, 0x67,
+  0xc0, 0x14, 0x51, 0x45, 0x00, 0x76, 0x7a, 0x34, 0x0d, 0x71, 0x23, 0xa0, 0xe3, 0x3b, 0x72, 0x71,
+  0x9c, 0x01, 0xbb, 0x9f, 0xf3, 0xde, 0xbd, 0xea, 0x38, 0xd6, 0x24, 0x54, 0x5e, 0x8a, 0x31, 0xff,
+  0x00, 0xd7, 0x38, 0xee, 0x7b, 0xd7, 0x37, 0xa2, 0xe9, 0xdf, 0x62, 0xb0, 0x8a, 0x66, 0x1f, 0xbc,
+  0xba, 0xcc, 0x87, 0xda, 0x3c, 0x0f, 0x2c, 0x70, 0xc4, 0x74, 0x25, 0xf3, 0x80, 0x7e, 0x7c, 0x1e,
+  0x95, 0xd5, 0x57, 0xaf, 0x86, 0xa5, 0x18, 0xa7, 0x3f, 0xb5, 0x3f, 0xc1, 0x2d, 0x2d, 0xf8, 0x5c,
+  0xfc, 0xef, 0x3b, 0xc7, 0xd5, 0xad, 0x2a, 0x78, 0x5d, 0xa9, 0x61, 0xf5, 0x4b, 0xf9, 0xa7, 0x3f,
+  0x79, 0xcd, 0xfa, 0x29, 0x72, 0xa5, 0xd3, 0xe6, 0x15, 0xe6, 0xb5, 0xe9, 0x55, 0xe6, 0xb5, 0xf5,
+  0x38, 0x6f, 0xb5, 0xf2, 0xfd, 0x4f, 0xba, 0xe0, 0xaf, 0xf9, 0x8d, 0xff, 0x00, 0xb8, 0x1f, 0xfb,
+  0x94, 0x2b, 0x99, 0xd4, 0x7f, 0xe5, 0x9f, 0xfc, 0x0b, 0xfa, 0x57, 0x4d, 0x5c, 0xce, 0xa3, 0xff,
+  0x00, 0x2c, 0xff, 0x00, 0xe0, 0x5f, 0xd2, 0xbd, 0xfa, 0x1f, 0xc4, 0x8f, 0xcf, 0xf2, 0x67, 0xea,
+  0xb9, 0xa7, 0xfb, 0x9d, 0x5f, 0xfb, 0x73, 0xff, 0x00, 0x4b, 0x89, 0xcc, 0xd1, 0x45, 0x15, 0xf4,
+  0x07, 0xe3, 0xe7, 0xd8, 0xb4, 0x51, 0x45, 0x7f, 0x00, 0x1f, 0x54, 0x73, 0x3a, 0x8f, 0xfc, 0xb3,
+  0xff, 0x00, 0x81, 0x7f, 0x4a, 0xe6, 0x6b, 0xa6, 0xd4, 0x7f, 0xe5, 0x9f, 0xfc, 0x0b, 0xfa, 0x57,
+  0x33, 0x5f, 0x43, 0x43, 0xf8, 0x71, 0xf9, 0xfe, 0x6c, 0xfc, 0x7f, 0x34, 0xff, 0x00, 0x7c, 0xab,
+  0xff, 0x00, 0x6e, 0x7f, 0xe9, 0x11, 0x0a, 0xf3, 0x5a, 0xf4, 0xaa, 0xf3, 0x5a, 0xfa, 0x0c, 0x37,
+  0xda, 0xf9, 0x7e, 0xa7, 0xea, 0xbc, 0x15, 0xff, 0x00, 0x31, 0xbf, 0xf7, 0x03, 0xff, 0x00, 0x72,
+  0x8e, 0x04, 0x82, 0x08, 0x38, 0x23, 0x90, 0x47, 0x6a, 0xf7, 0x6d, 0x0a, 0xe4, 0x5c, 0xc7, 0x21,
+  0xc6, 0x18, 0x6d, 0x0c, 0x3f, 0x3e, 0x47, 0x7c, 0x1f, 0x7a, 0xf0, 0x7a, 0xb5, 0x67, 0xa8, 0xff,
+  0x00, 0x66, 0x5f, 0xdb, 0x4c, 0x4e, 0x23, 0x6d, 0xf1, 0xcb, 0xff, 0x00, 0x5c, 0xd8, 0xae, 0x4f,
+  0xdd, 0x63, 0xf2, 0x90, 0x1f, 0x0a, 0x32, 0x76, 0xe3, 0xbd, 0x7d, 0x2e, 0x1a, 0xa4, 0xa3, 0x27,
+  0x15, 0xb4, 0xf7, 0x5e, 0x9a, 0xa6, 0x7e, 0x83, 0x9d, 0x60, 0xe9, 0x56, 0xa5, 0x1a, 0xf2, 0x5f,
+  0xbc, 0xc3, 0xbb, 0xc2, 0x5e, 0x53, 0xf7, 0x65, 0x17, 0xe5, 0xad, 0xfd, 0x51, 0xf5, 0x4d, 0x14,
+  0x51, 0x5e, 0xd1, 0xf9, 0xa1, 0xf0, 0x05, 0x74, 0x1a, 0x55, 0x97, 0xf6, 0x8d, 0xf4, 0x16, 0xd9,
+  0xda, 0x24, 0x6f, 0x98, 0xe7, 0x07, 0x62, 0x82, 0xcf, 0x83, 0x86, 0xf9, 0xb6, 0x83, 0xb7, 0x23,
+  0x19, 0xc6, 0x6b, 0x9f, 0xaf, 0x70, 0xf0, 0x44, 0x1b, 0xae, 0x6e, 0xa7, 0xdd, 0xfe, 0xae, 0x25,
+  0x8f, 0x6e, 0x3a, 0xf9, 0xad, 0xbb, 0x39, 0xcf, 0x18, 0xf2, 0xfa, 0x63, 0x9c, 0xfb, 0x50, 0x07,
+  0xb4, 0xea, 0x3f, 0xf2, 0xcf, 0xfe, 0x05, 0xfd, 0x2b, 0x99, 0xae, 0x9b, 0x51, 0xff, 0x00, 0x96,
+  0x7f, 0xf0, 0x2f, 0xe9, 0x5c, 0xcd, 0x7d, 0x05, 0x0f, 0xe1, 0xc7, 0xe7, 0xf9, 0xb3, 0xf1, 0xfc,
+  0xd3, 0xfd, 0xf2, 0xaf, 0xfd, 0xb9, 0xff, 0x00, 0xa4, 0x44, 0x2b, 0xcd, 0x6b, 0xd2, 0xab, 0xcd,
+  0x6b, 0xe8, 0x30, 0xdf, 0x6b, 0xe5, 0xfa, 0x9f, 0xab, 0x70, 0x57, 0xfc, 0xc6, 0xff, 0x00, 0xdc,
+  0x0f, 0xfd, 0xca, 0x15, 0xcc, 0xea, 0x3f, 0xf2, 0xcf, 0xfe, 0x05, 0xfd, 0x2b, 0xa6, 0xae, 0x67,
+  0x51, 0xff, 0x00, 0x96, 0x7f, 0xf0, 0x2f, 0xe9, 0x5e, 0xfd, 0x0f, 0xe2, 0x47, 0xe7, 0xf9, 0x33,
+  0xf5, 0x5c, 0xd3, 0xfd, 0xce, 0xaf, 0xfd, 0xb9, 0xff, 0x00, 0xa5, 0xc4, 0xe6, 0x68, 0xa2, 0x8a,
+  0xfa, 0x03, 0xf1, 0xf3, 0xec, 0x5a, 0x28, 0xa2, 0xbf, 0x80, 0x0f, 0xaa, 0x39, 0x9d, 0x47, 0xfe,
+  0x59, 0xff, 0x00, 0xc0, 0xbf, 0xa5, 0x73, 0x35, 0xd3, 0x6a, 0x3f, 0xf2, 0xcf, 0xfe, 0x05, 0xfd,
+  0x2b, 0x99, 0xaf, 0xa1, 0xa1, 0xfc, 0x38, 0xfc, 0xff, 0x00, 0x36, 0x7e, 0x3f, 0x9a, 0x7f, 0xbe,
+  0x55, 0xff, 0x00, 0xb7, 0x3f, 0xf4, 0x88, 0x85, 0x79, 0xad, 0x7a, 0x55, 0x79, 0xad, 0x7d, 0x06,
+  0x1b, 0xed, 0x7c, 0xbf, 0x53, 0xf5, 0x5e, 0x0a, 0xff, 0x00, 0x98, 0xdf, 0xfb, 0x81, 0xff, 0x00,
+  0xb9, 0x42, 0xb9, 0x9d, 0x47, 0xfe, 0x59, 0xff, 0x00, 0xc0, 0xbf, 0xa5, 0x76, 0x91, 0x5a, 0xdc,
+  0x4e, 0x82, 0x48, 0xa1, 0x96, 0x44, 0x6c, 0xe1, 0xd1, 0x19, 0x94, 0xe0, 0xe0, 0xe0, 0xa8, 0x20,
+  0xe0, 0xf1, 0x5c, 0xb6, 0xad, 0x6f, 0x34, 0x1e, 0x4f, 0x9b, 0x14, 0x91, 0xee, 0xdf, 0x8d, 0xe8,
+  0xcb, 0x9c, 0x6d, 0xce, 0x32, 0x06, 0x71, 0x5f, 0x43, 0x45, 0x3f, 0x69, 0x1d, 0x1f, 0x5f, 0xc8,
+  0xfd, 0x3f, 0x33, 0xa9, 0x09, 0x61, 0x2a, 0xa5, 0x28, 0xb7, 0xee, 0x68, 0x9a, 0xfe, 0x78, 0x9f,
+  0x47, 0x78, 0x66, 0xf7, 0xed, 0xba, 0x64, 0x59, 0x18, 0x68, 0x3f, 0xd1, 0xdb, 0x8c, 0x03, 0xe5,
+  0xaa, 0xed, 0x23, 0x92, 0x7e, 0xe1, 0x5c, 0xf4, 0xf9, 0xb3, 0xc6, 0x2b, 0xd0, 0x2b, 0xe7, 0x0f,
+  0x04, 0x4f, 0xb6, 0xe6, 0xea, 0x0d, 0xbf, 0xeb, 0x22, 0x59, 0x37, 0x67, 0xa7, 0x94, 0xdb, 0x71,
+  0x8c, 0x73, 0x9f, 0x33, 0xae, 0x78, 0xc7, 0xbd, 0x7d, 0x1f, 0x5e, 0xf1, 0xf9, 0x31, 0xf0, 0x05,
+  0x7d, 0x37, 0xe0, 0x94, 0x51, 0x61, 0x3b, 0x6d, 0x1b, 0x8d, 0xc3, 0x29, 0x6c, 0x0c, 0x90, 0xb1,
+  0xc6, 0x40, 0x27, 0xae, 0x01, 0x63, 0x81, 0xdb, 0x26, 0xbe, 0x64, 0xaf, 0xa7, 0xfc, 0x15, 0xff,
+  0x00, 0x20, 0xe9, 0xbf, 0xeb, 0xe9, 0xff, 0x00, 0xf4, 0x54, 0x54, 0x01, 0xdd, 0x6a, 0x3f, 0xf2,
+  0xcf, 0xfe, 0x05, 0xfd, 0x2b, 0x99, 0xae, 0x9b, 0x51, 0xff, 0x00, 0x96, 0x7f, 0xf0, 0x2f, 0xe9,
+  0x5c, 0xcd, 0x7d, 0x05, 0x0f, 0xe1, 0xc7, 0xe7, 0xf9, 0xb3, 0xf1, 0xfc, 0xd3, 0xfd, 0xf2, 0xaf,
+  0xfd, 0xb9, 0xff, 0x00, 0xa4, 0x44, 0x2b, 0xcd, 0x6b, 0xd2, 0xab, 0xcd, 0x6b, 0xe8, 0x30, 0xdf,
+  0x6b, 0xe5, 0xfa, 0x9f, 0xab, 0x70, 0x57, 0xfc, 0xc6, 0xff, 0x00, 0xdc, 0x0f, 0xfd, 0xca, 0x15,
+  0xcc, 0xea, 0x3f, 0xf2, 0xcf, 0xfe, 0x05, 0xfd, 0x2b, 0xa6, 0xae, 0x67, 0x51, 0xff, 0x00, 0x96,
+  0x7f, 0xf0, 0x2f, 0xe9, 0x5e, 0xfd, 0x0f, 0xe2, 0x47, 0xe7, 0xf9, 0x33, 0xf5, 0x5c, 0xd3, 0xfd,
+  0xce, 0xaf, 0xfd, 0xb9, 0xff, 0x00, 0xa5, 0xc4, 0xe6, 0x68, 0xa2, 0x8a, 0xfa, 0x03, 0xf1, 0xf3,
+  0xec, 0x5a, 0x28, 0xa2, 0xbf, 0x80, 0x0f, 0xaa, 0x39, 0x9d, 0x47, 0xfe, 0x59, 0xff, 0x00, 0xc0,
+  0xbf, 0xa5, 0x73, 0x35, 0xd3, 0x6a, 0x3f, 0xf2, 0xcf, 0xfe, 0x05, 0xfd, 0x2b, 0x99, 0xaf, 0xa1,
+  0xa1, 0xfc, 0x38, 0xfc, 0xff, 0x00, 0x36, 0x7e, 0x3f, 0x9a, 0x7f, 0xbe, 0x55, 0xff, 0x00, 0xb7,
+  0x3f, 0xf4, 0x88, 0x85, 0x79, 0xad, 0x7a, 0x55, 0x79, 0xad, 0x7d, 0x06, 0x1b, 0xed, 0x7c, 0xbf,
+  0x53, 0xf5, 0x5e, 0x0a, 0xff, 0x00, 0x98, 0xdf, 0xfb, 0x81, 0xff, 0x00, 0xb9, 0x49, 0x35, 0xfb,
+  0xbb, 0x9b, 0x1d, 0x4a, 0xe2, 0x0b, 0x59, 0xe6, 0xb6, 0x85, 0x3c, 0xbd, 0x91, 0x43, 0x23, 0xc5,
+  0x1a, 0xee, 0x89, 0x18, 0xed, 0x44, 0x21, 0x46, 0x58, 0x92, 0x70, 0x39, 0x24, 0x9a, 0xaf, 0x04,
+  0xb2, 0x5e, 0xe9, 0x3a, 0xa4, 0x97, 0x2e, 0xf7, 0x0f, 0x0f, 0xd9, 0x3c, 0xa7, 0x99, 0x8c, 0x8d,
+  0x16, 0xf9, 0x88, 0x7f, 0x2c, 0xb9, 0x25, 0x37, 0x00, 0x03, 0x6d, 0xc6, 0x71, 0xcd, 0x63, 0xeb,
+  0xff, 0x00, 0x69, 0xfe, 0xd2, 0xb8, 0xfb, 0x57, 0x93, 0xe7, 0x7e, 0xef, 0x7f, 0x93, 0xbf, 0xcb,
+  0xff, 0x00, 0x54, 0x98, 0xdb, 0xbf, 0xe6, 0xfb, 0xb8, 0xce, 0x7b, 0xe6, 0x8b, 0x2f, 0xb4, 0xff,
+  0x00, 0x66, 0xea, 0x7e, 0x5f, 0x93, 0xe4, 0xff, 0x00, 0xa2, 0xf9, 0xfb, 0xb7, 0xf9, 0x9f, 0xeb,
+  0x4e, 0xcf, 0x2b, 0x1f, 0x2f, 0xde, 0xfb, 0xfb, 0xbb, 0x74, 0xaf, 0xbf, 0x39, 0x0d, 0x4f, 0x0a,
+  0xbb, 0x2e, 0xb1, 0x6e, 0x03, 0x10, 0x18, 0x4a, 0xac, 0x01, 0x20, 0x30, 0xf2, 0x9d, 0xb0, 0x7d,
+  0x46, 0x40, 0x38, 0x3d, 0xc0, 0x35, 0xf5, 0xdd, 0x7c, 0x81, 0xe1, 0x6f, 0xf9, 0x0c, 0xda, 0xff,
+  0x00, 0xdb, 0x6f, 0xfd, 0x11, 0x25, 0x7d, 0x7f, 0x40, 0xcf, 0x80, 0x2b, 0xe9, 0xff, 0x00, 0x05,
+  0x7f, 0xc8, 0x3a, 0x6f, 0xfa, 0xfa, 0x7f, 0xfd, 0x15, 0x15, 0x7c, 0xc1, 0x5e, 0xe9, 0xe0, 0x79,
+  0xd5, 0x66, 0xbb, 0x87, 0x07, 0x73, 0xc7, 0x1c, 0x80, 0xf1, 0x8c, 0x46, 0xc5, 0x4e, 0x79, 0xce,
+  0x73, 0x20, 0xc7, 0x1e, 0xb4, 0x01, 0xec, 0xba, 0x8f, 0xfc, 0xb3, 0xff, 0x00, 0x81, 0x7f, 0x4a,
+  0xe6, 0x6b, 0xa6, 0xd4, 0x7f, 0xe5, 0x9f, 0xfc, 0x0b, 0xfa, 0x57, 0x33, 0x5f, 0x41, 0x43, 0xf8,
+  0x71, 0xf9, 0xfe, 0x6c, 0xfc, 0x7f, 0x34, 0xff, 0x00, 0x7c, 0xab, 0xff, 0x00, 0x6e, 0x7f, 0xe9,
+  0x11, 0x0a, 0xf3, 0x5a, 0xf4, 0xaa, 0xf3, 0x5a, 0xfa, 0x0c, 0x37, 0xda, 0xf9, 0x7e, 0xa7, 0xea,
+  0xdc, 0x15, 0xff, 0x00, 0x31, 0xbf, 0xf7, 0x03, 0xff, 0x00, 0x72, 0x85, 0x73, 0x3a, 0x8f, 0xfc,
+  0xb3, 0xff, 0x00, 0x81, 0x7f, 0x4a, 0xe9, 0xab, 0x99, 0xd4, 0x7f, 0xe5, 0x9f, 0xfc, 0x0b, 0xfa,
+  0x57, 0xbf, 0x43, 0xf8, 0x91, 0xf9, 0xfe, 0x4c, 0xfd, 0x57, 0x34, 0xff, 0x00, 0x73, 0xab, 0xff,
+  0x00, 0x6e, 0x7f, 0xe9, 0x71, 0x39, 0x9a, 0x28, 0xa2, 0xbe, 0x80, 0xfc, 0x7c, 0xfb, 0x16, 0x8a,
+  0x28, 0xaf, 0xe0, 0x03, 0xea, 0x8e, 0x67, 0x51, 0xff, 0x00, 0x96, 0x7f, 0xf0, 0x2f, 0xe9, 0x5c,
+  0xcd, 0x74, 0xda, 0x8f, 0xfc, 0xb3, 0xff, 0x00, 0x81, 0x7f, 0x4a, 0xe6, 0x6b, 0xe8, 0x68, 0x7f,
+  0x0e, 0x3f, 0x3f, 0xcd, 0x9f, 0x8f, 0xe6, 0x9f, 0xef, 0x95, 0x7f, 0xed, 0xcf, 0xfd, 0x22, 0x21,
+  0x5e, 0x6b, 0x5e, 0x95, 0x5e, 0x6b, 0x5f, 0x41, 0x86, 0xfb, 0x5f, 0x2f, 0xd4, 0xfd, 0x57, 0x82,
+  0xbf, 0xe6, 0x37, 0xfe, 0xe0, 0x7f, 0xee, 0x52, 0x4d, 0x7e, 0xd2, 0xe6, 0xfb, 0x52, 0xb8, 0x9e,
+  0xd6, 0x09, 0xae, 0x61, 0x7f, 0x2f, 0x64, 0xb0, 0xc6, 0xf2, 0xc6, 0xdb, 0x62, 0x45, 0x3b, 0x5d,
+  0x01, 0x53, 0x86, 0x04, 0x1c, 0x1e, 0x08, 0x22, 0xab, 0xc1, 0x14, 0x96, 0x5a, 0x4e, 0xa9, 0x1d,
+  0xca, 0x3d, 0xbb, 0xcd, 0xf6, 0x4f, 0x29, 0x26, 0x53, 0x1b, 0x4b, 0xb2, 0x62, 0x5f, 0xcb, 0x0e,
+  0x01, 0x7d, 0xa0, 0x82, 0xdb, 0x73, 0x8c, 0xf3, 0x5a, 0x51, 0x5d, 0x5c, 0x40, 0x82, 0x38, 0xa6,
+  0x96, 0x34, 0x5c, 0xe1, 0x11, 0xd9, 0x54, 0x64, 0xe4, 0xe0, 0x29, 0x00, 0x64, 0xf3, 0x5c, 0xb6,
+  0xad, 0x71, 0x34, 0xfe, 0x4f, 0x9b, 0x2c, 0x92, 0x6d, 0xdf, 0x8d, 0xee, 0xcd, 0x8c, 0xed, 0xce,
+  0x32, 0x4e, 0x33, 0x5f, 0x63, 0x0a, 0xea, 0x72, 0x4a, 0xcf, 0x53, 0xdf, 0xc4, 0xe5, 0x53, 0xc3,
+  0x52, 0x95, 0x57, 0x52, 0x32, 0x51, 0xb6, 0x89, 0x3e, 0xad, 0x2f, 0xd4, 0xbf, 0xe1, 0x6f, 0xf9,
+  0x0c, 0xda, 0xff, 0x00, 0xdb, 0x6f, 0xfd, 0x11, 0x25, 0x7d, 0x7f, 0x5f, 0x36, 0x78, 0x22, 0x06,
+  0x6b, 0xbb, 0x99, 0xb2, 0x36, 0xa4, 0x22, 0x32, 0x39, 0xce, 0x64, 0x70, 0xc3, 0x1c, 0x63, 0x18,
+  0x8c, 0xe7, 0x9f, 0x4a, 0xfa, 0x4e, 0xbb, 0x8f, 0x96, 0x3e, 0x00, 0xae, 0xb3, 0x44, 0xbf, 0x1a,
+  0x6e, 0xa1, 0x0c, 0xcc, 0x48, 0x8f, 0x25, 0x25, 0xc1, 0x20, 0x6c, 0x71, 0x82, 0x48, 0x50, 0x4b,
+  0x05, 0x38, 0x7d, 0xb8, 0x39, 0x2a, 0x3b, 0xd6, 0xdc, 0x76, 0x16, 0xcd, 0xd6, 0x3f, 0xfc, 0x79,
+  0xff, 0x00, 0xf8, 0xaa, 0xe8, 0x23, 0xd2, 0x6c, 0x9b, 0xac, 0x5f, 0xf8, 0xfc, 0x9f, 0xfc, 0x55,
+  0x78, 0xd2, 0xc7, 0x53, 0x86, 0xea, 0x7f, 0x72, 0xff, 0x00, 0x33, 0xe9, 0x67, 0x95, 0x57, 0x86,
+  0xf2, 0xa7, 0xf7, 0xbf, 0xfe, 0x44, 0xf7, 0x2d, 0x47, 0xfe, 0x59, 0xff, 0x00, 0xc0, 0xbf, 0xa5,
+  0x73, 0x35, 0x32, 0x3b, 0xc8, 0xa8, 0xae, 0xc5, 0x82, 0x0c, 0x0d, 0xc7, 0x27, 0xb7, 0x56, 0x3f,
+  0x33, 0x1e, 0x39, 0x2c, 0x49, 0x35, 0xac, 0xb0, 0xc6, 0x47, 0x4f, 0xd4, 0xff, 0x00, 0x8d, 0x5c,
+  0x73, 0xec, 0x2d, 0x28, 0xa8, 0xb8, 0x56, 0xd3, 0xb2, 0x8f, 0x7f, 0xf1, 0x1f, 0x96, 0xe6, 0x19,
+  0x1e, 0x26, 0xae, 0x22, 0x75, 0x14, 0xe9, 0x5a, 0x5c, 0xbb, 0xb9, 0x5f, 0x48, 0xa5, 0xfc, 0xbe,
+  0x46, 0x1d, 0x79, 0xad, 0x7a, 0xfb, 0x46, 0x83, 0xb7, 0xea, 0x6b, 0x9c, 0x6b, 0x2b, 0x71, 0xfc,
+  0x1f, 0xf8, 0xf3, 0x7f, 0x8d, 0x7a, 0x94, 0x38, 0x93, 0x07, 0x1b, 0xde, 0x9d, 0x7d, 0x6d, 0xf6,
+  0x61, 0xff, 0x00, 0xc9, 0x9e, 0xde, 0x45, 0x51, 0x64, 0xbf, 0x59, 0xf6, 0xf7, 0x9f, 0xb5, 0xf6,
+  0x7c, 0xbe, 0xcf, 0x5f, 0x83, 0x9e, 0xf7, 0xe6, 0xe5, 0xfe, 0x65, 0x63, 0x83, 0xae, 0x67, 0x51,
+  0xff, 0x00, 0x96, 0x7f, 0xf0, 0x2f, 0xe9, 0x5e, 0xa4, 0xd6, 0xd0, 0x8f, 0xe1, 0xfd, 0x5b, 0xfc,
+  0x6b, 0x35, 0xec, 0x6d, 0xe6, 0xc6, 0xf4, 0xce, 0x3a, 0x7c, 0xcc, 0x3a, 0xfd, 0x08, 0xaf, 0x7e,
+  0x8f, 0x12, 0xe0, 0xf9, 0xd3, 0xf6, 0x75, 0xff, 0x00, 0xf0, 0x18, 0x76, 0xff, 0x00, 0x19, 0xee,
+  0xe3, 0xf8, 0x93, 0x09, 0x5a, 0x84, 0xe9, 0x28, 0x57, 0xe6, 0x97, 0x2d, 0xaf, 0x18, 0x5b, 0x49,
+  0x27, 0xfc, 0xfe, 0x47, 0x8c, 0xd1, 0x5e, 0xc6, 0x34, 0xab, 0x2f, 0xf9, 0xe5, 0xff, 0x00, 0x8f,
+  0xc9, 0xff, 0x00, 0xc5, 0x54, 0xc3, 0x49, 0xb1, 0xff, 0x00, 0x9e, 0x3f, 0xf8, 0xfc, 0x9f, 0xfc,
+  0x5d, 0x7d, 0x65, 0x3c, 0xfb, 0x0d, 0x53, 0x68, 0x56, 0xf9, 0xa8, 0xff, 0x00, 0xf2, 0x67, 0xe7,
+  0x6f, 0x34, 0xa2, 0xbe, 0xcd, 0x4f, 0xb9, 0x7f, 0xf2, 0x47, 0xae, 0x51, 0x5c, 0xc7, 0xda, 0x25,
+  0xc7, 0xde, 0xfd, 0x07, 0xf8, 0x56, 0x44, 0x97, 0xb7, 0x0b, 0xd1, 0xff, 0x00, 0xf1, 0xd5, 0xff,
+  0x00, 0x0a, 0xfe, 0x79, 0x87, 0x0d, 0x63, 0x27, 0xb5, 0x4a, 0x1f, 0xf8, 0x14, 0xff, 0x00, 0xf9,
+  0x03, 0xdc, 0x8e, 0x79, 0x86, 0x96, 0xd0, 0xab, 0xf7, 0x47, 0xff, 0x00, 0x92, 0x36, 0x35, 0x1f,
+  0xf9, 0x67, 0xff, 0x00, 0x02, 0xfe, 0x95, 0xcc, 0xd6, 0x1d, 0xcd, 0xf5, 0xc3, 0xe3, 0x73, 0xe7,
+  0x19, 0xc7, 0xca, 0xbd, 0xfe, 0x8b, 0x5c, 0xb4, 0x97, 0xf7, 0x2b, 0xd2, 0x4f, 0xfc, 0x75, 0x3f,
+  0xf8, 0x9a, 0xfa, 0x7a, 0x1c, 0x2f, 0x8d, 0xe4, 0x4b, 0xda, 0x61, 0xff, 0x00, 0xf0, 0x29, 0xf7,
+  0xff, 0x00, 0x01, 0xf3, 0x18, 0x9a, 0x6f, 0x19, 0x88, 0x9d, 0x48, 0x59, 0x29, 0x72, 0xdb, 0x9b,
+  0x7d, 0x22, 0x97, 0x4b, 0xf6, 0x3d, 0x16, 0xbc, 0xd6, 0xaa, 0x2e, 0xa5, 0x76, 0x7f, 0xe5, 0xaf,
+  0xfe, 0x3a, 0x9f, 0xfc, 0x4d, 0x31, 0x5d, 0x8f, 0x7a, 0xf6, 0xa9, 0xf0, 0xce, 0x32, 0x95, 0xef,
+  0x52, 0x86, 0xb6, 0xda, 0x53, 0xff, 0x00, 0xe4, 0x0f, 0xd3, 0x78, 0x6b, 0xfe, 0x13, 0x7e, 0xb1,
+  0xed, 0x7d, 0xef, 0x6b, 0xec, 0xb9, 0x79, 0x35, 0xb7, 0x27, 0x3d, 0xef, 0x7b, 0x7f, 0x32, 0x2f,
+  0x57, 0x33, 0xa8, 0xff, 0x00, 0xcb, 0x3f, 0xf8, 0x17, 0xf4, 0xae, 0xa1, 0x79, 0xa9, 0x9a, 0xd6,
+  0x19, 0xb1, 0xbd, 0x73, 0x8e, 0x9c, 0xb0, 0xeb, 0xf4, 0x22, 0xba, 0xe1, 0x92, 0xe2, 0x29, 0xc9,
+  0x37, 0x2a, 0x5a, 0x5f, 0x67, 0x2e, 0xdf, 0xe1, 0x3f, 0x51, 0xc4, 0xcd, 0x63, 0x30, 0xf3, 0xa7,
+  0x0d, 0x1c, 0xb9, 0x6d, 0xcd, 0xb6, 0x92, 0x4f, 0xa5, 0xfb, 0x1e, 0xbf, 0xe1, 0x4b, 0x03, 0x67,
+  0xa7, 0x2b, 0xb0, 0x1b, 0xee, 0x4f, 0x9d, 0xd0, 0x64, 0x21, 0x03, 0xcb, 0x52, 0xc0, 0x9d, 0xc3,
+  0x1f, 0x38, 0xe9, 0x8d, 0xe4, 0x63, 0x35, 0xe9, 0x95, 0xe0, 0xcb, 0xab, 0x5e, 0xc6, 0xaa, 0x89,
+  0x28, 0x55, 0x50, 0x15, 0x55, 0x63, 0x88, 0x05, 0x03, 0x80, 0x00, 0x09, 0x80, 0x00, 0xe8, 0x29,
+  0xa7, 0x5a, 0xd4, 0x3f, 0xe7, 0xbf, 0xfe, 0x43, 0x8b, 0xff, 0x00, 0x88, 0xa5, 0x53, 0x0f, 0x2a,
+  0x7b, 0xb5, 0xf2, 0xff, 0x00, 0x86, 0x3e, 0x41, 0x64, 0xf8, 0x87, 0xf6, 0xa9, 0x7d, 0xf2, 0xff,
+  0x00, 0xe4, 0x4e, 0x6a, 0x1a, 0xea, 0xa1, 0xaf, 0x0e, 0x17, 0xf7, 0x2b, 0xd2, 0x4f, 0xfc, 0x75,
+  0x3f, 0xf8, 0x9a, 0xb4, 0x35, 0x6b, 0xd5, 0xe9, 0x2f, 0xfe, 0x39, 0x1f, 0xff, 0x00, 0x13, 0x5f,
+  0x11, 0x53, 0x03, 0x52, 0x7b, 0x38, 0x7d, 0xef, 0xfc, 0x8f, 0x4e, 0xae, 0x6b, 0x42, 0x7b, 0x46,
+  0xa7, 0xdc, 0xbf, 0xf9, 0x23, 0xe9, 0x28, 0x6b, 0xa5, 0x4f, 0xbb, 0x5f, 0x37, 0xd8, 0xea, 0xf7,
+  0xcf, 0xbf, 0x74, 0xd9, 0xc6, 0xdc, 0x7c, 0x91, 0xf7, 0xcf, 0xa2, 0x57, 0x6d, 0x6d, 0xac, 0xce,
+  0xad, 0x89, 0x9f, 0x72, 0x1e, 0xfb, 0x57, 0x2b, 0xef, 0xc2, 0xf2, 0x3d, 0x7b, 0xfa, 0x57, 0xcc,
+  0xd4, 0xcb, 0x6a, 0xb9, 0xf2, 0xf3, 0xd3, 0x5e, 0x6d, 0xca, 0xdf, 0xfa, 0x49, 0xc7, 0x52, 0x85,
+  0x5a, 0xd8, 0x67, 0x88, 0xa7, 0x17, 0x51, 0x59, 0xb5, 0x4e, 0x3f, 0xc4, 0x76, 0x6d, 0x34, 0x93,
+  0xd1, 0xbd, 0x34, 0x57, 0xd4, 0xf4, 0xf7, 0xac, 0xa7, 0xa4, 0xf3, 0x59, 0x80, 0x3b, 0xb2, 0x0f,
+  0x20, 0x8c, 0x73, 0x5c, 0x21, 0xbd, 0xb8, 0x3f, 0xc7, 0xff, 0x00, 0x8e, 0xaf, 0xf8, 0x57, 0xd0,
+  0xd1, 0xe1, 0xbc, 0x5c, 0xf6, 0xa9, 0x43, 0x4f, 0xef, 0x4f, 0xff, 0x00, 0x90, 0x3f, 0x37, 0xc1,
+  0x52, 0x96, 0x73, 0xed, 0x95, 0x0f, 0x73, 0xd9, 0x72, 0xf3, 0x7b, 0x5d, 0x3e, 0x2e, 0x6b, 0x5b,
+  0x97, 0x9b, 0xf9, 0x5d, 0xce, 0x99, 0xea, 0xa8, 0xae, 0x78, 0xdc, 0xcc, 0x7f, 0x8b, 0xf4, 0x5f,
+  0xf0, 0xae, 0x7e, 0xf6, 0xfa, 0xe2, 0x1d, 0x9b, 0x1f, 0x19, 0xdd, 0x9f, 0x95, 0x4f, 0x4c, 0x7a,
+  0x83, 0x5e, 0xfd, 0x1e, 0x1a, 0xc6, 0x73, 0x25, 0xed, 0x28, 0x7f, 0xe0, 0x53, 0xff, 0x00, 0xe4,
+  0x0e, 0x5c, 0x67, 0x0d, 0xe2, 0xe8, 0xc2, 0x55, 0x65, 0x3a, 0x1c, 0xb1, 0xb5, 0xed, 0x29, 0xdf,
+  0x56, 0x97, 0xf2, 0x79, 0x9e, 0x92, 0x2a, 0xc8, 0xaf, 0x13, 0xfe, 0xd5, 0xbd, 0xff, 0x00, 0x9e,
+  0xbf, 0xf8, 0xe4, 0x7f, 0xfc, 0x4d, 0x3b, 0xfb, 0x5a, 0xfb, 0xfe, 0x7b, 0x7f, 0xe3, 0x91, 0xff,
+  0x00, 0xf1, 0x15, 0xf6, 0x94, 0x72, 0x1c, 0x55, 0x3d, 0xe7, 0x47, 0xe4, 0xe5, 0xff, 0x00, 0xc8,
+  0x9f, 0x1a, 0xf2, 0xba, 0xcf, 0xed, 0x53, 0xfb, 0xdf, 0xff, 0x00, 0x22, 0x7b, 0x79, 0xe9, 0x5c,
+  0xfc, 0xd5, 0xe8, 0xdf, 0x67, 0x8b, 0xfb, 0xbf, 0xa9, 0xff, 0x00, 0x1a, 0xae, 0x6c, 0xad, 0xdb,
+  0xaa, 0x7f, 0xe3, 0xcd, 0xfe, 0x35, 0xf1, 0x54, 0xb8, 0x97, 0x07, 0x0d, 0xe9, 0xd7, 0xff, 0x00,
+  0xc0, 0x61, 0xff, 0x00, 0xc9, 0x9e, 0x9d, 0x3c, 0x8f, 0x13, 0x17, 0xac, 0xe9, 0x7d, 0xf2, 0xff,
+  0x00, 0xe4, 0x4f, 0x16, 0x9a, 0xb9, 0x59, 0xab, 0xdb, 0x2f, 0xac, 0x6d, 0xd3, 0x66, 0xd4, 0xc6,
+  0x77, 0x67, 0xe6, 0x6e, 0xd8, 0xf5, 0x6a, 0xe6, 0x0d, 0x85, 0xb3, 0x75, 0x8f, 0xff, 0x00, 0x1e,
+  0x7f, 0xfe, 0x2a, 0xbe, 0xaa, 0x87, 0x14, 0x60, 0xac, 0x9f, 0xb3, 0xc4, 0x7f, 0xe0, 0x30, 0xff,
+  0x00, 0xe4, 0xc2, 0x55, 0x16, 0x0e, 0xab, 0xa7, 0x3b, 0xb7, 0x1b, 0x5f, 0x97, 0x6d, 0x52, 0x7d,
+  0x6d, 0xdc, 0xf2, 0x55, 0xad, 0x44, 0xaf, 0x41, 0xfe, 0xcd, 0xb4, 0x1f, 0xf2, 0xcb, 0xff, 0x00,
+  0x1e, 0x7f, 0xfe, 0x2a, 0xb8, 0xc0, 0x8a, 0x3b, 0x57, 0xae, 0xb8, 0x9b, 0x07, 0x56, 0xf6, 0xa7,
+  0x5f, 0x4e, 0xf1, 0x87, 0xff, 0x00, 0x26, 0x7e, 0x91, 0x92, 0xff, 0x00, 0xc2, 0x97, 0xb4, 0xf6,
+  0x5e, 0xef, 0xb2, 0xe4, 0xe6, 0xe7, 0xd2, 0xfc, 0xfc, 0xd6, 0xb5, 0xaf, 0xfc, 0xac, 0xb0, 0x95,
+  0xaa, 0xb5, 0xbd, 0x67, 0xa7, 0x0d, 0xbb, 0xa6, 0x1c, 0x9e, 0x89, 0x92, 0x31, 0xee, 0x71, 0xce,
+  0x7d, 0xbb, 0x77, 0xae, 0xea, 0xcb, 0x4c, 0xb4, 0x97, 0x7e, 0xe8, 0xb3, 0x8d, 0xb8, 0xf9, 0xdc,
+  0x75, 0xcf, 0xa3, 0x57, 0xa1, 0x2c, 0x7d, 0x39, 0x53, 0xe7, 0xe4, 0xa9, 0x1f, 0x26, 0x95, 0xff,
+  0x00, 0x33, 0xd5, 0xa7, 0x9e, 0xe0, 0xe9, 0x62, 0xbe, 0xaa, 0x9c, 0xea, 0xc9, 0x36, 0xb9, 0xe9,
+  0xa4, 0xe9, 0xdd, 0x26, 0xdd, 0x9b, 0x92, 0x6e, 0xd6, 0xb5, 0xd2, 0xb1, 0xe4, 0xc6, 0xab, 0x9a,
+  0xf7, 0xdf, 0xec, 0x6b, 0x0f, 0xf9, 0xe3, 0xff, 0x00, 0x8f, 0xc9, 0xff, 0x00, 0xc5, 0xd3, 0x7f,
+  0xb1, 0x74, 0xff, 0x00, 0xf9, 0xe1, 0xff, 0x00, 0x91, 0x25, 0xff, 0x00, 0xe2, 0xeb, 0xe5, 0xab,
+  0x62, 0x23, 0x53, 0x64, 0xfe, 0x7f, 0xf0, 0xe7, 0xd4, 0xac, 0xe3, 0x0e, 0xbe, 0xcd, 0x5f, 0xba,
+  0x3f, 0xfc, 0x91, 0xf1, 0x4d, 0x14, 0x51, 0x5e, 0x39, 0xf9, 0xc1, 0xd3, 0x69, 0xdf, 0xf2, 0xd3,
+  0xfe, 0x03, 0xfd, 0x6b, 0xa6, 0xae, 0x67, 0x4e, 0xff, 0x00, 0x96, 0x9f, 0xf0, 0x1f, 0xeb, 0x5d,
+  0x35, 0x7c, 0xfd, 0x7f, 0xe2, 0x4b, 0xe5, 0xf9, 0x23, 0xf5, 0xfc, 0xaf, 0xfd, 0xce, 0x97, 0xfd,
+  0xbf, 0xff, 0x00, 0xa5, 0xc8, 0xdf, 0xb4, 0xbe, 0x6b, 0x6f, 0x95, 0x86, 0xe4, 0xf4, 0xee, 0xbe,
+  0xb8, 0xff, 0x00, 0x0f, 0x5a, 0x56, 0x52, 0xa7, 0x04, 0x62, 0xb9, 0xfa, 0xeb, 0xae, 0x7e, 0xf8,
+  0xff, 0x00, 0x77, 0xfa, 0x9a, 0xfa, 0xec, 0x9f, 0x11, 0x51, 0xd4, 0x74, 0x5b, 0xbc, 0x79, 0x6e,
+  0xaf, 0xba, 0xb7, 0x44, 0xfb, 0x6a, 0x71, 0x4a, 0x8d, 0x2c, 0x2e, 0x37, 0x9a, 0x95, 0x38, 0xc6,
+  0x58, 0xb8, 0xca, 0x55, 0x9a, 0xbf, 0xbc, 0xe9, 0x5b, 0x95, 0xda, 0xf6, 0x4f, 0xdf, 0x7c, 0xce,
+  0xda, 0x99, 0xd5, 0xcc, 0xea, 0x3f, 0xf2, 0xcf, 0xfe, 0x05, 0xfd, 0x2b, 0xa6, 0xae, 0x67, 0x51,
+  0xff, 0x00, 0x96, 0x7f, 0xf0, 0x2f, 0xe9, 0x5f, 0xa8, 0xd0, 0xfe, 0x24, 0x7e, 0x7f, 0x93, 0x30,
+  0xcd, 0x3f, 0xdc, 0xea, 0xff, 0x00, 0xdb, 0x9f, 0xfa, 0x5c, 0x4e, 0x66, 0x8a, 0x28, 0xaf, 0xa0,
+  0x3f, 0x1f, 0x3e, 0xc5, 0xa2, 0x8a, 0x2b, 0xf8, 0x00, 0xfa, 0xa3, 0x99, 0xd4, 0x7f, 0xe5, 0x9f,
+  0xfc, 0x0b, 0xfa, 0x57, 0x33, 0x5d, 0x36, 0xa3, 0xff, 0x00, 0x2c, 0xff, 0x00, 0xe0, 0x5f, 0xd2,
+  0xb9, 0x9a, 0xfa, 0x1a, 0x1f, 0xc3, 0x8f, 0xcf, 0xf3, 0x67, 0xe3, 0xf9, 0xa7, 0xfb, 0xe5, 0x5f,
+  0xfb, 0x73, 0xff, 0x00, 0x48, 0x88, 0x84, 0x81, 0xc9, 0xe2, 0xaa, 0xd9, 0xe9, 0xe2, 0x22, 0x24,
+  0x93, 0x96, 0xea, 0x17, 0xb2, 0x9f, 0xea, 0x7f, 0x40, 0x68, 0x9f, 0xfd, 0x5b, 0x7e, 0x1f, 0xcc,
+  0x57, 0x51, 0x5f, 0xa4, 0xe4, 0xd4, 0x21, 0x35, 0x3a, 0x92, 0x57, 0x6a, 0x49, 0x25, 0xd3, 0x6b,
+  0xde, 0xdd, 0xce, 0x68, 0xe3, 0x2b, 0xe1, 0x30, 0xb5, 0x21, 0x46, 0x6e, 0x0b, 0x13, 0x27, 0x1a,
+  0xb6, 0xdd, 0xc6, 0x9c, 0x55, 0x92, 0x7b, 0xa4, 0xfd, 0xa3, 0xe6, 0xef, 0xa7, 0x98, 0x57, 0x4d,
+  0xa7, 0x7f, 0xcb, 0x4f, 0xf8, 0x0f, 0xf5, 0xae, 0x66, 0xba, 0x6d, 0x3b, 0xfe, 0x5a, 0x7f, 0xc0,
+  0x7f, 0xad, 0x7d, 0xb5, 0x7f, 0xe1, 0xcb, 0xe5, 0xf9, 0xa3, 0x8f, 0x2b, 0xff, 0x00, 0x7c, 0xa5,
+  0xff, 0x00, 0x6f, 0xff, 0x00, 0xe9, 0x12, 0x3a, 0x6a, 0x28, 0xa2, 0xbe, 0x7c, 0xfd, 0x80, 0xff,
+  0xd9,
+};
+
+static const uint8_t frame_b[] = {
+  0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x02, 0x00, 0x00, 0x01,
+  0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x84, 0x00, 0x08, 0x10, 0x10, 0x13, 0x10, 0x13, 0x16,
+  0x16, 0x16, 0x16, 0x16, 0x16, 0x1a, 0x18, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a, 0x1a, 0x1a, 0x1a, 0x1b,
+  0x1b, 0x1b, 0x1d, 0x1d, 0x1d, 0x22, 0x22, 0x22, 0x1d, 0x1d, 0x1d, 0x1b, 0x1b, 0x1d, 0x1d, 0x20,
+  0x20, 0x22, 0x22, 0x25, 0x26, 0x25, 0x23, 0x23, 0x22, 0x23, 0x26, 0x26, 0x28, 0x28, 0x28, 0x30,
+  0x30, 0x2e, 0x2e, 0x38, 0x38, 0x3a, 0x45, 0x45, 0x53, 0x01, 0x08, 0x10, 0x10, 0x13, 0x10, 0x13,
+  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x1a, 0x18, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a, 0x1a, 0x1a, 0x1a,
+  0x1b, 0x1b, 0x1b, 0x1d, 0x1d, 0x1d, 0x22, 0x22, 0x22, 0x1d, 0x1d, 0x1d, 0x1b, 0x1b, 0x1d, 0x1d,
+  0x20, 0x20, 0x22, 0x22, 0x25, 0x26, 0x25, 0x23, 0x23, 0x22, 0x23, 0x26, 0x26, 0x28, 0x28, 0x28,
+  0x30, 0x30, 0x2e, 0x2e, 0x38, 0x38, 0x3a, 0x45, 0x45, 0x53, 0xff, 0xc4, 0x01, 0xa2, 0x00, 0x00,
+  0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x01, 0x00, 0x03, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03,
+  0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04,
+  0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05,
+  0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1,
+  0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a,
+  0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38,
+  0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+  0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+  0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+  0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5,
+  0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3,
+  0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9,
+  0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0x11, 0x00, 0x02, 0x01, 0x02,
+  0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00, 0x01, 0x02, 0x03,
+  0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13, 0x22, 0x32, 0x81,
+  0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15, 0x62, 0x72, 0xd1,
+  0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27, 0x28, 0x29, 0x2a,
+  0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54,
+  0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74,
+  0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92,
+  0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9,
+  0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+  0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2, 0xe3, 0xe4, 0xe5,
+  0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xc0,
+  0x00, 0x11, 0x08, 0x00, 0x78, 0x00, 0xa0, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+  0x01, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xf9,
+  0xfe, 0x8a, 0x28, 0xa0, 0x0e, 0x9b, 0x4e, 0xff, 0x00, 0x96, 0x9f, 0xf0, 0x1f, 0xeb, 0x5d, 0x35,
+  0x73, 0x3a, 0x77, 0xfc, 0xb4, 0xff, 0x00, 0x80, 0xff, 0x00, 0x5a, 0xef, 0xad, 0x2d, 0x1a, 0xe5,
+  0xbd, 0x10, 0x7d, 0xe6, 0xfe, 0x83, 0xdf, 0xf9, 0x57, 0x89, 0x52, 0x12, 0xa9, 0x59, 0xc6, 0x2a,
+  0xed, 0xdb, 0xf2, 0x47, 0xea, 0x18, 0x4c, 0x55, 0x1c, 0x1e, 0x5b, 0x1a, 0xd5, 0xa6, 0xa1, 0x08,
+  0x29, 0xb6, 0xdf, 0xf8, 0xe5, 0xa2, 0x5d, 0x5b, 0xe8, 0x96, 0xe3, 0x2d, 0xad, 0x24, 0xb9, 0x3c,
+  0x7c, 0xaa, 0x3a, 0xb1, 0xfe, 0x43, 0xd4, 0xe3, 0x9f, 0xeb, 0x57, 0x9d, 0xd9, 0xce, 0x49, 0xae,
+  0xfd, 0x11, 0x63, 0x50, 0xaa, 0x30, 0x07, 0x41, 0x5e, 0x75, 0x5f, 0xa1, 0xe5, 0xd8, 0x3a, 0x74,
+  0x6f, 0x26, 0x94, 0xaa, 0x24, 0xbd, 0xee, 0xd7, 0xbd, 0xf9, 0x7b, 0x7e, 0xa7, 0xca, 0x64, 0xf9,
+  0xab, 0xce, 0xb1, 0x38, 0xaa, 0xb2, 0xa7, 0x18, 0xc7, 0x0f, 0xc8, 0xb0, 0xf7, 0x49, 0xce, 0x11,
+  0xa9, 0xcf, 0xce, 0xdc, 0xbb, 0xcb, 0x96, 0x37, 0xb6, 0x8b, 0x60, 0xae, 0x67, 0x51, 0xff, 0x00,
+  0x96, 0x7f, 0xf0, 0x2f, 0xe9, 0x5d, 0x35, 0x73, 0x3a, 0x8f, 0xfc, 0xb3, 0xff, 0x00, 0x81, 0x7f,
+  0x4a, 0xfb, 0x7a, 0x1f, 0xc4, 0x8f, 0xcf, 0xf2, 0x67, 0xd3, 0x66, 0x9f, 0xee, 0x75, 0x7f, 0xed,
+  0xcf, 0xfd, 0x2e, 0x27, 0x33, 0x45, 0x14, 0x57, 0xd0, 0x1f, 0x8f, 0x9f, 0x62, 0xd1, 0x45, 0x15,
+  0xfc, 0x00, 0x7d, 0x51, 0xcc, 0xea, 0x3f, 0xf2, 0xcf, 0xfe, 0x05, 0xfd, 0x2b, 0x99, 0xae, 0x9b,
+  0x51, 0xff, 0x00, 0x96, 0x7f, 0xf0, 0x2f, 0xe9, 0x5c, 0xcd, 0x7d, 0x0d, 0x0f, 0xe1, 0xc7, 0xe7,
+  0xf9, 0xb3, 0xf1, 0xfc, 0xd3, 0xfd, 0xf2, 0xaf, 0xfd, 0xb9, 0xff, 0x00, 0xa4, 0x44, 0x8d, 0x94,
+  0x38, 0xc1, 0x19, 0xa9, 0x2d, 0x2f, 0x92, 0xe3, 0x0a, 0x7e, 0x57, 0xc7, 0x4e, 0xc7, 0xfd, 0xdf,
+  0xe7, 0x8f, 0xe7, 0x45, 0x79, 0xb8, 0x24, 0x10, 0x41, 0xc1, 0x1c, 0x82, 0x3b, 0x57, 0xd9, 0x65,
+  0xd8, 0xaa, 0x94, 0x39, 0x92, 0x6d, 0xc2, 0xea, 0xf0, 0x7b, 0x6b, 0xbb, 0x5d, 0x99, 0xf5, 0x59,
+  0x1e, 0x55, 0x4f, 0x39, 0xc3, 0xe2, 0xe9, 0x54, 0x94, 0xa3, 0x2a, 0x5e, 0xce, 0x54, 0x65, 0x76,
+  0xd5, 0x39, 0x4f, 0x9f, 0x9b, 0xdd, 0xd9, 0xa9, 0x72, 0xc7, 0x9b, 0xae, 0x8b, 0x53, 0xd9, 0x6b,
+  0xa6, 0xd3, 0xbf, 0xe5, 0xa7, 0xfc, 0x07, 0xfa, 0xd7, 0x9b, 0xd9, 0x5e, 0x89, 0xc6, 0xc7, 0xe2,
+  0x41, 0xff, 0x00, 0x8f, 0xfb, 0x8f, 0x7f, 0x51, 0xf8, 0x8a, 0xf4, 0x8d, 0x3b, 0xfe, 0x5a, 0x7f,
+  0xc0, 0x7f, 0xad, 0x7e, 0x8d, 0x2a, 0x91, 0xab, 0x45, 0xca, 0x2e, 0xe9, 0xdb, 0xe5, 0xaa, 0xd1,
+  0x9f, 0x2b, 0x87, 0xc1, 0x57, 0xc0, 0x66, 0x70, 0xa1, 0x5e, 0x3c, 0xb3, 0x8f, 0x3f, 0xa4, 0x97,
+  0x24, 0xad, 0x28, 0xbe, 0xb1, 0x7d, 0x1f, 0xea, 0x74, 0xd4, 0x51, 0x45, 0x78, 0xc7, 0xe9, 0x67,
+  0xc0, 0x14, 0x51, 0x45, 0x00, 0x76, 0x7a, 0x34, 0x0d, 0x71, 0x23, 0xa0, 0xe3, 0x3b, 0x72, 0x71,
+  0x9c, 0x01, 0xbb, 0x9f, 0xf3, 0xde, 0xbd, 0xea, 0x38, 0xd6, 0x24, 0x54, 0x5e, 0x8a, 0x31, 0xff,
+  0x00, 0xd7, 0x38, 0xee, 0x7b, 0xd7, 0x37, 0xa2, 0xe9, 0xdf, 0x62, 0xb0, 0x8a, 0x66, 0x1f, 0xbc,
+  0xba, 0xcc, 0x87, 0xda, 0x3c, 0x0f, 0x2c, 0x70, 0xc4, 0x74, 0x25, 0xf3, 0x80, 0x7e, 0x7c, 0x1e,
+  0x95, 0xd5, 0x57, 0xaf, 0x86, 0xa5, 0x18, 0xa7, 0x3f, 0xb5, 0x3f, 0xc1, 0x2d, 0x2d, 0xf8, 0x5c,
+  0xfc, 0xef, 0x3b, 0xc7, 0xd5, 0xad, 0x2a, 0x78, 0x5d, 0xa9, 0x61, 0xf5, 0x4b, 0xf9, 0xa7, 0x3f,
+  0x79, 0xcd, 0xfa, 0x29, 0x72, 0xa5, 0xd3, 0xe6, 0x15, 0xe6, 0xb5, 0xe9, 0x55, 0xe6, 0xb5, 0xf5,
+  0x38, 0x6f, 0xb5, 0xf2, 0xfd, 0x4f, 0xba, 0xe0, 0xaf, 0xf9, 0x8d, 0xff, 0x00, 0xb8, 0x1f, 0xfb,
+  0x94, 0x2b, 0x99, 0xd4, 0x7f, 0xe5, 0x9f, 0xfc, 0x0b, 0xfa, 0x57, 0x4d, 0x5c, 0xce, 0xa3, 0xff,
+  0x00, 0x2c, 0xff, 0x00, 0xe0, 0x5f, 0xd2, 0xbd, 0xfa, 0x1f, 0xc4, 0x8f, 0xcf, 0xf2, 0x67, 0xea,
+  0xb9, 0xa7, 0xfb, 0x9d, 0x5f, 0xfb, 0x73, 0xff, 0x00, 0x4b, 0x89, 0xcc, 0xd1, 0x45, 0x15, 0xf4,
+  0x07, 0xe3, 0xe7, 0xd8, 0xb4, 0x51, 0x45, 0x7f, 0x00, 0x1f, 0x54, 0x73, 0x3a, 0x8f, 0xfc, 0xb3,
+  0xff, 0x00, 0x81, 0x7f, 0x4a, 0xe6, 0x6b, 0xa6, 0xd4, 0x7f, 0xe5, 0x9f, 0xfc, 0x0b, 0xfa, 0x57,
+  0x33, 0x5f, 0x43, 0x43, 0xf8, 0x71, 0xf9, 0xfe, 0x6c, 0xfc, 0x7f, 0x34, 0xff, 0x00, 0x7c, 0xab,
+  0xff, 0x00, 0x6e, 0x7f, 0xe9, 0x11, 0x0a, 0xf3, 0x5a, 0xf4, 0xaa, 0xf3, 0x5a, 0xfa, 0x0c, 0x37,
+  0xda, 0xf9, 0x7e, 0xa7, 0xea, 0xbc, 0x15, 0xff, 0x00, 0x31, 0xbf, 0xf7, 0x03, 0xff, 0x00, 0x72,
+  0x8e, 0x04, 0x82, 0x08, 0x38, 0x23, 0x90, 0x47, 0x6a, 0xf7, 0x6d, 0x0a, 0xe4, 0x5c, 0xc7, 0x21,
+  0xc6, 0x18, 0x6d, 0x0c, 0x3f, 0x3e, 0x47, 0x7c, 0x1f, 0x7a, 0xf0, 0x7a, 0xb5, 0x67, 0xa8, 0xff,
+  0x00, 0x66, 0x5f, 0xdb, 0x4c, 0x4e, 0x23, 0x6d, 0xf1, 0xcb, 0xff, 0x00, 0x5c, 0xd8, 0xae, 0x4f,
+  0xdd, 0x63, 0xf2, 0x90, 0x1f, 0x0a, 0x32, 0x76, 0xe3, 0xbd, 0x7d, 0x2e, 0x1a, 0xa4, 0xa3, 0x27,
+  0x15, 0xb4, 0xf7, 0x5e, 0x9a, 0xa6, 0x7e, 0x83, 0x9d, 0x60, 0xe9, 0x56, 0xa5, 0x1a, 0xf2, 0x5f,
+  0xbc, 0xc3, 0xbb, 0xc2, 0x5e, 0x53, 0xf7, 0x65, 0x17, 0xe5, 0xad, 0xfd, 0x51, 0xf5, 0x4d, 0x14,
+  0x51, 0x5e, 0xd1, 0xf9, 0xa1, 0xf0, 0x05, 0x74, 0x1a, 0x55, 0x97, 0xf6, 0x8d, 0xf4, 0x16, 0xd9,
+  0xda, 0x24, 0x6f, 0x98, 0xe7, 0x07, 0x62, 0x82, 0xcf, 0x83, 0x86, 0xf9, 0xb6, 0x83, 0xb7, 0x23,
+  0x19, 0xc6, 0x6b, 0x9f, 0xaf, 0x70, 0xf0, 0x44, 0x1b, 0xae, 0x6e, 0xa7, 0xdd, 0xfe, 0xae, 0x25,
+  0x8f, 0x6e, 0x3a, 0xf9, 0xad, 0xbb, 0x39, 0xcf, 0x18, 0xf2, 0xfa, 0x63, 0x9c, 0xfb, 0x50, 0x07,
+  0xb4, 0xea, 0x3f, 0xf2, 0xcf, 0xfe, 0x05, 0xfd, 0x2b, 0x99, 0xae, 0x9b, 0x51, 0xff, 0x00, 0x96,
+  0x7f, 0xf0, 0x2f, 0xe9, 0x5c, 0xcd, 0x7d, 0x05, 0x0f, 0xe1, 0xc7, 0xe7, 0xf9, 0xb3, 0xf1, 0xfc,
+  0xd3, 0xfd, 0xf2, 0xaf, 0xfd, 0xb9, 0xff, 0x00, 0xa4, 0x44, 0x2b, 0xcd, 0x6b, 0xd2, 0xab, 0xcd,
+  0x6b, 0xe8, 0x30, 0xdf, 0x6b, 0xe5, 0xfa, 0x9f, 0xab, 0x70, 0x57, 0xfc, 0xc6, 0xff, 0x00, 0xdc,
+  0x0f, 0xfd, 0xca, 0x15, 0xcc, 0xea, 0x3f, 0xf2, 0xcf, 0xfe, 0x05, 0xfd, 0x2b, 0xa6, 0xae, 0x67,
+  0x51, 0xff, 0x00, 0x96, 0x7f, 0xf0, 0x2f, 0xe9, 0x5e, 0xfd, 0x0f, 0xe2, 0x47, 0xe7, 0xf9, 0x33,
+  0xf5, 0x5c, 0xd3, 0xfd, 0xce, 0xaf, 0xfd, 0xb9, 0xff, 0x00, 0xa5, 0xc4, 0xe6, 0x68, 0xa2, 0x8a,
+  0xfa, 0x03, 0xf1, 0xf3, 0xec, 0x5a, 0x28, 0xa2, 0xbf, 0x80, 0x0f, 0xaa, 0x39, 0x9d, 0x47, 0xfe,
+  0x59, 0xff, 0x00, 0xc0, 0xbf, 0xa5, 0x73, 0x35, 0xd3, 0x6a, 0x3f, 0xf2, 0xcf, 0xfe, 0x05, 0xfd,
+  0x2b, 0x99, 0xaf, 0xa1, 0xa1, 0xfc, 0x38, 0xfc, 0xff, 0x00, 0x36, 0x7e, 0x3f, 0x9a, 0x7f, 0xbe,
+  0x55, 0xff, 0x00, 0xb7, 0x3f, 0xf4, 0x88, 0x85, 0x79, 0xad, 0x7a, 0x55, 0x79, 0xad, 0x7d, 0x06,
+  0x1b, 0xed, 0x7c, 0xbf, 0x53, 0xf5, 0x5e, 0x0a, 0xff, 0x00, 0x98, 0xdf, 0xfb, 0x81, 0xff, 0x00,
+  0xb9, 0x42, 0xb9, 0x9d, 0x47, 0xfe, 0x59, 0xff, 0x00, 0xc0, 0xbf, 0xa5, 0x76, 0x91, 0x5a, 0xdc,
+  0x4e, 0x82, 0x48, 0xa1, 0x96, 0x44, 0x6c, 0xe1, 0xd1, 0x19, 0x94, 0xe0, 0xe0, 0xe0, 0xa8, 0x20,
+  0xe0, 0xf1, 0x5c, 0xb6, 0xad, 0x6f, 0x34, 0x1e, 0x4f, 0x9b, 0x14, 0x91, 0xee, 0xdf, 0x8d, 0xe8,
+  0xcb, 0x9c, 0x6d, 0xce, 0x32, 0x06, 0x71, 0x5f, 0x43, 0x45, 0x3f, 0x69, 0x1d, 0x1f, 0x5f, 0xc8,
+  0xfd, 0x3f, 0x33, 0xa9, 0x09, 0x61, 0x2a, 0xa5, 0x28, 0xb7, 0xee, 0x68, 0x9a, 0xfe, 0x78, 0x9f,
+  0x47, 0x78, 0x66, 0xf7, 0xed, 0xba, 0x64, 0x59, 0x18, 0x68, 0x3f, 0xd1, 0xdb, 0x8c, 0x03, 0xe5,
+  0xaa, 0xed, 0x23, 0x92, 0x7e, 0xe1, 0x5c, 0xf4, 0xf9, 0xb3, 0xc6, 0x2b, 0xd0, 0x2b, 0xe7, 0x0f,
+  0x04, 0x4f, 0xb6, 0xe6, 0xea, 0x0d, 0xbf, 0xeb, 0x22, 0x59, 0x37, 0x67, 0xa7, 0x94, 0xdb, 0x71,
+  0x8c, 0x73, 0x9f, 0x33, 0xae, 0x78, 0xc7, 0xbd, 0x7d, 0x1f, 0x5e, 0xf1, 0xf9, 0x31, 0xf0, 0x05,
+  0x7d, 0x37, 0xe0, 0x94, 0x51, 0x61, 0x3b, 0x6d, 0x1b, 0x8d, 0xc3, 0x29, 0x6c, 0x0c, 0x90, 0xb1,
+  0xc6, 0x40, 0x27, 0xae, 0x01, 0x63, 0x81, 0xdb, 0x26, 0xbe, 0x64, 0xaf, 0xa7, 0xfc, 0x15, 0xff,
+  0x00, 0x20, 0xe9, 0xbf, 0xeb, 0xe9, 0xff, 0x00, 0xf4, 0x54, 0x54, 0x01, 0xdd, 0x6a, 0x3f, 0xf2,
+  0xcf, 0xfe, 0x05, 0xfd, 0x2b, 0x99, 0xae, 0x9b, 0x51, 0xff, 0x00, 0x96, 0x7f, 0xf0, 0x2f, 0xe9,
+  0x5c, 0xcd, 0x7d, 0x05, 0x0f, 0xe1, 0xc7, 0xe7, 0xf9, 0xb3, 0xf1, 0xfc, 0xd3, 0xfd, 0xf2, 0xaf,
+  0xfd, 0xb9, 0xff, 0x00, 0xa4, 0x44, 0x2b, 0xcd, 0x6b, 0xd2, 0xab, 0xcd, 0x6b, 0xe8, 0x30, 0xdf,
+  0x6b, 0xe5, 0xfa, 0x9f, 0xab, 0x70, 0x57, 0xfc, 0xc6, 0xff, 0x00, 0xdc, 0x0f, 0xfd, 0xca, 0x15,
+  0xcc, 0xea, 0x3f, 0xf2, 0xcf, 0xfe, 0x05, 0xfd, 0x2b, 0xa6, 0xae, 0x67, 0x51, 0xff, 0x00, 0x96,
+  0x7f, 0xf0, 0x2f, 0xe9, 0x5e, 0xfd, 0x0f, 0xe2, 0x47, 0xe7, 0xf9, 0x33, 0xf5, 0x5c, 0xd3, 0xfd,
+  0xce, 0xaf, 0xfd, 0xb9, 0xff, 0x00, 0xa5, 0xc4, 0xe6, 0x68, 0xa2, 0x8a, 0xfa, 0x03, 0xf1, 0xf3,
+  0xec, 0x5a, 0x28, 0xa2, 0xbf, 0x80, 0x0f, 0xaa, 0x39, 0x9d, 0x47, 0xfe, 0x59, 0xff, 0x00, 0xc0,
+  0xbf, 0xa5, 0x73, 0x35, 0xd3, 0x6a, 0x3f, 0xf2, 0xcf, 0xfe, 0x05, 0xfd, 0x2b, 0x99, 0xaf, 0xa1,
+  0xa1, 0xfc, 0x38, 0xfc, 0xff, 0x00, 0x36, 0x7e, 0x3f, 0x9a, 0x7f, 0xbe, 0x55, 0xff, 0x00, 0xb7,
+  0x3f, 0xf4, 0x88, 0x85, 0x79, 0xad, 0x7a, 0x55, 0x79, 0xad, 0x7d, 0x06, 0x1b, 0xed, 0x7c, 0xbf,
+  0x53, 0xf5, 0x5e, 0x0a, 0xff, 0x00, 0x98, 0xdf, 0xfb, 0x81, 0xff, 0x00, 0xb9, 0x49, 0x35, 0xfb,
+  0xbb, 0x9b, 0x1d, 0x4a, 0xe2, 0x0b, 0x59, 0xe6, 0xb6, 0x85, 0x3c, 0xbd, 0x91, 0x43, 0x23, 0xc5,
+  0x1a, 0xee, 0x89, 0x18, 0xed, 0x44, 0x21, 0x46, 0x58, 0x92, 0x70, 0x39, 0x24, 0x9a, 0xaf, 0x04,
+  0xb2, 0x5e, 0xe9, 0x3a, 0xa4, 0x97, 0x2e, 0xf7, 0x0f, 0x0f, 0xd9, 0x3c, 0xa7, 0x99, 0x8c, 0x8d,
+  0x16, 0xf9, 0x88, 0x7f, 0x2c, 0xb9, 0x25, 0x37, 0x00, 0x03, 0x6d, 0xc6, 0x71, 0xcd, 0x63, 0xeb,
+  0xff, 0x00, 0x69, 0xfe, 0xd2, 0xb8, 0xfb, 0x57, 0x93, 0xe7, 0x7e, 0xef, 0x7f, 0x93, 0xbf, 0xcb,
+  0xff, 0x00, 0x54, 0x98, 0xdb, 0xbf, 0xe6, 0xfb, 0xb8, 0xce, 0x7b, 0xe6, 0x8b, 0x2f, 0xb4, 0xff,
+  0x00, 0x66, 0xea, 0x7e, 0x5f, 0x93, 0xe4, 0xff, 0x00, 0xa2, 0xf9, 0xfb, 0xb7, 0xf9, 0x9f, 0xeb,
+  0x4e, 0xcf, 0x2b, 0x1f, 0x2f, 0xde, 0xfb, 0xfb, 0xbb, 0x74, 0xaf, 0xbf, 0x39, 0x0d, 0x4f, 0x0a,
+  0xbb, 0x2e, 0xb1, 0x6e, 0x03, 0x10, 0x18, 0x4a, 0xac, 0x01, 0x20, 0x30, 0xf2, 0x9d, 0xb0, 0x7d,
+  0x46, 0x40, 0x38, 0x3d, 0xc0, 0x35, 0xf5, 0xdd, 0x7c, 0x81, 0xe1, 0x6f, 0xf9, 0x0c, 0xda, 0xff,
+  0x00, 0xdb, 0x6f, 0xfd, 0x11, 0x25, 0x7d, 0x7f, 0x40, 0xcf, 0x80, 0x2b, 0xe9, 0xff, 0x00, 0x05,
+  0x7f, 0xc8, 0x3a, 0x6f, 0xfa, 0xfa, 0x7f, 0xfd, 0x15, 0x15, 0x7c, 0xc1, 0x5e, 0xe9, 0xe0, 0x79,
+  0xd5, 0x66, 0xbb, 0x87, 0x07, 0x73, 0xc7, 0x1c, 0x80, 0xf1, 0x8c, 0x46, 0xc5, 0x4e, 0x79, 0xce,
+  0x73, 0x20, 0xc7, 0x1e, 0xb4, 0x01, 0xec, 0xba, 0x8f, 0xfc, 0xb3, 0xff, 0x00, 0x81, 0x7f, 0x4a,
+  0xe6, 0x6b, 0xa6, 0xd4, 0x7f, 0xe5, 0x9f, 0xfc, 0x0b, 0xfa, 0x57, 0x33, 0x5f, 0x41, 0x43, 0xf8,
+  0x71, 0xf9, 0xfe, 0x6c, 0xfc, 0x7f, 0x34, 0xff, 0x00, 0x7c, 0xab, 0xff, 0x00, 0x6e, 0x7f, 0xe9,
+  0x11, 0x0a, 0xf3, 0x5a, 0xf4, 0xaa, 0xf3, 0x5a, 0xfa, 0x0c, 0x37, 0xda, 0xf9, 0x7e, 0xa7, 0xea,
+  0xdc, 0x15, 0xff, 0x00, 0x31, 0xbf, 0xf7, 0x03, 0xff, 0x00, 0x72, 0x85, 0x73, 0x3a, 0x8f, 0xfc,
+  0xb3, 0xff, 0x00, 0x81, 0x7f, 0x4a, 0xe9, 0xab, 0x99, 0xd4, 0x7f, 0xe5, 0x9f, 0xfc, 0x0b, 0xfa,
+  0x57, 0xbf, 0x43, 0xf8, 0x91, 0xf9, 0xfe, 0x4c, 0xfd, 0x57, 0x34, 0xff, 0x00, 0x73, 0xab, 0xff,
+  0x00, 0x6e, 0x7f, 0xe9, 0x71, 0x39, 0x9a, 0x28, 0xa2, 0xbe, 0x80, 0xfc, 0x7c, 0xfb, 0x16, 0x8a,
+  0x28, 0xaf, 0xe0, 0x03, 0xea, 0x8e, 0x67, 0x51, 0xff, 0x00, 0x96, 0x7f, 0xf0, 0x2f, 0xe9, 0x5c,
+  0xcd, 0x74, 0xda, 0x8f, 0xfc, 0xb3, 0xff, 0x00, 0x81, 0x7f, 0x4a, 0xe6, 0x6b, 0xe8, 0x68, 0x7f,
+  0x0e, 0x3f, 0x3f, 0xcd, 0x9f, 0x8f, 0xe6, 0x9f, 0xef, 0x95, 0x7f, 0xed, 0xcf, 0xfd, 0x22, 0x21,
+  0x5e, 0x6b, 0x5e, 0x95, 0x5e, 0x6b, 0x5f, 0x41, 0x86, 0xfb, 0x5f, 0x2f, 0xd4, 0xfd, 0x57, 0x82,
+  0xbf, 0xe6, 0x37, 0xfe, 0xe0, 0x7f, 0xee, 0x52, 0x4d, 0x7e, 0xd2, 0xe6, 0xfb, 0x52, 0xb8, 0x9e,
+  0xd6, 0x09, 0xae, 0x61, 0x7f, 0x2f, 0x64, 0xb0, 0xc6, 0xf2, 0xc6, 0xdb, 0x62, 0x45, 0x3b, 0x5d,
+  0x01, 0x53, 0x86, 0x04, 0x1c, 0x1e, 0x08, 0x22, 0xab, 0xc1, 0x14, 0x96, 0x5a, 0x4e, 0xa9, 0x1d,
+  0xca, 0x3d, 0xbb, 0xcd, 0xf6, 0x4f, 0x29, 0x26, 0x53, 0x1b, 0x4b, 0xb2, 0x62, 0x5f, 0xcb, 0x0e,
+  0x01, 0x7d, 0xa0, 0x82, 0xdb, 0x73, 0x8c, 0xf3, 0x5a, 0x51, 0x5d, 0x5c, 0x40, 0x82, 0x38, 0xa6,
+  0x96, 0x34, 0x5c, 0xe1, 0x11, 0xd9, 0x54, 0x64, 0xe4, 0xe0, 0x29, 0x00, 0x64, 0xf3, 0x5c, 0xb6,
+  0xad, 0x71, 0x34, 0xfe, 0x4f, 0x9b, 0x2c, 0x92, 0x6d, 0xdf, 0x8d, 0xee, 0xcd, 0x8c, 0xed, 0xce,
+  0x32, 0x4e, 0x33, 0x5f, 0x63, 0x0a, 0xea, 0x72, 0x4a, 0xcf, 0x53, 0xdf, 0xc4, 0xe5, 0x53, 0xc3,
+  0x52, 0x95, 0x57, 0x52, 0x32, 0x51, 0xb6, 0x89, 0x3e, 0xad, 0x2f, 0xd4, 0xbf, 0xe1, 0x6f, 0xf9,
+  0x0c, 0xda, 0xff, 0x00, 0xdb, 0x6f, 0xfd, 0x11, 0x25, 0x7d, 0x7f, 0x5f, 0x36, 0x78, 0x22, 0x06,
+  0x6b, 0xbb, 0x99, 0xb2, 0x36, 0xa4, 0x22, 0x32, 0x39, 0xce, 0x64, 0x70, 0xc3, 0x1c, 0x63, 0x18,
+  0x8c, 0xe7, 0x9f, 0x4a, 0xfa, 0x4e, 0xbb, 0x8f, 0x96, 0x3e, 0x00, 0xae, 0xb3, 0x44, 0xbf, 0x1a,
+  0x6e, 0xa1, 0x0c, 0xcc, 0x48, 0x8f, 0x25, 0x25, 0xc1, 0x20, 0x6c, 0x71, 0x82, 0x48, 0x50, 0x4b,
+  0x05, 0x38, 0x7d, 0xb8, 0x39, 0x2a, 0x3b, 0xd7, 0xa8, 0xc7, 0xa2, 0x69, 0xed, 0xd6, 0x0f, 0xfc,
+  0x89, 0x2f, 0xff, 0x00, 0x17, 0x5b, 0xf1, 0xf8, 0x7b, 0x4b, 0x6e, 0xb6, 0xff, 0x00, 0xf9, 0x16,
+  0x6f, 0xfe, 0x39, 0x5f, 0x2f, 0x2c, 0xda, 0x84, 0x37, 0x8d, 0x4f, 0xba, 0x3f, 0xfc, 0x91, 0xe9,
+  0x4f, 0x0b, 0x38, 0x6e, 0xe3, 0xf8, 0xff, 0x00, 0x91, 0xde, 0xea, 0x3f, 0xf2, 0xcf, 0xfe, 0x05,
+  0xfd, 0x2b, 0x99, 0xad, 0xf9, 0x17, 0x2a, 0x8a, 0x72, 0xc1, 0x06, 0x06, 0xe2, 0x58, 0xf6, 0xea,
+  0xc4, 0x96, 0x63, 0xc7, 0x25, 0x89, 0x26, 0xb2, 0x59, 0x40, 0xaf, 0x46, 0x96, 0x7d, 0x85, 0x51,
+  0x4b, 0x92, 0xb7, 0xdd, 0x1e, 0xff, 0x00, 0xe2, 0x3f, 0x2a, 0xcc, 0x72, 0xfa, 0xb5, 0x31, 0x13,
+  0xa8, 0x9c, 0x2d, 0x2e, 0x5d, 0xdb, 0xbe, 0x91, 0x4b, 0xb7, 0x91, 0x5a, 0xbc, 0xd6, 0xbd, 0x0d,
+  0x89, 0x15, 0x81, 0xf6, 0x78, 0xb3, 0xf7, 0x7f, 0x53, 0xfe, 0x35, 0xef, 0x50, 0xcf, 0xf0, 0xb1,
+  0xbf, 0xb9, 0x5b, 0x5b, 0x74, 0x8f, 0xff, 0x00, 0x24, 0x7b, 0x79, 0x0e, 0x61, 0x4b, 0x25, 0xfa,
+  0xc7, 0xb7, 0x8c, 0xe5, 0xed, 0x7d, 0x9f, 0x2f, 0xb3, 0x49, 0xdb, 0x93, 0x9e, 0xf7, 0xe6, 0x71,
+  0xfe, 0x65, 0x63, 0x9b, 0xae, 0x67, 0x51, 0xff, 0x00, 0x96, 0x7f, 0xf0, 0x2f, 0xe9, 0x5e, 0x9c,
+  0x2d, 0xe2, 0xfe, 0xef, 0xea, 0x7f, 0xc6, 0x98, 0xfa, 0x7d, 0xac, 0xd8, 0xdf, 0x1e, 0x71, 0xd3,
+  0xe6, 0x71, 0xd7, 0xe8, 0xc2, 0xbe, 0xab, 0x0f, 0x9d, 0x61, 0xdc, 0x93, 0xe5, 0xab, 0xf7, 0x47,
+  0xb7, 0xf8, 0x8f, 0xab, 0xc6, 0xf1, 0x46, 0x0b, 0x11, 0x87, 0x9d, 0x38, 0xd3, 0xc4, 0x27, 0x2e,
+  0x5b, 0x5e, 0x30, 0xb6, 0x92, 0x4f, 0xf9, 0xfc, 0x8f, 0x0e, 0xa2, 0xbd, 0xb4, 0x69, 0x16, 0x3f,
+  0xf3, 0xc7, 0xff, 0x00, 0x1f, 0x93, 0xff, 0x00, 0x8b, 0xaa, 0x52, 0x69, 0x76, 0x6b, 0xd2, 0x2f,
+  0xfc, 0x7e, 0x4f, 0xfe, 0x2a, 0xbe, 0xba, 0x19, 0x95, 0x19, 0xed, 0x19, 0xfd, 0xcb, 0xfc, 0xcf,
+  0x83, 0x59, 0xa5, 0x06, 0xed, 0xcb, 0x53, 0xee, 0x5f, 0xfc, 0x91, 0xec, 0xb4, 0x57, 0x95, 0xc9,
+  0xa9, 0x5d, 0xaf, 0x49, 0x3f, 0xf1, 0xd4, 0xff, 0x00, 0xe2, 0x6b, 0x9f, 0x93, 0x59, 0xbf, 0x5e,
+  0x93, 0x7f, 0xe3, 0x91, 0xff, 0x00, 0xf1, 0x15, 0xfc, 0xe7, 0x1e, 0x11, 0xc7, 0x4f, 0x6a, 0x98,
+  0x6f, 0xfc, 0x0a, 0x7f, 0xfc, 0xac, 0xfa, 0xd8, 0x66, 0x54, 0x67, 0xb4, 0x67, 0xf7, 0x2f, 0xf3,
+  0x3d, 0x3b, 0x51, 0xff, 0x00, 0x96, 0x7f, 0xf0, 0x2f, 0xe9, 0x5c, 0xcd, 0x79, 0xa4, 0xba, 0xc5,
+  0xfc, 0xa4, 0x6f, 0x9b, 0x38, 0xe9, 0xf2, 0x46, 0x3a, 0xfd, 0x12, 0x85, 0xd4, 0x2e, 0x8f, 0xfc,
+  0xb4, 0xff, 0x00, 0xc7, 0x53, 0xff, 0x00, 0x89, 0xaf, 0x7a, 0x1c, 0x25, 0x8e, 0xa7, 0x04, 0x9d,
+  0x4c, 0x37, 0xfe, 0x05, 0x3e, 0xff, 0x00, 0xf5, 0xec, 0xf9, 0xbc, 0x4e, 0x02, 0xae, 0x37, 0x11,
+  0x3a, 0x90, 0x70, 0x4a, 0x5c, 0xb6, 0xe6, 0x6e, 0xfa, 0x45, 0x2e, 0x89, 0xf6, 0x3d, 0x2e, 0xbc,
+  0xd6, 0xb4, 0x16, 0xf2, 0x73, 0xfc, 0x7f, 0xf8, 0xea, 0xff, 0x00, 0x85, 0x31, 0x51, 0x4f, 0x6a,
+  0xec, 0xa7, 0xc3, 0xd8, 0xba, 0x57, 0xbc, 0xe8, 0xeb, 0x6d, 0xa5, 0x2f, 0xfe, 0x40, 0xfd, 0x43,
+  0x86, 0xb0, 0x75, 0x32, 0xdf, 0xac, 0x7b, 0x57, 0x19, 0x7b, 0x5f, 0x65, 0xcb, 0xc9, 0x77, 0x6e,
+  0x4e, 0x7b, 0xde, 0xe9, 0x7f, 0x32, 0x29, 0x57, 0x33, 0xa8, 0xff, 0x00, 0xcb, 0x3f, 0xf8, 0x17,
+  0xf4, 0xae, 0xe4, 0xc6, 0xbe, 0x9f, 0xce, 0xa8, 0x4b, 0x6d, 0x14, 0xb8, 0xde, 0xb9, 0xc7, 0x4e,
+  0x58, 0x75, 0xfa, 0x1a, 0x7f, 0xd9, 0xd5, 0x68, 0x49, 0x39, 0x4a, 0x0e, 0xd7, 0xd9, 0xbe, 0xde,
+  0x87, 0xe8, 0xd8, 0xc8, 0x3c, 0x4e, 0x1e, 0x74, 0xe3, 0x64, 0xe5, 0xcb, 0x6b, 0xed, 0xa4, 0x93,
+  0xe9, 0x7e, 0xc7, 0xb1, 0xf8, 0x52, 0xc0, 0xd9, 0xe9, 0xca, 0xec, 0x06, 0xfb, 0x93, 0xe7, 0x74,
+  0x19, 0x08, 0x40, 0xf2, 0xd4, 0xb0, 0x27, 0x70, 0xc7, 0xce, 0x3a, 0x63, 0x79, 0x18, 0xcd, 0x7a,
+  0x65, 0x7c, 0xf6, 0xba, 0xc5, 0xf4, 0x6a, 0x11, 0x25, 0x0a, 0xaa, 0x02, 0xaa, 0xac, 0x50, 0x80,
+  0xa0, 0x70, 0x00, 0x01, 0x30, 0x00, 0x1d, 0x05, 0x38, 0x6b, 0x9a, 0x8e, 0x7f, 0xd7, 0xff, 0x00,
+  0xe4, 0x38, 0xbf, 0xf8, 0x8a, 0xc6, 0xa5, 0x45, 0x4f, 0x7b, 0xfc, 0x8f, 0x87, 0xfe, 0xc6, 0xc4,
+  0x7f, 0x35, 0x2f, 0xbe, 0x5f, 0xfc, 0x89, 0xd4, 0xc3, 0x5d, 0x5c, 0x35, 0xf2, 0xc0, 0xd6, 0xf5,
+  0x05, 0xe9, 0x3f, 0xfe, 0x43, 0x8b, 0xff, 0x00, 0x88, 0xab, 0x43, 0xc4, 0x3a, 0xa2, 0xf4, 0xb8,
+  0xff, 0x00, 0xc8, 0x50, 0xff, 0x00, 0xf1, 0xba, 0xf8, 0x5a, 0x99, 0x4d, 0x79, 0xed, 0x2a, 0x7f,
+  0x7c, 0xbf, 0xf9, 0x13, 0xcf, 0xab, 0x8a, 0x84, 0xf6, 0x52, 0xfc, 0x3f, 0xcc, 0xfa, 0x85, 0xeb,
+  0x29, 0xeb, 0xc4, 0x6c, 0xf5, 0xcd, 0x46, 0x6d, 0xfb, 0xe7, 0xdd, 0x8d, 0xb8, 0xfd, 0xdc, 0x43,
+  0xae, 0x7d, 0x10, 0x57, 0x4f, 0x6f, 0xaa, 0xcb, 0xbf, 0x13, 0x36, 0xe5, 0x3d, 0xf6, 0x80, 0x57,
+  0xdf, 0xe5, 0x03, 0x23, 0xd7, 0xbf, 0xa5, 0x70, 0xc7, 0x2c, 0xab, 0x19, 0xf2, 0x39, 0xd3, 0x5e,
+  0x77, 0x95, 0xbf, 0xf4, 0x93, 0xcf, 0xab, 0x96, 0x62, 0x6b, 0xe1, 0x9e, 0x22, 0x92, 0x53, 0x56,
+  0x6d, 0x53, 0x4f, 0xf7, 0x8e, 0xce, 0xcd, 0x25, 0x6b, 0x37, 0xa6, 0x8a, 0xfa, 0x9d, 0x8b, 0xd6,
+  0x77, 0x7a, 0xd6, 0xf9, 0x58, 0x67, 0xa8, 0x3c, 0x82, 0x3b, 0xd7, 0x0b, 0xf6, 0x89, 0x7f, 0xbd,
+  0xfa, 0x0f, 0xf0, 0xaf, 0xb1, 0xa1, 0x90, 0x62, 0xa5, 0xb4, 0xe8, 0xe9, 0x6f, 0xb5, 0x2f, 0xfe,
+  0x44, 0xfc, 0xdf, 0x03, 0x97, 0x56, 0xce, 0x5d, 0x6f, 0x62, 0xe1, 0x0f, 0x63, 0xcb, 0xcd, 0xed,
+  0x6e, 0xbe, 0x2e, 0x6b, 0x5b, 0x95, 0x4b, 0xf9, 0x5d, 0xce, 0xa8, 0x55, 0x81, 0x5c, 0x77, 0xda,
+  0x25, 0xfe, 0xf7, 0xe8, 0x3f, 0xc2, 0xb1, 0x6f, 0x75, 0x0b, 0xa8, 0x76, 0x6c, 0x93, 0x19, 0xdd,
+  0x9f, 0x95, 0x0f, 0x4c, 0x7a, 0xa9, 0xaf, 0xb1, 0xc3, 0x64, 0xb8, 0x84, 0xd2, 0xe6, 0xa5, 0xf7,
+  0xcb, 0xff, 0x00, 0x91, 0x3b, 0xb1, 0x3c, 0x2f, 0x8d, 0xc3, 0xd2, 0x95, 0x49, 0x54, 0xc3, 0xb5,
+  0x1b, 0x5e, 0xd2, 0x9d, 0xf5, 0x69, 0x7f, 0x27, 0x99, 0xea, 0x62, 0xb3, 0x66, 0xaf, 0x23, 0xfe,
+  0xd7, 0xbe, 0xff, 0x00, 0x9e, 0xdf, 0xf8, 0xe4, 0x7f, 0xfc, 0x45, 0x46, 0x75, 0x4b, 0xc6, 0xeb,
+  0x2f, 0xfe, 0x39, 0x1f, 0xff, 0x00, 0x13, 0x5f, 0x6f, 0x4b, 0x2d, 0xad, 0x0d, 0xe5, 0x0f, 0xbd,
+  0xff, 0x00, 0x91, 0xf3, 0x31, 0xca, 0xeb, 0x27, 0x7e, 0x6a, 0x7f, 0x7b, 0xff, 0x00, 0xe4, 0x4e,
+  0xd6, 0x6a, 0xe5, 0x66, 0xaf, 0x7e, 0x3a, 0x6d, 0xa3, 0x75, 0x8f, 0xff, 0x00, 0x1e, 0x7f, 0xfe,
+  0x2a, 0xaa, 0x1d, 0x1a, 0xc1, 0xba, 0xc3, 0xff, 0x00, 0x8f, 0xc9, 0xff, 0x00, 0xc5, 0xd7, 0xc0,
+  0x53, 0xe2, 0xdc, 0x04, 0x37, 0xa7, 0x89, 0xff, 0x00, 0xc0, 0x69, 0xff, 0x00, 0xf2, 0xc3, 0xec,
+  0x29, 0x65, 0xb5, 0xa1, 0xbc, 0xa1, 0xf7, 0xbf, 0xf2, 0x3e, 0x69, 0x3f, 0x7a, 0xae, 0xa5, 0x7b,
+  0x25, 0xee, 0x8f, 0x61, 0x16, 0xcd, 0x90, 0xe3, 0x3b, 0xb3, 0xf3, 0xc8, 0x7a, 0x63, 0xd5, 0xeb,
+  0x18, 0x69, 0xf6, 0xa3, 0xfe, 0x59, 0xff, 0x00, 0xe3, 0xcf, 0xff, 0x00, 0xc5, 0x57, 0xba, 0xb8,
+  0xb7, 0x03, 0x52, 0x29, 0xaa, 0x78, 0x9f, 0xfc, 0x06, 0x1f, 0xfc, 0xb0, 0xd1, 0xe3, 0xe9, 0x60,
+  0xaa, 0xba, 0x73, 0x53, 0x6e, 0x36, 0xbf, 0x2a, 0x56, 0xd5, 0x27, 0xd5, 0xae, 0xe7, 0x14, 0x95,
+  0xac, 0x95, 0xd2, 0x8b, 0x38, 0x07, 0xf0, 0x7f, 0xe3, 0xcd, 0xfe, 0x35, 0xc6, 0x07, 0x61, 0xde,
+  0xa1, 0x71, 0x0e, 0x12, 0xad, 0xed, 0x0a, 0xda, 0x77, 0x8c, 0x7f, 0xf9, 0x33, 0xf4, 0xdc, 0x97,
+  0x19, 0x4f, 0x32, 0xf6, 0x9e, 0xc9, 0x4a, 0x3e, 0xcb, 0x93, 0x9b, 0x9e, 0xca, 0xfc, 0xfc, 0xd6,
+  0xb5, 0x9b, 0xfe, 0x57, 0x73, 0x58, 0xd5, 0x73, 0x5d, 0x4d, 0xa5, 0x91, 0x2b, 0xba, 0x7e, 0x49,
+  0xe8, 0x9d, 0x31, 0xee, 0x71, 0x83, 0x9f, 0x6e, 0xdd, 0xeb, 0xb3, 0xb2, 0xd2, 0xec, 0xe6, 0xdf,
+  0xbe, 0x2c, 0xe3, 0x6e, 0x3e, 0x79, 0x07, 0x5c, 0xfa, 0x30, 0xaa, 0xad, 0x59, 0x54, 0x87, 0x3f,
+  0x2c, 0xa3, 0x7e, 0x92, 0xb5, 0xff, 0x00, 0x32, 0xdf, 0x12, 0x60, 0x56, 0x29, 0xe1, 0xa3, 0xed,
+  0x2a, 0xc9, 0x36, 0xb9, 0xe0, 0xa2, 0xe9, 0xdd, 0x26, 0xdd, 0x9b, 0x92, 0x6e, 0xd6, 0xb5, 0xd2,
+  0xb1, 0xe3, 0x46, 0xa3, 0x1d, 0x6b, 0xe8, 0x3f, 0xec, 0x4d, 0x3f, 0xfe, 0x78, 0x7f, 0xe4, 0x49,
+  0x7f, 0xf8, 0xba, 0x3f, 0xb0, 0xf4, 0xef, 0xf9, 0xe1, 0xff, 0x00, 0x91, 0x25, 0xff, 0x00, 0xe2,
+  0xeb, 0xe2, 0xeb, 0x53, 0x75, 0x36, 0xb7, 0xcc, 0xf6, 0xff, 0x00, 0xb6, 0x70, 0xff, 0x00, 0xcb,
+  0x57, 0xee, 0x8f, 0xff, 0x00, 0x24, 0x7c, 0x57, 0x45, 0x14, 0x57, 0x71, 0xf9, 0x91, 0xd3, 0x69,
+  0xdf, 0xf2, 0xd3, 0xfe, 0x03, 0xfd, 0x6b, 0xa6, 0xae, 0x67, 0x4e, 0xff, 0x00, 0x96, 0x9f, 0xf0,
+  0x1f, 0xeb, 0x5d, 0x35, 0x7c, 0xfd, 0x7f, 0xe2, 0x4b, 0xe5, 0xf9, 0x23, 0xf5, 0xfc, 0xaf, 0xfd,
+  0xce, 0x97, 0xfd, 0xbf, 0xff, 0x00, 0xa5, 0xc8, 0xdf, 0xb4, 0xbe, 0x6b, 0x6f, 0x95, 0x86, 0xe4,
+  0xf4, 0xee, 0xbe, 0xb8, 0xff, 0x00, 0x0f, 0x5a, 0x56, 0x52, 0xa7, 0x04, 0x62, 0xb9, 0xfa, 0xeb,
+  0xae, 0x7e, 0xf8, 0xff, 0x00, 0x77, 0xfa, 0x9a, 0xfa, 0xec, 0x9f, 0x11, 0x51, 0xd4, 0x74, 0x5b,
+  0xbc, 0x79, 0x6e, 0xaf, 0xba, 0xb7, 0x44, 0xfb, 0x6a, 0x71, 0x4a, 0x8d, 0x2c, 0x2e, 0x37, 0x9a,
+  0x95, 0x38, 0xc6, 0x58, 0xb8, 0xca, 0x55, 0x9a, 0xbf, 0xbc, 0xe9, 0x5b, 0x95, 0xda, 0xf6, 0x4f,
+  0xdf, 0x7c, 0xce, 0xda, 0x99, 0xd5, 0xcc, 0xea, 0x3f, 0xf2, 0xcf, 0xfe, 0x05, 0xfd, 0x2b, 0xa6,
+  0xae, 0x67, 0x51, 0xff, 0x00, 0x96, 0x7f, 0xf0, 0x2f, 0xe9, 0x5f, 0xa8, 0xd0, 0xfe, 0x24, 0x7e,
+  0x7f, 0x93, 0x30, 0xcd, 0x3f, 0xdc, 0xea, 0xff, 0x00, 0xdb, 0x9f, 0xfa, 0x5c, 0x4e, 0x66, 0x8a,
+  0x28, 0xaf, 0xa0, 0x3f, 0x1f, 0x3e, 0xc5, 0xa2, 0x8a, 0x2b, 0xf8, 0x00, 0xfa, 0xa3, 0x99, 0xd4,
+  0x7f, 0xe5, 0x9f, 0xfc, 0x0b, 0xfa, 0x57, 0x33, 0x5d, 0x36, 0xa3, 0xff, 0x00, 0x2c, 0xff, 0x00,
+  0xe0, 0x5f, 0xd2, 0xb9, 0x9a, 0xfa, 0x1a, 0x1f, 0xc3, 0x8f, 0xcf, 0xf3, 0x67, 0xe3, 0xf9, 0xa7,
+  0xfb, 0xe5, 0x5f, 0xfb, 0x73, 0xff, 0x00, 0x48, 0x88, 0x84, 0x81, 0xc9, 0xe2, 0xaa, 0xd9, 0xe9,
+  0xe2, 0x22, 0x24, 0x93, 0x96, 0xea, 0x17, 0xb2, 0x9f, 0xea, 0x7f, 0x40, 0x68, 0x9f, 0xfd, 0x5b,
+  0x7e, 0x1f, 0xcc, 0x57, 0x51, 0x5f, 0xa4, 0xe4, 0xd4, 0x21, 0x35, 0x3a, 0x92, 0x57, 0x6a, 0x49,
+  0x25, 0xd3, 0x6b, 0xde, 0xdd, 0xce, 0x68, 0xe3, 0x2b, 0xe1, 0x30, 0xb5, 0x21, 0x46, 0x6e, 0x0b,
+  0x13, 0x27, 0x1a, 0xb6, 0xdd, 0xc6, 0x9c, 0x55, 0x92, 0x7b, 0xa4, 0xfd, 0xa3, 0xe6, 0xef, 0xa7,
+  0x98, 0x57, 0x4d, 0xa7, 0x7f, 0xcb, 0x4f, 0xf8, 0x0f, 0xf5, 0xae, 0x66, 0xba, 0x6d, 0x3b, 0xfe,
+  0x5a, 0x7f, 0xc0, 0x7f, 0xad, 0x7d, 0xb5, 0x7f, 0xe1, 0xcb, 0xe5, 0xf9, 0xa3, 0x8f, 0x2b, 0xff,
+  0x00, 0x7c, 0xa5, 0xff, 0x00, 0x6f, 0xff, 0x00, 0xe9, 0x12, 0x3a, 0x6a, 0x28, 0xa2, 0xbe, 0x7c,
+  0xfd, 0x80, 0xff, 0xd9,
+};
@@ -0,0 +1,206 @@
+#include <unity.h>
+#include <Arduino.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include "esp_camera.h"
+#include "frame_pipe.h"
+#include "rtsp_server.h"
+#include "sample_frames.h"
+
+// The server runs on localhost as in the device, behind frame_pipe and the
+// fake camera. Its tasks wait on their sockets in real time and on the frame
+// pipe in simulated time, so while a client plays the stream the test keeps
+// the sensor going at 25 fps of both clocks.
+
+#define SENSOR_MS 40
+#define FRAMES    50
+
+static uint16_t _port = 0;
+
+// A port nothing listens on right now
+static uint16_t free_port() {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  struct sockaddr_in a = {};
+  a.sin_family = AF_INET;
+  a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  bind(fd, (struct sockaddr *)&a, sizeof(a));
+  socklen_t len = sizeof(a);
+  getsockname(fd, (struct sockaddr *)&a, &len);
+  close(fd);
+  return ntohs(a.sin_port);
+}
+
+static bool have_ffmpeg() {
+  return system("ffmpeg -version > /dev/null 2>&1") == 0;
+}
+
+// Run cmd while the sensor delivers frames; its output lines and exit status
+static int run_with_sensor(const char *cmd, std::vector<std::string> &lines) {
+  std::atomic<bool> done{false};
+  int status = -1;
+  std::thread t([&] {
+    FILE *p = popen(cmd, "r");
+    char line[256];
+    while (p && fgets(line, sizeof(line), p)) {
+      lines.push_back(line);
+    }
+    status = p ? pclose(p) : -1;
+    done = true;
+  });
+  // 30 s at most
+  for (int k = 0; !done && k < 30000 / SENSOR_MS; k++) {
+    if (k % 2) {
+      host_camera_shoot(frame_b, sizeof(frame_b), 160, 120);
+    } else {
+      host_camera_shoot(frame_a, sizeof(frame_a), 160, 120);
+    }
+    host_time_advance_ms(SENSOR_MS);
+    usleep(SENSOR_MS * 1000);
+  }
+  t.join();
+  return status;
+}
+
+// CRC of the decoded pictures of a JPEG, as ffmpeg's framecrc prints it
+static std::string jpeg_crc(const uint8_t *jpeg, size_t len) {
+  char path[] = "/tmp/test_rtsp_XXXXXX";
+  int fd = mkstemp(path);
+  TEST_ASSERT_TRUE(fd >= 0);
+  TEST_ASSERT_EQUAL_INT((int)len, (int)write(fd, jpeg, len));
+  close(fd);
+  char cmd[256];
+  snprintf(cmd, sizeof(cmd), "ffmpeg -v error -f jpeg_pipe -i %s -f framecrc - 2>&1", path);
+  FILE *p = popen(cmd, "r");
+  char line[256];
+  std::string crc;
+  while (fgets(line, sizeof(line), p)) {
+    const char *c = strrchr(line, ',');
+    if (line[0] != '#' && c) {
+      crc = c + 1;
+    }
+  }
+  pclose(p);
+  unlink(path);
+  return crc;
+}
+
+// Play the stream with ffmpeg over transport and check every picture it
+// decodes is one of the frames the camera took
+static void play(const char *transport) {
+  if (!have_ffmpeg()) {
+    TEST_IGNORE_MESSAGE("ffmpeg not on PATH");
+  }
+  std::string crc_a = jpeg_crc(frame_a, sizeof(frame_a));
+  std::string crc_b = jpeg_crc(frame_b, sizeof(frame_b));
+  TEST_ASSERT_TRUE(!crc_a.empty() && crc_a != crc_b);
+
+  char cmd[256];
+  snprintf(cmd, sizeof(cmd), "ffmpeg -v error -rtsp_transport %s -timeout 5000000 -i rtsp://127.0.0.1:%u/ -frames:v %d -f framecrc - 2>&1",
+           transport, _port, FRAMES);
+  std::vector<std::string> lines;
+  int status = run_with_sensor(cmd, lines);
+  int frames = 0, a = 0, b = 0;
+  bool size_ok = false;
+  for (const std::string &l : lines) {
+    if (l.find("#dimensions 0: 160x120") == 0) {
+      size_ok = true;
+    }
+    if (l[0] == '#') {
+      continue;
+    }
+    size_t c = l.rfind(',');
+    TEST_ASSERT_TRUE_MESSAGE(c != std::string::npos, l.c_str());
+    std::string crc = l.substr(c + 1);
+    TEST_ASSERT_TRUE_MESSAGE(crc == crc_a || crc == crc_b, l.c_str());
+    a += crc == crc_a;
+    b += crc == crc_b;
+    frames++;
+  }
+  char msg[96];
+  snprintf(msg, sizeof(msg), "%s: %d frames decoded (%d a, %d b), exit %d", transport, frames, a, b, status);
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_EQUAL_INT(0, status);
+  TEST_ASSERT_TRUE(size_ok);
+  TEST_ASSERT_EQUAL_INT(FRAMES, frames);
+  TEST_ASSERT_TRUE(a > 0 && b > 0);
+}
+
+// One request on a new connection; the reply
+static std::string request(const char *req) {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  struct sockaddr_in a = {};
+  a.sin_family = AF_INET;
+  a.sin_port = htons(_port);
+  a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  TEST_ASSERT_EQUAL_INT(0, connect(fd, (struct sockaddr *)&a, sizeof(a)));
+  struct timeval tv = {5, 0};
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+  TEST_ASSERT_EQUAL_INT((int)strlen(req), (int)send(fd, req, strlen(req), 0));
+  std::string reply;
+  char buf[1024];
+  ssize_t n;
+  while (reply.find("\r\n\r\n") == std::string::npos && (n = recv(fd, buf, sizeof(buf), 0)) > 0) {
+    reply.append(buf, n);
+  }
+  size_t clen = reply.find("Content-Length: ");
+  if (clen != std::string::npos) {
+    size_t want = reply.find("\r\n\r\n") + 4 + atoi(reply.c_str() + clen + 16);
+    while (reply.size() < want && (n = recv(fd, buf, sizeof(buf), 0)) > 0) {
+      reply.append(buf, n);
+    }
+  }
+  close(fd);
+  // the session ends with the connection; wait for the slot to be free again
+  usleep(100 * 1000);
+  return reply;
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_requests() {
+  std::string r = request("OPTIONS rtsp://127.0.0.1/ RTSP/1.0\r\nCSeq: 1\r\n\r\n");
+  TEST_ASSERT_EQUAL_INT(0, r.find("RTSP/1.0 200 OK\r\nCSeq: 1\r\n"));
+  TEST_ASSERT_TRUE(r.find("Public: OPTIONS, DESCRIBE, SETUP, PLAY, TEARDOWN, GET_PARAMETER\r\n") != std::string::npos);
+
+  r = request("DESCRIBE rtsp://127.0.0.1/ RTSP/1.0\r\nCSeq: 2\r\n\r\n");
+  TEST_ASSERT_EQUAL_INT(0, r.find("RTSP/1.0 200 OK\r\nCSeq: 2\r\n"));
+  TEST_ASSERT_TRUE(r.find("Content-Base: rtsp://127.0.0.1/\r\n") != std::string::npos);
+  TEST_ASSERT_TRUE(r.find("m=video 0 RTP/AVP 26\r\na=rtpmap:26 JPEG/90000\r\n") != std::string::npos);
+
+  r = request("OPTIONS\r\nCSeq: 3\r\n\r\n");
+  TEST_ASSERT_EQUAL_INT(0, r.find("RTSP/1.0 400 Bad Request\r\nCSeq: 3\r\n"));
+
+  r = request("RECORD rtsp://127.0.0.1/ RTSP/1.0\r\nCSeq: 4\r\n\r\n");
+  TEST_ASSERT_EQUAL_INT(0, r.find("RTSP/1.0 405 Method Not Allowed\r\nCSeq: 4\r\n"));
+}
+
+void test_ffmpeg_plays_over_tcp() {
+  play("tcp");
+}
+
+void test_ffmpeg_plays_over_udp() {
+  play("udp");
+}
+
+int main(int argc, char **argv) {
+  frame_pipe_begin(2);
+  _port = free_port();
+  if (!rtsp_server_begin(_port)) {
+    return 1;
+  }
+
+  UNITY_BEGIN();
+  RUN_TEST(test_requests);
+  RUN_TEST(test_ffmpeg_plays_over_tcp);
+  RUN_TEST(test_ffmpeg_plays_over_udp);
+  return UNITY_END();
+}
@@ -0,0 +1,561 @@
+#include <unity.h>
+#include <Arduino.h>
+#include <Preferences.h>
+#include <fcntl.h>
+#include <poll.h>
+#if defined(__APPLE__)
+#include <util.h>
+#else
+#include <pty.h>
+#endif
+#include <termios.h>
+#include <unistd.h>
+#include <atomic>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+#include "esp_camera.h"
+#include "esp_rom_crc.h"
+#include "camera_settings.h"
+#include "frame_pipe.h"
+#include "serial_frame.h"
+#include "serial_proto.h"
+
+typedef std::vector<uint8_t> bytes_t;
+
+// Frames as tools/serial_prov.py encodes them (zlib.crc32)
+static const uint8_t PING_SEQ7[] = {0x00, 0x07, 0x01, 0x07, 0x1d, 0xb6, 0xa6, 0xc6, 0x00};
+static const uint8_t SETTINGS_SEQ1[] = {0x00, 0x0e, 0x03, 0x01, 0x09, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x73, 0x69, 0x7a,
+                                        0x65, 0x05, 0x01, 0x01, 0x05, 0xd9, 0x7a, 0x4a, 0xe7, 0x00};
+
+static bytes_t encode(uint8_t type, uint8_t seq, const bytes_t &payload) {
+  bytes_t out(SERIAL_FRAME_ENCODED_MAX(payload.size()));
+  size_t n = serial_frame_encode(type, seq, payload.data(), payload.size(), NULL, 0, out.data(), out.size());
+  out.resize(n);
+  return out;
+}
+
+static bytes_t random_bytes(std::mt19937 &rng, size_t n) {
+  bytes_t b(n);
+  for (size_t i = 0; i < n; i++) {
+    // plenty of zeros and of 254 byte runs without one
+    b[i] = rng() % 4 ? rng() % 255 + 1 : 0;
+  }
+  return b;
+}
+
+static uint32_t u32(const uint8_t *p) {
+  return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static void put32(bytes_t &b, uint32_t v) {
+  for (int i = 0; i < 4; i++) {
+    b.push_back(v >> (8 * i));
+  }
+}
+
+// Device side: the pty's slave end is the console, and this thread runs the
+// console loop the way serialCmdsLoop() does, with log lines going out
+// between the protocol's frames when _noise is set. It holds _device_lock
+// while it works on the input, so a test that takes the lock sees the state a
+// reply left behind. (Unity's failures longjmp out of a test: only plain
+// reads go under the lock, the assertions come after.)
+
+static int _host = -1;
+static std::thread _device;
+static std::atomic<bool> _stop{false};
+static std::atomic<bool> _noise{false};
+static std::mutex _device_lock;
+static std::string _text;  // what reached the text shell
+
+static void device_loop() {
+  unsigned n = 0;
+  while (!_stop) {
+    {
+      std::lock_guard<std::mutex> g(_device_lock);
+      serial_proto_poll();
+      while (Serial.available()) {
+        int c = Serial.read();
+        if (!serial_proto_feed((uint8_t)c)) {
+          _text += (char)c;
+        }
+      }
+    }
+    if (_noise && ++n % 20 == 0) {
+      Serial.printf("I (%lu) cam: log line %u\r\n", millis(), n);
+    }
+    usleep(200);
+  }
+}
+
+template <typename F>
+static auto on_device(F fn) -> decltype(fn()) {
+  std::lock_guard<std::mutex> g(_device_lock);
+  return fn();
+}
+
+static std::string take_text() {
+  return on_device([] {
+    std::string t = _text;
+    _text.clear();
+    return t;
+  });
+}
+
+static void open_console() {
+  int slave;
+  TEST_ASSERT_EQUAL_INT(0, openpty(&_host, &slave, NULL, NULL, NULL));
+  struct termios t;
+  tcgetattr(slave, &t);
+  cfmakeraw(&t);
+  tcsetattr(slave, TCSANOW, &t);
+  tcgetattr(_host, &t);
+  cfmakeraw(&t);
+  tcsetattr(_host, TCSANOW, &t);
+  fcntl(slave, F_SETFL, fcntl(slave, F_GETFL) | O_NONBLOCK);
+  Serial.host_attach(slave);
+  _device = std::thread(device_loop);
+}
+
+// Host side, as the provisioning tool does it: split the input at zeros and
+// keep what decodes
+
+static bytes_t _rx;
+static size_t _dropped = 0;  // chunks that were not frames
+
+static void host_write(const uint8_t *p, size_t n) {
+  while (n) {
+    ssize_t r = ::write(_host, p, n);
+    TEST_ASSERT_TRUE(r > 0);
+    p += r;
+    n -= r;
+  }
+}
+
+static void host_send(uint8_t type, uint8_t seq, const bytes_t &payload) {
+  bytes_t f = encode(type, seq, payload);
+  TEST_ASSERT_TRUE(f.size());
+  host_write(f.data(), f.size());
+}
+
+typedef struct {
+  uint8_t type;
+  uint8_t seq;
+  bytes_t payload;
+} frame_in_t;
+
+static bool host_recv(frame_in_t *out, int timeout_ms = 2000) {
+  while (true) {
+    for (size_t end = 0; end < _rx.size(); end++) {
+      if (_rx[end]) {
+        continue;
+      }
+      bytes_t chunk(_rx.begin(), _rx.begin() + end);
+      _rx.erase(_rx.begin(), _rx.begin() + end + 1);
+      end = (size_t)-1;
+      const uint8_t *p;
+      size_t len;
+      if (chunk.empty()) {
+        continue;
+      }
+      if (!serial_frame_decode(chunk.data(), chunk.size(), &out->type, &out->seq, &p, &len)) {
+        _dropped++;
+        continue;
+      }
+      out->payload.assign(p, p + len);
+      return true;
+    }
+    struct pollfd pfd = {_host, POLLIN, 0};
+    if (poll(&pfd, 1, timeout_ms) <= 0) {
+      return false;
+    }
+    uint8_t buf[4096];
+    ssize_t n = ::read(_host, buf, sizeof(buf));
+    if (n > 0) {
+      _rx.insert(_rx.end(), buf, buf + n);
+    }
+  }
+}
+
+// Let the device loop see the current time
+static void advance_ms(uint32_t ms) {
+  host_time_advance_ms(ms);
+  usleep(20000);
+}
+
+// Send a request and return the reply's payload after checking its status.
+// For a command that waits in simulated time, tick_ms keeps the clock moving
+// until the reply comes.
+static bytes_t request(uint8_t cmd, const bytes_t &payload, uint8_t status = SP_OK, uint32_t tick_ms = 0) {
+  static uint8_t seq = 0;
+  seq++;
+  host_send(cmd, seq, payload);
+  frame_in_t f;
+  bool got = host_recv(&f, tick_ms ? 0 : 2000);
+  for (int i = 0; i < 100 && tick_ms && !got; i++) {
+    advance_ms(tick_ms);
+    got = host_recv(&f, 0);
+  }
+  TEST_ASSERT_TRUE_MESSAGE(got, "no reply");
+  TEST_ASSERT_EQUAL_HEX8(cmd | SP_REPLY, f.type);
+  TEST_ASSERT_EQUAL_UINT8(seq, f.seq);
+  TEST_ASSERT_TRUE(f.payload.size() >= 1);
+  TEST_ASSERT_EQUAL_UINT8(status, f.payload[0]);
+  return bytes_t(f.payload.begin() + 1, f.payload.end());
+}
+
+static void wait_baud(uint32_t baud) {
+  for (int i = 0; i < 2000 && Serial.baudRate() != baud; i++) {
+    usleep(1000);
+  }
+  TEST_ASSERT_EQUAL_UINT32(baud, Serial.baudRate());
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_roundtrip() {
+  std::mt19937 rng(46);
+  static const size_t sizes[] = {0, 1, 2, 247, 248, 249, 253, 254, 255, 500, 508, 509, 1000, SERIAL_FRAME_MAX_PAYLOAD};
+  for (size_t size : sizes) {
+    for (int rep = 0; rep < 50; rep++) {
+      // no zeros at all, nothing but zeros, then random
+      bytes_t payload = rep > 1 ? random_bytes(rng, size) : bytes_t(size, rep ? 0 : 0xAB);
+      bytes_t f = encode(0x40, rep, payload);
+      TEST_ASSERT_TRUE(f.size() >= 2 && f.size() <= SERIAL_FRAME_ENCODED_MAX(size));
+      TEST_ASSERT_EQUAL_UINT8(0, f.front());
+      TEST_ASSERT_EQUAL_UINT8(0, f.back());
+      TEST_ASSERT_NULL(memchr(f.data() + 1, 0, f.size() - 2));
+
+      uint8_t type, seq;
+      const uint8_t *p;
+      size_t len;
+      TEST_ASSERT_TRUE(serial_frame_decode(f.data() + 1, f.size() - 2, &type, &seq, &p, &len));
+      TEST_ASSERT_EQUAL_HEX8(0x40, type);
+      TEST_ASSERT_EQUAL_UINT8(rep, seq);
+      TEST_ASSERT_EQUAL_size_t(size, len);
+      TEST_ASSERT_TRUE(!size || !memcmp(payload.data(), p, size));
+    }
+  }
+}
+
+void test_head_and_body_make_one_payload() {
+  const uint8_t head[4] = {0, 4, 0, 0}, body[3] = {'a', 0, 'b'};
+  uint8_t out[64];
+  size_t n = serial_frame_encode(SP_DATA, 9, head, 4, body, 3, out, sizeof(out));
+  bytes_t whole = encode(SP_DATA, 9, {0, 4, 0, 0, 'a', 0, 'b'});
+  TEST_ASSERT_EQUAL_size_t(whole.size(), n);
+  TEST_ASSERT_EQUAL_MEMORY(whole.data(), out, n);
+}
+
+void test_matches_the_host_tool() {
+  bytes_t ping = encode(SP_CMD_PING, 7, {});
+  TEST_ASSERT_EQUAL_size_t(sizeof(PING_SEQ7), ping.size());
+  TEST_ASSERT_EQUAL_MEMORY(PING_SEQ7, ping.data(), sizeof(PING_SEQ7));
+  bytes_t set = encode(SP_CMD_SETTINGS, 1, {9, 'f', 'r', 'a', 'm', 'e', 's', 'i', 'z', 'e', 5, 0, 0, 0});
+  TEST_ASSERT_EQUAL_size_t(sizeof(SETTINGS_SEQ1), set.size());
+  TEST_ASSERT_EQUAL_MEMORY(SETTINGS_SEQ1, set.data(), sizeof(SETTINGS_SEQ1));
+}
+
+void test_corruption_is_rejected() {
+  std::mt19937 rng(7);
+  bytes_t f = encode(SP_CMD_SETTINGS, 3, random_bytes(rng, 300));
+  size_t len = f.size() - 2;
+  uint8_t type, seq;
+  const uint8_t *p;
+  size_t plen;
+  // every single byte change that keeps the frame free of zeros
+  for (size_t i = 1; i <= len; i++) {
+    for (int delta = 1; delta < 256; delta += 17) {
+      bytes_t bad = f;
+      bad[i] = (uint8_t)(bad[i] + delta);
+      if (!bad[i]) {
+        continue;
+      }
+      TEST_ASSERT_FALSE(serial_frame_decode(bad.data() + 1, len, &type, &seq, &p, &plen));
+    }
+  }
+  // truncated, or too short to hold type, seq and CRC
+  for (size_t cut = 0; cut < len; cut++) {
+    bytes_t bad = f;
+    TEST_ASSERT_FALSE(serial_frame_decode(bad.data() + 1, cut, &type, &seq, &p, &plen));
+  }
+  uint8_t tiny[] = {0x06, 1, 2, 3, 4, 5};
+  TEST_ASSERT_FALSE(serial_frame_decode(tiny, sizeof(tiny), &type, &seq, &p, &plen));
+  // CRCs that are right but leave no room for type and seq
+  uint8_t no_header[] = {0x01, 0x01, 0x01, 0x01, 0x01};  // crc32("") = 0
+  TEST_ASSERT_FALSE(serial_frame_decode(no_header, sizeof(no_header), &type, &seq, &p, &plen));
+  uint8_t t = SP_CMD_PING;
+  uint32_t crc = esp_rom_crc32_le(0, &t, 1);
+  uint8_t raw[5] = {t, (uint8_t)crc, (uint8_t)(crc >> 8), (uint8_t)(crc >> 16), (uint8_t)(crc >> 24)};
+  bytes_t no_seq(1);  // COBS by hand: a code byte before each run
+  size_t code_at = 0;
+  for (uint8_t b : raw) {
+    if (b) {
+      no_seq.push_back(b);
+    } else {
+      no_seq[code_at] = no_seq.size() - code_at;
+      code_at = no_seq.size();
+      no_seq.push_back(0);
+    }
+  }
+  no_seq[code_at] = no_seq.size() - code_at;
+  TEST_ASSERT_FALSE(serial_frame_decode(no_seq.data(), no_seq.size(), &type, &seq, &p, &plen));
+}
+
+void test_size_limits() {
+  bytes_t max(SERIAL_FRAME_MAX_PAYLOAD, 0x55);
+  bytes_t out(SERIAL_FRAME_ENCODED_MAX(SERIAL_FRAME_MAX_PAYLOAD + 1));
+  TEST_ASSERT_EQUAL_size_t(0, serial_frame_encode(SP_DATA, 0, max.data(), max.size(), max.data(), 1, out.data(), out.size()));
+  size_t n = serial_frame_encode(SP_DATA, 0, max.data(), max.size(), NULL, 0, out.data(), SERIAL_FRAME_ENCODED_MAX(max.size()));
+  TEST_ASSERT_TRUE(n > max.size());
+  TEST_ASSERT_EQUAL_size_t(0, serial_frame_encode(SP_DATA, 0, max.data(), max.size(), NULL, 0, out.data(), n - 1));
+}
+
+// Over the pty from here on; the device keeps its session state between tests
+
+void test_text_stays_with_the_shell() {
+  open_console();
+  const char line[] = "status\n";
+  host_write((const uint8_t *)line, strlen(line));
+  usleep(50000);
+  TEST_ASSERT_EQUAL_STRING("status\n", take_text().c_str());
+}
+
+void test_ping_from_the_tool() {
+  host_write(PING_SEQ7, sizeof(PING_SEQ7));
+  frame_in_t f;
+  TEST_ASSERT_TRUE(host_recv(&f));
+  TEST_ASSERT_EQUAL_HEX8(SP_CMD_PING | SP_REPLY, f.type);
+  TEST_ASSERT_EQUAL_UINT8(7, f.seq);
+  TEST_ASSERT_EQUAL_size_t(8, f.payload.size());
+  TEST_ASSERT_EQUAL_UINT8(SP_OK, f.payload[0]);
+  TEST_ASSERT_EQUAL_UINT8(SERIAL_PROTO_VERSION, f.payload[1]);
+  TEST_ASSERT_EQUAL_UINT32(115200, u32(&f.payload[2]));
+  TEST_ASSERT_EQUAL_UINT16(SERIAL_FRAME_MAX_PAYLOAD, f.payload[6] | f.payload[7] << 8);
+}
+
+void test_garbage_and_unknown_commands() {
+  _noise = true;
+  // a corrupted request gets no reply; the next one is answered normally
+  bytes_t bad = encode(SP_CMD_PING, 99, {});
+  bad[3] ^= 0x10;
+  host_write(bad.data(), bad.size());
+  const char junk[] = "\x00+++\x00";
+  host_write((const uint8_t *)junk, sizeof(junk) - 1);
+  request(0x33, {}, SP_ERR_UNKNOWN);
+  // log lines printed meanwhile end up in front of the next reply
+  usleep(30000);
+  request(SP_CMD_PING, {});
+  TEST_ASSERT_TRUE(_dropped > 0);
+}
+
+void test_credentials() {
+  std::string ssid = "Factory Net", pass = "s3cret pass";
+  bytes_t p;
+  p.push_back(ssid.size());
+  p.insert(p.end(), ssid.begin(), ssid.end());
+  p.push_back(pass.size());
+  p.insert(p.end(), pass.begin(), pass.end());
+  p.push_back(0);
+  request(SP_CMD_CREDS, p);
+
+  std::string saved = on_device([] {
+    Preferences prefs;
+    prefs.begin("wifi", true);
+    std::string s = std::string(prefs.getString("ssid", "").c_str()) + "/" + prefs.getString("pass", "").c_str();
+    prefs.end();
+    return s;
+  });
+  TEST_ASSERT_EQUAL_STRING("Factory Net/s3cret pass", saved.c_str());
+
+  request(SP_CMD_CREDS, {}, SP_ERR_REQUEST);
+  request(SP_CMD_CREDS, {40, 'x'}, SP_ERR_REQUEST);          // SSID too long
+  request(SP_CMD_CREDS, {2, 'a', 'b', 5, 'x', 'y'}, SP_ERR_REQUEST);  // truncated
+}
+
+void test_settings_batch() {
+  bytes_t p;
+  const char *names[] = {"quality", "nope", "hmirror"};
+  const int vals[] = {10, 3, 1};
+  for (int i = 0; i < 3; i++) {
+    p.push_back(strlen(names[i]));
+    p.insert(p.end(), names[i], names[i] + strlen(names[i]));
+    put32(p, vals[i]);
+  }
+  bytes_t r = request(SP_CMD_SETTINGS, p);
+  TEST_ASSERT_EQUAL_size_t(12, r.size());
+  TEST_ASSERT_EQUAL_INT32(0, (int32_t)u32(&r[0]));
+  TEST_ASSERT_EQUAL_INT32(-1, (int32_t)u32(&r[4]));
+  TEST_ASSERT_EQUAL_INT32(0, (int32_t)u32(&r[8]));
+  int quality = on_device([] { return camera_setting_read(camera_setting_index("quality")); });
+  int hmirror = on_device([] { return camera_setting_read(camera_setting_index("hmirror")); });
+  TEST_ASSERT_EQUAL_INT(10, quality);
+  TEST_ASSERT_EQUAL_INT(1, hmirror);
+
+  p.pop_back();
+  request(SP_CMD_SETTINGS, p, SP_ERR_REQUEST);
+}
+
+void test_register_batch() {
+  bytes_t p;
+  auto op = [&](uint8_t set, uint16_t reg, uint32_t mask, uint32_t val) {
+    p.push_back(set);
+    p.push_back(reg);
+    p.push_back(reg >> 8);
+    put32(p, mask);
+    put32(p, val);
+  };
+  op(1, 0x3008, 0xFF, 0x42);
+  op(1, 0x3008, 0x0F, 0x05);
+  op(0, 0x3008, 0xFF, 0);
+  op(0, 0x3008, 0xF0, 0);
+  bytes_t r = request(SP_CMD_REGS, p);
+  TEST_ASSERT_EQUAL_size_t(16, r.size());
+  TEST_ASSERT_EQUAL_INT32(0, (int32_t)u32(&r[0]));
+  TEST_ASSERT_EQUAL_INT32(0, (int32_t)u32(&r[4]));
+  TEST_ASSERT_EQUAL_INT32(0x45, (int32_t)u32(&r[8]));
+  TEST_ASSERT_EQUAL_INT32(0x40, (int32_t)u32(&r[12]));
+  TEST_ASSERT_EQUAL_INT(0, on_device([] { return host_camera.sensor_held; }));
+
+  p.pop_back();
+  request(SP_CMD_REGS, p, SP_ERR_REQUEST);
+  on_device([] { host_camera.offline = true; });
+  request(SP_CMD_REGS, {}, SP_ERR_FAILED);
+  on_device([] { host_camera.offline = false; });
+}
+
+void test_status_dump() {
+  bytes_t r = request(SP_CMD_STATUS, {});
+  TEST_ASSERT_TRUE(r.size() >= 1);
+  size_t n = r[0], i = 1;
+  int quality = -1, uptime = -1;
+  for (size_t k = 0; k < n; k++) {
+    TEST_ASSERT_TRUE(i < r.size() && i + 1 + r[i] + 4 <= r.size());
+    std::string name((const char *)&r[i + 1], r[i]);
+    int32_t v = (int32_t)u32(&r[i + 1 + r[i]]);
+    if (name == "quality") {
+      quality = v;
+    } else if (name == "uptime_ms") {
+      uptime = v;
+    }
+    i += 1 + r[i] + 4;
+  }
+  TEST_ASSERT_EQUAL_size_t(r.size(), i);
+  TEST_ASSERT_EQUAL_INT(HOST_CAMERA_SETTINGS + 9, (int)n);
+  TEST_ASSERT_EQUAL_INT(10, quality);
+  TEST_ASSERT_EQUAL_INT((int)millis(), uptime);
+}
+
+void test_snapshot_download() {
+  std::mt19937 rng(3);
+  // the driver keeps pointing at the last shot
+  static bytes_t jpeg = random_bytes(rng, 20000);
+  TEST_ASSERT_TRUE(frame_pipe_begin(2));
+  host_camera_shoot(jpeg.data(), jpeg.size(), 1600, 1200);
+
+  bytes_t r = request(SP_CMD_SNAP, {});
+  TEST_ASSERT_EQUAL_size_t(16, r.size());
+  TEST_ASSERT_EQUAL_UINT32(frame_pipe_seq(), u32(&r[0]));
+  TEST_ASSERT_EQUAL_UINT32(jpeg.size(), u32(&r[4]));
+  TEST_ASSERT_EQUAL_UINT16(1600, r[8] | r[9] << 8);
+  TEST_ASSERT_EQUAL_UINT16(1200, r[10] | r[11] << 8);
+  TEST_ASSERT_EQUAL_HEX32(esp_rom_crc32_le(0, jpeg.data(), jpeg.size()), u32(&r[12]));
+
+  bytes_t got(jpeg.size());
+  size_t received = 0;
+  while (received < jpeg.size()) {
+    frame_in_t f;
+    TEST_ASSERT_TRUE_MESSAGE(host_recv(&f), "missing data frame");
+    TEST_ASSERT_EQUAL_HEX8(SP_DATA, f.type);
+    TEST_ASSERT_TRUE(f.payload.size() > 4 && f.payload.size() <= 4 + SERIAL_PROTO_CHUNK);
+    uint32_t off = u32(&f.payload[0]);
+    TEST_ASSERT_EQUAL_UINT32(received, off);
+    memcpy(&got[off], &f.payload[4], f.payload.size() - 4);
+    received += f.payload.size() - 4;
+  }
+  TEST_ASSERT_EQUAL_size_t(jpeg.size(), received);
+  TEST_ASSERT_TRUE(got == jpeg);
+  TEST_ASSERT_EQUAL_UINT32(0, on_device([] {
+    frame_pipe_stats_t st;
+    frame_pipe_get_stats(&st);
+    return st.consumers;
+  }));
+
+  // with nobody asking, the pipe hands its frame back once the sensor has
+  // gone quiet; the next snapshot waits for the sensor, in simulated time
+  advance_ms(HOST_CAMERA_FB_TIMEOUT_MS + 1000);
+  TEST_ASSERT_EQUAL_INT(0, host_camera.fbs_held);
+  request(SP_CMD_SNAP, {10, 0, 0, 0}, SP_ERR_TIMEOUT, 10);
+  _noise = false;
+}
+
+void test_baud_switch_needs_confirmation() {
+  bytes_t p;
+  put32(p, 100);
+  request(SP_CMD_BAUD, p, SP_ERR_REQUEST);
+
+  // not confirmed: back to the old rate
+  p.clear();
+  put32(p, 921600);
+  request(SP_CMD_BAUD, p);
+  wait_baud(921600);
+  advance_ms(SERIAL_PROTO_BAUD_CONFIRM_MS + 1);
+  wait_baud(115200);
+
+  // confirmed by the next valid frame
+  request(SP_CMD_BAUD, p);
+  wait_baud(921600);
+  bytes_t r = request(SP_CMD_PING, {});
+  TEST_ASSERT_EQUAL_UINT32(921600, u32(&r[1]));
+  advance_ms(SERIAL_PROTO_BAUD_CONFIRM_MS + 1);
+  wait_baud(921600);
+}
+
+void test_idle_ends_the_session() {
+  advance_ms(SERIAL_PROTO_IDLE_MS + 1);
+  wait_baud(115200);
+  take_text();
+  const char line[] = "help\n";
+  host_write((const uint8_t *)line, strlen(line));
+  usleep(50000);
+  TEST_ASSERT_EQUAL_STRING("help\n", take_text().c_str());
+}
+
+void test_bye_ends_the_session() {
+  request(SP_CMD_PING, {});
+  take_text();
+  request(SP_CMD_BYE, {});
+  const char line[] = "wifi\n";
+  host_write((const uint8_t *)line, strlen(line));
+  usleep(50000);
+  TEST_ASSERT_EQUAL_STRING("wifi\n", take_text().c_str());
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_roundtrip);
+  RUN_TEST(test_head_and_body_make_one_payload);
+  RUN_TEST(test_matches_the_host_tool);
+  RUN_TEST(test_corruption_is_rejected);
+  RUN_TEST(test_size_limits);
+  RUN_TEST(test_text_stays_with_the_shell);
+  RUN_TEST(test_ping_from_the_tool);
+  RUN_TEST(test_garbage_and_unknown_commands);
+  RUN_TEST(test_credentials);
+  RUN_TEST(test_settings_batch);
+  RUN_TEST(test_register_batch);
+  RUN_TEST(test_status_dump);
+  RUN_TEST(test_snapshot_download);
+  RUN_TEST(test_baud_switch_needs_confirmation);
+  RUN_TEST(test_idle_ends_the_session);
+  RUN_TEST(test_bye_ends_the_session);
+  int failures = UNITY_END();
+  _stop = true;
+  if (_device.joinable()) {
+    _device.join();
+  }
+  return failures;
+}
@@ -0,0 +1,354 @@
+#include <unity.h>
+#include <host_alloc.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "url_form.h"
+
+typedef std::vector<std::pair<std::string, std::string>> pairs_t;
+
+static int hex_digit(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+// Reference: the WHATWG application/x-www-form-urlencoded parser, written
+// the obvious way with copies
+static std::string ref_decode(const std::string &s) {
+  std::string out;
+  for (size_t i = 0; i < s.size(); i++) {
+    char c = s[i];
+    if (c == '+') {
+      c = ' ';
+    } else if (c == '%' && i + 2 < s.size() && hex_digit(s[i + 1]) >= 0 && hex_digit(s[i + 2]) >= 0) {
+      c = (char)(hex_digit(s[i + 1]) * 16 + hex_digit(s[i + 2]));
+      i += 2;
+    }
+    out += c;
+  }
+  return out;
+}
+
+static pairs_t ref_parse(const std::string &in) {
+  pairs_t out;
+  size_t pos = 0;
+  while (pos <= in.size()) {
+    size_t amp = in.find('&', pos);
+    if (amp == std::string::npos) {
+      amp = in.size();
+    }
+    std::string pair = in.substr(pos, amp - pos);
+    if (!pair.empty()) {
+      size_t eq = pair.find('=');
+      if (eq == std::string::npos) {
+        out.push_back({ref_decode(pair), ""});
+      } else {
+        out.push_back({ref_decode(pair.substr(0, eq)), ref_decode(pair.substr(eq + 1))});
+      }
+    }
+    pos = amp + 1;
+  }
+  return out;
+}
+
+// Parse in with url_form into a buffer with canaries behind it, checking
+// that every span is terminated and lies within the buffer
+static pairs_t parse(const std::string &in) {
+  static const char canary[8] = {'\x5a', '\x5a', '\x5a', '\x5a', '\x5a', '\x5a', '\x5a', '\x5a'};
+  std::vector<char> buf(in.size() + 1 + sizeof(canary));
+  memcpy(buf.data(), in.c_str(), in.size() + 1);
+  memcpy(buf.data() + in.size() + 1, canary, sizeof(canary));
+  const char *lo = buf.data(), *hi = buf.data() + in.size();
+
+  pairs_t out;
+  url_form_t form;
+  url_span_t key, val;
+  url_form_init(&form, buf.data());
+  while (url_form_next(&form, &key, &val)) {
+    TEST_ASSERT_TRUE(key.p >= lo && key.p + key.len <= hi);
+    TEST_ASSERT_TRUE(val.p >= lo && val.p + val.len <= hi);
+    TEST_ASSERT_EQUAL_CHAR(0, key.p[key.len]);
+    TEST_ASSERT_EQUAL_CHAR(0, val.p[val.len]);
+    out.push_back({std::string(key.p, key.len), std::string(val.p, val.len)});
+  }
+  TEST_ASSERT_FALSE(url_form_next(&form, &key, &val));
+  TEST_ASSERT_EQUAL_MEMORY(canary, buf.data() + in.size() + 1, sizeof(canary));
+  return out;
+}
+
+static void check(const char *in, const pairs_t &expect) {
+  pairs_t got = parse(in);
+  TEST_ASSERT_EQUAL_size_t_MESSAGE(expect.size(), got.size(), in);
+  for (size_t i = 0; i < expect.size(); i++) {
+    TEST_ASSERT_TRUE_MESSAGE(expect[i].first == got[i].first, in);
+    TEST_ASSERT_TRUE_MESSAGE(expect[i].second == got[i].second, in);
+  }
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_pairs_and_decoding() {
+  check("var=framesize&val=8", {{"var", "framesize"}, {"val", "8"}});
+  check("ssid=My+Home+Net%21&pass=p%40ss%20word", {{"ssid", "My Home Net!"}, {"pass", "p@ss word"}});
+  check("a%3Db=c%26d", {{"a=b", "c&d"}});  // encoded separators are data
+  check("x=%2541", {{"x", "%41"}});           // decoded once, not twice
+  check("x=%e2%82%AC", {{"x", "\xe2\x82\xac"}});
+}
+
+void test_edge_cases() {
+  check("", {});
+  check("&&", {});
+  check("&a=1&&b=2&", {{"a", "1"}, {"b", "2"}});
+  check("flag", {{"flag", ""}});
+  check("=v", {{"", "v"}});
+  check("k=", {{"k", ""}});
+  check("k=a=b", {{"k", "a=b"}});
+  check("p=%", {{"p", "%"}});
+  check("p=%4", {{"p", "%4"}});
+  check("p=%zz%4g", {{"p", "%zz%4g"}});
+  check("p=100%", {{"p", "100%"}});
+}
+
+void test_embedded_nul_keeps_its_length() {
+  char buf[] = "k=a%00b";
+  url_form_t form;
+  url_span_t key, val;
+  url_form_init(&form, buf);
+  TEST_ASSERT_TRUE(url_form_next(&form, &key, &val));
+  TEST_ASSERT_EQUAL_size_t(3, val.len);
+  TEST_ASSERT_EQUAL_MEMORY("a\0b", val.p, 3);
+  TEST_ASSERT_TRUE(url_span_eq(&key, "k"));
+  TEST_ASSERT_FALSE(url_span_eq(&val, "a"));
+}
+
+void test_fuzz_against_the_reference() {
+  // separators, escapes and bytes that must pass through untouched
+  static const char alphabet[] = "ab=&%+0F9fgz \x01\x7f\x80\xff";
+  std::mt19937 rng(45);
+  for (int it = 0; it < 200000; it++) {
+    std::string in;
+    int n = rng() % 48;
+    for (int i = 0; i < n; i++) {
+      in += alphabet[rng() % (sizeof(alphabet) - 1)];
+    }
+    pairs_t expect = ref_parse(in), got = parse(in);
+    if (expect != got) {
+      char msg[160];
+      snprintf(msg, sizeof(msg), "mismatch on \"%s\" (iteration %d)", in.c_str(), it);
+      TEST_FAIL_MESSAGE(msg);
+    }
+  }
+}
+
+void test_fuzz_decode_in_place() {
+  std::mt19937 rng(46);
+  for (int it = 0; it < 200000; it++) {
+    std::string in;
+    int n = rng() % 24;
+    for (int i = 0; i < n; i++) {
+      in += "%+4aF="[rng() % 6];
+    }
+    std::string expect = ref_decode(in);
+    std::vector<char> buf(in.begin(), in.end());
+    size_t len = url_decode(buf.data(), buf.size());
+    TEST_ASSERT_TRUE(len <= in.size());
+    TEST_ASSERT_TRUE(expect == std::string(buf.data(), len));
+  }
+}
+
+// The code url_form replaced, with std::string standing in for Arduino's
+// String: parse_get() copied the query into a malloc()ed buffer for
+// httpd_query_key_value(), and the portal decoded with String +=.
+static bool legacy_key_value(const char *qry, const char *key, char *val, size_t val_size) {
+  size_t klen = strlen(key);
+  for (const char *p = qry; *p;) {
+    const char *amp = strchr(p, '&');
+    const char *end = amp ? amp : p + strlen(p);
+    if (!strncmp(p, key, klen) && p[klen] == '=') {
+      size_t n = end - (p + klen + 1);
+      n = n < val_size - 1 ? n : val_size - 1;
+      memcpy(val, p + klen + 1, n);
+      val[n] = 0;
+      return true;
+    }
+    p = amp ? amp + 1 : end;
+  }
+  return false;
+}
+
+static std::string legacy_url_decode(const std::string &input) {
+  std::string ret = "";
+  for (size_t i = 0; i < input.length(); ++i) {
+    char c = input[i];
+    if (c == '+') {
+      ret += ' ';
+    } else if (c == '%' && i + 2 < input.length()) {
+      char hex[3] = {input[i + 1], input[i + 2], 0};
+      ret += (char)strtol(hex, NULL, 16);
+      i += 2;
+    } else {
+      ret += c;
+    }
+  }
+  return ret;
+}
+
+static const char *const CONTROL_QUERY = "var=framesize&val=8";
+static const char *const WIN_QUERY = "sx=0&sy=0&ex=1599&ey=1199&offx=0&offy=0&tx=2000&ty=1300&ox=800&oy=600&scale=1&binning=0";
+static const char *const PORTAL_BODY = "ssid=Camera+Network+%232&pass=s3cr3t%21+with+spaces";
+
+// httpd_req_get_url_query_str()'s copy, shared by both sides
+static void copy_query(char *dst, const char *src, size_t size) {
+  size_t n = strlen(src);
+  n = n < size - 1 ? n : size - 1;
+  memcpy(dst, src, n);
+  dst[n] = 0;
+}
+
+static long legacy_control(const char *query) {
+  size_t len = strlen(query) + 1;
+  char *buf = (char *)malloc(len);
+  copy_query(buf, query, len);
+  char var[32], val[32];
+  long r = legacy_key_value(buf, "var", var, sizeof(var)) && legacy_key_value(buf, "val", val, sizeof(val)) ? atoi(val) + var[0] : -1;
+  free(buf);
+  return r;
+}
+
+static long new_control(const char *query) {
+  char buf[URL_FORM_QUERY_MAX];
+  copy_query(buf, query, sizeof(buf));
+  url_form_t form;
+  url_span_t key, val;
+  const char *var = NULL;
+  long v = 0;
+  url_form_init(&form, buf);
+  while (url_form_next(&form, &key, &val)) {
+    if (url_span_eq(&key, "var")) {
+      var = val.p;
+    } else if (url_span_eq(&key, "val")) {
+      v = atoi(val.p);
+    }
+  }
+  return var ? v + var[0] : -1;
+}
+
+static long legacy_win(const char *query) {
+  static const char *const keys[] = {"sx", "sy", "ex", "ey", "offx", "offy", "tx", "ty", "ox", "oy", "scale", "binning"};
+  size_t len = strlen(query) + 1;
+  char *buf = (char *)malloc(len);
+  copy_query(buf, query, len);
+  char val[32];
+  long sum = 0;
+  for (size_t i = 0; i < sizeof(keys) / sizeof(keys[0]); i++) {
+    if (legacy_key_value(buf, keys[i], val, sizeof(val))) {
+      sum += atoi(val);
+    }
+  }
+  free(buf);
+  return sum;
+}
+
+static long new_win(const char *query) {
+  char buf[URL_FORM_QUERY_MAX];
+  copy_query(buf, query, sizeof(buf));
+  url_form_t form;
+  url_span_t key, val;
+  long sum = 0;
+  url_form_init(&form, buf);
+  while (url_form_next(&form, &key, &val)) {
+    sum += atoi(val.p);
+  }
+  return sum;
+}
+
+static long legacy_portal(const char *body_in) {
+  std::string body = body_in, ssid, pass;
+  size_t i = body.find("ssid=");
+  if (i != std::string::npos) {
+    size_t j = body.find('&', i);
+    ssid = legacy_url_decode(body.substr(i + 5, j == std::string::npos ? std::string::npos : j - i - 5));
+  }
+  i = body.find("pass=");
+  if (i != std::string::npos) {
+    size_t j = body.find('&', i);
+    pass = legacy_url_decode(body.substr(i + 5, j == std::string::npos ? std::string::npos : j - i - 5));
+  }
+  return ssid.size() + pass.size();
+}
+
+static long new_portal(const char *body_in) {
+  char body[URL_FORM_QUERY_MAX];
+  copy_query(body, body_in, sizeof(body));
+  url_form_t form;
+  url_span_t key, val;
+  long n = 0;
+  url_form_init(&form, body);
+  while (url_form_next(&form, &key, &val)) {
+    if (url_span_eq(&key, "ssid") || url_span_eq(&key, "pass")) {
+      n += val.len;
+    }
+  }
+  return n;
+}
+
+typedef struct {
+  double ns;
+  double allocs;
+} bench_t;
+
+static bench_t bench(long (*fn)(const char *), const char *input, long *result) {
+  const int n = 200000;
+  long sum = 0;
+  host_allocs_reset();
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < n; i++) {
+    sum += fn(input);
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  *result = sum / n;
+  return {std::chrono::duration<double, std::nano>(t1 - t0).count() / n, (double)host_allocs() / n};
+}
+
+static void compare(const char *name, long (*legacy)(const char *), long (*parser)(const char *), const char *input) {
+  long a, b;
+  bench_t old = bench(legacy, input, &a);
+  bench_t now = bench(parser, input, &b);
+  TEST_ASSERT_EQUAL_INT32(a, b);  // same answer
+  char msg[160];
+  if (HOST_ALLOCS_COUNTED) {
+    snprintf(msg, sizeof(msg), "%-8s before %6.1f ns, %.1f allocs | url_form %6.1f ns, %.1f allocs", name, old.ns, old.allocs, now.ns, now.allocs);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_EQUAL_INT(0, (int)now.allocs);
+    TEST_ASSERT_GREATER_THAN(0, (int)old.allocs);
+  } else {
+    snprintf(msg, sizeof(msg), "%-8s before %6.1f ns | url_form %6.1f ns (allocations not counted here)", name, old.ns, now.ns);
+    TEST_MESSAGE(msg);
+  }
+}
+
+void test_benchmark_against_the_replaced_code() {
+  compare("/control", legacy_control, new_control, CONTROL_QUERY);
+  compare("/win", legacy_win, new_win, WIN_QUERY);
+  compare("portal", legacy_portal, new_portal, PORTAL_BODY);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_pairs_and_decoding);
+  RUN_TEST(test_edge_cases);
+  RUN_TEST(test_embedded_nul_keeps_its_length);
+  RUN_TEST(test_fuzz_against_the_reference);
+  RUN_TEST(test_fuzz_decode_in_place);
+  RUN_TEST(test_benchmark_against_the_replaced_code);
+  return UNITY_END();
+}
@@ -0,0 +1,249 @@
+#include <unity.h>
+#include <WiFi.h>
+#include <Preferences.h>
+#include "freertos/task.h"
+#include "wifi_link.h"
+
+// Reasons from wifi_err_reason_t
+#define REASON_NO_AP_FOUND   201
+#define REASON_BEACON_TIMEOUT 200
+#define REASON_AUTH_EXPIRE   2
+
+static wifi_link_stats_t stats() {
+  wifi_link_stats_t st;
+  host_settle();
+  wifi_link_get_stats(&st);
+  return st;
+}
+
+// Start over with credentials for a network the link has never joined
+static void begin_fresh(const char *ssid) {
+  Preferences prefs;
+  prefs.begin("wifi", false);
+  prefs.clear();
+  prefs.end();
+  wifi_link_begin(ssid, "secret");
+  host_settle();
+}
+
+// Bring the link up (with a scan) and leave the AP lingering period behind
+static void connect_now(const char *ssid) {
+  begin_fresh(ssid);
+  host_wifi_event(ARDUINO_EVENT_WIFI_STA_GOT_IP);
+  host_time_advance_ms(WIFI_LINK_AP_LINGER_MS);
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_begin_does_not_wait_for_the_link() {
+  int64_t t0 = esp_timer_get_time();
+  wifi_link_begin("slow-net", "secret");
+  // no simulated time passed: setup() goes on to start the camera and servers
+  TEST_ASSERT_EQUAL_INT64(t0, esp_timer_get_time());
+  wifi_link_stats_t st = stats();
+  TEST_ASSERT_EQUAL_INT(WIFI_LINK_CONNECTING, st.state);
+  TEST_ASSERT_EQUAL_UINT32(1, host_wifi.begins);
+  TEST_ASSERT_FALSE(wifi_link_connected());
+}
+
+void test_slow_association_within_the_timeout() {
+  begin_fresh("slow-net");
+  uint32_t attempts = stats().attempts;
+  // the AP takes 8 s to answer; nothing gives up on it meanwhile
+  host_time_advance_ms(8000);
+  TEST_ASSERT_EQUAL_INT(WIFI_LINK_CONNECTING, stats().state);
+  host_wifi_event(ARDUINO_EVENT_WIFI_STA_GOT_IP);
+
+  wifi_link_stats_t st = stats();
+  TEST_ASSERT_EQUAL_INT(WIFI_LINK_CONNECTED, st.state);
+  TEST_ASSERT_TRUE(wifi_link_connected());
+  TEST_ASSERT_EQUAL_UINT32(8000, st.last_ms);
+  TEST_ASSERT_EQUAL_UINT32(8000, wifi_link_connect_ms());
+  TEST_ASSERT_EQUAL_UINT32(attempts, st.attempts);
+  TEST_ASSERT_EQUAL_UINT32(0, st.failures);
+  TEST_ASSERT_FALSE(st.last_fast);
+  TEST_ASSERT_FALSE(st.ap);
+  // the AP it joined is remembered for the next connect
+  TEST_ASSERT_TRUE(st.cached);
+  TEST_ASSERT_EQUAL_UINT8(host_wifi.ap_channel, st.channel);
+  TEST_ASSERT_EQUAL_MEMORY(host_wifi.ap_bssid, st.bssid, 6);
+}
+
+void test_association_slower_than_the_timeout_backs_off_then_opens_the_portal() {
+  begin_fresh("slow-net");
+  uint32_t begins = host_wifi.begins;
+  uint32_t ap_starts = host_wifi.ap_starts;
+
+  host_time_advance_ms(WIFI_LINK_CONNECT_TIMEOUT_MS);
+  wifi_link_stats_t st = stats();
+  TEST_ASSERT_EQUAL_INT(WIFI_LINK_BACKOFF, st.state);
+  TEST_ASSERT_EQUAL_UINT32(1, st.failures);
+  TEST_ASSERT_EQUAL_UINT32(WIFI_LINK_BACKOFF_MIN_MS, st.backoff_ms);
+  TEST_ASSERT_FALSE(host_wifi.ap);
+
+  // retried once the backoff is over, not before
+  host_time_advance_ms(WIFI_LINK_BACKOFF_MIN_MS - 1);
+  TEST_ASSERT_EQUAL_UINT32(begins, host_wifi.begins);
+  host_time_advance_ms(1);
+  TEST_ASSERT_EQUAL_UINT32(begins + 1, host_wifi.begins);
+  TEST_ASSERT_EQUAL_INT(WIFI_LINK_CONNECTING, stats().state);
+
+  // second failure: the portal comes up next to the station
+  host_time_advance_ms(WIFI_LINK_CONNECT_TIMEOUT_MS);
+  st = stats();
+  TEST_ASSERT_EQUAL_UINT32(2, st.failures);
+  TEST_ASSERT_EQUAL_UINT32(2 * WIFI_LINK_BACKOFF_MIN_MS, st.backoff_ms);
+  TEST_ASSERT_TRUE(host_wifi.ap);
+  TEST_ASSERT_TRUE(host_wifi.portal_scanning);
+  TEST_ASSERT_EQUAL_UINT32(ap_starts + 1, host_wifi.ap_starts);
+
+  // the station keeps trying and gets through in the end
+  host_time_advance_ms(2 * WIFI_LINK_BACKOFF_MIN_MS + 4000);
+  host_wifi_event(ARDUINO_EVENT_WIFI_STA_GOT_IP);
+  st = stats();
+  TEST_ASSERT_EQUAL_INT(WIFI_LINK_CONNECTED, st.state);
+  TEST_ASSERT_EQUAL_UINT32(0, st.failures);
+  TEST_ASSERT_EQUAL_UINT32(0, st.backoff_ms);
+  // from the first attempt: two timeouts, two backoffs and 4 s
+  TEST_ASSERT_EQUAL_UINT32(2 * WIFI_LINK_CONNECT_TIMEOUT_MS + 3 * WIFI_LINK_BACKOFF_MIN_MS + 4000, st.last_ms);
+
+  // the portal lingers so its client can read the new address, then goes
+  host_time_advance_ms(WIFI_LINK_AP_LINGER_MS - 1);
+  TEST_ASSERT_TRUE(host_wifi.ap);
+  host_time_advance_ms(1);
+  TEST_ASSERT_FALSE(host_wifi.ap);
+  TEST_ASSERT_FALSE(host_wifi.portal_scanning);
+}
+
+void test_backoff_doubles_up_to_the_cap() {
+  begin_fresh("gone-net");
+  uint32_t expect = WIFI_LINK_BACKOFF_MIN_MS;
+  for (int i = 1; i <= 10; i++) {
+    // the AP is not there at all: the driver reports it at once
+    host_wifi_event(ARDUINO_EVENT_WIFI_STA_DISCONNECTED, REASON_NO_AP_FOUND);
+    wifi_link_stats_t st = stats();
+    TEST_ASSERT_EQUAL_INT(WIFI_LINK_BACKOFF, st.state);
+    TEST_ASSERT_EQUAL_UINT32(i, st.failures);
+    TEST_ASSERT_EQUAL_UINT32(expect, st.backoff_ms);
+    TEST_ASSERT_EQUAL_UINT8(REASON_NO_AP_FOUND, st.reason);
+    host_time_advance_ms(st.backoff_ms);
+    TEST_ASSERT_EQUAL_INT(WIFI_LINK_CONNECTING, stats().state);
+    expect = expect * 2 < WIFI_LINK_BACKOFF_MAX_MS ? expect * 2 : WIFI_LINK_BACKOFF_MAX_MS;
+  }
+  TEST_ASSERT_EQUAL_UINT32(WIFI_LINK_BACKOFF_MAX_MS, stats().backoff_ms);
+  host_wifi_event(ARDUINO_EVENT_WIFI_STA_GOT_IP);
+  host_time_advance_ms(WIFI_LINK_AP_LINGER_MS);
+  TEST_ASSERT_FALSE(host_wifi.ap);
+}
+
+void test_cached_bssid_connects_directly_and_falls_back_to_a_scan() {
+  connect_now("home");
+  wifi_link_stats_t before = stats();
+
+  // reconnect: straight to the remembered AP and channel
+  wifi_link_begin("home", "secret");
+  host_settle();
+  TEST_ASSERT_TRUE(host_wifi.direct);
+  TEST_ASSERT_EQUAL_UINT8(host_wifi.ap_channel, host_wifi.channel);
+  host_time_advance_ms(300);
+  host_wifi_event(ARDUINO_EVENT_WIFI_STA_GOT_IP);
+  wifi_link_stats_t st = stats();
+  TEST_ASSERT_TRUE(st.last_fast);
+  TEST_ASSERT_EQUAL_UINT32(before.fast + 1, st.fast);
+  TEST_ASSERT_EQUAL_UINT32(300, st.last_ms);
+
+  // the AP moved: the direct attempt fails and a scan follows at once
+  wifi_link_begin("home", "secret");
+  host_settle();
+  TEST_ASSERT_TRUE(host_wifi.direct);
+  uint32_t begins = host_wifi.begins;
+  host_wifi_event(ARDUINO_EVENT_WIFI_STA_DISCONNECTED, REASON_NO_AP_FOUND);
+  TEST_ASSERT_EQUAL_UINT32(begins + 1, host_wifi.begins);
+  TEST_ASSERT_FALSE(host_wifi.direct);
+  st = stats();
+  TEST_ASSERT_EQUAL_INT(WIFI_LINK_CONNECTING, st.state);
+  TEST_ASSERT_EQUAL_UINT32(before.fallbacks + 1, st.fallbacks);
+  TEST_ASSERT_EQUAL_UINT32(0, st.failures);
+  host_wifi_event(ARDUINO_EVENT_WIFI_STA_GOT_IP);
+  st = stats();
+  TEST_ASSERT_FALSE(st.last_fast);
+  TEST_ASSERT_EQUAL_UINT32(before.full + 1, st.full);
+}
+
+void test_lost_link_is_timed_until_it_returns() {
+  connect_now("home");
+  uint32_t disconnects = stats().disconnects;
+  uint32_t down_total = stats().down_ms_total;
+
+  host_wifi_event(ARDUINO_EVENT_WIFI_STA_DISCONNECTED, REASON_BEACON_TIMEOUT);
+  wifi_link_stats_t st = stats();
+  TEST_ASSERT_EQUAL_INT(WIFI_LINK_CONNECTING, st.state);
+  TEST_ASSERT_EQUAL_UINT32(disconnects + 1, st.disconnects);
+  TEST_ASSERT_TRUE(host_wifi.direct);
+  TEST_ASSERT_FALSE(wifi_link_connected());
+
+  host_time_advance_ms(2500);
+  // the outage in progress already counts
+  TEST_ASSERT_EQUAL_UINT32(down_total + 2500, stats().down_ms_total);
+  host_wifi_event(ARDUINO_EVENT_WIFI_STA_GOT_IP);
+  st = stats();
+  TEST_ASSERT_EQUAL_INT(WIFI_LINK_CONNECTED, st.state);
+  TEST_ASSERT_EQUAL_UINT32(2500, st.last_down_ms);
+  TEST_ASSERT_EQUAL_UINT32(down_total + 2500, st.down_ms_total);
+}
+
+void test_own_disconnects_are_not_failures() {
+  connect_now("home");
+  // WIFI_REASON_ASSOC_LEAVE follows our own WiFi.disconnect()
+  host_wifi_event(ARDUINO_EVENT_WIFI_STA_DISCONNECTED, 8);
+  wifi_link_stats_t st = stats();
+  TEST_ASSERT_EQUAL_INT(WIFI_LINK_CONNECTED, st.state);
+  TEST_ASSERT_EQUAL_UINT32(0, st.failures);
+}
+
+void test_rssi_is_sampled_while_connected() {
+  host_wifi.rssi = -50;
+  connect_now("home");
+  host_wifi.rssi = -80;
+  host_time_advance_ms(WIFI_LINK_RSSI_PERIOD_MS);
+  wifi_link_stats_t st = stats();
+  TEST_ASSERT_EQUAL_INT(-80, st.rssi);
+  TEST_ASSERT_EQUAL_INT(-80, st.rssi_min);
+  // averaged over about 8 samples
+  TEST_ASSERT_INT_WITHIN(1, -54, st.rssi_avg);
+  host_wifi.rssi = -58;
+}
+
+void test_static_address_applies_on_the_next_connect() {
+  IPAddress ip(192, 168, 1, 50), gw(192, 168, 1, 1), mask(255, 255, 255, 0);
+  TEST_ASSERT_FALSE(wifi_link_set_static(ip, 0, mask, 0));
+  connect_now("home");
+  TEST_ASSERT_TRUE(wifi_link_set_static(ip, gw, mask, 0));
+  TEST_ASSERT_EQUAL_UINT32(0, host_wifi.static_ip);
+  wifi_link_begin("home", "secret");
+  host_settle();
+  TEST_ASSERT_EQUAL_UINT32((uint32_t)ip, host_wifi.static_ip);
+  TEST_ASSERT_TRUE(stats().static_ip);
+
+  TEST_ASSERT_TRUE(wifi_link_set_static(0, 0, 0, 0));
+  wifi_link_begin("home", "secret");
+  host_settle();
+  TEST_ASSERT_EQUAL_UINT32(0, host_wifi.static_ip);
+  host_wifi_event(ARDUINO_EVENT_WIFI_STA_GOT_IP);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_begin_does_not_wait_for_the_link);
+  RUN_TEST(test_slow_association_within_the_timeout);
+  RUN_TEST(test_association_slower_than_the_timeout_backs_off_then_opens_the_portal);
+  RUN_TEST(test_backoff_doubles_up_to_the_cap);
+  RUN_TEST(test_cached_bssid_connects_directly_and_falls_back_to_a_scan);
+  RUN_TEST(test_lost_link_is_timed_until_it_returns);
+  RUN_TEST(test_own_disconnects_are_not_failures);
+  RUN_TEST(test_rssi_is_sampled_while_connected);
+  RUN_TEST(test_static_address_applies_on_the_next_connect);
+  return UNITY_END();
+}
@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+"""Reference receiver for the /mcast UDP multicast stream.
+
+Joins the multicast group, reassembles JPEG frames from the fragments sent by
+src/mcast_sender.cpp and repairs single losses per FEC group from the XOR
+parity datagrams. Complete frames are written to --out (latest.jpg, or one
+file per frame with --keep) and statistics are printed once per second.
+
+  python tools/mcast_recv.py --group 239.255.0.1 --port 5004 --out frames
+  python tools/mcast_recv.py --loss 0.02      # drop 2% of datagrams to exercise FEC
+"""
+
+import argparse
+import os
+import random
+import socket
+import struct
+import time
+
+HDR = struct.Struct("<HBBIIHHHHIIQ")
+MAGIC = 0x4D43
+VERSION = 1
+PAYLOAD = 1400
+FLAG_PARITY = 0x01
+MAX_PENDING = 8
+
+
+class Frame:
+    def __init__(self, frame_len, count, fec):
+        self.frame_len = frame_len
+        self.count = count
+        self.fec = fec
+        self.data = bytearray(frame_len)
+        self.have = [False] * count
+        self.parity = {}
+        self.recovered = 0
+
+    def add(self, frag, offset, payload):
+        if frag < self.count and not self.have[frag]:
+            self.data[offset:offset + len(payload)] = payload
+            self.have[frag] = True
+
+    def repair(self):
+        for group, parity in list(self.parity.items()):
+            first = group * self.fec
+            members = range(first, min(first + self.fec, self.count))
+            missing = [i for i in members if not self.have[i]]
+            if len(missing) != 1:
+                continue
+            lost = missing[0]
+            buf = bytearray(parity)
+            for i in members:
+                if i == lost:
+                    continue
+                off = i * PAYLOAD
+                chunk = self.data[off:min(off + PAYLOAD, self.frame_len)]
+                for k in range(len(chunk)):
+                    buf[k] ^= chunk[k]
+            off = lost * PAYLOAD
+            n = min(PAYLOAD, self.frame_len - off)
+            self.add(lost, off, buf[:n])
+            self.recovered += 1
+            del self.parity[group]
+
+    def complete(self):
+        return all(self.have)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--group", default="239.255.0.1")
+    ap.add_argument("--port", type=int, default=5004)
+    ap.add_argument("--iface", default="0.0.0.0", help="local interface address to join on")
+    ap.add_argument("--out", default=None, help="directory for received frames")
+    ap.add_argument("--keep", action="store_true", help="write every frame instead of latest.jpg")
+    ap.add_argument("--loss", type=float, default=0.0, help="simulated datagram loss ratio")
+    args = ap.parse_args()
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM, socket.IPPROTO_UDP)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_RCVBUF, 1 << 20)
+    sock.bind(("", args.port))
+    mreq = socket.inet_aton(args.group) + socket.inet_aton(args.iface)
+    sock.setsockopt(socket.IPPROTO_IP, socket.IP_ADD_MEMBERSHIP, mreq)
+    sock.settimeout(1.0)
+    if args.out:
+        os.makedirs(args.out, exist_ok=True)
+
+    pending = {}
+    done = set()
+    stats = dict(datagrams=0, dropped=0, frames=0, recovered=0, lost=0)
+    last_seq = None
+    gaps = 0
+    t_report = time.monotonic()
+
+    while True:
+        try:
+            pkt = sock.recv(65536)
+        except socket.timeout:
+            pkt = None
+
+        if pkt and len(pkt) >= HDR.size:
+            if args.loss and random.random() < args.loss:
+                stats["dropped"] += 1
+                pkt = None
+
+        if pkt and len(pkt) >= HDR.size:
+            (magic, version, flags, frame_id, seq, frag, count, fec,
+             plen, offset, frame_len, ts) = HDR.unpack_from(pkt)
+            payload = pkt[HDR.size:HDR.size + plen]
+            if magic == MAGIC and version == VERSION and len(payload) == plen and frame_id not in done:
+                stats["datagrams"] += 1
+                if last_seq is not None and seq > last_seq + 1:
+                    gaps += seq - last_seq - 1
+                last_seq = seq
+
+                f = pending.get(frame_id)
+                if f is None:
+                    f = pending[frame_id] = Frame(frame_len, count, fec)
+                if flags & FLAG_PARITY:
+                    f.parity[frag] = payload
+                else:
+                    f.add(frag, offset, payload)
+                if fec:
+                    f.repair()
+
+                if f.complete():
+                    del pending[frame_id]
+                    done.add(frame_id)
+                    stats["frames"] += 1
+                    stats["recovered"] += f.recovered
+                    if args.out:
+                        name = "%08u.jpg" % frame_id if args.keep else "latest.jpg"
+                        with open(os.path.join(args.out, name), "wb") as fp:
+                            fp.write(f.data)
+
+                # frames overtaken by newer ones are not coming back
+                while len(pending) > MAX_PENDING:
+                    oldest = min(pending)
+                    del pending[oldest]
+                    done.add(oldest)
+                    stats["lost"] += 1
+                if len(done) > 4 * MAX_PENDING:
+                    done = set(sorted(done)[-MAX_PENDING:])
+
+        now = time.monotonic()
+        if now - t_report >= 1.0:
+            print("frames %(frames)d  recovered %(recovered)d  lost %(lost)d  datagrams %(datagrams)d  dropped %(dropped)d" % stats,
+                  " seq gaps %d" % gaps)
+            t_report = now
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+"""Pack web UI files into the asset bundle flashed to the `fr` partition.
+
+The layout matches src/asset_bundle.h:
+
+    header   <IHHII   magic "CWAB", version, count, total_len, reserved
+    entries  <48sIIII name, offset, length, etag (crc32), flags
+    data     each file aligned to 4 bytes
+
+Files ending in .gz are stored as-is with the gzip flag (and the .gz suffix
+dropped from the name); text files are gzipped unless --no-gzip is given.
+
+Examples:
+    python tools/mkassets.py data/ui -o .pio/assets.bin
+    python tools/mkassets.py --from-header src/camera_index.h -o .pio/assets.bin
+"""
+import argparse
+import gzip
+import os
+import re
+import struct
+import sys
+import zlib
+
+MAGIC = 0x42415743
+VERSION = 1
+NAME_MAX = 48
+FLAG_GZIP = 0x01
+HDR = struct.Struct("<IHHII")
+ENTRY = struct.Struct("<%dsIIII" % NAME_MAX)
+TEXT_EXT = (".html", ".htm", ".js", ".css", ".json", ".svg")
+DEFAULT_PARTITION_SIZE = 0x20000
+
+
+def from_dir(root, compress):
+    files = []
+    for dirpath, _, names in os.walk(root):
+        for n in sorted(names):
+            path = os.path.join(dirpath, n)
+            name = os.path.relpath(path, root).replace(os.sep, "/")
+            with open(path, "rb") as f:
+                data = f.read()
+            flags = 0
+            if name.endswith(".gz"):
+                name = name[:-3]
+                flags |= FLAG_GZIP
+            elif compress and name.endswith(TEXT_EXT):
+                data = gzip.compress(data, 9, mtime=0)
+                flags |= FLAG_GZIP
+            files.append((name, data, flags))
+    return files
+
+
+def from_header(path):
+    """Extract the gzip arrays from camera_index.h (index_<sensor>_html_gz)."""
+    src = open(path).read()
+    files = []
+    for m in re.finditer(r"const unsigned char (\w+)_html_gz\[\] = \{(.*?)\};", src, re.S):
+        data = bytes(int(b, 16) for b in re.findall(r"0x([0-9A-Fa-f]{2})", m.group(2)))
+        files.append((m.group(1) + ".html", data, FLAG_GZIP))
+    return files
+
+
+def pack(files):
+    index_len = HDR.size + ENTRY.size * len(files)
+    offset = (index_len + 3) & ~3
+    entries = b""
+    blob = b""
+    for name, data, flags in files:
+        encoded = name.encode()
+        if len(encoded) >= NAME_MAX:
+            sys.exit("asset name too long: %s" % name)
+        entries += ENTRY.pack(encoded, offset + len(blob), len(data), zlib.crc32(data) & 0xFFFFFFFF, flags)
+        blob += data + b"\0" * (-len(data) & 3)
+    pad = b"\0" * (offset - index_len)
+    total = offset + len(blob)
+    return HDR.pack(MAGIC, VERSION, len(files), total, 0) + entries + pad + blob
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("src", nargs="?", help="directory with UI files")
+    ap.add_argument("--from-header", help="extract the UI from camera_index.h instead")
+    ap.add_argument("-o", "--output", required=True)
+    ap.add_argument("--no-gzip", action="store_true", help="do not gzip text files")
+    ap.add_argument("--max-size", type=lambda v: int(v, 0), default=DEFAULT_PARTITION_SIZE, help="partition size (default 0x20000)")
+    args = ap.parse_args()
+
+    if args.from_header:
+        files = from_header(args.from_header)
+    elif args.src:
+        files = from_dir(args.src, not args.no_gzip)
+    else:
+        ap.error("give a source directory or --from-header")
+    if not files:
+        sys.exit("no assets found")
+
+    bundle = pack(files)
+    if len(bundle) > args.max_size:
+        sys.exit("bundle is %d bytes, partition holds %d" % (len(bundle), args.max_size))
+    os.makedirs(os.path.dirname(os.path.abspath(args.output)), exist_ok=True)
+    with open(args.output, "wb") as f:
+        f.write(bundle)
+    for name, data, flags in files:
+        print("  %-40s %7d%s" % (name, len(data), " gz" if flags & FLAG_GZIP else ""))
+    print("%s: %d files, %d bytes" % (args.output, len(files), len(bundle)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,44 @@
+# PlatformIO extra script: adds the `buildassets` and `uploadassets` targets.
+#
+#   pio run -t buildassets     -> .pio/build/<env>/assets.bin
+#   pio run -t uploadassets    -> writes the bundle to the `fr` partition
+#
+# The UI is taken from data/ui/ when present, otherwise it is extracted from
+# src/camera_index.h.
+import os
+
+Import("env")
+
+FR_OFFSET = "0x3d0000"
+FR_SIZE = "0x20000"
+
+project_dir = env.subst("$PROJECT_DIR")
+bundle = os.path.join(env.subst("$BUILD_DIR"), "assets.bin")
+ui_dir = os.path.join(project_dir, "data", "ui")
+mkassets = os.path.join(project_dir, "tools", "mkassets.py")
+
+if os.path.isdir(ui_dir):
+    source = '"%s"' % ui_dir
+else:
+    source = '--from-header "%s"' % os.path.join(project_dir, "src", "camera_index.h")
+
+build_cmd = '"$PYTHONEXE" "%s" %s --max-size %s -o "%s"' % (mkassets, source, FR_SIZE, bundle)
+
+env.AddCustomTarget(
+    name="buildassets",
+    dependencies=None,
+    actions=[build_cmd],
+    title="Build asset bundle",
+    description="Pack the web UI into the fr partition image",
+)
+
+env.AddCustomTarget(
+    name="uploadassets",
+    dependencies=None,
+    actions=[
+        build_cmd,
+        '"$PYTHONEXE" "$UPLOADER" --chip $BOARD_MCU --port "$UPLOAD_PORT" --baud $UPLOAD_SPEED write_flash %s "%s"' % (FR_OFFSET, bundle),
+    ],
+    title="Upload asset bundle",
+    description="Write the web UI bundle to the fr partition",
+)
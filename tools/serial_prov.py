@@ -0,0 +1,343 @@
+#!/usr/bin/env python3
+"""Host side of the binary serial protocol (src/serial_proto.h).
+
+Provisions and tunes a camera over its USB serial console without Wi-Fi:
+credentials, camera settings and sensor registers are sent in batched frames,
+and a snapshot can be downloaded at a raised baud rate.
+
+  python tools/serial_prov.py -p /dev/ttyUSB0 ping
+  python tools/serial_prov.py -p /dev/ttyUSB0 creds MyNet secret --connect
+  python tools/serial_prov.py -p /dev/ttyUSB0 set framesize=8 quality=10 hmirror=1
+  python tools/serial_prov.py -p /dev/ttyUSB0 reg 0x3008:0xff 0x503d:0xff=0x80
+  python tools/serial_prov.py -p /dev/ttyUSB0 status
+  python tools/serial_prov.py -p /dev/ttyUSB0 --fast 2000000 snap frame.jpg
+  python tools/serial_prov.py -p /dev/ttyUSB0 script factory.txt
+
+A script holds one command per line (same syntax as above, '#' comments) and
+runs in a single session, e.g. for factory provisioning of many units.
+Requires pyserial.
+"""
+
+import argparse
+import shlex
+import struct
+import sys
+import time
+import zlib
+
+import serial
+
+CMD_PING = 0x01
+CMD_CREDS = 0x02
+CMD_SETTINGS = 0x03
+CMD_REGS = 0x04
+CMD_STATUS = 0x05
+CMD_SNAP = 0x06
+CMD_BAUD = 0x07
+CMD_BYE = 0x0F
+DATA = 0x40
+REPLY = 0x80
+
+STATUS_TEXT = {1: "malformed request", 2: "unknown command", 3: "failed", 4: "timeout"}
+CREDS_CONNECT = 0x01
+
+
+def cobs_encode(data):
+    out = bytearray([0])
+    code_at, code = 1, 1
+    out.append(0)
+    for b in data:
+        if b:
+            out.append(b)
+            code += 1
+        if not b or code == 0xFF:
+            out[code_at] = code
+            code_at, code = len(out), 1
+            out.append(0)
+    out[code_at] = code
+    out.append(0)
+    return bytes(out)
+
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        i += 1
+        if code == 0 or i + code - 1 > len(data):
+            return None
+        out += data[i:i + code - 1]
+        i += code - 1
+        if code < 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def encode_frame(ftype, seq, payload=b""):
+    raw = bytes([ftype, seq]) + payload
+    return cobs_encode(raw + struct.pack("<I", zlib.crc32(raw)))
+
+
+def decode_frame(chunk):
+    raw = cobs_decode(chunk)
+    if raw is None or len(raw) < 6:
+        return None
+    body, crc = raw[:-4], struct.unpack("<I", raw[-4:])[0]
+    if zlib.crc32(body) != crc:
+        return None
+    return body[0], body[1], body[2:]
+
+
+class ProtoError(Exception):
+    pass
+
+
+class Link:
+    def __init__(self, ser, timeout):
+        self.ser = ser
+        self.timeout = timeout
+        self.seq = 0
+        self.rx = bytearray()
+        self.bad = 0
+        # a zero byte switches the console to binary mode
+        self.ser.write(b"\x00")
+
+    @classmethod
+    def open(cls, port, baud, timeout):
+        ser = serial.Serial(port, baud, timeout=0.05)
+        ser.reset_input_buffer()
+        return cls(ser, timeout)
+
+    def frames(self, deadline):
+        while time.monotonic() < deadline:
+            data = self.ser.read(self.ser.in_waiting or 1)
+            if not data:
+                continue
+            self.rx += data
+            while True:
+                end = self.rx.find(0)
+                if end < 0:
+                    break
+                chunk, self.rx = bytes(self.rx[:end]), self.rx[end + 1:]
+                if not chunk:
+                    continue
+                frame = decode_frame(chunk)
+                if frame is None:
+                    self.bad += 1  # log text or a damaged frame
+                    continue
+                yield frame
+
+    def send(self, cmd, payload=b""):
+        self.seq = (self.seq + 1) & 0xFF
+        self.ser.write(encode_frame(cmd, self.seq, payload))
+        return self.seq
+
+    def call(self, cmd, payload=b"", timeout=None):
+        seq = self.send(cmd, payload)
+        for ftype, fseq, data in self.frames(time.monotonic() + (timeout or self.timeout)):
+            if ftype == cmd | REPLY and fseq == seq:
+                if data[0]:
+                    raise ProtoError("%s: %s" % (hex(cmd), STATUS_TEXT.get(data[0], data[0])))
+                return data[1:]
+        raise ProtoError("%s: no reply" % hex(cmd))
+
+    def ping(self):
+        data = self.call(CMD_PING)
+        version, baud, max_payload = struct.unpack("<BIH", data[:7])
+        return version, baud, max_payload
+
+    def set_baud(self, baud):
+        self.call(CMD_BAUD, struct.pack("<I", baud))
+        self.ser.flush()
+        self.ser.baudrate = baud
+        self.confirm_baud(baud)
+
+    def confirm_baud(self, baud):
+        self.rx.clear()
+        # the device falls back unless a frame arrives at the new rate in time
+        for _ in range(3):
+            try:
+                if self.ping()[1] == baud:
+                    return
+            except ProtoError:
+                pass
+        raise ProtoError("baud %d not confirmed" % baud)
+
+    def close(self):
+        try:
+            self.call(CMD_BYE, timeout=0.5)
+        except ProtoError:
+            pass
+        self.ser.close()
+
+
+def parse_int(s):
+    return int(s, 0)
+
+
+def do_ping(link, args):
+    version, baud, max_payload = link.ping()
+    print("protocol %d, %d baud, max payload %d" % (version, baud, max_payload))
+
+
+def do_creds(link, args):
+    ssid, pw = args.ssid.encode(), args.password.encode()
+    if not 0 < len(ssid) <= 32 or len(pw) > 64:
+        raise ProtoError("SSID must be 1-32 bytes and password up to 64")
+    flags = CREDS_CONNECT if args.connect else 0
+    link.call(CMD_CREDS, bytes([len(ssid)]) + ssid + bytes([len(pw)]) + pw + bytes([flags]))
+    print("credentials saved" + (", connecting" if args.connect else ""))
+
+
+def do_set(link, args):
+    payload = b""
+    names = []
+    for item in args.settings:
+        name, _, value = item.partition("=")
+        if not value:
+            raise ProtoError("expected name=value, got %r" % item)
+        payload += bytes([len(name)]) + name.encode() + struct.pack("<i", parse_int(value))
+        names.append(name)
+    data = link.call(CMD_SETTINGS, payload)
+    results = struct.unpack("<%di" % len(names), data)
+    failed = 0
+    for name, res in zip(names, results):
+        print("%-16s %s" % (name, "ok" if res >= 0 else "failed (%d)" % res))
+        failed += res < 0
+    return 1 if failed else 0
+
+
+def do_reg(link, args):
+    # REG[:MASK][=VALUE], a value makes it a write
+    payload = b""
+    for item in args.regs:
+        spec, eq, value = item.partition("=")
+        reg, _, mask = spec.partition(":")
+        payload += struct.pack("<BHII", 1 if eq else 0, parse_int(reg), parse_int(mask or "0xff"), parse_int(value or "0"))
+    data = link.call(CMD_REGS, payload)
+    for item, res in zip(args.regs, struct.unpack("<%di" % len(args.regs), data)):
+        print("%-20s %s" % (item, ("0x%x" % res) if res >= 0 else "failed (%d)" % res))
+
+
+def do_status(link, args):
+    data = link.call(CMD_STATUS)
+    n, pos = data[0], 1
+    for _ in range(n):
+        nl = data[pos]
+        name = data[pos + 1:pos + 1 + nl].decode()
+        value = struct.unpack("<i", data[pos + 1 + nl:pos + 5 + nl])[0]
+        pos += 5 + nl
+        if name == "wifi.ip":
+            value = ".".join(str(b) for b in struct.pack("<I", value & 0xFFFFFFFF))
+        print("%-20s %s" % (name, value))
+
+
+def snap(link, timeout_ms=2000):
+    seq = link.send(CMD_SNAP, struct.pack("<I", timeout_ms))
+    start = time.monotonic()
+    info = None
+    got = 0
+    deadline = start + link.timeout + timeout_ms / 1000.0
+    for ftype, fseq, data in link.frames(deadline):
+        if fseq != seq:
+            continue
+        if ftype == CMD_SNAP | REPLY:
+            if data[0]:
+                raise ProtoError("snap: %s" % STATUS_TEXT.get(data[0], data[0]))
+            info = struct.unpack("<IIHHI", data[1:17])
+            jpeg = bytearray(info[1])
+        elif ftype == DATA and info:
+            off = struct.unpack("<I", data[:4])[0]
+            jpeg[off:off + len(data) - 4] = data[4:]
+            got += len(data) - 4
+            deadline = time.monotonic() + link.timeout
+            if got >= info[1]:
+                break
+    if not info or got < info[1]:
+        raise ProtoError("snap: incomplete (%d of %d bytes)" % (got, info[1] if info else 0))
+    if zlib.crc32(jpeg) != info[4]:
+        raise ProtoError("snap: CRC mismatch")
+    elapsed = time.monotonic() - start
+    return bytes(jpeg), info, elapsed
+
+
+def do_snap(link, args):
+    for attempt in range(args.retries + 1):
+        try:
+            jpeg, info, elapsed = snap(link)
+            break
+        except ProtoError as e:
+            if attempt == args.retries:
+                raise
+            print("%s, retrying" % e, file=sys.stderr)
+    with open(args.out, "wb") as f:
+        f.write(jpeg)
+    print("frame %d: %dx%d, %d bytes in %.2f s (%.0f kB/s) -> %s" % (info[0], info[2], info[3], info[1], elapsed, info[1] / elapsed / 1024, args.out))
+
+
+def do_script(link, args):
+    rc = 0
+    with open(args.file) as f:
+        for line in f:
+            line = line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            print("> " + line)
+            sub = build_parser().parse_args(shlex.split(line))
+            rc |= sub.func(link, sub) or 0
+    return rc
+
+
+def build_parser():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    sp = ap.add_subparsers(dest="cmd", required=True)
+    p = sp.add_parser("ping")
+    p.set_defaults(func=do_ping)
+    p = sp.add_parser("creds", help="save Wi-Fi credentials")
+    p.add_argument("ssid")
+    p.add_argument("password")
+    p.add_argument("--connect", action="store_true", help="connect right away")
+    p.set_defaults(func=do_creds)
+    p = sp.add_parser("set", help="camera settings, name=value ...")
+    p.add_argument("settings", nargs="+")
+    p.set_defaults(func=do_set)
+    p = sp.add_parser("reg", help="sensor registers, REG[:MASK][=VALUE] ...")
+    p.add_argument("regs", nargs="+")
+    p.set_defaults(func=do_reg)
+    p = sp.add_parser("status")
+    p.set_defaults(func=do_status)
+    p = sp.add_parser("snap", help="download a JPEG frame")
+    p.add_argument("out")
+    p.add_argument("--retries", type=int, default=2)
+    p.set_defaults(func=do_snap)
+    p = sp.add_parser("script", help="run commands from a file")
+    p.add_argument("file")
+    p.set_defaults(func=do_script)
+    return ap
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter, add_help=False)
+    ap.add_argument("-p", "--port", required=True)
+    ap.add_argument("-b", "--baud", type=int, default=115200, help="console baud rate (monitor_speed)")
+    ap.add_argument("--fast", type=int, default=0, help="switch to this baud rate for the session")
+    ap.add_argument("--timeout", type=float, default=2.0)
+    opts, rest = ap.parse_known_args()
+    args = build_parser().parse_args(rest)
+
+    link = Link.open(opts.port, opts.baud, opts.timeout)
+    try:
+        if opts.fast:
+            link.set_baud(opts.fast)
+        return args.func(link, args) or 0
+    except ProtoError as e:
+        print("error: %s" % e, file=sys.stderr)
+        return 1
+    finally:
+        # back to the text shell at the console rate
+        link.close()
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+"""Download a JPEG frame over the serial console, for cameras without network.
+
+Types `snap <baud>` into the text shell, waits for the `SNAP <baud>` answer,
+switches the port to that rate and pulls the newest frame with the binary
+protocol (see tools/serial_prov.py): CRC-checked 1 KB chunks sent straight
+from the frame buffer, checked again as a whole. The console returns to the
+normal rate when done, so a serial monitor can stay configured as usual.
+
+  python tools/serial_snap.py -p /dev/ttyUSB0 frame.jpg
+  python tools/serial_snap.py -p /dev/ttyUSB0 --baud 3000000 --count 5 shot.jpg
+
+The USB-UART bridge has to support the chosen rate (CP2102N: up to 3 Mbaud).
+"""
+
+import argparse
+import os
+import sys
+import time
+
+import serial
+
+from serial_prov import Link, ProtoError, snap
+
+
+def negotiate(ser, baud, timeout):
+    ser.reset_input_buffer()
+    ser.write(b"\nsnap %d\n" % baud)
+    expect = b"SNAP %d" % baud
+    deadline = time.monotonic() + timeout
+    line = b""
+    while time.monotonic() < deadline:
+        c = ser.read(1)
+        if not c:
+            continue
+        if c != b"\n":
+            line += c
+            continue
+        if line.strip() == expect:
+            return
+        if line.strip().startswith(b"Usage: snap"):
+            raise ProtoError("baud %d refused by the device" % baud)
+        line = b""
+    raise ProtoError("no answer to snap (is the text shell running at %d?)" % ser.baudrate)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("-p", "--port", required=True)
+    ap.add_argument("--console", type=int, default=115200, help="console baud rate (monitor_speed)")
+    ap.add_argument("--baud", type=int, default=2000000, help="transfer baud rate")
+    ap.add_argument("--count", type=int, default=1, help="frames to fetch; name_N.jpg when more than one")
+    ap.add_argument("--timeout", type=float, default=3.0)
+    ap.add_argument("out")
+    args = ap.parse_args()
+
+    ser = serial.Serial(args.port, args.console, timeout=0.05)
+    link = None
+    try:
+        negotiate(ser, args.baud, args.timeout)
+        ser.baudrate = args.baud
+        link = Link(ser, args.timeout)
+        link.confirm_baud(args.baud)
+        base, ext = os.path.splitext(args.out)
+        for i in range(args.count):
+            jpeg, info, elapsed = snap(link)
+            name = args.out if args.count == 1 else "%s_%d%s" % (base, i, ext or ".jpg")
+            with open(name, "wb") as f:
+                f.write(jpeg)
+            print("frame %d: %dx%d, %d bytes in %.2f s (%.0f kB/s) -> %s" % (info[0], info[2], info[3], info[1], elapsed, info[1] / elapsed / 1024, name))
+        return 0
+    except ProtoError as e:
+        print("error: %s" % e, file=sys.stderr)
+        return 1
+    finally:
+        if link:
+            # back to the text shell at the console rate
+            link.close()
+        else:
+            ser.close()
+
+
+if __name__ == "__main__":
+    sys.exit(main())